@@ -25,6 +25,7 @@
 #include "Schema/ServerRPCEndpoint.h"
 #include "SpatialConstants.h"
 #include "SpatialGDKSettings.h"
+#include "Utils/HandoverShadowData.h"
 #include "Utils/RepLayoutUtils.h"
 #include "Utils/SpatialActorUtils.h"
 
@@ -105,6 +106,7 @@ void USpatialActorChannel::Init(UNetConnection* InConnection, int32 ChannelIndex
 	EntityId = SpatialConstants::INVALID_ENTITY_ID;
 	bInterestDirty = false;
 	bNetOwned = false;
+	FastArrayBaselines.Empty();
 	LastPositionSinceUpdate = FVector::ZeroVector;
 	TimeWhenPositionLastUpdated = 0.0f;
 
@@ -115,6 +117,8 @@ void USpatialActorChannel::Init(UNetConnection* InConnection, int32 ChannelIndex
 
 	ActorHandoverShadowData = nullptr;
 	HandoverShadowDataMap.Empty();
+	bHandoverCaptureRequested = false;
+	TimeWhenHandoverLastCaptured = 0.0f;
 
 	NetDriver = Cast<USpatialNetDriver>(Connection->Driver);
 	check(NetDriver);
@@ -251,6 +255,30 @@ void USpatialActorChannel::UpdateShadowData()
 		ComponentReplicator.RepLayout->InitRepStateStaticBuffer(ComponentReplicator.ChangelistMgr->GetRepChangelistState()->StaticBuffer, reinterpret_cast<const uint8*>(ActorComponent));
 #endif
 	}
+
+	SeedFastArrayBaselines();
+}
+
+SpatialGDK::FSpatialFastArrayBaselines* USpatialActorChannel::GetFastArrayBaselines()
+{
+	return GetDefault<USpatialGDKSettings>()->bUseFastArrayDeltaReplication ? &FastArrayBaselines : nullptr;
+}
+
+void USpatialActorChannel::SeedFastArrayBaselines()
+{
+	if (!GetDefault<USpatialGDKSettings>()->bUseFastArrayDeltaReplication)
+	{
+		return;
+	}
+
+	FastArrayBaselines.Empty();
+	for (auto& RepComp : ReplicationMap)
+	{
+		if (UObject* Object = RepComp.Value->GetWeakObjectPtr().Get())
+		{
+			FastArrayBaselines.Seed(NetDriver, Object, *RepComp.Value->RepLayout);
+		}
+	}
 }
 
 void USpatialActorChannel::UpdateSpatialPositionWithFrequencyCheck()
@@ -271,12 +299,25 @@ FRepChangeState USpatialActorChannel::CreateInitialRepChangeState(TWeakObjectPtr
 
 	TArray<uint16> InitialRepChanged;
 
+	// Receivers restore properties left out of initial data from the same baseline.
+	const uint8* Baseline = nullptr;
+	if (GetDefault<USpatialGDKSettings>()->bOmitDefaultPropertiesFromInitialData)
+	{
+		Baseline = (const uint8*)SpatialGDK::GetInitialDataBaseline(Object.Get());
+	}
+	const uint8* Data = (const uint8*)Object.Get();
+
 	int32 DynamicArrayDepth = 0;
 	const int32 CmdCount = Replicator.RepLayout->Cmds.Num();
 	for (uint16 CmdIdx = 0; CmdIdx < CmdCount; ++CmdIdx)
 	{
 		const auto& Cmd = Replicator.RepLayout->Cmds[CmdIdx];
 
+		if (Baseline != nullptr && DynamicArrayDepth == 0 && SpatialGDK::IsPropertyOmittedFromInitialData(*Replicator.RepLayout, Cmd, Data, Baseline))
+		{
+			continue;
+		}
+
 		InitialRepChanged.Add(Cmd.RelativeHandle);
 
 		if (Cmd.Type == ERepLayoutCmdType::DynamicArray)
@@ -440,7 +481,8 @@ int64 USpatialActorChannel::ReplicateActor()
 
 	FHandoverChangeState HandoverChangeState;
 
-	if (ActorHandoverShadowData != nullptr)
+	const bool bCaptureHandover = ShouldCaptureHandover();
+	if (ActorHandoverShadowData != nullptr && bCaptureHandover)
 	{
 		HandoverChangeState = GetHandoverChangeList(*ActorHandoverShadowData, Actor);
 	}
@@ -513,24 +555,27 @@ int64 USpatialActorChannel::ReplicateActor()
 		// the same SpatialActorChannel::ReplicateSubobject.
 		bWroteSomethingImportant |= Actor->ReplicateSubobjects(this, &DummyOutBunch, &RepFlags);
 
-		for (auto& SubobjectInfoPair : GetHandoverSubobjects())
+		if (bCaptureHandover)
 		{
-			UObject* Subobject = SubobjectInfoPair.Key;
-			const FClassInfo& SubobjectInfo = *SubobjectInfoPair.Value;
-
-			// Handover shadow data should already exist for this object. If it doesn't, it must have
-			// started replicating after SetChannelActor was called on the owning actor.
-			TSharedRef<TArray<uint8>>* SubobjectHandoverShadowData = HandoverShadowDataMap.Find(Subobject);
-			if (SubobjectHandoverShadowData == nullptr)
+			for (auto& SubobjectInfoPair : GetHandoverSubobjects())
 			{
-				UE_LOG(LogSpatialActorChannel, Warning, TEXT("EntityId: %lld Actor: %s HandoverShadowData not found for Subobject %s"), EntityId, *Actor->GetName(), *Subobject->GetName());
-				continue;
-			}
+				UObject* Subobject = SubobjectInfoPair.Key;
+				const FClassInfo& SubobjectInfo = *SubobjectInfoPair.Value;
 
-			FHandoverChangeState SubobjectHandoverChangeState = GetHandoverChangeList(SubobjectHandoverShadowData->Get(), Subobject);
-			if (SubobjectHandoverChangeState.Num() > 0)
-			{
-				Sender->SendComponentUpdates(Subobject, SubobjectInfo, this, nullptr, &SubobjectHandoverChangeState);
+				// Handover shadow data should already exist for this object. If it doesn't, it must have
+				// started replicating after SetChannelActor was called on the owning actor.
+				TSharedRef<TArray<uint8>>* SubobjectHandoverShadowData = HandoverShadowDataMap.Find(Subobject);
+				if (SubobjectHandoverShadowData == nullptr)
+				{
+					UE_LOG(LogSpatialActorChannel, Warning, TEXT("EntityId: %lld Actor: %s HandoverShadowData not found for Subobject %s"), EntityId, *Actor->GetName(), *Subobject->GetName());
+					continue;
+				}
+
+				FHandoverChangeState SubobjectHandoverChangeState = GetHandoverChangeList(SubobjectHandoverShadowData->Get(), Subobject);
+				if (SubobjectHandoverChangeState.Num() > 0)
+				{
+					Sender->SendComponentUpdates(Subobject, SubobjectInfo, this, nullptr, &SubobjectHandoverChangeState);
+				}
 			}
 		}
 
@@ -554,6 +599,12 @@ int64 USpatialActorChannel::ReplicateActor()
 	// If we evaluated everything, mark LastUpdateTime, even if nothing changed.
 	LastUpdateTime = Connection->Driver->Time;
 
+	if (bCaptureHandover)
+	{
+		bHandoverCaptureRequested = false;
+		TimeWhenHandoverLastCaptured = NetDriver->Time;
+	}
+
 	MemMark.Pop();
 
 	bIsReplicatingActor = false;
@@ -785,62 +836,36 @@ TMap<UObject*, const FClassInfo*> USpatialActorChannel::GetHandoverSubobjects()
 void USpatialActorChannel::InitializeHandoverShadowData(TArray<uint8>& ShadowData, UObject* Object)
 {
 	const FClassInfo& ClassInfo = NetDriver->ClassInfoManager->GetOrCreateClassInfoByClass(Object->GetClass());
-
-	uint32 Size = 0;
-	for (const FHandoverPropertyInfo& PropertyInfo : ClassInfo.HandoverProperties)
-	{
-		if (PropertyInfo.ArrayIdx == 0) // For static arrays, the first element will handle the whole array
-		{
-			// Make sure we conform to Unreal's alignment requirements; this is matched below and in ReplicateActor()
-			Size = Align(Size, PropertyInfo.Property->GetMinAlignment());
-			Size += PropertyInfo.Property->GetSize();
-		}
-	}
-	ShadowData.AddZeroed(Size);
-	uint32 Offset = 0;
-	for (const FHandoverPropertyInfo& PropertyInfo : ClassInfo.HandoverProperties)
-	{
-		if (PropertyInfo.ArrayIdx == 0)
-		{
-			Offset = Align(Offset, PropertyInfo.Property->GetMinAlignment());
-			PropertyInfo.Property->InitializeValue(ShadowData.GetData() + Offset);
-			Offset += PropertyInfo.Property->GetSize();
-		}
-	}
+	SpatialGDK::InitializeHandoverShadowData(ClassInfo.HandoverProperties, ShadowData);
 }
 
 FHandoverChangeState USpatialActorChannel::GetHandoverChangeList(TArray<uint8>& ShadowData, UObject* Object)
 {
-	FHandoverChangeState HandoverChanged;
-
 	const FClassInfo& ClassInfo = NetDriver->ClassInfoManager->GetOrCreateClassInfoByClass(Object->GetClass());
+	return SpatialGDK::GetHandoverChangeList(ClassInfo.HandoverProperties, ShadowData, (const uint8*)Object, bCreatingNewEntity);
+}
 
-	uint32 ShadowDataOffset = 0;
-	for (const FHandoverPropertyInfo& PropertyInfo : ClassInfo.HandoverProperties)
+bool USpatialActorChannel::ShouldCaptureHandover() const
+{
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	if (!SpatialGDKSettings->bOnDemandHandover || bCreatingNewEntity || bHandoverCaptureRequested)
 	{
-		ShadowDataOffset = Align(ShadowDataOffset, PropertyInfo.Property->GetMinAlignment());
-
-		const uint8* Data = (uint8*)Object + PropertyInfo.Offset;
-		uint8* StoredData = ShadowData.GetData() + ShadowDataOffset;
-		// Compare and assign.
-		if (bCreatingNewEntity || !PropertyInfo.Property->Identical(StoredData, Data))
-		{
-			HandoverChanged.Add(PropertyInfo.Handle);
-			PropertyInfo.Property->CopySingleValue(StoredData, Data);
-		}
-		ShadowDataOffset += PropertyInfo.Property->ElementSize;
+		return true;
 	}
 
-	return HandoverChanged;
+	return SpatialGDKSettings->HandoverCaptureIntervalSeconds > 0.f
+		&& NetDriver->Time - TimeWhenHandoverLastCaptured >= SpatialGDKSettings->HandoverCaptureIntervalSeconds;
 }
 
 #if ENGINE_MINOR_VERSION <= 22
 void USpatialActorChannel::SetChannelActor(AActor* InActor)
 {
+	const double StartTime = FPlatformTime::Seconds();
 	Super::SetChannelActor(InActor);
 #else
 void USpatialActorChannel::SetChannelActor(AActor* InActor, ESetChannelActorFlags Flags)
 {
+	const double StartTime = FPlatformTime::Seconds();
 	Super::SetChannelActor(InActor, Flags);
 #endif
 	USpatialPackageMapClient* PackageMap = NetDriver->PackageMap;
@@ -862,6 +887,9 @@ void USpatialActorChannel::SetChannelActor(AActor* InActor, ESetChannelActorFlag
 			PackageMap->RemovePendingCreationEntityId(EntityId);
 		}
 		NetDriver->AddActorChannel(EntityId, this);
+
+		// Super::SetChannelActor has just rebuilt the replicators if this actor was woken from cold storage.
+		NetDriver->GetDormantColdStorage().TrackWake(EntityId, FPlatformTime::Seconds() - StartTime);
 		NetDriver->UnregisterDormantEntityId(EntityId);
 	}
 
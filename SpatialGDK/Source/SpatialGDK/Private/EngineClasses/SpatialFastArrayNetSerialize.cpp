@@ -4,10 +4,86 @@
 
 #include "EngineClasses/SpatialNetBitReader.h"
 #include "EngineClasses/SpatialNetBitWriter.h"
+#include "EngineClasses/SpatialNetDriver.h"
+#include "SpatialConstants.h"
+#include "SpatialGDKSettings.h"
+#include "Utils/SchemaUtils.h"
+
+#include "Engine/NetSerialization.h"
 
 namespace SpatialGDK
 {
 
+namespace
+{
+// Never matches the key of an item, so the items given it in a base state are always written.
+const int32 UnsentReplicationKey = MIN_int32;
+
+UArrayProperty* GetFastArrayItemsProperty(UScriptStruct* NetDeltaStruct)
+{
+	for (TFieldIterator<UArrayProperty> It(NetDeltaStruct); It; ++It)
+	{
+		if (GetFastArraySerializerProperty(*It) == NetDeltaStruct)
+		{
+			return *It;
+		}
+	}
+	return nullptr;
+}
+
+// Items received from other workers keep their IDs, which new items must not reuse. This also means every ID
+// that a worker holding the entity could have seen is at most IDCounter.
+void BumpIDCounterPastItems(FFastArraySerializer& Serializer, UArrayProperty* ItemsProperty)
+{
+	FScriptArrayHelper ArrayHelper(ItemsProperty, ItemsProperty->ContainerPtrToValuePtr<void>(&Serializer));
+	for (int32 i = 0; i < ArrayHelper.Num(); i++)
+	{
+		const FFastArraySerializerItem* Item = reinterpret_cast<const FFastArraySerializerItem*>(ArrayHelper.GetRawPtr(i));
+		Serializer.IDCounter = FMath::Max(Serializer.IDCounter, Item->ReplicationID + 1);
+	}
+}
+} // anonymous namespace
+
+FSpatialFastArrayBaseline& FSpatialFastArrayBaselines::FindOrAdd(UObject* Object, uint16 Handle)
+{
+	return Baselines.FindOrAdd(TPair<TWeakObjectPtr<UObject>, uint16>(Object, Handle));
+}
+
+void FSpatialFastArrayBaselines::Seed(USpatialNetDriver* NetDriver, UObject* Object, const FRepLayout& RepLayout)
+{
+	for (uint16 Handle = 1; Handle <= RepLayout.BaseHandleToCmdIndex.Num(); Handle++)
+	{
+		const FRepLayoutCmd& Cmd = RepLayout.Cmds[RepLayout.BaseHandleToCmdIndex[Handle - 1].CmdIndex];
+		if (Cmd.Type != ERepLayoutCmdType::DynamicArray)
+		{
+			continue;
+		}
+
+		UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Cmd.Property);
+		UScriptStruct* NetDeltaStruct = GetFastArraySerializerProperty(ArrayProperty);
+		if (NetDeltaStruct == nullptr)
+		{
+			continue;
+		}
+
+		const FRepParentCmd& Parent = RepLayout.Parents[Cmd.ParentIndex];
+		FFastArraySerializer* Serializer = Cast<UStructProperty>(Parent.Property)->ContainerPtrToValuePtr<FFastArraySerializer>(Object, Parent.ArrayIndex);
+		BumpIDCounterPastItems(*Serializer, ArrayProperty);
+
+		FSpatialFastArrayBaseline& Baseline = FindOrAdd(Object, Handle);
+		FSpatialNetBitWriter Writer(NetDriver->PackageMap);
+		FSpatialNetDeltaSerializeInfo::DeltaSerializeWrite(NetDriver, Writer, Object, Parent.ArrayIndex, Parent.Property, NetDeltaStruct, nullptr, &Baseline.SnapshotState);
+		Baseline.SnapshotBytes = Writer.GetNumBytes();
+		Baseline.bNeedsSnapshot = true;
+	}
+}
+
+FSpatialNetDeltaSerializeInfo::FSpatialNetDeltaSerializeInfo()
+{
+	// Replicating fast arrays as changes relies on the engine's delta format, which can express removals.
+	bIsSpatialType = !GetDefault<USpatialGDKSettings>()->bUseFastArrayDeltaReplication;
+}
+
 bool FSpatialNetDeltaSerializeInfo::DeltaSerializeRead(USpatialNetDriver* NetDriver, FSpatialNetBitReader& Reader, UObject* Object, int32 ArrayIndex, UProperty* ParentProperty, UScriptStruct* NetDeltaStruct)
 {
 	FSpatialNetDeltaSerializeInfo NetDeltaInfo;
@@ -26,19 +102,36 @@ bool FSpatialNetDeltaSerializeInfo::DeltaSerializeRead(USpatialNetDriver* NetDri
 	UScriptStruct::ICppStructOps* CppStructOps = NetDeltaStruct->GetCppStructOps();
 	check(CppStructOps);
 
-	return CppStructOps->NetDeltaSerialize(NetDeltaInfo, Destination);
+	const bool bResult = CppStructOps->NetDeltaSerialize(NetDeltaInfo, Destination);
+
+	// Keeps IDCounter past every ID received, so that a later authoritative write can remove any of them.
+	if (!NetDeltaInfo.bIsSpatialType)
+	{
+		if (UArrayProperty* ItemsProperty = GetFastArrayItemsProperty(NetDeltaStruct))
+		{
+			BumpIDCounterPastItems(*static_cast<FFastArraySerializer*>(Destination), ItemsProperty);
+		}
+	}
+
+	return bResult;
 }
 
-bool FSpatialNetDeltaSerializeInfo::DeltaSerializeWrite(USpatialNetDriver* NetDriver, FSpatialNetBitWriter& Writer, UObject* Object, int32 ArrayIndex, UProperty* ParentProperty, UScriptStruct* NetDeltaStruct)
+bool FSpatialNetDeltaSerializeInfo::DeltaSerializeWrite(USpatialNetDriver* NetDriver, FSpatialNetBitWriter& Writer, UObject* Object, int32 ArrayIndex, UProperty* ParentProperty, UScriptStruct* NetDeltaStruct,
+	INetDeltaBaseState* OldState /*= nullptr*/, TSharedPtr<INetDeltaBaseState>* NewState /*= nullptr*/)
 {
 	FSpatialNetDeltaSerializeInfo NetDeltaInfo;
 
 	SpatialFastArrayNetSerializeCB SerializeCB(NetDriver);
 
+	// The engine's delta format always needs somewhere to put the new state, even when the caller doesn't keep it.
+	TSharedPtr<INetDeltaBaseState> DiscardedState;
+
 	NetDeltaInfo.Writer = &Writer;
 	NetDeltaInfo.Map = Writer.PackageMap;
 	NetDeltaInfo.NetSerializeCB = &SerializeCB;
 	NetDeltaInfo.Object = Object;
+	NetDeltaInfo.OldState = OldState;
+	NetDeltaInfo.NewState = NewState != nullptr ? NewState : &DiscardedState;
 
 	UStructProperty* ParentStruct = Cast<UStructProperty>(ParentProperty);
 	check(ParentStruct);
@@ -50,6 +143,80 @@ bool FSpatialNetDeltaSerializeInfo::DeltaSerializeWrite(USpatialNetDriver* NetDr
 	return CppStructOps->NetDeltaSerialize(NetDeltaInfo, Source);
 }
 
+void FSpatialNetDeltaSerializeInfo::DeltaSerializeWriteWithBaseline(USpatialNetDriver* NetDriver, Schema_Object* ComponentObject, Schema_FieldId FieldId, UObject* Object, int32 ArrayIndex, UProperty* ParentProperty, UScriptStruct* NetDeltaStruct,
+	FSpatialFastArrayBaseline& Baseline, bool bIsInitialData)
+{
+	const bool bHasSnapshot = Baseline.SnapshotState.IsValid() && !bIsInitialData;
+
+	FSpatialNetBitWriter ChangesWriter(NetDriver->PackageMap);
+	if (bHasSnapshot)
+	{
+		// Items added since the snapshot are unknown to it, so they are added to the state the changes are written
+		// against. That way they are written as removed once they are gone.
+		const FNetFastTArrayBaseState& SnapshotState = static_cast<const FNetFastTArrayBaseState&>(*Baseline.SnapshotState);
+		TSharedPtr<FNetFastTArrayBaseState> ChangesBaseState = MakeShared<FNetFastTArrayBaseState>(SnapshotState);
+		for (int32 ItemId : Baseline.AddedItemIds)
+		{
+			ChangesBaseState->IDToCLMap.Add(ItemId, UnsentReplicationKey);
+		}
+
+		TSharedPtr<INetDeltaBaseState> CurrentState;
+		DeltaSerializeWrite(NetDriver, ChangesWriter, Object, ArrayIndex, ParentProperty, NetDeltaStruct, ChangesBaseState.Get(), &CurrentState);
+
+		if (CurrentState.IsValid())
+		{
+			for (const auto& ItemPair : static_cast<FNetFastTArrayBaseState*>(CurrentState.Get())->IDToCLMap)
+			{
+				if (!SnapshotState.IDToCLMap.Contains(ItemPair.Key))
+				{
+					Baseline.AddedItemIds.Add(ItemPair.Key);
+				}
+			}
+		}
+
+		// Every change since the snapshot is sent again with each update, so a new snapshot is taken once they outgrow it.
+		if (!Baseline.bNeedsSnapshot && ChangesWriter.GetNumBytes() * 2 <= Baseline.SnapshotBytes)
+		{
+			AddBytesToSchema(ComponentObject, FieldId, ChangesWriter);
+			return;
+		}
+	}
+	else if (!bIsInitialData)
+	{
+		// Without a snapshot, nothing is known about what workers holding the entity have. So they are sent the full
+		// state, along with a removal for every ID that has been assigned and is gone.
+		UStructProperty* ParentStruct = Cast<UStructProperty>(ParentProperty);
+		check(ParentStruct);
+		FFastArraySerializer* Serializer = ParentStruct->ContainerPtrToValuePtr<FFastArraySerializer>(Object, ArrayIndex);
+		UArrayProperty* ItemsProperty = GetFastArrayItemsProperty(NetDeltaStruct);
+		check(ItemsProperty);
+		BumpIDCounterPastItems(*Serializer, ItemsProperty);
+
+		TSharedPtr<FNetFastTArrayBaseState> ChangesBaseState = MakeShared<FNetFastTArrayBaseState>();
+		ChangesBaseState->IDToCLMap.Reserve(Serializer->IDCounter + 1);
+		for (int32 ItemId = 0; ItemId <= Serializer->IDCounter; ItemId++)
+		{
+			ChangesBaseState->IDToCLMap.Add(ItemId, UnsentReplicationKey);
+		}
+
+		DeltaSerializeWrite(NetDriver, ChangesWriter, Object, ArrayIndex, ParentProperty, NetDeltaStruct, ChangesBaseState.Get());
+	}
+
+	FSpatialNetBitWriter SnapshotWriter(NetDriver->PackageMap);
+	DeltaSerializeWrite(NetDriver, SnapshotWriter, Object, ArrayIndex, ParentProperty, NetDeltaStruct, nullptr, &Baseline.SnapshotState);
+	Baseline.SnapshotBytes = SnapshotWriter.GetNumBytes();
+	Baseline.AddedItemIds.Reset();
+	Baseline.bNeedsSnapshot = false;
+
+	AddBytesToSchema(ComponentObject, FieldId + SpatialConstants::FAST_ARRAY_BASELINE_FIELD_ID_OFFSET, SnapshotWriter);
+
+	// Workers already holding the entity ignore the snapshot field, so they are sent the changes written above.
+	if (!bIsInitialData)
+	{
+		AddBytesToSchema(ComponentObject, FieldId, ChangesWriter);
+	}
+}
+
 void SpatialFastArrayNetSerializeCB::NetSerializeStruct(UScriptStruct* Struct, FBitArchive& Ar, UPackageMap* PackageMap, void* Data, bool& bHasUnmapped)
 {
 	// Check if struct has custom NetSerialize function, otherwise call standard struct replication
@@ -139,28 +139,13 @@ void USpatialNetConnection::InitHeartbeat(FTimerManager* InTimerManager, Worker_
 	PlayerControllerEntity = InPlayerControllerEntity;
 	TimerManager = InTimerManager;
 
-	if (Driver->IsServer())
-	{
-		SetHeartbeatTimeoutTimer();
-	}
-	else
+	// Servers track heartbeat timeouts for all of their client connections in USpatialReceiver.
+	if (!Driver->IsServer())
 	{
 		SetHeartbeatEventTimer();
 	}
 }
 
-void USpatialNetConnection::SetHeartbeatTimeoutTimer()
-{
-	TimerManager->SetTimer(HeartbeatTimer, [WeakThis = TWeakObjectPtr<USpatialNetConnection>(this)]()
-	{
-		if (USpatialNetConnection* Connection = WeakThis.Get())
-		{
-			// This client timed out. Disconnect it and trigger OnDisconnected logic.
-			Connection->CleanUp();
-		}
-	}, GetDefault<USpatialGDKSettings>()->HeartbeatTimeoutSeconds, false);
-}
-
 void USpatialNetConnection::SetHeartbeatEventTimer()
 {
 	TimerManager->SetTimer(HeartbeatTimer, [WeakThis = TWeakObjectPtr<USpatialNetConnection>(this)]()
@@ -192,8 +177,3 @@ void USpatialNetConnection::DisableHeartbeat()
 	}
 	PlayerControllerEntity = SpatialConstants::INVALID_ENTITY_ID;
 }
-
-void USpatialNetConnection::OnHeartbeat()
-{
-	SetHeartbeatTimeoutTimer();
-}
@@ -134,6 +134,9 @@ bool USpatialNetDriver::InitBase(bool bInitAsClient, FNetworkNotify* InNotify, c
 		return false;
 	}
 
+	// Start loading classes while the connection is made, so their first entities don't cause a hitch.
+	ClassInfoManager->StartWarmUp();
+
 	if (!bInitAsClient)
 	{
 		GatherClientInterestDistances();
@@ -1361,25 +1364,51 @@ void USpatialNetDriver::TickDispatch(float DeltaTime)
 	// Not calling Super:: on purpose.
 	UNetDriver::TickDispatch(DeltaTime);
 
+	if (ClassInfoManager != nullptr)
+	{
+		ClassInfoManager->TickWarmUp();
+	}
+
 	if (Connection != nullptr)
 	{
-		TArray<Worker_OpList*> OpLists = Connection->GetOpList();
+		const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+
+		OpListBatch.SetCountBytes(SpatialGDKSettings->bEnableMetrics);
+		Connection->GetOpLists(OpListBatch);
 
 		// Servers will queue ops at startup until we've extracted necessary information from the op stream
 		if (!bIsReadyToStart)
 		{
-			HandleStartupOpQueueing(OpLists);
+			HandleStartupOpQueueing(OpListBatch.GetOpLists());
+			OpListBatch.Reset();
 			return;
 		}
 
-		for (Worker_OpList* OpList : OpLists)
+		// Ops marked to skip are found by address, so they must be processed in the op lists they were received in.
+		if (SpatialGDKSettings->bCoalesceOpLists && Dispatcher->GetNumOpsToSkip() == 0)
 		{
-			Dispatcher->ProcessOps(OpList);
+			for (const Worker_OpList& OpList : OpListBatch.Coalesce())
+			{
+				Dispatcher->ProcessOps(const_cast<Worker_OpList*>(&OpList));
+			}
+		}
+		else
+		{
+			for (Worker_OpList* OpList : OpListBatch.GetOpLists())
+			{
+				Dispatcher->ProcessOps(OpList);
+			}
+		}
 
-			Worker_OpList_Destroy(OpList);
+		for (Worker_OpList* OpList : OpListBatch.GetOpLists())
+		{
+			Connection->DestroyOpList(OpList);
 		}
+		OpListBatch.Reset();
 
-		if (SpatialMetrics != nullptr && GetDefault<USpatialGDKSettings>()->bEnableMetrics)
+		Receiver->ProcessEntityMaterializationQueue();
+
+		if (SpatialMetrics != nullptr && SpatialGDKSettings->bEnableMetrics)
 		{
 			SpatialMetrics->TickMetrics();
 		}
@@ -1620,9 +1649,19 @@ void USpatialNetDriver::ProcessPendingDormancy()
 				}
 			}
 
+			// Cleaning up the channel clears its actor and connection, so grab them first.
+			AActor* Actor = Channel->Actor;
+			UNetConnection* NetConnection = Channel->Connection;
+			const Worker_EntityId EntityId = Channel->GetEntityId();
+
 			// This same logic is called from within UChannel::ReceivedSequencedBunch when a dormant cmd is received
 			Channel->Dormant = 1;
 			Channel->ConditionalCleanUp(false, EChannelCloseReason::Dormancy);
+
+			if (Actor != nullptr && GetDefault<USpatialGDKSettings>()->bUseDormantColdStorage && IsDormantEntity(EntityId))
+			{
+				DormantColdStorage.Store(EntityId, Actor, NetConnection, this);
+			}
 		}
 	}
 	PendingDormantChannels = MoveTemp(RemainingChannels);
@@ -1836,6 +1875,11 @@ void USpatialNetDriver::RemoveActorChannel(Worker_EntityId EntityId)
 	}
 
 	EntityToActorChannel.FindAndRemoveChecked(EntityId);
+
+	if (Sender != nullptr)
+	{
+		Sender->ClearSentInterest(EntityId);
+	}
 }
 
 TMap<Worker_EntityId_Key, USpatialActorChannel*>& USpatialNetDriver::GetEntityToActorChannelMap()
@@ -1941,6 +1985,7 @@ void USpatialNetDriver::RegisterDormantEntityId(Worker_EntityId EntityId)
 void USpatialNetDriver::UnregisterDormantEntityId(Worker_EntityId EntityId)
 {
 	DormantEntities.Remove(EntityId);
+	DormantColdStorage.Remove(EntityId);
 }
 
 bool USpatialNetDriver::IsDormantEntity(Worker_EntityId EntityId) const
@@ -2137,7 +2182,7 @@ void USpatialNetDriver::HandleStartupOpQueueing(const TArray<Worker_OpList*>& In
 	for (Worker_OpList* OpList : QueuedStartupOpLists)
 	{
 		Dispatcher->ProcessOps(OpList);
-		Worker_OpList_Destroy(OpList);
+		Connection->DestroyOpList(OpList);
 	}
 
 	// Sanity check that the dispatcher encountered, skipped, and removed
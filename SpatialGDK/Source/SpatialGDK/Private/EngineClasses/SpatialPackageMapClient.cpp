@@ -15,7 +15,6 @@
 #include "Schema/UnrealObjectRef.h"
 #include "SpatialConstants.h"
 #include "Utils/EntityPool.h"
-#include "Utils/SchemaOption.h"
 #include "UObject/UObjectGlobals.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialPackageMap);
@@ -349,14 +348,15 @@ FNetworkGUID FSpatialNetGUIDCache::AssignNewEntityActorNetGUID(AActor* Actor, Wo
 		// AssignNewStablyNamedObjectNetGUID will register the path ref.
 		NetGUID = AssignNewStablyNamedObjectNetGUID(Actor);
 
-		// We register the entity id ref here.
-		UnrealObjectRefToNetGUID.Emplace(EntityObjectRef, NetGUID);
-
 		// Once we have an entity id, we should always be using it to refer to entities.
-		// Since the path ref may have been registered previously, we first try to remove it
-		// and then register the entity id ref.
-		StablyNamedRef = NetGUIDToUnrealObjectRef[NetGUID];
-		NetGUIDToUnrealObjectRef.Emplace(NetGUID, EntityObjectRef);
+		// The path ref stays as an alias of the NetGUID, and is removed along with the entity.
+		const FUnrealObjectRef* PathRef = ObjectRefRegistry.FindObjectRef(NetGUID);
+		check(PathRef != nullptr);
+		StablyNamedRef = *PathRef;
+		ObjectRefRegistry.AddAlias(StablyNamedRef, NetGUID, EntityId);
+
+		// We register the entity id ref here.
+		ObjectRefRegistry.Register(NetGUID, EntityObjectRef);
 	}
 	else
 	{
@@ -400,12 +400,12 @@ FNetworkGUID FSpatialNetGUIDCache::AssignNewEntityActorNetGUID(AActor* Actor, Wo
 			FUnrealObjectRef StablyNamedSubobjectRef(0, 0, Subobject->GetFName().ToString(), StablyNamedRef);
 
 			// This is the only extra object ref that has to be registered for the subobject.
-			UnrealObjectRefToNetGUID.Emplace(StablyNamedSubobjectRef, SubobjectNetGUID);
+			ObjectRefRegistry.AddAlias(StablyNamedSubobjectRef, SubobjectNetGUID, EntityId);
 
 			// As the subobject may have be referred to previously in replication flow, it would
-			// have it's stable name registered as it's UnrealObjectRef inside NetGUIDToUnrealObjectRef.
-			// Update the map to point to the entity id version.
-			NetGUIDToUnrealObjectRef.Emplace(SubobjectNetGUID, EntityIdSubobjectRef);
+			// have it's stable name registered as it's UnrealObjectRef for the NetGUID.
+			// Update the registry to point to the entity id version.
+			ObjectRefRegistry.Register(SubobjectNetGUID, EntityIdSubobjectRef);
 		}
 
 		RegisterObjectRef(SubobjectNetGUID, EntityIdSubobjectRef);
@@ -475,125 +475,15 @@ FNetworkGUID FSpatialNetGUIDCache::AssignNewStablyNamedObjectNetGUID(UObject* Ob
 
 void FSpatialNetGUIDCache::RemoveEntityNetGUID(Worker_EntityId EntityId)
 {
-	// Remove actor subobjects.
-	USpatialNetDriver* SpatialNetDriver = Cast<USpatialNetDriver>(Driver);
-
-	SpatialGDK::UnrealMetadata* UnrealMetadata = SpatialNetDriver->StaticComponentView->GetComponentData<SpatialGDK::UnrealMetadata>(EntityId);
-
-	// If UnrealMetadata is nullptr (can happen if the editor is closing down) just return.
-	if (UnrealMetadata == nullptr)
-	{
-		return;
-	}
-
-	// Due to UnrealMetadata::GetNativeEntityClass using LoadObject, if we are shutting down and garbage collecting,
-	// calling LoadObject will crash the editor. In this case, just return since everything will be cleaned up anyways.
-	if (IsInGameThread() && IsGarbageCollecting())
-	{
-		return;
-	}
-
-	SpatialGDK::TSchemaOption<FUnrealObjectRef>& StablyNamedRefOption = UnrealMetadata->StablyNamedRef;
-
-	if (UnrealMetadata->NativeClass.IsStale())
-	{
-		UE_LOG(LogSpatialPackageMap, Warning, TEXT("Attempting to remove stale object from package map - %s"), *UnrealMetadata->ClassPath);
-	}
-	else
-	{
-		const FClassInfo& Info = SpatialNetDriver->ClassInfoManager->GetOrCreateClassInfoByClass(UnrealMetadata->GetNativeEntityClass());
-
-		for (auto& SubobjectInfoPair : Info.SubobjectInfo)
-		{
-			FUnrealObjectRef SubobjectRef(EntityId, SubobjectInfoPair.Key);
-			if (FNetworkGUID* SubobjectNetGUID = UnrealObjectRefToNetGUID.Find(SubobjectRef))
-			{
-				NetGUIDToUnrealObjectRef.Remove(*SubobjectNetGUID);
-				UnrealObjectRefToNetGUID.Remove(SubobjectRef);
-
-				if (StablyNamedRefOption.IsSet())
-				{
-					UnrealObjectRefToNetGUID.Remove(FUnrealObjectRef(0, 0, SubobjectInfoPair.Value->SubobjectName.ToString(), StablyNamedRefOption.GetValue()));
-				}
-			}
-		}
-	}
-
-	// Remove dynamically attached subobjects
-	if (USpatialActorChannel* Channel = SpatialNetDriver->GetActorChannelByEntityId(EntityId))
-	{
-		for (UObject* DynamicSubobject : Channel->CreateSubObjects)
-		{
-			if (FNetworkGUID* SubobjectNetGUID = NetGUIDLookup.Find(DynamicSubobject))
-			{
-				if (FUnrealObjectRef* SubobjectRef = NetGUIDToUnrealObjectRef.Find(*SubobjectNetGUID))
-				{
-					UnrealObjectRefToNetGUID.Remove(*SubobjectRef);
-					NetGUIDToUnrealObjectRef.Remove(*SubobjectNetGUID);
-				}
-			}
-		}
-	}
-
-	// Remove actor.
-	FNetworkGUID EntityNetGUID = GetNetGUIDFromEntityId(EntityId);
-	// TODO: Figure out why NetGUIDToUnrealObjectRef might not have this GUID. UNR-989
-	if (FUnrealObjectRef* ActorRef = NetGUIDToUnrealObjectRef.Find(EntityNetGUID))
-	{
-		UnrealObjectRefToNetGUID.Remove(*ActorRef);
-	}
-	NetGUIDToUnrealObjectRef.Remove(EntityNetGUID);
-	if (StablyNamedRefOption.IsSet())
-	{
-		UnrealObjectRefToNetGUID.Remove(StablyNamedRefOption.GetValue());
-	}
+	// Removes the actor, its subobjects (including dynamically attached ones) and their stably named refs,
+	// all of which were recorded against the entity when they were registered.
+	ObjectRefRegistry.RemoveEntity(EntityId);
 }
 
 void FSpatialNetGUIDCache::RemoveSubobjectNetGUID(const FUnrealObjectRef& SubobjectRef)
 {
-	if (!UnrealObjectRefToNetGUID.Contains(SubobjectRef))
-	{
-		return;
-	}
-
-	USpatialNetDriver* SpatialNetDriver = Cast<USpatialNetDriver>(Driver);
-	SpatialGDK::UnrealMetadata* UnrealMetadata = SpatialNetDriver->StaticComponentView->GetComponentData<SpatialGDK::UnrealMetadata>(SubobjectRef.Entity);
-
-	// If UnrealMetadata is nullptr (can happen if the editor is closing down) just return.
-	if (UnrealMetadata == nullptr)
-	{
-		return;
-	}
-
-	// Due to UnrealMetadata::GetNativeEntityClass using LoadObject, if we are shutting down and garbage collecting,
-	// calling LoadObject will crash the editor. In this case, just return since everything will be cleaned up anyways.
-	if (IsInGameThread() && IsGarbageCollecting())
-	{
-		return;
-	}
-
-	if (UnrealMetadata->NativeClass.IsStale())
-	{
-		UE_LOG(LogSpatialPackageMap, Warning, TEXT("Attempting to remove stale subobject from package map - %s"), *UnrealMetadata->ClassPath);
-	}
-	else
-	{
-		const FClassInfo& Info = SpatialNetDriver->ClassInfoManager->GetOrCreateClassInfoByClass(UnrealMetadata->GetNativeEntityClass());
-
-		// Part of the CDO
-		if (const TSharedRef<const FClassInfo>* SubobjectInfoPtr = Info.SubobjectInfo.Find(SubobjectRef.Offset))
-		{
-			SpatialGDK::TSchemaOption<FUnrealObjectRef>& StablyNamedRefOption = UnrealMetadata->StablyNamedRef;
-
-			if (StablyNamedRefOption.IsSet())
-			{
-				UnrealObjectRefToNetGUID.Remove(FUnrealObjectRef(0, 0, SubobjectInfoPtr->Get().SubobjectName.ToString(), StablyNamedRefOption.GetValue()));
-			}
-		}
-	}
-	FNetworkGUID SubobjectNetGUID = UnrealObjectRefToNetGUID[SubobjectRef];
-	NetGUIDToUnrealObjectRef.Remove(SubobjectNetGUID);
-	UnrealObjectRefToNetGUID.Remove(SubobjectRef);
+	// Also removes the subobject's stably named ref, if it has one.
+	ObjectRefRegistry.RemoveNetGUIDOf(SubobjectRef);
 }
 
 FNetworkGUID FSpatialNetGUIDCache::GetNetGUIDFromUnrealObjectRef(const FUnrealObjectRef& ObjectRef)
@@ -603,7 +493,7 @@ FNetworkGUID FSpatialNetGUIDCache::GetNetGUIDFromUnrealObjectRef(const FUnrealOb
 
 FNetworkGUID FSpatialNetGUIDCache::GetNetGUIDFromUnrealObjectRefInternal(const FUnrealObjectRef& ObjectRef)
 {
-	FNetworkGUID* CachedGUID = UnrealObjectRefToNetGUID.Find(ObjectRef);
+	const FNetworkGUID* CachedGUID = ObjectRefRegistry.FindNetGUID(ObjectRef);
 	FNetworkGUID NetGUID = CachedGUID ? *CachedGUID : FNetworkGUID{};
 	if (!NetGUID.IsValid() && ObjectRef.Path.IsSet())
 	{
@@ -649,22 +539,20 @@ void FSpatialNetGUIDCache::NetworkRemapObjectRefPaths(FUnrealObjectRef& ObjectRe
 
 void FSpatialNetGUIDCache::UnregisterActorObjectRefOnly(const FUnrealObjectRef& ObjectRef)
 {
-	FNetworkGUID& NetGUID = UnrealObjectRefToNetGUID.FindChecked(ObjectRef);
-	// Remove ObjectRef first so the reference above isn't destroyed
-	NetGUIDToUnrealObjectRef.Remove(NetGUID);
-	UnrealObjectRefToNetGUID.Remove(ObjectRef);
+	check(ObjectRefRegistry.FindNetGUID(ObjectRef) != nullptr);
+	ObjectRefRegistry.Unregister(ObjectRef);
 }
 
 FUnrealObjectRef FSpatialNetGUIDCache::GetUnrealObjectRefFromNetGUID(const FNetworkGUID& NetGUID) const
 {
-	const FUnrealObjectRef* ObjRef = NetGUIDToUnrealObjectRef.Find(NetGUID);
+	const FUnrealObjectRef* ObjRef = ObjectRefRegistry.FindObjectRef(NetGUID);
 	return ObjRef ? (FUnrealObjectRef)*ObjRef : FUnrealObjectRef::UNRESOLVED_OBJECT_REF;
 }
 
 FNetworkGUID FSpatialNetGUIDCache::GetNetGUIDFromEntityId(Worker_EntityId EntityId) const
 {
 	FUnrealObjectRef ObjRef(EntityId, 0);
-	const FNetworkGUID* NetGUID = UnrealObjectRefToNetGUID.Find(ObjRef);
+	const FNetworkGUID* NetGUID = ObjectRefRegistry.FindNetGUID(ObjRef);
 	return (NetGUID == nullptr) ? FNetworkGUID(0) : *NetGUID;
 }
 
@@ -730,12 +618,11 @@ void FSpatialNetGUIDCache::RegisterObjectRef(FNetworkGUID NetGUID, const FUnreal
 	FUnrealObjectRef RemappedObjectRef = ObjectRef;
 	NetworkRemapObjectRefPaths(RemappedObjectRef, false /*bIsReading*/);
 
-	checkfSlow(!NetGUIDToUnrealObjectRef.Contains(NetGUID) || (NetGUIDToUnrealObjectRef.Contains(NetGUID) && NetGUIDToUnrealObjectRef.FindChecked(NetGUID) == RemappedObjectRef),
+	checkfSlow(ObjectRefRegistry.FindObjectRef(NetGUID) == nullptr || *ObjectRefRegistry.FindObjectRef(NetGUID) == RemappedObjectRef,
 		TEXT("NetGUID to UnrealObjectRef mismatch - NetGUID: %s ObjRef in map: %s ObjRef expected: %s"), *NetGUID.ToString(),
-		*NetGUIDToUnrealObjectRef.FindChecked(NetGUID).ToString(), *RemappedObjectRef.ToString());
-	checkfSlow(!UnrealObjectRefToNetGUID.Contains(RemappedObjectRef) || (UnrealObjectRefToNetGUID.Contains(RemappedObjectRef) && UnrealObjectRefToNetGUID.FindChecked(RemappedObjectRef) == NetGUID),
+		*ObjectRefRegistry.FindObjectRef(NetGUID)->ToString(), *RemappedObjectRef.ToString());
+	checkfSlow(ObjectRefRegistry.FindNetGUID(RemappedObjectRef) == nullptr || *ObjectRefRegistry.FindNetGUID(RemappedObjectRef) == NetGUID,
 		TEXT("UnrealObjectRef to NetGUID mismatch - UnrealObjectRef: %s NetGUID in map: %s NetGUID expected: %s"), *NetGUID.ToString(),
-		*UnrealObjectRefToNetGUID.FindChecked(RemappedObjectRef).ToString(), *RemappedObjectRef.ToString());
-	NetGUIDToUnrealObjectRef.Emplace(NetGUID, RemappedObjectRef);
-	UnrealObjectRefToNetGUID.Emplace(RemappedObjectRef, NetGUID);
+		*ObjectRefRegistry.FindNetGUID(RemappedObjectRef)->ToString(), *RemappedObjectRef.ToString());
+	ObjectRefRegistry.Register(NetGUID, RemappedObjectRef);
 }
@@ -0,0 +1,116 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/Connection/LogBuffer.h"
+
+#include "HAL/PlatformTime.h"
+#include "Misc/Crc.h"
+#include "Misc/ScopeLock.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+FLogBuffer::FLogBuffer(int32 InMaxBufferedMessages, int32 InMaxMessagesPerCategoryPerSecond)
+	: MaxBufferedMessages(InMaxBufferedMessages)
+	, MaxMessagesPerCategoryPerSecond(InMaxMessagesPerCategoryPerSecond)
+{
+}
+
+void FLogBuffer::SetLimits(int32 InMaxBufferedMessages, int32 InMaxMessagesPerCategoryPerSecond)
+{
+	FScopeLock Lock(&Mutex);
+	MaxBufferedMessages = InMaxBufferedMessages;
+	MaxMessagesPerCategoryPerSecond = InMaxMessagesPerCategoryPerSecond;
+}
+
+uint32 FLogBuffer::GetEntryHash(uint8 Level, const FName& Category, const TCHAR* Message)
+{
+	return HashCombine(HashCombine(GetTypeHash(Level), GetTypeHash(Category)), FCrc::StrCrc32(Message));
+}
+
+bool FLogBuffer::Add(uint8 Level, const FName& LoggerName, const FName& Category, const TCHAR* Message)
+{
+	const uint32 Hash = GetEntryHash(Level, Category, Message);
+
+	FScopeLock Lock(&Mutex);
+
+	if (const int32* Index = EntryIndices.Find(Hash))
+	{
+		FEntry& Entry = Entries[*Index];
+		if (Entry.Level == Level && Entry.Category == Category && Entry.LoggerName == LoggerName && Entry.Message.Equals(Message, ESearchCase::CaseSensitive))
+		{
+			Entry.RepeatCount++;
+			return true;
+		}
+	}
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	FCategoryRate& Rate = CategoryRates.FindOrAdd(Category);
+	if (CurrentTime - Rate.WindowStartTime >= 1.0)
+	{
+		Rate.WindowStartTime = CurrentTime;
+		Rate.NumMessagesInWindow = 0;
+	}
+
+	if (Rate.NumMessagesInWindow >= MaxMessagesPerCategoryPerSecond || Entries.Num() >= MaxBufferedMessages)
+	{
+		DroppedSinceLastFlush++;
+		DroppedLoggerName = LoggerName;
+		TotalDroppedMessages++;
+		return false;
+	}
+
+	Rate.NumMessagesInWindow++;
+
+	// On a hash collision the newer message is simply not coalesced.
+	EntryIndices.FindOrAdd(Hash, Entries.Num());
+	Entries.Add(FEntry{ Level, LoggerName, Category, Message, 1 });
+	return true;
+}
+
+void FLogBuffer::Flush(TFunctionRef<void(uint8 Level, const FName& LoggerName, const TCHAR* Message)> Callback)
+{
+	TArray<FEntry> EntriesToFlush;
+	uint32 NumDropped;
+	FName LoggerNameForDropped;
+	{
+		FScopeLock Lock(&Mutex);
+		if (Entries.Num() == 0 && DroppedSinceLastFlush == 0)
+		{
+			return;
+		}
+
+		EntriesToFlush = MoveTemp(Entries);
+		Entries.Reset();
+		EntryIndices.Reset();
+		NumDropped = DroppedSinceLastFlush;
+		LoggerNameForDropped = DroppedLoggerName;
+		DroppedSinceLastFlush = 0;
+	}
+
+	for (const FEntry& Entry : EntriesToFlush)
+	{
+		if (Entry.RepeatCount > 1)
+		{
+			Callback(Entry.Level, Entry.LoggerName, *FString::Printf(TEXT("%s (repeated %u times)"), *Entry.Message, Entry.RepeatCount));
+		}
+		else
+		{
+			Callback(Entry.Level, Entry.LoggerName, *Entry.Message);
+		}
+	}
+
+	if (NumDropped > 0)
+	{
+		Callback(WORKER_LOG_LEVEL_WARN, LoggerNameForDropped, *FString::Printf(TEXT("Dropped %u log messages because the log rate limit was exceeded."), NumDropped));
+	}
+}
+
+int32 FLogBuffer::GetNumBufferedMessages() const
+{
+	FScopeLock Lock(&Mutex);
+	return Entries.Num();
+}
+
+} // namespace SpatialGDK
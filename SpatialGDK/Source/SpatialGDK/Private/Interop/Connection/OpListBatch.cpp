@@ -0,0 +1,122 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/Connection/OpListBatch.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+namespace SpatialGDK
+{
+
+namespace
+{
+	uint32 GetSchemaBytes(const Worker_Op& Op)
+	{
+		switch (Op.op_type)
+		{
+		case WORKER_OP_TYPE_ADD_COMPONENT:
+			return Op.op.add_component.data.schema_type != nullptr ? Schema_GetWriteBufferLength(Schema_GetComponentDataFields(Op.op.add_component.data.schema_type)) : 0;
+		case WORKER_OP_TYPE_COMPONENT_UPDATE:
+			return Op.op.component_update.update.schema_type != nullptr ? Schema_GetWriteBufferLength(Schema_GetComponentUpdateFields(Op.op.component_update.update.schema_type)) : 0;
+		case WORKER_OP_TYPE_COMMAND_REQUEST:
+			return Op.op.command_request.request.schema_type != nullptr ? Schema_GetWriteBufferLength(Schema_GetCommandRequestObject(Op.op.command_request.request.schema_type)) : 0;
+		case WORKER_OP_TYPE_COMMAND_RESPONSE:
+			return Op.op.command_response.response.schema_type != nullptr ? Schema_GetWriteBufferLength(Schema_GetCommandResponseObject(Op.op.command_response.response.schema_type)) : 0;
+		default:
+			return 0;
+		}
+	}
+} // anonymous namespace
+
+void FOpListBatch::Add(Worker_OpList* OpList)
+{
+	OpLists.Add(OpList);
+
+	bool bRemovesComponent = false;
+	for (uint32 i = 0; i < OpList->op_count; i++)
+	{
+		const Worker_Op& Op = OpList->ops[i];
+
+		if (Op.op_type >= Stats.OpsByType.Num())
+		{
+			Stats.OpsByType.SetNumZeroed(Op.op_type + 1);
+		}
+		Stats.OpsByType[Op.op_type]++;
+
+		bRemovesComponent |= Op.op_type == WORKER_OP_TYPE_REMOVE_COMPONENT;
+
+		if (bCountBytes)
+		{
+			Stats.NumBytes += GetSchemaBytes(Op);
+		}
+	}
+	RemovesComponents.Add(bRemovesComponent);
+
+	Stats.NumOpLists++;
+	Stats.NumOps += OpList->op_count;
+}
+
+const TArray<Worker_OpList>& FOpListBatch::Coalesce()
+{
+	CoalescedOpLists.Reset();
+
+	// Reserved up front, as the coalesced op lists point into this array.
+	CoalescedOps.Reset(Stats.NumOps);
+
+	int32 FirstOp = 0;
+	auto EndCoalescedOpList = [this, &FirstOp]()
+	{
+		if (CoalescedOps.Num() > FirstOp)
+		{
+			Worker_OpList& OpList = CoalescedOpLists.AddZeroed_GetRef();
+			OpList.ops = CoalescedOps.GetData() + FirstOp;
+			OpList.op_count = CoalescedOps.Num() - FirstOp;
+			FirstOp = CoalescedOps.Num();
+		}
+	};
+
+	for (int32 i = 0; i < OpLists.Num(); i++)
+	{
+		CoalescedOps.Append(OpLists[i]->ops, OpLists[i]->op_count);
+
+		if (RemovesComponents[i])
+		{
+			EndCoalescedOpList();
+		}
+	}
+	EndCoalescedOpList();
+
+	return CoalescedOpLists;
+}
+
+void FOpListBatch::Reset()
+{
+	TicksSinceConsumed++;
+	OpListsSinceConsumed += Stats.NumOpLists;
+	OpsSinceConsumed += Stats.NumOps;
+	BytesSinceConsumed += Stats.NumBytes;
+
+	OpLists.Reset();
+	RemovesComponents.Reset();
+	CoalescedOps.Reset();
+	CoalescedOpLists.Reset();
+
+	Stats.NumOpLists = 0;
+	Stats.NumOps = 0;
+	Stats.NumBytes = 0;
+	FMemory::Memzero(Stats.OpsByType.GetData(), Stats.OpsByType.Num() * sizeof(int32));
+}
+
+void FOpListBatch::ConsumeStats(int32& OutNumTicks, int32& OutNumOpLists, int32& OutNumOps, uint64& OutNumBytes)
+{
+	OutNumTicks = TicksSinceConsumed;
+	OutNumOpLists = OpListsSinceConsumed;
+	OutNumOps = OpsSinceConsumed;
+	OutNumBytes = BytesSinceConsumed;
+
+	TicksSinceConsumed = 0;
+	OpListsSinceConsumed = 0;
+	OpsSinceConsumed = 0;
+	BytesSinceConsumed = 0;
+}
+
+} // namespace SpatialGDK
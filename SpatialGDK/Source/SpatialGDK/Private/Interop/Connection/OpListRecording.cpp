@@ -0,0 +1,743 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/Connection/OpListRecording.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+DEFINE_LOG_CATEGORY(LogSpatialOpListRecording);
+
+namespace SpatialGDK
+{
+
+namespace
+{
+	const uint32 RecordingMagic = 0x4C504F53; // "SOPL"
+	const uint32 RecordingVersion = 1;
+
+	enum class ERecordType : uint8
+	{
+		OpList,
+		OutgoingMessage
+	};
+
+	template <typename T>
+	void WriteValue(FArchive& Ar, T Value)
+	{
+		Ar << Value;
+	}
+
+	template <typename T>
+	T ReadValue(FArchive& Ar)
+	{
+		T Value = T();
+		Ar << Value;
+		return Value;
+	}
+
+	// Strings are written as their length and UTF-8 bytes, with a length of -1 for null.
+	void WriteString(FArchive& Ar, const char* String)
+	{
+		int32 Length = String != nullptr ? FCStringAnsi::Strlen(String) : -1;
+		Ar << Length;
+		if (Length > 0)
+		{
+			Ar.Serialize(const_cast<char*>(String), Length);
+		}
+	}
+
+	void WriteSchemaObject(FArchive& Ar, const Schema_Object* Object)
+	{
+		uint32 Length = Object != nullptr ? Schema_GetWriteBufferLength(Object) : 0;
+		Ar << Length;
+		if (Length > 0)
+		{
+			TArray<uint8> Buffer;
+			Buffer.SetNumUninitialized(Length);
+			Schema_SerializeToBuffer(Object, Buffer.GetData(), Length);
+			Ar.Serialize(Buffer.GetData(), Length);
+		}
+	}
+
+	bool ReadSchemaObject(FArchive& Ar, Schema_Object* Object)
+	{
+		const uint32 Length = ReadValue<uint32>(Ar);
+		if (Length == 0)
+		{
+			return !Ar.IsError();
+		}
+
+		if (Length > Ar.TotalSize() - Ar.Tell())
+		{
+			Ar.SetError();
+			return false;
+		}
+
+		TArray<uint8> Buffer;
+		Buffer.SetNumUninitialized(Length);
+		Ar.Serialize(Buffer.GetData(), Length);
+		return !Ar.IsError() && Schema_MergeFromBuffer(Object, Buffer.GetData(), Length) != 0;
+	}
+
+	void WriteComponentData(FArchive& Ar, const Worker_ComponentData& Data)
+	{
+		WriteValue<uint32>(Ar, Data.component_id);
+		WriteSchemaObject(Ar, Data.schema_type != nullptr ? Schema_GetComponentDataFields(Data.schema_type) : nullptr);
+	}
+
+	void WriteComponentUpdate(FArchive& Ar, const Worker_ComponentUpdate& Update)
+	{
+		WriteValue<uint32>(Ar, Update.component_id);
+		if (Update.schema_type == nullptr)
+		{
+			WriteSchemaObject(Ar, nullptr);
+			WriteSchemaObject(Ar, nullptr);
+			WriteValue<uint32>(Ar, 0);
+			return;
+		}
+
+		WriteSchemaObject(Ar, Schema_GetComponentUpdateFields(Update.schema_type));
+		WriteSchemaObject(Ar, Schema_GetComponentUpdateEvents(Update.schema_type));
+
+		TArray<Schema_FieldId> ClearedFields;
+		ClearedFields.SetNumUninitialized(Schema_GetComponentUpdateClearedFieldCount(Update.schema_type));
+		Schema_GetComponentUpdateClearedFieldList(Update.schema_type, ClearedFields.GetData());
+		Ar << ClearedFields;
+	}
+
+	void WriteCommandRequest(FArchive& Ar, const Worker_CommandRequest& Request)
+	{
+		WriteValue<uint32>(Ar, Request.component_id);
+		WriteValue<uint32>(Ar, Request.command_index);
+		WriteSchemaObject(Ar, Request.schema_type != nullptr ? Schema_GetCommandRequestObject(Request.schema_type) : nullptr);
+	}
+
+	void WriteCommandResponse(FArchive& Ar, const Worker_CommandResponse& Response)
+	{
+		WriteValue<uint32>(Ar, Response.component_id);
+		WriteValue<uint32>(Ar, Response.command_index);
+		WriteSchemaObject(Ar, Response.schema_type != nullptr ? Schema_GetCommandResponseObject(Response.schema_type) : nullptr);
+	}
+} // anonymous namespace
+
+FRecordedOpList::~FRecordedOpList()
+{
+	for (Schema_ComponentData* Data : SchemaComponentData)
+	{
+		Schema_DestroyComponentData(Data);
+	}
+	for (Schema_ComponentUpdate* Update : SchemaComponentUpdates)
+	{
+		Schema_DestroyComponentUpdate(Update);
+	}
+	for (Schema_CommandRequest* Request : SchemaCommandRequests)
+	{
+		Schema_DestroyCommandRequest(Request);
+	}
+	for (Schema_CommandResponse* Response : SchemaCommandResponses)
+	{
+		Schema_DestroyCommandResponse(Response);
+	}
+}
+
+FOpListRecorder::FOpListRecorder()
+	: StartTime(0.0)
+{
+}
+
+FOpListRecorder::~FOpListRecorder()
+{
+	Close();
+}
+
+bool FOpListRecorder::Open(const FString& Filename, const FString& WorkerId, const TArray<FString>& WorkerAttributes)
+{
+	Close();
+
+	Archive.Reset(IFileManager::Get().CreateFileWriter(*Filename));
+	if (!Archive.IsValid())
+	{
+		UE_LOG(LogSpatialOpListRecording, Error, TEXT("Failed to open %s to record op lists."), *Filename);
+		return false;
+	}
+
+	WriteValue<uint32>(*Archive, RecordingMagic);
+	WriteValue<uint32>(*Archive, RecordingVersion);
+	WriteValue<FString>(*Archive, WorkerId);
+	WriteValue<TArray<FString>>(*Archive, WorkerAttributes);
+
+	StartTime = FPlatformTime::Seconds();
+
+	UE_LOG(LogSpatialOpListRecording, Log, TEXT("Recording op lists for worker %s to %s."), *WorkerId, *Filename);
+	return true;
+}
+
+void FOpListRecorder::Close()
+{
+	if (Archive.IsValid())
+	{
+		Archive->Close();
+		Archive.Reset();
+	}
+}
+
+int64 FOpListRecorder::GetBytesWritten() const
+{
+	return Archive.IsValid() ? Archive->Tell() : 0;
+}
+
+void FOpListRecorder::RecordOpList(const Worker_OpList& OpList)
+{
+	if (!Archive.IsValid())
+	{
+		return;
+	}
+
+	FArchive& Ar = *Archive;
+	WriteValue<uint8>(Ar, static_cast<uint8>(ERecordType::OpList));
+	WriteValue<double>(Ar, FPlatformTime::Seconds() - StartTime);
+	WriteValue<uint32>(Ar, OpList.op_count);
+
+	for (uint32 i = 0; i < OpList.op_count; i++)
+	{
+		WriteOp(OpList.ops[i]);
+	}
+}
+
+void FOpListRecorder::WriteOp(const Worker_Op& Op)
+{
+	FArchive& Ar = *Archive;
+	WriteValue<uint8>(Ar, Op.op_type);
+
+	switch (Op.op_type)
+	{
+	case WORKER_OP_TYPE_DISCONNECT:
+		WriteValue<uint8>(Ar, Op.op.disconnect.connection_status_code);
+		WriteString(Ar, Op.op.disconnect.reason);
+		break;
+	case WORKER_OP_TYPE_FLAG_UPDATE:
+		WriteString(Ar, Op.op.flag_update.name);
+		WriteString(Ar, Op.op.flag_update.value);
+		break;
+	case WORKER_OP_TYPE_LOG_MESSAGE:
+		WriteValue<uint8>(Ar, Op.op.log_message.level);
+		WriteString(Ar, Op.op.log_message.message);
+		break;
+	case WORKER_OP_TYPE_METRICS:
+	{
+		const Worker_Metrics& Metrics = Op.op.metrics.metrics;
+		WriteValue<bool>(Ar, Metrics.load != nullptr);
+		if (Metrics.load != nullptr)
+		{
+			WriteValue<double>(Ar, *Metrics.load);
+		}
+		WriteValue<uint32>(Ar, Metrics.gauge_metric_count);
+		for (uint32 i = 0; i < Metrics.gauge_metric_count; i++)
+		{
+			WriteString(Ar, Metrics.gauge_metrics[i].key);
+			WriteValue<double>(Ar, Metrics.gauge_metrics[i].value);
+		}
+		break;
+	}
+	case WORKER_OP_TYPE_CRITICAL_SECTION:
+		WriteValue<uint8>(Ar, Op.op.critical_section.in_critical_section);
+		break;
+	case WORKER_OP_TYPE_ADD_ENTITY:
+		WriteValue<int64>(Ar, Op.op.add_entity.entity_id);
+		break;
+	case WORKER_OP_TYPE_REMOVE_ENTITY:
+		WriteValue<int64>(Ar, Op.op.remove_entity.entity_id);
+		break;
+	case WORKER_OP_TYPE_RESERVE_ENTITY_IDS_RESPONSE:
+		WriteValue<int64>(Ar, Op.op.reserve_entity_ids_response.request_id);
+		WriteValue<uint8>(Ar, Op.op.reserve_entity_ids_response.status_code);
+		WriteString(Ar, Op.op.reserve_entity_ids_response.message);
+		WriteValue<int64>(Ar, Op.op.reserve_entity_ids_response.first_entity_id);
+		WriteValue<uint32>(Ar, Op.op.reserve_entity_ids_response.number_of_entity_ids);
+		break;
+	case WORKER_OP_TYPE_CREATE_ENTITY_RESPONSE:
+		WriteValue<int64>(Ar, Op.op.create_entity_response.request_id);
+		WriteValue<uint8>(Ar, Op.op.create_entity_response.status_code);
+		WriteString(Ar, Op.op.create_entity_response.message);
+		WriteValue<int64>(Ar, Op.op.create_entity_response.entity_id);
+		break;
+	case WORKER_OP_TYPE_DELETE_ENTITY_RESPONSE:
+		WriteValue<int64>(Ar, Op.op.delete_entity_response.request_id);
+		WriteValue<int64>(Ar, Op.op.delete_entity_response.entity_id);
+		WriteValue<uint8>(Ar, Op.op.delete_entity_response.status_code);
+		WriteString(Ar, Op.op.delete_entity_response.message);
+		break;
+	case WORKER_OP_TYPE_ENTITY_QUERY_RESPONSE:
+	{
+		const Worker_EntityQueryResponseOp& Response = Op.op.entity_query_response;
+		WriteValue<int64>(Ar, Response.request_id);
+		WriteValue<uint8>(Ar, Response.status_code);
+		WriteString(Ar, Response.message);
+		WriteValue<uint32>(Ar, Response.result_count);
+
+		// Count queries have a result count but no results.
+		WriteValue<bool>(Ar, Response.results != nullptr);
+		if (Response.results != nullptr)
+		{
+			for (uint32 i = 0; i < Response.result_count; i++)
+			{
+				const Worker_Entity& Entity = Response.results[i];
+				WriteValue<int64>(Ar, Entity.entity_id);
+				WriteValue<uint32>(Ar, Entity.component_count);
+				for (uint32 j = 0; j < Entity.component_count; j++)
+				{
+					WriteComponentData(Ar, Entity.components[j]);
+				}
+			}
+		}
+		break;
+	}
+	case WORKER_OP_TYPE_ADD_COMPONENT:
+		WriteValue<int64>(Ar, Op.op.add_component.entity_id);
+		WriteComponentData(Ar, Op.op.add_component.data);
+		break;
+	case WORKER_OP_TYPE_REMOVE_COMPONENT:
+		WriteValue<int64>(Ar, Op.op.remove_component.entity_id);
+		WriteValue<uint32>(Ar, Op.op.remove_component.component_id);
+		break;
+	case WORKER_OP_TYPE_AUTHORITY_CHANGE:
+		WriteValue<int64>(Ar, Op.op.authority_change.entity_id);
+		WriteValue<uint32>(Ar, Op.op.authority_change.component_id);
+		WriteValue<uint8>(Ar, Op.op.authority_change.authority);
+		break;
+	case WORKER_OP_TYPE_COMPONENT_UPDATE:
+		WriteValue<int64>(Ar, Op.op.component_update.entity_id);
+		WriteComponentUpdate(Ar, Op.op.component_update.update);
+		break;
+	case WORKER_OP_TYPE_COMMAND_REQUEST:
+	{
+		const Worker_CommandRequestOp& Request = Op.op.command_request;
+		WriteValue<int64>(Ar, Request.request_id);
+		WriteValue<int64>(Ar, Request.entity_id);
+		WriteValue<uint32>(Ar, Request.timeout_millis);
+		WriteString(Ar, Request.caller_worker_id);
+		WriteValue<uint32>(Ar, Request.caller_attribute_set.attribute_count);
+		for (uint32 i = 0; i < Request.caller_attribute_set.attribute_count; i++)
+		{
+			WriteString(Ar, Request.caller_attribute_set.attributes[i]);
+		}
+		WriteCommandRequest(Ar, Request.request);
+		break;
+	}
+	case WORKER_OP_TYPE_COMMAND_RESPONSE:
+	{
+		const Worker_CommandResponseOp& Response = Op.op.command_response;
+		WriteValue<int64>(Ar, Response.request_id);
+		WriteValue<int64>(Ar, Response.entity_id);
+		WriteValue<uint8>(Ar, Response.status_code);
+		WriteString(Ar, Response.message);
+		WriteValue<uint32>(Ar, Response.command_id);
+		WriteCommandResponse(Ar, Response.response);
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+void FOpListRecorder::RecordOutgoingMessage(const FOutgoingMessage& Message)
+{
+	if (!Archive.IsValid())
+	{
+		return;
+	}
+
+	int64 EntityId = 0;
+	uint32 ComponentId = 0;
+	TArray<uint8> Payload;
+	FMemoryWriter PayloadWriter(Payload);
+
+	switch (Message.Type)
+	{
+	case EOutgoingMessageType::CreateEntityRequest:
+	{
+		const FCreateEntityRequest& Request = static_cast<const FCreateEntityRequest&>(Message);
+		EntityId = Request.EntityId.Get(0);
+		WriteValue<int32>(PayloadWriter, Request.Components.Num());
+		for (const Worker_ComponentData& Data : Request.Components)
+		{
+			WriteComponentData(PayloadWriter, Data);
+		}
+		break;
+	}
+	case EOutgoingMessageType::DeleteEntityRequest:
+		EntityId = static_cast<const FDeleteEntityRequest&>(Message).EntityId;
+		break;
+	case EOutgoingMessageType::AddComponent:
+	{
+		const FAddComponent& AddComponent = static_cast<const FAddComponent&>(Message);
+		EntityId = AddComponent.EntityId;
+		ComponentId = AddComponent.Data.component_id;
+		WriteComponentData(PayloadWriter, AddComponent.Data);
+		break;
+	}
+	case EOutgoingMessageType::RemoveComponent:
+		EntityId = static_cast<const FRemoveComponent&>(Message).EntityId;
+		ComponentId = static_cast<const FRemoveComponent&>(Message).ComponentId;
+		break;
+	case EOutgoingMessageType::ComponentUpdate:
+	{
+		const FComponentUpdate& ComponentUpdate = static_cast<const FComponentUpdate&>(Message);
+		EntityId = ComponentUpdate.EntityId;
+		ComponentId = ComponentUpdate.Update.component_id;
+		WriteComponentUpdate(PayloadWriter, ComponentUpdate.Update);
+		break;
+	}
+	case EOutgoingMessageType::CommandRequest:
+	{
+		const FCommandRequest& Request = static_cast<const FCommandRequest&>(Message);
+		EntityId = Request.EntityId;
+		ComponentId = Request.Request.component_id;
+		WriteCommandRequest(PayloadWriter, Request.Request);
+		break;
+	}
+	case EOutgoingMessageType::CommandResponse:
+	{
+		const FCommandResponse& Response = static_cast<const FCommandResponse&>(Message);
+		ComponentId = Response.Response.component_id;
+		WriteCommandResponse(PayloadWriter, Response.Response);
+		break;
+	}
+	case EOutgoingMessageType::ComponentInterest:
+	{
+		const FComponentInterest& Interest = static_cast<const FComponentInterest&>(Message);
+		EntityId = Interest.EntityId;
+		WriteValue<int32>(PayloadWriter, Interest.Interests.Num());
+		for (const Worker_InterestOverride& Override : Interest.Interests)
+		{
+			WriteValue<uint32>(PayloadWriter, Override.component_id);
+			WriteValue<uint8>(PayloadWriter, Override.is_interested);
+		}
+		break;
+	}
+	default:
+		break;
+	}
+
+	FArchive& Ar = *Archive;
+	WriteValue<uint8>(Ar, static_cast<uint8>(ERecordType::OutgoingMessage));
+	WriteValue<double>(Ar, FPlatformTime::Seconds() - StartTime);
+	WriteValue<int32>(Ar, static_cast<int32>(Message.Type));
+	Ar << EntityId;
+	Ar << ComponentId;
+	Ar << Payload;
+}
+
+bool FOpListRecording::Load(const FString& Filename)
+{
+	OpLists.Empty();
+	OutgoingMessages.Empty();
+
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Filename))
+	{
+		UE_LOG(LogSpatialOpListRecording, Error, TEXT("Failed to read op list recording %s."), *Filename);
+		return false;
+	}
+
+	FMemoryReader Ar(Bytes);
+	if (ReadValue<uint32>(Ar) != RecordingMagic || ReadValue<uint32>(Ar) != RecordingVersion)
+	{
+		UE_LOG(LogSpatialOpListRecording, Error, TEXT("%s is not an op list recording, or was made by a different version of the GDK."), *Filename);
+		return false;
+	}
+
+	Ar << WorkerId;
+	Ar << WorkerAttributes;
+
+	while (!Ar.AtEnd() && !Ar.IsError())
+	{
+		const ERecordType RecordType = static_cast<ERecordType>(ReadValue<uint8>(Ar));
+		const double Time = ReadValue<double>(Ar);
+
+		if (RecordType == ERecordType::OpList)
+		{
+			TUniquePtr<FRecordedOpList> OpList = MakeUnique<FRecordedOpList>();
+			OpList->Time = Time;
+
+			const uint32 OpCount = ReadValue<uint32>(Ar);
+			for (uint32 i = 0; i < OpCount && !Ar.IsError(); i++)
+			{
+				Worker_Op Op;
+				FMemory::Memzero(Op);
+				if (ReadOp(Ar, *OpList, Op))
+				{
+					OpList->Ops.Add(Op);
+				}
+			}
+
+			// Op lists cut short by the worker exiting mid-write are dropped.
+			if (!Ar.IsError())
+			{
+				OpList->OpList.ops = OpList->Ops.GetData();
+				OpList->OpList.op_count = OpList->Ops.Num();
+				OpLists.Add(MoveTemp(OpList));
+			}
+		}
+		else if (RecordType == ERecordType::OutgoingMessage)
+		{
+			FRecordedOutgoingMessage& Message = OutgoingMessages.AddDefaulted_GetRef();
+			Message.Time = Time;
+			Message.Type = static_cast<EOutgoingMessageType>(ReadValue<int32>(Ar));
+			Message.EntityId = ReadValue<int64>(Ar);
+			Message.ComponentId = ReadValue<uint32>(Ar);
+			Ar << Message.Payload;
+
+			if (Ar.IsError())
+			{
+				OutgoingMessages.Pop();
+			}
+		}
+		else
+		{
+			Ar.SetError();
+		}
+	}
+
+	if (Ar.IsError())
+	{
+		UE_LOG(LogSpatialOpListRecording, Warning, TEXT("Op list recording %s is truncated or corrupt. Read %d op lists before the error."), *Filename, OpLists.Num());
+	}
+
+	return true;
+}
+
+bool FOpListRecording::ReadOp(FArchive& Ar, FRecordedOpList& OpList, Worker_Op& OutOp)
+{
+	auto ReadString = [&Ar, &OpList]() -> const char*
+	{
+		const int32 Length = ReadValue<int32>(Ar);
+		if (Length < 0)
+		{
+			return nullptr;
+		}
+		if (Length > Ar.TotalSize() - Ar.Tell())
+		{
+			Ar.SetError();
+			return nullptr;
+		}
+
+		TArray<ANSICHAR>& String = OpList.Strings.AddDefaulted_GetRef();
+		String.SetNumZeroed(Length + 1);
+		Ar.Serialize(String.GetData(), Length);
+		return String.GetData();
+	};
+
+	auto ReadComponentData = [&Ar, &OpList](Worker_ComponentData& OutData)
+	{
+		OutData.component_id = ReadValue<uint32>(Ar);
+		OutData.schema_type = Schema_CreateComponentData();
+		OpList.SchemaComponentData.Add(OutData.schema_type);
+		ReadSchemaObject(Ar, Schema_GetComponentDataFields(OutData.schema_type));
+	};
+
+	OutOp.op_type = ReadValue<uint8>(Ar);
+
+	switch (OutOp.op_type)
+	{
+	case WORKER_OP_TYPE_DISCONNECT:
+		OutOp.op.disconnect.connection_status_code = ReadValue<uint8>(Ar);
+		OutOp.op.disconnect.reason = ReadString();
+		break;
+	case WORKER_OP_TYPE_FLAG_UPDATE:
+		OutOp.op.flag_update.name = ReadString();
+		OutOp.op.flag_update.value = ReadString();
+		break;
+	case WORKER_OP_TYPE_LOG_MESSAGE:
+		OutOp.op.log_message.level = ReadValue<uint8>(Ar);
+		OutOp.op.log_message.message = ReadString();
+		break;
+	case WORKER_OP_TYPE_METRICS:
+	{
+		Worker_Metrics& Metrics = OutOp.op.metrics.metrics;
+		if (ReadValue<bool>(Ar))
+		{
+			Metrics.load = OpList.Loads.Add_GetRef(MakeUnique<double>(ReadValue<double>(Ar))).Get();
+		}
+
+		TArray<Worker_GaugeMetric>& GaugeMetrics = OpList.GaugeMetricLists.AddDefaulted_GetRef();
+		GaugeMetrics.SetNum(ReadValue<uint32>(Ar));
+		for (Worker_GaugeMetric& GaugeMetric : GaugeMetrics)
+		{
+			GaugeMetric.key = ReadString();
+			GaugeMetric.value = ReadValue<double>(Ar);
+		}
+		Metrics.gauge_metric_count = GaugeMetrics.Num();
+		Metrics.gauge_metrics = GaugeMetrics.GetData();
+		break;
+	}
+	case WORKER_OP_TYPE_CRITICAL_SECTION:
+		OutOp.op.critical_section.in_critical_section = ReadValue<uint8>(Ar);
+		break;
+	case WORKER_OP_TYPE_ADD_ENTITY:
+		OutOp.op.add_entity.entity_id = ReadValue<int64>(Ar);
+		break;
+	case WORKER_OP_TYPE_REMOVE_ENTITY:
+		OutOp.op.remove_entity.entity_id = ReadValue<int64>(Ar);
+		break;
+	case WORKER_OP_TYPE_RESERVE_ENTITY_IDS_RESPONSE:
+		OutOp.op.reserve_entity_ids_response.request_id = ReadValue<int64>(Ar);
+		OutOp.op.reserve_entity_ids_response.status_code = ReadValue<uint8>(Ar);
+		OutOp.op.reserve_entity_ids_response.message = ReadString();
+		OutOp.op.reserve_entity_ids_response.first_entity_id = ReadValue<int64>(Ar);
+		OutOp.op.reserve_entity_ids_response.number_of_entity_ids = ReadValue<uint32>(Ar);
+		break;
+	case WORKER_OP_TYPE_CREATE_ENTITY_RESPONSE:
+		OutOp.op.create_entity_response.request_id = ReadValue<int64>(Ar);
+		OutOp.op.create_entity_response.status_code = ReadValue<uint8>(Ar);
+		OutOp.op.create_entity_response.message = ReadString();
+		OutOp.op.create_entity_response.entity_id = ReadValue<int64>(Ar);
+		break;
+	case WORKER_OP_TYPE_DELETE_ENTITY_RESPONSE:
+		OutOp.op.delete_entity_response.request_id = ReadValue<int64>(Ar);
+		OutOp.op.delete_entity_response.entity_id = ReadValue<int64>(Ar);
+		OutOp.op.delete_entity_response.status_code = ReadValue<uint8>(Ar);
+		OutOp.op.delete_entity_response.message = ReadString();
+		break;
+	case WORKER_OP_TYPE_ENTITY_QUERY_RESPONSE:
+	{
+		Worker_EntityQueryResponseOp& Response = OutOp.op.entity_query_response;
+		Response.request_id = ReadValue<int64>(Ar);
+		Response.status_code = ReadValue<uint8>(Ar);
+		Response.message = ReadString();
+		Response.result_count = ReadValue<uint32>(Ar);
+		Response.results = nullptr;
+
+		if (ReadValue<bool>(Ar))
+		{
+			TArray<Worker_Entity>& Entities = OpList.EntityLists.AddDefaulted_GetRef();
+			Entities.SetNumZeroed(Response.result_count);
+			for (Worker_Entity& Entity : Entities)
+			{
+				Entity.entity_id = ReadValue<int64>(Ar);
+
+				TArray<Worker_ComponentData>& Components = OpList.ComponentDataLists.AddDefaulted_GetRef();
+				Components.SetNumZeroed(ReadValue<uint32>(Ar));
+				for (Worker_ComponentData& Data : Components)
+				{
+					ReadComponentData(Data);
+				}
+				Entity.component_count = Components.Num();
+				Entity.components = Components.GetData();
+			}
+			Response.results = Entities.GetData();
+		}
+		break;
+	}
+	case WORKER_OP_TYPE_ADD_COMPONENT:
+		OutOp.op.add_component.entity_id = ReadValue<int64>(Ar);
+		ReadComponentData(OutOp.op.add_component.data);
+		break;
+	case WORKER_OP_TYPE_REMOVE_COMPONENT:
+		OutOp.op.remove_component.entity_id = ReadValue<int64>(Ar);
+		OutOp.op.remove_component.component_id = ReadValue<uint32>(Ar);
+		break;
+	case WORKER_OP_TYPE_AUTHORITY_CHANGE:
+		OutOp.op.authority_change.entity_id = ReadValue<int64>(Ar);
+		OutOp.op.authority_change.component_id = ReadValue<uint32>(Ar);
+		OutOp.op.authority_change.authority = ReadValue<uint8>(Ar);
+		break;
+	case WORKER_OP_TYPE_COMPONENT_UPDATE:
+	{
+		Worker_ComponentUpdate& Update = OutOp.op.component_update.update;
+		OutOp.op.component_update.entity_id = ReadValue<int64>(Ar);
+		Update.component_id = ReadValue<uint32>(Ar);
+		Update.schema_type = Schema_CreateComponentUpdate();
+		OpList.SchemaComponentUpdates.Add(Update.schema_type);
+
+		ReadSchemaObject(Ar, Schema_GetComponentUpdateFields(Update.schema_type));
+		ReadSchemaObject(Ar, Schema_GetComponentUpdateEvents(Update.schema_type));
+
+		TArray<Schema_FieldId> ClearedFields;
+		Ar << ClearedFields;
+		for (Schema_FieldId FieldId : ClearedFields)
+		{
+			Schema_AddComponentUpdateClearedField(Update.schema_type, FieldId);
+		}
+		break;
+	}
+	case WORKER_OP_TYPE_COMMAND_REQUEST:
+	{
+		Worker_CommandRequestOp& Request = OutOp.op.command_request;
+		Request.request_id = ReadValue<int64>(Ar);
+		Request.entity_id = ReadValue<int64>(Ar);
+		Request.timeout_millis = ReadValue<uint32>(Ar);
+		Request.caller_worker_id = ReadString();
+
+		TArray<const char*>& Attributes = OpList.StringLists.AddDefaulted_GetRef();
+		Attributes.SetNum(ReadValue<uint32>(Ar));
+		for (const char*& Attribute : Attributes)
+		{
+			Attribute = ReadString();
+		}
+		Request.caller_attribute_set.attribute_count = Attributes.Num();
+		Request.caller_attribute_set.attributes = Attributes.GetData();
+
+		Request.request.component_id = ReadValue<uint32>(Ar);
+		Request.request.command_index = ReadValue<uint32>(Ar);
+		Request.request.schema_type = Schema_CreateCommandRequest();
+		OpList.SchemaCommandRequests.Add(Request.request.schema_type);
+		ReadSchemaObject(Ar, Schema_GetCommandRequestObject(Request.request.schema_type));
+		break;
+	}
+	case WORKER_OP_TYPE_COMMAND_RESPONSE:
+	{
+		Worker_CommandResponseOp& Response = OutOp.op.command_response;
+		Response.request_id = ReadValue<int64>(Ar);
+		Response.entity_id = ReadValue<int64>(Ar);
+		Response.status_code = ReadValue<uint8>(Ar);
+		Response.message = ReadString();
+		Response.command_id = ReadValue<uint32>(Ar);
+
+		Response.response.component_id = ReadValue<uint32>(Ar);
+		Response.response.command_index = ReadValue<uint32>(Ar);
+		Response.response.schema_type = Schema_CreateCommandResponse();
+		OpList.SchemaCommandResponses.Add(Response.response.schema_type);
+		ReadSchemaObject(Ar, Schema_GetCommandResponseObject(Response.response.schema_type));
+		break;
+	}
+	default:
+		UE_LOG(LogSpatialOpListRecording, Warning, TEXT("Unknown op type %d in op list recording."), OutOp.op_type);
+		Ar.SetError();
+		return false;
+	}
+
+	return !Ar.IsError();
+}
+
+void DiscardOutgoingMessage(FOutgoingMessage& Message)
+{
+	switch (Message.Type)
+	{
+	case EOutgoingMessageType::CreateEntityRequest:
+		for (Worker_ComponentData& Data : static_cast<FCreateEntityRequest&>(Message).Components)
+		{
+			Schema_DestroyComponentData(Data.schema_type);
+		}
+		break;
+	case EOutgoingMessageType::AddComponent:
+		Schema_DestroyComponentData(static_cast<FAddComponent&>(Message).Data.schema_type);
+		break;
+	case EOutgoingMessageType::ComponentUpdate:
+		Schema_DestroyComponentUpdate(static_cast<FComponentUpdate&>(Message).Update.schema_type);
+		break;
+	case EOutgoingMessageType::CommandRequest:
+		Schema_DestroyCommandRequest(static_cast<FCommandRequest&>(Message).Request.schema_type);
+		break;
+	case EOutgoingMessageType::CommandResponse:
+		Schema_DestroyCommandResponse(static_cast<FCommandResponse&>(Message).Response.schema_type);
+		break;
+	default:
+		break;
+	}
+}
+
+} // namespace SpatialGDK
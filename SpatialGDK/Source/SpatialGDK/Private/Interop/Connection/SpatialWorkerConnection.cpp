@@ -23,6 +23,9 @@ using namespace SpatialGDK;
 void USpatialWorkerConnection::Init(USpatialGameInstance* InGameInstance)
 {
 	GameInstance = InGameInstance;
+
+	const USpatialGDKSettings* Settings = GetDefault<USpatialGDKSettings>();
+	LogBuffer.SetLimits(Settings->MaxBufferedLogMessages, Settings->MaxLogMessagesPerCategoryPerSecond);
 }
 
 void USpatialWorkerConnection::FinishDestroy()
@@ -41,6 +44,16 @@ void USpatialWorkerConnection::DestroyConnection()
 		OpsProcessingThread = nullptr;
 	}
 
+	OpListRecorder.Close();
+
+	if (Replay.IsValid())
+	{
+		// Replayed op lists are owned by the recording, so none can be left in the queue once it is gone.
+		OpListQueue.Empty();
+		Replay.Reset();
+		NextReplayedOpList = 0;
+	}
+
 	if (WorkerConnection)
 	{
 		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WorkerConnection = WorkerConnection]
@@ -63,6 +76,7 @@ void USpatialWorkerConnection::DestroyConnection()
 
 	bIsConnected = false;
 	NextRequestId = 0;
+	RequestSendTimes.Empty();
 	KeepRunning.AtomicSet(true);
 }
 
@@ -74,6 +88,13 @@ void USpatialWorkerConnection::Connect(bool bInitAsClient, uint32 PlayInEditorID
 		return;
 	}
 
+	FString ReplayFilename;
+	if (FParse::Value(FCommandLine::Get(), TEXT("SpatialReplayOps="), ReplayFilename))
+	{
+		ConnectToReplay(ReplayFilename);
+		return;
+	}
+
 	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
 	if (SpatialGDKSettings->bUseDevelopmentAuthenticationFlow && bInitAsClient)
 	{
@@ -338,6 +359,26 @@ void USpatialWorkerConnection::FinishConnecting(Worker_ConnectionFuture* Connect
 	});
 }
 
+void USpatialWorkerConnection::ConnectToReplay(const FString& Filename)
+{
+	TUniquePtr<FOpListRecording> Recording = MakeUnique<FOpListRecording>();
+	if (!Recording->Load(Filename))
+	{
+		OnPreConnectionFailure(FString::Printf(TEXT("Failed to load op list recording %s"), *Filename));
+		return;
+	}
+
+	UE_LOG(LogSpatialWorkerConnection, Log, TEXT("Replaying %d op lists received by worker %s from %s. Nothing will be sent to SpatialOS."),
+		Recording->OpLists.Num(), *Recording->GetWorkerId(), *Filename);
+
+	CachedWorkerAttributes = Recording->GetWorkerAttributes();
+	Replay = MoveTemp(Recording);
+	NextReplayedOpList = 0;
+	ReplayStartTime = FPlatformTime::Seconds();
+
+	OnConnectionSuccess();
+}
+
 SpatialConnectionType USpatialWorkerConnection::GetConnectionType() const
 {
 	if (!LocatorConfig.PlayerIdentityToken.IsEmpty())
@@ -350,17 +391,22 @@ SpatialConnectionType USpatialWorkerConnection::GetConnectionType() const
 	}
 }
 
-TArray<Worker_OpList*> USpatialWorkerConnection::GetOpList()
+void USpatialWorkerConnection::GetOpLists(SpatialGDK::FOpListBatch& OutBatch)
 {
-	TArray<Worker_OpList*> OpLists;
-	while (!OpListQueue.IsEmpty())
+	Worker_OpList* OutOpList;
+	while (OpListQueue.Dequeue(OutOpList))
 	{
-		Worker_OpList* OutOpList;
-		OpListQueue.Dequeue(OutOpList);
-		OpLists.Add(OutOpList);
+		OutBatch.Add(OutOpList);
 	}
+}
 
-	return OpLists;
+void USpatialWorkerConnection::DestroyOpList(Worker_OpList* OpList)
+{
+	// Replayed op lists are owned by the recording.
+	if (!Replay.IsValid())
+	{
+		Worker_OpList_Destroy(OpList);
+	}
 }
 
 Worker_RequestId USpatialWorkerConnection::SendReserveEntityIdsRequest(uint32_t NumOfEntities)
@@ -372,6 +418,7 @@ Worker_RequestId USpatialWorkerConnection::SendReserveEntityIdsRequest(uint32_t
 Worker_RequestId USpatialWorkerConnection::SendCreateEntityRequest(TArray<Worker_ComponentData>&& Components, const Worker_EntityId* EntityId)
 {
 	QueueOutgoingMessage<FCreateEntityRequest>(MoveTemp(Components), EntityId);
+	RequestSendTimes.Add(NextRequestId, FPlatformTime::Seconds());
 	return NextRequestId++;
 }
 
@@ -399,6 +446,7 @@ void USpatialWorkerConnection::SendComponentUpdate(Worker_EntityId EntityId, con
 Worker_RequestId USpatialWorkerConnection::SendCommandRequest(Worker_EntityId EntityId, const Worker_CommandRequest* Request, uint32_t CommandId)
 {
 	QueueOutgoingMessage<FCommandRequest>(EntityId, *Request, CommandId);
+	RequestSendTimes.Add(NextRequestId, FPlatformTime::Seconds());
 	return NextRequestId++;
 }
 
@@ -412,9 +460,9 @@ void USpatialWorkerConnection::SendCommandFailure(Worker_RequestId RequestId, co
 	QueueOutgoingMessage<FCommandFailure>(RequestId, Message);
 }
 
-void USpatialWorkerConnection::SendLogMessage(const uint8_t Level, const FName& LoggerName, const TCHAR* Message)
+void USpatialWorkerConnection::SendLogMessage(const uint8_t Level, const FName& LoggerName, const TCHAR* Message, const FName& Category)
 {
-	QueueOutgoingMessage<FLogMessage>(Level, LoggerName, Message);
+	LogBuffer.Add(Level, LoggerName, Category, Message);
 }
 
 void USpatialWorkerConnection::SendComponentInterest(Worker_EntityId EntityId, TArray<Worker_InterestOverride>&& ComponentInterest)
@@ -435,6 +483,11 @@ void USpatialWorkerConnection::SendMetrics(const SpatialMetrics& Metrics)
 
 FString USpatialWorkerConnection::GetWorkerId() const
 {
+	if (Replay.IsValid())
+	{
+		return Replay->GetWorkerId();
+	}
+
 	return FString(UTF8_TO_TCHAR(Worker_Connection_GetWorkerId(WorkerConnection)));
 }
 
@@ -443,6 +496,18 @@ const TArray<FString>& USpatialWorkerConnection::GetWorkerAttributes() const
 	return CachedWorkerAttributes;
 }
 
+bool USpatialWorkerConnection::ConsumeRequestLatency(Worker_RequestId RequestId, double& OutSeconds)
+{
+	double SendTime;
+	if (!RequestSendTimes.RemoveAndCopyValue(RequestId, SendTime))
+	{
+		return false;
+	}
+
+	OutSeconds = FPlatformTime::Seconds() - SendTime;
+	return true;
+}
+
 void USpatialWorkerConnection::CacheWorkerAttributes()
 {
 	const Worker_WorkerAttributes* Attributes = Worker_Connection_GetWorkerAttributes(WorkerConnection);
@@ -466,6 +531,13 @@ void USpatialWorkerConnection::OnConnectionSuccess()
 
 	if (OpsProcessingThread == nullptr)
 	{
+		FString CaptureDirectory;
+		if (FParse::Value(FCommandLine::Get(), TEXT("SpatialCaptureOps="), CaptureDirectory))
+		{
+			const FString WorkerId = GetWorkerId();
+			OpListRecorder.Open(FPaths::Combine(CaptureDirectory, WorkerId + TEXT(".spatialops")), WorkerId, CachedWorkerAttributes);
+		}
+
 		InitializeOpsProcessingThread();
 	}
 
@@ -504,9 +576,18 @@ uint32 USpatialWorkerConnection::Run()
 	{
 		FPlatformProcess::Sleep(OpsUpdateInterval);
 
-		QueueLatestOpList();
+		if (Replay.IsValid())
+		{
+			QueueReplayedOpLists();
+		}
+		else
+		{
+			QueueLatestOpList();
+		}
 
 		ProcessOutgoingMessages();
+
+		FlushLogMessages();
 	}
 
 	return 0;
@@ -530,6 +611,7 @@ void USpatialWorkerConnection::QueueLatestOpList()
 	Worker_OpList* OpList = Worker_Connection_GetOpList(WorkerConnection, 0);
 	if (OpList->op_count > 0)
 	{
+		OpListRecorder.RecordOpList(*OpList);
 		OpListQueue.Enqueue(OpList);
 	}
 	else
@@ -538,6 +620,18 @@ void USpatialWorkerConnection::QueueLatestOpList()
 	}
 }
 
+void USpatialWorkerConnection::QueueReplayedOpLists()
+{
+	// Op lists are handed to the game thread at the same pace they were received.
+	const double ReplayTime = FPlatformTime::Seconds() - ReplayStartTime;
+	while (NextReplayedOpList < Replay->OpLists.Num() && Replay->OpLists[NextReplayedOpList]->Time <= ReplayTime)
+	{
+		Worker_OpList* OpList = Replay->OpLists[NextReplayedOpList++]->Get();
+		OpListRecorder.RecordOpList(*OpList);
+		OpListQueue.Enqueue(OpList);
+	}
+}
+
 void USpatialWorkerConnection::ProcessOutgoingMessages()
 {
 	while (!OutgoingMessagesQueue.IsEmpty())
@@ -545,6 +639,16 @@ void USpatialWorkerConnection::ProcessOutgoingMessages()
 		TUniquePtr<FOutgoingMessage> OutgoingMessage;
 		OutgoingMessagesQueue.Dequeue(OutgoingMessage);
 
+		OutgoingMessageLatency.Record(FPlatformTime::Seconds() - OutgoingMessage->EnqueueTime);
+
+		OpListRecorder.RecordOutgoingMessage(*OutgoingMessage);
+
+		if (Replay.IsValid())
+		{
+			DiscardOutgoingMessage(*OutgoingMessage);
+			continue;
+		}
+
 		static const Worker_UpdateParameters DisableLoopback{ /*loopback*/ WORKER_COMPONENT_UPDATE_LOOPBACK_NONE };
 
 		switch (OutgoingMessage->Type)
@@ -638,20 +742,6 @@ void USpatialWorkerConnection::ProcessOutgoingMessages()
 				TCHAR_TO_UTF8(*Message->Message));
 			break;
 		}
-		case EOutgoingMessageType::LogMessage:
-		{
-			FLogMessage* Message = static_cast<FLogMessage*>(OutgoingMessage.Get());
-
-			FTCHARToUTF8 LoggerName(*Message->LoggerName.ToString());
-			FTCHARToUTF8 LogString(*Message->Message);
-
-			Worker_LogMessage LogMessage{};
-			LogMessage.level = Message->Level;
-			LogMessage.logger_name = LoggerName.Get();
-			LogMessage.message = LogString.Get();
-			Worker_Connection_SendLogMessage(WorkerConnection, &LogMessage);
-			break;
-		}
 		case EOutgoingMessageType::ComponentInterest:
 		{
 			FComponentInterest* Message = static_cast<FComponentInterest*>(OutgoingMessage.Get());
@@ -694,6 +784,7 @@ void USpatialWorkerConnection::ProcessOutgoingMessages()
 			TArray<Worker_HistogramMetric> WorkerHistogramMetrics;
 			TArray<TArray<Worker_HistogramMetricBucket>> WorkerHistogramMetricBuckets;
 			WorkerHistogramMetrics.SetNum(Message->Metrics.HistogramMetrics.Num());
+			WorkerHistogramMetricBuckets.SetNum(Message->Metrics.HistogramMetrics.Num());
 			for (int i = 0; i < Message->Metrics.HistogramMetrics.Num(); i++)
 			{
 				WorkerHistogramMetrics[i].key = Message->Metrics.HistogramMetrics[i].Key.c_str();
@@ -725,10 +816,33 @@ void USpatialWorkerConnection::ProcessOutgoingMessages()
 	}
 }
 
+void USpatialWorkerConnection::FlushLogMessages()
+{
+	if (Replay.IsValid())
+	{
+		LogBuffer.Flush([](uint8 Level, const FName& LoggerName, const TCHAR* Message) {});
+		return;
+	}
+
+	LogBuffer.Flush([this](uint8 Level, const FName& LoggerName, const TCHAR* Message)
+	{
+		FTCHARToUTF8 LoggerNameUTF8(*LoggerName.ToString());
+		FTCHARToUTF8 MessageUTF8(Message);
+
+		Worker_LogMessage LogMessage{};
+		LogMessage.level = Level;
+		LogMessage.logger_name = LoggerNameUTF8.Get();
+		LogMessage.message = MessageUTF8.Get();
+		Worker_Connection_SendLogMessage(WorkerConnection, &LogMessage);
+	});
+}
+
 template <typename T, typename... ArgsType>
 void USpatialWorkerConnection::QueueOutgoingMessage(ArgsType&&... Args)
 {
 	// TODO UNR-1271: As later optimization, we can change the queue to hold a union
 	// of all outgoing message types, rather than having a pointer.
-	OutgoingMessagesQueue.Enqueue(MakeUnique<T>(Forward<ArgsType>(Args)...));
+	TUniquePtr<FOutgoingMessage> Message = MakeUnique<T>(Forward<ArgsType>(Args)...);
+	Message->EnqueueTime = FPlatformTime::Seconds();
+	OutgoingMessagesQueue.Enqueue(MoveTemp(Message));
 }
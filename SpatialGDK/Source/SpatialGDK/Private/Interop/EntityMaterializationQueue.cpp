@@ -0,0 +1,196 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/EntityMaterializationQueue.h"
+
+#include "HAL/PlatformTime.h"
+
+namespace SpatialGDK
+{
+
+void FEntityMaterializationQueue::SetClassPriority(const FSoftObjectPath& ClassPath, int32 Priority)
+{
+	ClassPriorities.Add(ClassPath, Priority);
+}
+
+int32 FEntityMaterializationQueue::GetClassPriority(const FString& ClassPath) const
+{
+	if (ClassPriorities.Num() == 0)
+	{
+		return 0;
+	}
+
+	const int32* Priority = ClassPriorities.Find(FSoftObjectPath(ClassPath));
+	return Priority != nullptr ? *Priority : 0;
+}
+
+FEntityMaterializationQueue::FQueuedEntity& FEntityMaterializationQueue::Add(Worker_EntityId EntityId, int32 ClassPriority, float DistanceSquared, TArray<PendingAddComponentWrapper>&& Components)
+{
+	// An entity re-entering view while still parked replaces its old entry.
+	Remove(EntityId);
+
+	FQueuedEntity& Queued = Entries.Add(EntityId);
+	Queued.Sequence = NextSequence++;
+	Queued.ClassPriority = ClassPriority;
+	Queued.DistanceSquared = DistanceSquared;
+	Queued.bParked = false;
+	Queued.Entry.EntityId = EntityId;
+	Queued.Entry.EnqueueTime = FPlatformTime::Seconds();
+	Queued.Entry.Components = MoveTemp(Components);
+	return Queued;
+}
+
+void FEntityMaterializationQueue::Enqueue(Worker_EntityId EntityId, int32 ClassPriority, float DistanceSquared, TArray<PendingAddComponentWrapper>&& Components)
+{
+	const FQueuedEntity& Queued = Add(EntityId, ClassPriority, DistanceSquared, MoveTemp(Components));
+
+	Heap.HeapPush(FHeapNode{ ClassPriority, DistanceSquared, Queued.Sequence, EntityId });
+}
+
+bool FEntityMaterializationQueue::Park(Worker_EntityId EntityId, const FSoftObjectPath& ClassPath, int32 ClassPriority, float DistanceSquared, TArray<PendingAddComponentWrapper>&& Components)
+{
+	FQueuedEntity& Queued = Add(EntityId, ClassPriority, DistanceSquared, MoveTemp(Components));
+	Queued.bParked = true;
+	NumParkedEntities++;
+
+	bool bAlreadyLoading = true;
+	FLoadingClass* LoadingClass = LoadingClasses.Find(ClassPath);
+	if (LoadingClass == nullptr)
+	{
+		bAlreadyLoading = false;
+		LoadingClass = &LoadingClasses.Add(ClassPath);
+		LoadingClass->StartTime = Queued.Entry.EnqueueTime;
+	}
+
+	LoadingClass->Entities.Emplace(EntityId, Queued.Sequence);
+	return !bAlreadyLoading;
+}
+
+void FEntityMaterializationQueue::OnClassLoaded(const FSoftObjectPath& ClassPath)
+{
+	FLoadingClass LoadingClass;
+	if (!LoadingClasses.RemoveAndCopyValue(ClassPath, LoadingClass))
+	{
+		return;
+	}
+
+	ClassLoadTime.Record(FPlatformTime::Seconds() - LoadingClass.StartTime);
+
+	for (const TPair<Worker_EntityId, uint32>& Parked : LoadingClass.Entities)
+	{
+		FQueuedEntity* Queued = Entries.Find(Parked.Key);
+		if (Queued == nullptr || Queued->Sequence != Parked.Value || !Queued->bParked)
+		{
+			continue;
+		}
+
+		Queued->bParked = false;
+		NumParkedEntities--;
+
+		Heap.HeapPush(FHeapNode{ Queued->ClassPriority, Queued->DistanceSquared, Queued->Sequence, Parked.Key });
+	}
+}
+
+bool FEntityMaterializationQueue::AddComponent(Worker_EntityId EntityId, const Worker_ComponentData& Data)
+{
+	FQueuedEntity* Queued = Entries.Find(EntityId);
+	if (Queued == nullptr)
+	{
+		return false;
+	}
+
+	Queued->Entry.Components.Emplace(EntityId, Data.component_id, Data);
+	return true;
+}
+
+bool FEntityMaterializationQueue::RemoveComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId)
+{
+	FQueuedEntity* Queued = Entries.Find(EntityId);
+	if (Queued == nullptr)
+	{
+		return false;
+	}
+
+	Queued->Entry.Components.RemoveAll([ComponentId](const PendingAddComponentWrapper& Component)
+	{
+		return Component.ComponentId == ComponentId;
+	});
+	return true;
+}
+
+bool FEntityMaterializationQueue::AddUpdate(Worker_EntityId EntityId, const Worker_ComponentUpdate& Update)
+{
+	FQueuedEntity* Queued = Entries.Find(EntityId);
+	if (Queued == nullptr)
+	{
+		return false;
+	}
+
+	Queued->Entry.Updates.Emplace(Update);
+	return true;
+}
+
+bool FEntityMaterializationQueue::Remove(Worker_EntityId EntityId)
+{
+	FQueuedEntity* Queued = Entries.Find(EntityId);
+	if (Queued == nullptr)
+	{
+		return false;
+	}
+
+	if (Queued->bParked)
+	{
+		NumParkedEntities--;
+	}
+
+	Entries.Remove(EntityId);
+	return true;
+}
+
+void FEntityMaterializationQueue::TakeEntry(Worker_EntityId EntityId, FQueuedEntity& Queued, FEntry& OutEntry)
+{
+	if (Queued.bParked)
+	{
+		NumParkedEntities--;
+	}
+
+	OutEntry = MoveTemp(Queued.Entry);
+	Entries.Remove(EntityId);
+
+	WaitTime.Record(FPlatformTime::Seconds() - OutEntry.EnqueueTime);
+}
+
+bool FEntityMaterializationQueue::Pop(FEntry& OutEntry)
+{
+	while (Heap.Num() > 0)
+	{
+		FHeapNode Node;
+		Heap.HeapPop(Node, /* bAllowShrinking */ false);
+
+		FQueuedEntity* Queued = Entries.Find(Node.EntityId);
+		if (Queued == nullptr || Queued->Sequence != Node.Sequence)
+		{
+			continue;
+		}
+
+		TakeEntry(Node.EntityId, *Queued, OutEntry);
+		return true;
+	}
+
+	// Every queued entity that isn't parked has a heap node, so an empty heap means only parked entities are left.
+	check(Entries.Num() == NumParkedEntities);
+	return false;
+}
+
+bool FEntityMaterializationQueue::Pop(Worker_EntityId EntityId, FEntry& OutEntry)
+{
+	FQueuedEntity* Queued = Entries.Find(EntityId);
+	if (Queued == nullptr)
+	{
+		return false;
+	}
+
+	TakeEntry(EntityId, *Queued, OutEntry);
+	return true;
+}
+
+} // namespace SpatialGDK
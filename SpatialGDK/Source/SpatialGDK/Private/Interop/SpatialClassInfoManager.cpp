@@ -27,16 +27,227 @@ bool USpatialClassInfoManager::TryInit(USpatialNetDriver* InNetDriver, UActorGro
 	NetDriver = InNetDriver;
 	ActorGroupManager = InActorGroupManager;
 
+	if (GetDefault<USpatialGDKSettings>()->bUseCompactSchemaDatabase && LoadCompactSchemaDatabase())
+	{
+		InitComponentInfoTable();
+		return true;
+	}
+
+	const double LoadStartTime = FPlatformTime::Seconds();
+
 	FSoftObjectPath SchemaDatabasePath = FSoftObjectPath(FPaths::SetExtension(SpatialConstants::SCHEMA_DATABASE_ASSET_PATH, TEXT(".SchemaDatabase")));
-	SchemaDatabase = Cast<USchemaDatabase>(SchemaDatabasePath.TryLoad());
+	USchemaDatabase* LoadedSchemaDatabase = Cast<USchemaDatabase>(SchemaDatabasePath.TryLoad());
 
-	if (SchemaDatabase == nullptr)
+	if (LoadedSchemaDatabase == nullptr)
 	{
 		UE_LOG(LogSpatialClassInfoManager, Error, TEXT("SchemaDatabase not found! Please generate schema or turn off SpatialOS networking."));
 		QuitGame();
 		return false;
 	}
 
+	UE_LOG(LogSpatialClassInfoManager, Log, TEXT("Loaded SchemaDatabase asset in %.2fms"), (FPlatformTime::Seconds() - LoadStartTime) * 1000.0);
+
+	InitWithSchemaDatabase(InNetDriver, InActorGroupManager, LoadedSchemaDatabase);
+	return true;
+}
+
+void USpatialClassInfoManager::InitWithSchemaDatabase(USpatialNetDriver* InNetDriver, UActorGroupManager* InActorGroupManager, USchemaDatabase* InSchemaDatabase)
+{
+	NetDriver = InNetDriver;
+	ActorGroupManager = InActorGroupManager;
+	SchemaDatabase = InSchemaDatabase;
+
+	InitComponentInfoTable();
+}
+
+void USpatialClassInfoManager::InitComponentInfoTable()
+{
+	if (CompactSchemaDatabase.IsLoaded())
+	{
+		ComponentInfoTable.Init(SpatialConstants::STARTING_GENERATED_COMPONENT_ID, CompactSchemaDatabase.GetHeader().NextAvailableComponentId);
+		CompactSchemaDatabase.ForEachLevelComponentId([this](Worker_ComponentId ComponentId)
+		{
+			ComponentInfoTable.MarkSublevel(ComponentId);
+		});
+	}
+	else
+	{
+		ComponentInfoTable.Init(SpatialConstants::STARTING_GENERATED_COMPONENT_ID, SchemaDatabase->NextAvailableComponentId);
+		for (uint32 ComponentId : SchemaDatabase->LevelComponentIds)
+		{
+			ComponentInfoTable.MarkSublevel(ComponentId);
+		}
+	}
+}
+
+TArray<FSoftObjectPath> USpatialClassInfoManager::GatherWarmUpClassPaths() const
+{
+	TSet<FString> ClassPaths;
+
+	const TArray<FSoftClassPath>& ConfiguredClasses = GetDefault<USpatialGDKSettings>()->ClassInfoWarmUpClasses;
+	if (ConfiguredClasses.Num() == 0)
+	{
+		if (CompactSchemaDatabase.IsLoaded())
+		{
+			CompactSchemaDatabase.ForEachClassPath([&ClassPaths](const FString& ClassPath)
+			{
+				ClassPaths.Add(ClassPath);
+			});
+		}
+		else
+		{
+			for (const auto& ActorSchemaPair : SchemaDatabase->ActorClassPathToSchema)
+			{
+				ClassPaths.Add(ActorSchemaPair.Key);
+			}
+			for (const auto& SubobjectSchemaPair : SchemaDatabase->SubobjectClassPathToSchema)
+			{
+				ClassPaths.Add(SubobjectSchemaPair.Key);
+			}
+		}
+	}
+	else
+	{
+		for (const FSoftClassPath& ConfiguredClass : ConfiguredClasses)
+		{
+			const FString ClassPath = ConfiguredClass.ToString();
+			if (!IsSupportedClass(ClassPath))
+			{
+				UE_LOG(LogSpatialClassInfoManager, Warning, TEXT("Class %s is configured to be warmed up, but is not in the schema database."), *ClassPath);
+				continue;
+			}
+
+			ClassPaths.Add(ClassPath);
+
+			// Building an actor's class info also resolves its subobject classes, so load those ahead of time too.
+			if (CompactSchemaDatabase.IsLoaded())
+			{
+				if (const SpatialGDK::FCompactSchemaDatabase::FActorRecord* ActorRecord = CompactSchemaDatabase.FindActor(ClassPath))
+				{
+					CompactSchemaDatabase.ForEachActorSubobject(*ActorRecord, [this, &ClassPaths](const SpatialGDK::FCompactSchemaDatabase::FActorSubobjectRecord& Subobject)
+					{
+						ClassPaths.Add(CompactSchemaDatabase.GetString(Subobject.ClassPathId));
+					});
+				}
+			}
+			else if (const FActorSchemaData* ActorSchemaData = SchemaDatabase->ActorClassPathToSchema.Find(ClassPath))
+			{
+				for (const auto& SubobjectDataPair : ActorSchemaData->SubobjectData)
+				{
+					ClassPaths.Add(SubobjectDataPair.Value.ClassPath);
+				}
+			}
+		}
+	}
+
+	TArray<FSoftObjectPath> SoftObjectPaths;
+	SoftObjectPaths.Reserve(ClassPaths.Num());
+	for (const FString& ClassPath : ClassPaths)
+	{
+		SoftObjectPaths.Emplace(ClassPath);
+	}
+	return SoftObjectPaths;
+}
+
+void USpatialClassInfoManager::StartWarmUp()
+{
+	if (!GetDefault<USpatialGDKSettings>()->bWarmUpClassInfo || WarmUpHandle.IsValid())
+	{
+		return;
+	}
+
+	WarmUpClassPaths = GatherWarmUpClassPaths();
+	NextWarmUpClass = 0;
+	bWarmUpClassesLoaded = false;
+	WarmUpStartTime = FPlatformTime::Seconds();
+	WarmUpBuildSeconds = 0.0;
+	WarmUpFrames = 0;
+
+	if (WarmUpClassPaths.Num() == 0)
+	{
+		return;
+	}
+
+	// Packages are loaded on the async loading thread where it is enabled. Class info reflects over UObjects, so it is built on the game thread.
+	WarmUpHandle = StreamableManager.RequestAsyncLoad(WarmUpClassPaths, FStreamableDelegate::CreateUObject(this, &USpatialClassInfoManager::OnWarmUpClassesLoaded));
+	if (!WarmUpHandle.IsValid())
+	{
+		// Every class was already loaded, or none could be found.
+		OnWarmUpClassesLoaded();
+	}
+}
+
+void USpatialClassInfoManager::OnWarmUpClassesLoaded()
+{
+	bWarmUpClassesLoaded = true;
+	WarmUpLoadSeconds = FPlatformTime::Seconds() - WarmUpStartTime;
+
+	UE_LOG(LogSpatialClassInfoManager, Log, TEXT("Loaded %d classes to warm up in %.2fms"), WarmUpClassPaths.Num(), WarmUpLoadSeconds * 1000.0);
+
+	if (GetDefault<USpatialGDKSettings>()->ClassInfoWarmUpBudgetMs <= 0.f)
+	{
+		TickWarmUp();
+	}
+}
+
+void USpatialClassInfoManager::TickWarmUp()
+{
+	if (!bWarmUpClassesLoaded || NextWarmUpClass >= WarmUpClassPaths.Num())
+	{
+		return;
+	}
+
+	const float BudgetMs = GetDefault<USpatialGDKSettings>()->ClassInfoWarmUpBudgetMs;
+	const double StartTime = FPlatformTime::Seconds();
+	const double EndTime = BudgetMs > 0.f ? StartTime + BudgetMs / 1000.0 : DBL_MAX;
+
+	do
+	{
+		const FSoftObjectPath& ClassPath = WarmUpClassPaths[NextWarmUpClass++];
+		if (UClass* Class = Cast<UClass>(ClassPath.ResolveObject()))
+		{
+			GetOrCreateClassInfoByClass(Class);
+		}
+		else
+		{
+			UE_LOG(LogSpatialClassInfoManager, Warning, TEXT("Failed to load class %s to warm up."), *ClassPath.ToString());
+		}
+	}
+	while (NextWarmUpClass < WarmUpClassPaths.Num() && FPlatformTime::Seconds() < EndTime);
+
+	WarmUpBuildSeconds += FPlatformTime::Seconds() - StartTime;
+	WarmUpFrames++;
+
+	if (NextWarmUpClass >= WarmUpClassPaths.Num())
+	{
+		UE_LOG(LogSpatialClassInfoManager, Log, TEXT("Warmed up %d classes in %.2fms: %.2fms loading, then %.2fms building class info over %d frames"),
+			WarmUpClassPaths.Num(), (FPlatformTime::Seconds() - WarmUpStartTime) * 1000.0, WarmUpLoadSeconds * 1000.0, WarmUpBuildSeconds * 1000.0, WarmUpFrames);
+	}
+}
+
+bool USpatialClassInfoManager::LoadCompactSchemaDatabase()
+{
+	const double LoadStartTime = FPlatformTime::Seconds();
+	const FString Filename = SpatialGDK::FCompactSchemaDatabase::GetDefaultFilename();
+
+	if (!CompactSchemaDatabase.LoadFromFile(Filename))
+	{
+		UE_LOG(LogSpatialClassInfoManager, Log, TEXT("No usable compact schema database at %s, falling back to the SchemaDatabase asset."), *Filename);
+		return false;
+	}
+
+	// Cooked builds have no package file to compare against, so they use the baked file staged alongside the cooked asset.
+	const FString AssetFilename = SpatialGDK::FCompactSchemaDatabase::GetSchemaDatabaseAssetFilename();
+	if (FPaths::FileExists(AssetFilename) && !CompactSchemaDatabase.IsBakedFrom(FMD5Hash::HashFile(*AssetFilename)))
+	{
+		UE_LOG(LogSpatialClassInfoManager, Warning, TEXT("Compact schema database at %s is out of date with %s, falling back to the SchemaDatabase asset. Regenerate schema to rebuild it."), *Filename, *AssetFilename);
+		CompactSchemaDatabase.Reset();
+		return false;
+	}
+
+	UE_LOG(LogSpatialClassInfoManager, Log, TEXT("Loaded compact schema database (%u bytes, %u actor classes) in %.2fms"),
+		CompactSchemaDatabase.GetSize(), CompactSchemaDatabase.GetHeader().NumActors, (FPlatformTime::Seconds() - LoadStartTime) * 1000.0);
+
 	return true;
 }
 
@@ -150,8 +361,10 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 				HandoverInfo.Offset = Property->GetOffset_ForGC() + Property->ElementSize * ArrayIdx;
 				HandoverInfo.ArrayIdx = ArrayIdx;
 				HandoverInfo.Property = Property;
+				HandoverInfo.bPlainOldData = (Property->PropertyFlags & CPF_IsPlainOldData) && !Property->IsA<UBoolProperty>();
 
 				Info->HandoverProperties.Add(HandoverInfo);
+				Info->SerializationPlan.Handover.Add(SpatialGDK::CompilePropertyStep(Property, HandoverInfo.Offset));
 			}
 		}
 
@@ -168,6 +381,14 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 		}
 	}
 
+	if (NetDriver != nullptr)
+	{
+		if (TSharedPtr<FRepLayout> RepLayout = NetDriver->GetObjectClassRepLayout(Class))
+		{
+			Info->SerializationPlan.CompileReplicated(*RepLayout);
+		}
+	}
+
 	if (Class->IsChildOf<AActor>())
 	{
 		FinishConstructingActorClassInfo(ClassPath, Info);
@@ -180,9 +401,20 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 
 void USpatialClassInfoManager::FinishConstructingActorClassInfo(const FString& ClassPath, TSharedRef<FClassInfo>& Info)
 {
+	const uint32* SchemaComponents = nullptr;
+	if (CompactSchemaDatabase.IsLoaded())
+	{
+		SchemaComponents = CompactSchemaDatabase.FindActorSchemaComponents(ClassPath);
+	}
+	else
+	{
+		SchemaComponents = SchemaDatabase->ActorClassPathToSchema[ClassPath].SchemaComponents;
+	}
+	check(SchemaComponents != nullptr);
+
 	ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
 	{
-		Worker_ComponentId ComponentId = SchemaDatabase->ActorClassPathToSchema[ClassPath].SchemaComponents[Type];
+		Worker_ComponentId ComponentId = SchemaComponents[Type];
 
 		if (!GetDefault<USpatialGDKSettings>()->bEnableHandover && Type == SCHEMA_Handover)
 		{
@@ -192,48 +424,27 @@ void USpatialClassInfoManager::FinishConstructingActorClassInfo(const FString& C
 		if (ComponentId != SpatialConstants::INVALID_COMPONENT_ID)
 		{
 			Info->SchemaComponents[Type] = ComponentId;
-			ComponentToClassInfoMap.Add(ComponentId, Info);
-			ComponentToOffsetMap.Add(ComponentId, 0);
-			ComponentToCategoryMap.Add(ComponentId, (ESchemaComponentType)Type);
+			ComponentInfoTable.SetClassInfo(ComponentId, Info, 0, Type);
 		}
 	});
 
-	for (auto& SubobjectClassDataPair : SchemaDatabase->ActorClassPathToSchema[ClassPath].SubobjectData)
+	if (CompactSchemaDatabase.IsLoaded())
 	{
-		int32 Offset = SubobjectClassDataPair.Key;
-		FActorSpecificSubobjectSchemaData SubobjectSchemaData = SubobjectClassDataPair.Value;
-
-		UClass* SubobjectClass = ResolveClass(SubobjectSchemaData.ClassPath);
-		if (SubobjectClass == nullptr)
-		{
-			UE_LOG(LogSpatialClassInfoManager, Error, TEXT("Failed to resolve the class for subobject %s (class path: %s) on actor class %s! This subobject will not be able to replicate in Spatial!"), *SubobjectSchemaData.Name.ToString(), *SubobjectSchemaData.ClassPath, *ClassPath);
-			continue;
-		}
-
-		const FClassInfo& SubobjectInfo = GetOrCreateClassInfoByClass(SubobjectClass);
-
-		// Make a copy of the already made FClassInfo for this specific subobject
-		TSharedRef<FClassInfo> ActorSubobjectInfo = MakeShared<FClassInfo>(SubobjectInfo);
-		ActorSubobjectInfo->SubobjectName = SubobjectSchemaData.Name;
-
-		ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
+		const SpatialGDK::FCompactSchemaDatabase::FActorRecord* ActorRecord = CompactSchemaDatabase.FindActor(ClassPath);
+		CompactSchemaDatabase.ForEachActorSubobject(*ActorRecord, [&](const SpatialGDK::FCompactSchemaDatabase::FActorSubobjectRecord& Subobject)
 		{
-			if (!GetDefault<USpatialGDKSettings>()->bEnableHandover && Type == SCHEMA_Handover)
-			{
-				return;
-			}
-
-			Worker_ComponentId ComponentId = SubobjectSchemaData.SchemaComponents[Type];
-			if (ComponentId != 0)
-			{
-				ActorSubobjectInfo->SchemaComponents[Type] = ComponentId;
-				ComponentToClassInfoMap.Add(ComponentId, ActorSubobjectInfo);
-				ComponentToOffsetMap.Add(ComponentId, Offset);
-				ComponentToCategoryMap.Add(ComponentId, ESchemaComponentType(Type));
-			}
+			FinishConstructingActorSubobjectClassInfo(ClassPath, Info, Subobject.Offset, CompactSchemaDatabase.GetString(Subobject.ClassPathId),
+				CompactSchemaDatabase.GetName(Subobject.NameId), Subobject.SchemaComponents);
 		});
-
-		Info->SubobjectInfo.Add(Offset, ActorSubobjectInfo);
+	}
+	else
+	{
+		for (auto& SubobjectClassDataPair : SchemaDatabase->ActorClassPathToSchema[ClassPath].SubobjectData)
+		{
+			const FActorSpecificSubobjectSchemaData& SubobjectSchemaData = SubobjectClassDataPair.Value;
+			FinishConstructingActorSubobjectClassInfo(ClassPath, Info, SubobjectClassDataPair.Key, SubobjectSchemaData.ClassPath,
+				SubobjectSchemaData.Name, SubobjectSchemaData.SchemaComponents);
+		}
 	}
 
 	if (UClass* ActorClass = Info->Class.Get())
@@ -249,36 +460,95 @@ void USpatialClassInfoManager::FinishConstructingActorClassInfo(const FString& C
 	}
 }
 
-void USpatialClassInfoManager::FinishConstructingSubobjectClassInfo(const FString& ClassPath, TSharedRef<FClassInfo>& Info)
+void USpatialClassInfoManager::FinishConstructingActorSubobjectClassInfo(const FString& ActorClassPath, TSharedRef<FClassInfo>& Info, uint32 Offset, FString SubobjectClassPath, FName SubobjectName, const uint32* SubobjectSchemaComponents)
 {
-	for (const auto& DynamicSubobjectData : SchemaDatabase->SubobjectClassPathToSchema[ClassPath].DynamicSubobjectComponents)
+	UClass* SubobjectClass = ResolveClass(SubobjectClassPath);
+	if (SubobjectClass == nullptr)
 	{
-		// Make a copy of the already made FClassInfo for this dynamic subobject
-		TSharedRef<FClassInfo> SpecificDynamicSubobjectInfo = MakeShared<FClassInfo>(Info.Get());
+		UE_LOG(LogSpatialClassInfoManager, Error, TEXT("Failed to resolve the class for subobject %s (class path: %s) on actor class %s! This subobject will not be able to replicate in Spatial!"), *SubobjectName.ToString(), *SubobjectClassPath, *ActorClassPath);
+		return;
+	}
+
+	const FClassInfo& SubobjectInfo = GetOrCreateClassInfoByClass(SubobjectClass);
 
-		int32 Offset = DynamicSubobjectData.SchemaComponents[SCHEMA_Data];
-		check(Offset != SpatialConstants::INVALID_COMPONENT_ID);
+	// Make a copy of the already made FClassInfo for this specific subobject
+	TSharedRef<FClassInfo> ActorSubobjectInfo = MakeShared<FClassInfo>(SubobjectInfo);
+	ActorSubobjectInfo->SubobjectName = SubobjectName;
 
-		ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
+	ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
+	{
+		if (!GetDefault<USpatialGDKSettings>()->bEnableHandover && Type == SCHEMA_Handover)
 		{
-			Worker_ComponentId ComponentId = DynamicSubobjectData.SchemaComponents[Type];
+			return;
+		}
 
-			if (ComponentId != SpatialConstants::INVALID_COMPONENT_ID)
-			{
-				SpecificDynamicSubobjectInfo->SchemaComponents[Type] = ComponentId;
-				ComponentToClassInfoMap.Add(ComponentId, SpecificDynamicSubobjectInfo);
-				ComponentToOffsetMap.Add(ComponentId, Offset);
-				ComponentToCategoryMap.Add(ComponentId, ESchemaComponentType(Type));
-			}
-		});
+		Worker_ComponentId ComponentId = SubobjectSchemaComponents[Type];
+		if (ComponentId != 0)
+		{
+			ActorSubobjectInfo->SchemaComponents[Type] = ComponentId;
+			ComponentInfoTable.SetClassInfo(ComponentId, ActorSubobjectInfo, Offset, Type);
+		}
+	});
+
+	Info->SubobjectInfo.Add(Offset, ActorSubobjectInfo);
+}
 
-		Info->DynamicSubobjectInfo.Add(SpecificDynamicSubobjectInfo);
+void USpatialClassInfoManager::FinishConstructingSubobjectClassInfo(const FString& ClassPath, TSharedRef<FClassInfo>& Info)
+{
+	if (CompactSchemaDatabase.IsLoaded())
+	{
+		const SpatialGDK::FCompactSchemaDatabase::FSubobjectClassRecord* SubobjectRecord = CompactSchemaDatabase.FindSubobjectClass(ClassPath);
+		check(SubobjectRecord != nullptr);
+		CompactSchemaDatabase.ForEachDynamicSubobject(*SubobjectRecord, [&](const SpatialGDK::FCompactSchemaDatabase::FDynamicSubobjectRecord& DynamicSubobject)
+		{
+			AddDynamicSubobjectClassInfo(Info, DynamicSubobject.SchemaComponents);
+		});
+	}
+	else
+	{
+		for (const auto& DynamicSubobjectData : SchemaDatabase->SubobjectClassPathToSchema[ClassPath].DynamicSubobjectComponents)
+		{
+			AddDynamicSubobjectClassInfo(Info, DynamicSubobjectData.SchemaComponents);
+		}
 	}
 }
 
+void USpatialClassInfoManager::AddDynamicSubobjectClassInfo(TSharedRef<FClassInfo>& Info, const uint32* DynamicSubobjectSchemaComponents)
+{
+	// Make a copy of the already made FClassInfo for this dynamic subobject
+	TSharedRef<FClassInfo> SpecificDynamicSubobjectInfo = MakeShared<FClassInfo>(Info.Get());
+
+	int32 Offset = DynamicSubobjectSchemaComponents[SCHEMA_Data];
+	check(Offset != SpatialConstants::INVALID_COMPONENT_ID);
+
+	ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
+	{
+		Worker_ComponentId ComponentId = DynamicSubobjectSchemaComponents[Type];
+
+		if (ComponentId != SpatialConstants::INVALID_COMPONENT_ID)
+		{
+			SpecificDynamicSubobjectInfo->SchemaComponents[Type] = ComponentId;
+			ComponentInfoTable.SetClassInfo(ComponentId, SpecificDynamicSubobjectInfo, Offset, Type);
+		}
+	});
+
+	Info->DynamicSubobjectInfo.Add(SpecificDynamicSubobjectInfo);
+}
+
 void USpatialClassInfoManager::TryCreateClassInfoForComponentId(Worker_ComponentId ComponentId)
 {
-	if (FString* ClassPath = SchemaDatabase->ComponentIdToClassPath.Find(ComponentId))
+	if (CompactSchemaDatabase.IsLoaded())
+	{
+		FString ClassPath;
+		if (CompactSchemaDatabase.FindClassPathForComponentId(ComponentId, ClassPath))
+		{
+			if (UClass* Class = LoadObject<UClass>(nullptr, *ClassPath))
+			{
+				CreateClassInfoForClass(Class);
+			}
+		}
+	}
+	else if (FString* ClassPath = SchemaDatabase->ComponentIdToClassPath.Find(ComponentId))
 	{
 		if (UClass* Class = LoadObject<UClass>(nullptr, **ClassPath))
 		{
@@ -289,6 +559,11 @@ void USpatialClassInfoManager::TryCreateClassInfoForComponentId(Worker_Component
 
 bool USpatialClassInfoManager::IsSupportedClass(const FString& PathName) const
 {
+	if (CompactSchemaDatabase.IsLoaded())
+	{
+		return CompactSchemaDatabase.ContainsClassPath(PathName);
+	}
+
 	return SchemaDatabase->ActorClassPathToSchema.Contains(PathName) || SchemaDatabase->SubobjectClassPathToSchema.Contains(PathName);
 }
 
@@ -316,24 +591,31 @@ const FClassInfo& USpatialClassInfoManager::GetOrCreateClassInfoByObject(UObject
 
 		check(ObjectRef.IsValid());
 
-		return ComponentToClassInfoMap[ObjectRef.Offset].Get();
+		const SpatialGDK::FComponentInfo* Info = ComponentInfoTable.FindClassInfo(ObjectRef.Offset);
+		check(Info != nullptr);
+		return *Info->ClassInfo;
 	}
 }
 
 const FClassInfo& USpatialClassInfoManager::GetClassInfoByComponentId(Worker_ComponentId ComponentId)
 {
-	if (!ComponentToClassInfoMap.Contains(ComponentId))
+	const SpatialGDK::FComponentInfo* Info = ComponentInfoTable.FindClassInfo(ComponentId);
+	if (Info == nullptr)
 	{
 		TryCreateClassInfoForComponentId(ComponentId);
+		Info = ComponentInfoTable.FindClassInfo(ComponentId);
 	}
 
-	TSharedRef<FClassInfo> Info = ComponentToClassInfoMap.FindChecked(ComponentId);
-	return Info.Get();
+	check(Info != nullptr);
+	return *Info->ClassInfo;
 }
 
 UClass* USpatialClassInfoManager::GetClassByComponentId(Worker_ComponentId ComponentId)
 {
-	TSharedRef<FClassInfo> Info = ComponentToClassInfoMap.FindChecked(ComponentId);
+	const SpatialGDK::FComponentInfo* ComponentInfo = ComponentInfoTable.FindClassInfo(ComponentId);
+	check(ComponentInfo != nullptr);
+
+	const FClassInfo* Info = ComponentInfo->ClassInfo;
 	if (UClass* Class = Info->Class.Get())
 	{
 		return Class;
@@ -345,7 +627,7 @@ UClass* USpatialClassInfoManager::GetClassByComponentId(Worker_ComponentId Compo
 		// The weak pointer to the class stored in the FClassInfo will be the same as the one used as the key in ClassInfoMap, so we can use it to clean up the old entry.
 		ClassInfoMap.Remove(Info->Class);
 
-		// The old references in the other maps (ComponentToClassInfoMap etc) will be replaced by reloading the info (as a part of LoadClassForComponent).
+		// The old entries in ComponentInfoTable will be replaced by reloading the info (as a part of LoadClassForComponent).
 	}
 
 	return nullptr;
@@ -354,7 +636,13 @@ UClass* USpatialClassInfoManager::GetClassByComponentId(Worker_ComponentId Compo
 uint32 USpatialClassInfoManager::GetComponentIdForClass(const UClass& Class) const
 {
 	const FString ClassPath = Class.GetPathName();
-	if (const FActorSchemaData* ActorSchemaData = SchemaDatabase->ActorClassPathToSchema.Find(Class.GetPathName()))
+	if (CompactSchemaDatabase.IsLoaded())
+	{
+		const uint32* SchemaComponents = CompactSchemaDatabase.FindActorSchemaComponents(ClassPath);
+		return SchemaComponents != nullptr ? SchemaComponents[SCHEMA_Data] : SpatialConstants::INVALID_COMPONENT_ID;
+	}
+
+	if (const FActorSchemaData* ActorSchemaData = SchemaDatabase->ActorClassPathToSchema.Find(ClassPath))
 	{
 		return ActorSchemaData->SchemaComponents[SCHEMA_Data];
 	}
@@ -365,7 +653,7 @@ TArray<Worker_ComponentId> USpatialClassInfoManager::GetComponentIdsForClassHier
 {
 	TArray<Worker_ComponentId> OutComponentIds;
 
-	check(SchemaDatabase);
+	check(SchemaDatabase != nullptr || CompactSchemaDatabase.IsLoaded());
 	if (bIncludeDerivedTypes)
 	{
 		for (TObjectIterator<UClass> It; It; ++It)
@@ -398,14 +686,16 @@ TArray<Worker_ComponentId> USpatialClassInfoManager::GetComponentIdsForClassHier
 
 bool USpatialClassInfoManager::GetOffsetByComponentId(Worker_ComponentId ComponentId, uint32& OutOffset)
 {
-	if (!ComponentToOffsetMap.Contains(ComponentId))
+	const SpatialGDK::FComponentInfo* Info = ComponentInfoTable.FindClassInfo(ComponentId);
+	if (Info == nullptr)
 	{
 		TryCreateClassInfoForComponentId(ComponentId);
+		Info = ComponentInfoTable.FindClassInfo(ComponentId);
 	}
 
-	if (uint32* Offset = ComponentToOffsetMap.Find(ComponentId))
+	if (Info != nullptr)
 	{
-		OutOffset = *Offset;
+		OutOffset = Info->Offset;
 		return true;
 	}
 
@@ -414,14 +704,16 @@ bool USpatialClassInfoManager::GetOffsetByComponentId(Worker_ComponentId Compone
 
 ESchemaComponentType USpatialClassInfoManager::GetCategoryByComponentId(Worker_ComponentId ComponentId)
 {
-	if (!ComponentToCategoryMap.Contains(ComponentId))
+	const SpatialGDK::FComponentInfo* Info = ComponentInfoTable.FindClassInfo(ComponentId);
+	if (Info == nullptr)
 	{
 		TryCreateClassInfoForComponentId(ComponentId);
+		Info = ComponentInfoTable.FindClassInfo(ComponentId);
 	}
 
-	if (ESchemaComponentType* Category = ComponentToCategoryMap.Find(ComponentId))
+	if (Info != nullptr)
 	{
-		return *Category;
+		return Info->GetCategory();
 	}
 
 	return ESchemaComponentType::SCHEMA_Invalid;
@@ -455,6 +747,11 @@ const FRPCInfo& USpatialClassInfoManager::GetRPCInfo(UObject* Object, UFunction*
 uint32 USpatialClassInfoManager::GetComponentIdFromLevelPath(const FString& LevelPath)
 {
 	FString CleanLevelPath = UWorld::RemovePIEPrefix(LevelPath);
+	if (CompactSchemaDatabase.IsLoaded())
+	{
+		return CompactSchemaDatabase.FindComponentIdForLevelPath(CleanLevelPath);
+	}
+
 	if (const uint32* ComponentId = SchemaDatabase->LevelPathToComponentId.Find(CleanLevelPath))
 	{
 		return *ComponentId;
@@ -464,7 +761,7 @@ uint32 USpatialClassInfoManager::GetComponentIdFromLevelPath(const FString& Leve
 
 bool USpatialClassInfoManager::IsSublevelComponent(Worker_ComponentId ComponentId)
 {
-	return SchemaDatabase->LevelComponentIds.Contains(ComponentId);
+	return ComponentInfoTable.IsSublevel(ComponentId);
 }
 
 const FClassInfo* USpatialClassInfoManager::GetClassInfoForNewSubobject(const UObject * Object, Worker_EntityId EntityId, USpatialPackageMapClient* PackageMapClient)
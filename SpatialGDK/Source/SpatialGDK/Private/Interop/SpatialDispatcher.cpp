@@ -22,6 +22,8 @@ void USpatialDispatcher::Init(USpatialReceiver* InReceiver, USpatialStaticCompon
 
 void USpatialDispatcher::ProcessOps(Worker_OpList* OpList)
 {
+	const double StartTime = FPlatformTime::Seconds();
+
 	for (size_t i = 0; i < OpList->op_count; ++i)
 	{
 		Worker_Op* Op = &OpList->ops[i];
@@ -74,6 +76,7 @@ void USpatialDispatcher::ProcessOps(Worker_OpList* OpList)
 			Receiver->OnCommandRequest(Op->op.command_request);
 			break;
 		case WORKER_OP_TYPE_COMMAND_RESPONSE:
+			SpatialMetrics->TrackCommandResponse(Op->op.command_response.request_id);
 			Receiver->OnCommandResponse(Op->op.command_response);
 			break;
 
@@ -87,6 +90,7 @@ void USpatialDispatcher::ProcessOps(Worker_OpList* OpList)
 			Receiver->OnReserveEntityIdsResponse(Op->op.reserve_entity_ids_response);
 			break;
 		case WORKER_OP_TYPE_CREATE_ENTITY_RESPONSE:
+			SpatialMetrics->TrackCreateEntityResponse(Op->op.create_entity_response.request_id);
 			Receiver->OnCreateEntityResponse(Op->op.create_entity_response);
 			break;
 		case WORKER_OP_TYPE_DELETE_ENTITY_RESPONSE:
@@ -117,6 +121,8 @@ void USpatialDispatcher::ProcessOps(Worker_OpList* OpList)
 
 	Receiver->FlushRemoveComponentOps();
 	Receiver->FlushRetryRPCs();
+
+	SpatialMetrics->TrackOpListProcessingTime(FPlatformTime::Seconds() - StartTime);
 }
 
 bool USpatialDispatcher::IsExternalSchemaOp(Worker_Op* Op) const
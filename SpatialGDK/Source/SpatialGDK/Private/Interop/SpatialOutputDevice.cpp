@@ -38,7 +38,7 @@ void FSpatialOutputDevice::Serialize(const TCHAR* InData, ELogVerbosity::Type Ve
 			return;
 		}
 #endif //WITH_EDITOR
-		Connection->SendLogMessage(ConvertLogLevelToSpatial(Verbosity), LoggerName, InData);
+		Connection->SendLogMessage(ConvertLogLevelToSpatial(Verbosity), LoggerName, InData, Category);
 	}
 }
 
@@ -42,8 +42,8 @@ void USpatialPlayerSpawner::ReceivePlayerSpawnRequest(Schema_Object* Payload, co
 		FString URLString = GetStringFromSchema(Payload, 1);
 
 		FUniqueNetIdRepl UniqueId;
-		TArray<uint8> UniqueIdBytes = GetBytesFromSchema(Payload, 2);
-		FNetBitReader UniqueIdReader(nullptr, UniqueIdBytes.GetData(), UniqueIdBytes.Num() * 8);
+		TArrayView<const uint8> UniqueIdBytes = GetBytesViewFromSchema(Payload, 2);
+		FNetBitReader UniqueIdReader(nullptr, const_cast<uint8*>(UniqueIdBytes.GetData()), UniqueIdBytes.Num() * 8);
 		UniqueIdReader << UniqueId;
 
 		FName OnlinePlatformName = FName(*GetStringFromSchema(Payload, 3));
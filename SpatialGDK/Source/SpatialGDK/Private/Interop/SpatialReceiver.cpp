@@ -6,6 +6,7 @@
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/PlayerState.h"
+#include "HAL/PlatformTime.h"
 #include "Kismet/GameplayStatics.h"
 #include "TimerManager.h"
 
@@ -51,6 +52,27 @@ void USpatialReceiver::Init(USpatialNetDriver* InNetDriver, FTimerManager* InTim
 
 	IncomingRPCs.BindProcessingFunction(FProcessRPCDelegate::CreateUObject(this, &USpatialReceiver::ApplyRPC));
 	PeriodicallyProcessIncomingRPCs();
+
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	if (SpatialGDKSettings->bEnableActorPooling)
+	{
+		for (const auto& Pair : SpatialGDKSettings->PooledActorClasses)
+		{
+			ActorPool.SetClassCap(Pair.Key.ToSoftObjectPath(), Pair.Value);
+		}
+	}
+
+	if (NetDriver->IsServer())
+	{
+		HeartbeatTime = 0.0;
+		HeartbeatTimeouts.Init(SpatialGDKSettings->HeartbeatTimeoutSeconds, SpatialConstants::HEARTBEAT_TIMEOUT_CHECK_INTERVAL_SECONDS, HeartbeatTime);
+		PeriodicallyCheckHeartbeatTimeouts();
+	}
+
+	for (const auto& Pair : SpatialGDKSettings->EntityMaterializationClassPriorities)
+	{
+		MaterializationQueue.SetClassPriority(Pair.Key.ToSoftObjectPath(), Pair.Value);
+	}
 }
 
 void USpatialReceiver::OnCriticalSection(bool InCriticalSection)
@@ -77,9 +99,23 @@ void USpatialReceiver::LeaveCriticalSection()
 	UE_LOG(LogSpatialReceiver, Verbose, TEXT("Leaving critical section."));
 	check(bInCriticalSection);
 
-	for (Worker_EntityId& PendingAddEntity : PendingAddEntities)
+	if (!NetDriver->IsServer() && GetDefault<USpatialGDKSettings>()->EntityMaterializationBudgetMs > 0.f)
 	{
-		ReceiveActor(PendingAddEntity);
+		QueuePendingAddEntities();
+	}
+	else
+	{
+		for (Worker_EntityId& PendingAddEntity : PendingAddEntities)
+		{
+			FSoftObjectPath ClassPath;
+			if (NeedsEntityClassLoad(PendingAddEntity, ClassPath))
+			{
+				ParkEntityUntilClassLoaded(PendingAddEntity, ClassPath, 0, 0.f);
+				continue;
+			}
+
+			ReceiveActor(PendingAddEntity);
+		}
 	}
 
 	for (Worker_AuthorityChangeOp& PendingAuthorityChange : PendingAuthorityChanges)
@@ -96,6 +132,180 @@ void USpatialReceiver::LeaveCriticalSection()
 	ProcessQueuedResolvedObjects();
 }
 
+void USpatialReceiver::QueuePendingAddEntities()
+{
+	// Entities this worker gains authority over, such as the client's own player controller, are needed straight away.
+	TSet<Worker_EntityId_Key> AuthoritativeEntities;
+	for (const Worker_AuthorityChangeOp& PendingAuthorityChange : PendingAuthorityChanges)
+	{
+		if (PendingAuthorityChange.authority == WORKER_AUTHORITY_AUTHORITATIVE)
+		{
+			AuthoritativeEntities.Add(PendingAuthorityChange.entity_id);
+		}
+	}
+
+	FVector ViewLocation = FVector::ZeroVector;
+	if (APlayerController* PlayerController = NetDriver->GetWorld()->GetFirstPlayerController())
+	{
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+	}
+
+	for (Worker_EntityId PendingAddEntity : PendingAddEntities)
+	{
+		UnrealMetadata* UnrealMetadataComp = StaticComponentView->GetComponentData<UnrealMetadata>(PendingAddEntity);
+		if (UnrealMetadataComp == nullptr || AuthoritativeEntities.Contains(PendingAddEntity))
+		{
+			ReceiveActor(PendingAddEntity);
+			continue;
+		}
+
+		float DistanceSquared = 0.f;
+		if (Position* PositionComp = StaticComponentView->GetComponentData<Position>(PendingAddEntity))
+		{
+			DistanceSquared = FVector::DistSquared(Coordinates::ToFVector(PositionComp->Coords), ViewLocation);
+		}
+
+		const int32 ClassPriority = MaterializationQueue.GetClassPriority(UnrealMetadataComp->ClassPath);
+
+		FSoftObjectPath ClassPath;
+		if (NeedsEntityClassLoad(PendingAddEntity, ClassPath))
+		{
+			ParkEntityUntilClassLoaded(PendingAddEntity, ClassPath, ClassPriority, DistanceSquared);
+			continue;
+		}
+
+		MaterializationQueue.Enqueue(PendingAddEntity, ClassPriority, DistanceSquared, TakePendingAddComponents(PendingAddEntity));
+	}
+}
+
+TArray<PendingAddComponentWrapper> USpatialReceiver::TakePendingAddComponents(Worker_EntityId EntityId)
+{
+	TArray<PendingAddComponentWrapper> Components;
+	if (TArray<PendingAddComponentWrapper>* EntityPendingAddComponents = PendingAddComponents.Find(EntityId))
+	{
+		Components = MoveTemp(*EntityPendingAddComponents);
+		PendingAddComponents.Remove(EntityId);
+	}
+	return Components;
+}
+
+bool USpatialReceiver::NeedsEntityClassLoad(Worker_EntityId EntityId, FSoftObjectPath& OutClassPath) const
+{
+	if (!GetDefault<USpatialGDKSettings>()->bAsyncLoadEntityClasses)
+	{
+		return false;
+	}
+
+	// Stably named entities are never loaded by ReceiveActor, and entities with an actor already don't need their class.
+	UnrealMetadata* UnrealMetadataComp = StaticComponentView->GetComponentData<UnrealMetadata>(EntityId);
+	if (UnrealMetadataComp == nullptr || UnrealMetadataComp->StablyNamedRef.IsSet() || UnrealMetadataComp->NativeClass.IsValid()
+		|| PackageMap->GetObjectFromEntityId(EntityId).IsValid())
+	{
+		return false;
+	}
+
+	OutClassPath = FSoftObjectPath(UnrealMetadataComp->ClassPath);
+	return OutClassPath.IsValid() && OutClassPath.ResolveObject() == nullptr;
+}
+
+void USpatialReceiver::ParkEntityUntilClassLoaded(Worker_EntityId EntityId, const FSoftObjectPath& ClassPath, int32 ClassPriority, float DistanceSquared)
+{
+	UE_LOG(LogSpatialReceiver, Verbose, TEXT("Loading class %s in the background before creating the actor for entity %lld."), *ClassPath.ToString(), EntityId);
+
+	if (MaterializationQueue.Park(EntityId, ClassPath, ClassPriority, DistanceSquared, TakePendingAddComponents(EntityId)))
+	{
+		TSharedPtr<FStreamableHandle> Handle = EntityClassStreamableManager.RequestAsyncLoad(ClassPath,
+			FStreamableDelegate::CreateUObject(this, &USpatialReceiver::OnEntityClassLoaded, ClassPath));
+
+		// The load completes, and OnEntityClassLoaded is called, straight away if the class was loaded in the meantime.
+		if (Handle.IsValid() && !Handle->HasLoadCompleted())
+		{
+			EntityClassLoadHandles.Add(ClassPath, Handle);
+		}
+		else if (Handle.IsValid())
+		{
+			LoadedEntityClassHandles.Add(Handle);
+		}
+	}
+}
+
+void USpatialReceiver::OnEntityClassLoaded(FSoftObjectPath ClassPath)
+{
+	if (ClassPath.ResolveObject() == nullptr)
+	{
+		UE_LOG(LogSpatialReceiver, Warning, TEXT("Failed to load class %s in the background. Its entities will try to load it again when their actors are created."), *ClassPath.ToString());
+	}
+
+	TSharedPtr<FStreamableHandle> Handle;
+	if (EntityClassLoadHandles.RemoveAndCopyValue(ClassPath, Handle))
+	{
+		LoadedEntityClassHandles.Add(Handle);
+	}
+
+	// The parked entities are materialized from ProcessEntityMaterializationQueue, under the same budget as other queued entities.
+	MaterializationQueue.OnClassLoaded(ClassPath);
+}
+
+void USpatialReceiver::ProcessEntityMaterializationQueue()
+{
+	if (MaterializationQueue.Num() == MaterializationQueue.NumParked())
+	{
+		// Every entity let out by a class load has had its actor created, or left view, so from here on the actors keep their classes loaded.
+		for (const TSharedPtr<FStreamableHandle>& Handle : LoadedEntityClassHandles)
+		{
+			Handle->ReleaseHandle();
+		}
+		LoadedEntityClassHandles.Empty();
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double BudgetSeconds = GetDefault<USpatialGDKSettings>()->EntityMaterializationBudgetMs / 1000.0;
+
+	// At least one actor is created each frame, so the queue drains even if a single actor takes longer than the budget.
+	FEntityMaterializationQueue::FEntry Entry;
+	while (MaterializationQueue.Pop(Entry))
+	{
+		MaterializeEntity(Entry);
+
+		if (BudgetSeconds > 0.0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+		{
+			break;
+		}
+	}
+
+	MaterializationQueue.GetFrameTime().Record(FPlatformTime::Seconds() - StartTime);
+}
+
+void USpatialReceiver::MaterializeEntity(FEntityMaterializationQueue::FEntry& Entry)
+{
+	// ReceiveActor reads the entity's initial data from PendingAddComponents, as it does at the end of a critical section.
+	PendingAddComponents.Add(Entry.EntityId, MoveTemp(Entry.Components));
+	ReceiveActor(Entry.EntityId);
+	PendingAddComponents.Remove(Entry.EntityId);
+
+	// Then apply, in the order they arrived, the updates and RPCs received while the entity was queued.
+	for (const FPendingComponentUpdate& PendingUpdate : Entry.Updates)
+	{
+		Worker_ComponentUpdateOp Op = {};
+		Op.entity_id = Entry.EntityId;
+		Op.update = *PendingUpdate.Update;
+		OnComponentUpdate(Op);
+	}
+	Entry.Updates.Empty();
+}
+
+void USpatialReceiver::MaterializeQueuedEntity(Worker_EntityId EntityId)
+{
+	FEntityMaterializationQueue::FEntry Entry;
+	if (MaterializationQueue.Pop(EntityId, Entry))
+	{
+		UE_LOG(LogSpatialReceiver, Verbose, TEXT("Creating the actor for queued entity %lld ahead of its turn."), EntityId);
+		MaterializeEntity(Entry);
+	}
+}
+
 void USpatialReceiver::OnAddEntity(const Worker_AddEntityOp& Op)
 {
 	UE_LOG(LogSpatialReceiver, Verbose, TEXT("AddEntity: %lld"), Op.entity_id);
@@ -151,9 +361,10 @@ void USpatialReceiver::OnAddComponent(const Worker_AddComponentOp& Op)
 		{
 			NetDriver->AddPendingDormantChannel(Channel);
 		}
-		else
+		else if (!MaterializationQueue.Contains(Op.entity_id))
 		{
-			// This would normally get registered through the channel cleanup, but we don't have one for this entity
+			// This would normally get registered through the channel cleanup, but we don't have one for this entity.
+			// Queued entities are made dormant by ReceiveActor once their actor is created.
 			NetDriver->RegisterDormantEntityId(Op.entity_id);
 		}
 		return;
@@ -178,9 +389,9 @@ void USpatialReceiver::OnAddComponent(const Worker_AddComponentOp& Op)
 
 	if (bInCriticalSection)
 	{
-		PendingAddComponents.Emplace(Op.entity_id, Op.data.component_id, MakeUnique<DynamicComponent>(Op.data));
+		PendingAddComponents.FindOrAdd(Op.entity_id).Emplace(Op.entity_id, Op.data.component_id, Op.data);
 	}
-	else
+	else if (!MaterializationQueue.AddComponent(Op.entity_id, Op.data))
 	{
 		HandleIndividualAddComponent(Op);
 	}
@@ -243,6 +454,8 @@ void USpatialReceiver::ProcessRemoveComponent(const Worker_RemoveComponentOp& Op
 		return;
 	}
 
+	MaterializationQueue.RemoveComponent(Op.entity_id, Op.component_id);
+
 	if (AActor* Actor = Cast<AActor>(PackageMap->GetObjectFromEntityId(Op.entity_id).Get()))
 	{
 		if (Op.component_id == SpatialConstants::DORMANT_COMPONENT_ID)
@@ -299,15 +512,23 @@ void USpatialReceiver::HandlePlayerLifecycleAuthority(const Worker_AuthorityChan
 				if (NetDriver->IsServer())
 				{
 					AuthorityPlayerControllerConnectionMap.Add(Op.entity_id, Connection);
+					HeartbeatTimeouts.Refresh(Op.entity_id, HeartbeatTime);
 				}
 				Connection->InitHeartbeat(TimerManager, Op.entity_id);
 			}
+
+			if (NetDriver->IsServer())
+			{
+				Sender->SendHeartbeatComponentInterest(Op.entity_id, true);
+			}
 		}
 		else if (Op.authority == WORKER_AUTHORITY_NOT_AUTHORITATIVE)
 		{
 			if (NetDriver->IsServer())
 			{
 				AuthorityPlayerControllerConnectionMap.Remove(Op.entity_id);
+				HeartbeatTimeouts.Remove(Op.entity_id);
+				Sender->SendHeartbeatComponentInterest(Op.entity_id, false);
 			}
 			if (USpatialNetConnection* Connection = Cast<USpatialNetConnection>(PlayerController->GetNetConnection()))
 			{
@@ -319,8 +540,16 @@ void USpatialReceiver::HandlePlayerLifecycleAuthority(const Worker_AuthorityChan
 
 void USpatialReceiver::HandleActorAuthority(const Worker_AuthorityChangeOp& Op)
 {
+	MaterializeQueuedEntity(Op.entity_id);
+
 	StaticComponentView->OnAuthorityChange(Op);
 
+	// Another worker may change the entity's interest while we are not authoritative over it.
+	if (Op.component_id == SpatialConstants::INTEREST_COMPONENT_ID && Op.authority == WORKER_AUTHORITY_NOT_AUTHORITATIVE)
+	{
+		Sender->ClearSentInterest(Op.entity_id);
+	}
+
 	if (GlobalStateManager->HandlesComponent(Op.component_id))
 	{
 		GlobalStateManager->AuthorityChanged(Op);
@@ -426,6 +655,7 @@ void USpatialReceiver::HandleActorAuthority(const Worker_AuthorityChangeOp& Op)
 				if (USpatialActorChannel* ActorChannel = NetDriver->GetActorChannelByEntityId(Op.entity_id))
 				{
 					ActorChannel->bCreatedEntity = false;
+					ActorChannel->ResetFastArrayBaselines();
 				}
 
 				Actor->Role = ROLE_SimulatedProxy;
@@ -498,11 +728,16 @@ void USpatialReceiver::HandleActorAuthority(const Worker_AuthorityChangeOp& Op)
 
 bool USpatialReceiver::IsReceivedEntityTornOff(Worker_EntityId EntityId)
 {
+	TArray<PendingAddComponentWrapper>* EntityPendingAddComponents = PendingAddComponents.Find(EntityId);
+	if (EntityPendingAddComponents == nullptr)
+	{
+		return false;
+	}
+
 	// Check the pending add components, to find the root component for the received entity.
-	for (PendingAddComponentWrapper& PendingAddComponent : PendingAddComponents)
+	for (PendingAddComponentWrapper& PendingAddComponent : *EntityPendingAddComponents)
 	{
-		if (PendingAddComponent.EntityId != EntityId
-			|| ClassInfoManager->GetCategoryByComponentId(PendingAddComponent.ComponentId) != SCHEMA_Data)
+		if (ClassInfoManager->GetCategoryByComponentId(PendingAddComponent.ComponentId) != SCHEMA_Data)
 		{
 			continue;
 		}
@@ -513,7 +748,7 @@ bool USpatialReceiver::IsReceivedEntityTornOff(Worker_EntityId EntityId)
 			continue;
 		}
 
-		Worker_ComponentData* ComponentData = PendingAddComponent.Data->ComponentData;
+		Worker_ComponentData* ComponentData = PendingAddComponent.Data.ComponentData;
 		Schema_Object* ComponentObject = Schema_GetComponentDataFields(ComponentData->schema_type);
 		return GetBoolFromSchema(ComponentObject, SpatialConstants::ACTOR_TEAROFF_ID);
 	}
@@ -556,6 +791,8 @@ void USpatialReceiver::ReceiveActor(Worker_EntityId EntityId)
 	}
 	else
 	{
+		const double CheckoutStartTime = FPlatformTime::Seconds();
+
 		UClass* Class = UnrealMetadataComp->GetNativeEntityClass();
 		if (Class == nullptr)
 		{
@@ -586,6 +823,13 @@ void USpatialReceiver::ReceiveActor(Worker_EntityId EntityId)
 			return;
 		}
 
+		bool bAlreadyCheckedOutClass = false;
+		CheckedOutClasses.Add(Class, &bAlreadyCheckedOutClass);
+		if (!bAlreadyCheckedOutClass)
+		{
+			FirstCheckoutLatency.Record(FPlatformTime::Seconds() - CheckoutStartTime);
+		}
+
 		// RemoveActor immediately if we've received the tombstone component.
 		if (NetDriver->StaticComponentView->HasComponent(EntityId, SpatialConstants::TOMBSTONE_COMPONENT_ID))
 		{
@@ -634,16 +878,16 @@ void USpatialReceiver::ReceiveActor(Worker_EntityId EntityId)
 		// Apply initial replicated properties.
 		// This was moved to after FinishingSpawning because components existing only in blueprints aren't added until spawning is complete
 		// Potentially we could split out the initial actor state and the initial component state
-		for (PendingAddComponentWrapper& PendingAddComponent : PendingAddComponents)
+		if (TArray<PendingAddComponentWrapper>* EntityPendingAddComponents = PendingAddComponents.Find(EntityId))
 		{
-			if (ClassInfoManager->IsSublevelComponent(PendingAddComponent.ComponentId))
+			for (PendingAddComponentWrapper& PendingAddComponent : *EntityPendingAddComponents)
 			{
-				continue;
-			}
+				if (ClassInfoManager->IsSublevelComponent(PendingAddComponent.ComponentId))
+				{
+					continue;
+				}
 
-			if (PendingAddComponent.EntityId == EntityId)
-			{
-				ApplyComponentDataOnActorCreation(EntityId, *PendingAddComponent.Data->ComponentData, Channel, ActorClassInfo);
+				ApplyComponentDataOnActorCreation(EntityId, *PendingAddComponent.Data.ComponentData, Channel, ActorClassInfo);
 			}
 		}
 
@@ -668,6 +912,11 @@ void USpatialReceiver::ReceiveActor(Worker_EntityId EntityId)
 			}
 
 		}
+		else if (EntityActor->IsA(APlayerController::StaticClass()) && !StaticComponentView->HasAuthority(EntityId, SpatialConstants::POSITION_COMPONENT_ID))
+		{
+			// Only the server with authority over a PlayerController needs its heartbeats. It regains interest in them when it gains authority.
+			Sender->SendHeartbeatComponentInterest(EntityId, false);
+		}
 
 		// Taken from PostNetInit
 		if (NetDriver->GetWorld()->HasBegunPlay() && !EntityActor->HasActorBegunPlay())
@@ -695,6 +944,12 @@ void USpatialReceiver::ReceiveActor(Worker_EntityId EntityId)
 
 void USpatialReceiver::RemoveActor(Worker_EntityId EntityId)
 {
+	if (MaterializationQueue.Remove(EntityId))
+	{
+		// The entity left view before its actor was created.
+		return;
+	}
+
 	TWeakObjectPtr<UObject> WeakActor = PackageMap->GetObjectFromEntityId(EntityId);
 
 	// Actor has been destroyed already. Clean up surrounding bookkeeping.
@@ -799,15 +1054,32 @@ void USpatialReceiver::DestroyActor(AActor* Actor, Worker_EntityId EntityId)
 	// TODO: fix this with working sets (UNR-411)
 	NetDriver->StartIgnoringAuthoritativeDestruction();
 
+	bool bReturnedToPool = false;
+
 	// Clean up the actor channel. For clients, this will also call destroy on the actor.
 	if (USpatialActorChannel* ActorChannel = NetDriver->GetActorChannelByEntityId(EntityId))
 	{
-		ActorChannel->ConditionalCleanUp(false, EChannelCloseReason::Destroyed);
+		if (Actor != nullptr && CanReturnActorToPool(Actor, ActorChannel))
+		{
+			// Client actor channels don't destroy net temporary actors on clean up, so this keeps the actor
+			// alive while the channel still removes its package map entries and its replicators.
+			const bool bWasNetTemporary = Actor->bNetTemporary;
+			Actor->bNetTemporary = true;
+			ActorChannel->ConditionalCleanUp(false, EChannelCloseReason::Destroyed);
+			Actor->bNetTemporary = bWasNetTemporary;
+
+			bReturnedToPool = ActorPool.Release(Actor);
+		}
+		else
+		{
+			ActorChannel->ConditionalCleanUp(false, EChannelCloseReason::Destroyed);
+		}
 	}
 	else
 	{
 		if (NetDriver->IsDormantEntity(EntityId))
 		{
+			NetDriver->GetDormantColdStorage().Remove(EntityId);
 			PackageMap->RemoveEntityActor(EntityId);
 		}
 		else if (Actor == nullptr)
@@ -821,7 +1093,7 @@ void USpatialReceiver::DestroyActor(AActor* Actor, Worker_EntityId EntityId)
 	}
 
 	// It is safe to call AActor::Destroy even if the destruction has already started.
-	if (Actor != nullptr && !Actor->Destroy(true))
+	if (Actor != nullptr && !bReturnedToPool && !Actor->Destroy(true))
 	{
 		UE_LOG(LogSpatialReceiver, Error, TEXT("Failed to destroy actor in RemoveActor %s %lld"), *Actor->GetName(), EntityId);
 	}
@@ -830,6 +1102,28 @@ void USpatialReceiver::DestroyActor(AActor* Actor, Worker_EntityId EntityId)
 	check(PackageMap->GetObjectFromEntityId(EntityId) == nullptr);
 }
 
+bool USpatialReceiver::CanReturnActorToPool(AActor* Actor, USpatialActorChannel* Channel)
+{
+	if (NetDriver->IsServer() || !ActorPool.IsPooledClass(Actor->GetClass()))
+	{
+		return false;
+	}
+
+	// Dynamically attached subobjects are bound to the entity and destroyed with the channel, so the actor could not be reused as is.
+	if (Channel->CreateSubObjects.Num() > 0)
+	{
+		return false;
+	}
+
+	// Actors owned by this client (such as its pawn) hold references to the player's connection and controller.
+	if (Actor->GetNetConnection() != nullptr)
+	{
+		return false;
+	}
+
+	return !Actor->IsPendingKillPending();
+}
+
 AActor* USpatialReceiver::TryGetOrCreateActor(UnrealMetadata* UnrealMetadataComp, SpawnData* SpawnDataComp)
 {
 	if (UnrealMetadataComp->StablyNamedRef.IsSet())
@@ -882,7 +1176,16 @@ AActor* USpatialReceiver::CreateActor(UnrealMetadata* UnrealMetadataComp, SpawnD
 
 	FVector SpawnLocation = FRepMovement::RebaseOntoLocalOrigin(SpawnDataComp->Location, NetDriver->GetWorld()->OriginLocation);
 
-	AActor* NewActor = NetDriver->GetWorld()->SpawnActorAbsolute(ActorClass, FTransform(SpawnDataComp->Rotation, SpawnLocation), SpawnInfo);
+	AActor* NewActor = nullptr;
+	if (!bIsServer)
+	{
+		NewActor = ActorPool.Acquire(NetDriver->GetWorld(), ActorClass, FTransform(SpawnDataComp->Rotation, SpawnLocation, SpawnDataComp->Scale));
+	}
+
+	if (NewActor == nullptr)
+	{
+		NewActor = NetDriver->GetWorld()->SpawnActorAbsolute(ActorClass, FTransform(SpawnDataComp->Rotation, SpawnLocation), SpawnInfo);
+	}
 	check(NewActor);
 
 	if (bIsServer && bCreatingPlayerController)
@@ -995,7 +1298,7 @@ void USpatialReceiver::HandleIndividualAddComponent(const Worker_AddComponentOp&
 
 	// Otherwise this is a dynamically attached component. We need to make sure we have all related components before creation.
 	PendingDynamicSubobjectComponents.Add(MakeTuple(static_cast<Worker_EntityId_Key>(Op.entity_id), Op.data.component_id),
-		PendingAddComponentWrapper(Op.entity_id, Op.data.component_id, MakeUnique<DynamicComponent>(Op.data)));
+		PendingAddComponentWrapper(Op.entity_id, Op.data.component_id, Op.data));
 
 	bool bReadyToCreate = true;
 	ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
@@ -1049,7 +1352,7 @@ void USpatialReceiver::AttachDynamicSubobject(AActor* Actor, Worker_EntityId Ent
 		TPair<Worker_EntityId_Key, Worker_ComponentId> EntityComponentPair = MakeTuple(static_cast<Worker_EntityId_Key>(EntityId), ComponentId);
 
 		PendingAddComponentWrapper& AddComponent = PendingDynamicSubobjectComponents[EntityComponentPair];
-		ApplyComponentData(Subobject, NetDriver->GetActorChannelByEntityId(EntityId), *AddComponent.Data->ComponentData);
+		ApplyComponentData(Subobject, NetDriver->GetActorChannelByEntityId(EntityId), *AddComponent.Data.ComponentData);
 		PendingDynamicSubobjectComponents.Remove(EntityComponentPair);
 	});
 
@@ -1107,6 +1410,11 @@ void USpatialReceiver::ApplyComponentData(UObject* TargetObject, USpatialActorCh
 
 void USpatialReceiver::OnComponentUpdate(const Worker_ComponentUpdateOp& Op)
 {
+	if (MaterializationQueue.AddUpdate(Op.entity_id, Op.update))
+	{
+		return;
+	}
+
 	switch (Op.update.component_id)
 	{
 	case SpatialConstants::ENTITY_ACL_COMPONENT_ID:
@@ -1148,8 +1456,16 @@ void USpatialReceiver::OnComponentUpdate(const Worker_ComponentUpdateOp& Op)
 		HandleRPC(Op);
 		return;
 	case SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID:
-		check(false); // TODO(zoning): Handle updates to the entity's authority intent.
-		break;
+		// TODO(zoning): Handle updates to the entity's authority intent.
+		// The entity is about to move to another worker, so make sure that worker receives up to date handover data.
+		if (GetDefault<USpatialGDKSettings>()->bOnDemandHandover)
+		{
+			if (USpatialActorChannel* Channel = NetDriver->GetActorChannelByEntityId(Op.entity_id))
+			{
+				Channel->RequestHandoverCapture();
+			}
+		}
+		return;
 	case SpatialConstants::VIRTUAL_WORKER_TRANSLATION_COMPONENT_ID:
 		if (NetDriver->VirtualWorkerTranslator != nullptr)
 		{
@@ -1300,6 +1616,9 @@ void USpatialReceiver::ProcessRPCEventField(Worker_EntityId EntityId, const Work
 			{
 				ObjectRef.Entity = Schema_GetEntityId(EventData, SpatialConstants::UNREAL_PACKED_RPC_PAYLOAD_ENTITY_ID);
 
+				// Packed RPCs for a queued entity can't be buffered with it, as they arrive on the player controller's entity.
+				MaterializeQueuedEntity(ObjectRef.Entity);
+
 
 				// In a zoned multiworker scenario we might not have gained authority over the current entity in this bundle in time
 				// before processing so don't ApplyRPCs to an entity that we don't have authority over.
@@ -1377,6 +1696,13 @@ void USpatialReceiver::OnCommandRequest(const Worker_CommandRequestOp& Op)
 
 	RPCPayload Payload(RequestObject);
 	FUnrealObjectRef ObjectRef = FUnrealObjectRef(Op.entity_id, Payload.Offset);
+
+	// Command RPCs can't be buffered with a queued or parked entity, as the request has to be answered now.
+	if (MaterializationQueue.Contains(Op.entity_id))
+	{
+		MaterializeQueuedEntity(Op.entity_id);
+	}
+
 	UObject* TargetObject = PackageMap->GetObjectFromUnrealObjectRef(ObjectRef).Get();
 	if (TargetObject == nullptr)
 	{
@@ -1504,8 +1830,8 @@ ERPCResult USpatialReceiver::ApplyRPCInternal(UObject* TargetObject, UFunction*
 
 	TSet<FUnrealObjectRef> UnresolvedRefs;
 
-	RPCPayload PayloadCopy = Payload;
-	FSpatialNetBitReader PayloadReader(PackageMap, PayloadCopy.PayloadData.GetData(), PayloadCopy.CountDataBits(), UnresolvedRefs);
+	// The reader only reads from its source, so there is no need to copy the payload first.
+	FSpatialNetBitReader PayloadReader(PackageMap, const_cast<uint8*>(Payload.PayloadData.GetData()), Payload.CountDataBits(), UnresolvedRefs);
 
 	int ReliableRPCId = 0;
 	if (GetDefault<USpatialGDKSettings>()->bCheckRPCOrder)
@@ -2065,8 +2391,8 @@ void USpatialReceiver::OnHeartbeatComponentUpdate(const Worker_ComponentUpdateOp
 	TWeakObjectPtr<USpatialNetConnection>* ConnectionPtr = AuthorityPlayerControllerConnectionMap.Find(Op.entity_id);
 	if (ConnectionPtr == nullptr)
 	{
-		// Heartbeat component update on a PlayerController that this server does not have authority over.
-		// TODO: Disable component interest for Heartbeat components this server doesn't care about - UNR-986
+		// Heartbeat component update on a PlayerController that this server does not have authority over,
+		// received before the server's interest in it was removed.
 		return;
 	}
 
@@ -2074,6 +2400,7 @@ void USpatialReceiver::OnHeartbeatComponentUpdate(const Worker_ComponentUpdateOp
 	{
 		UE_LOG(LogSpatialReceiver, Warning, TEXT("Received heartbeat component update after NetConnection has been cleaned up. PlayerController entity: %lld"), Op.entity_id);
 		AuthorityPlayerControllerConnectionMap.Remove(Op.entity_id);
+		HeartbeatTimeouts.Remove(Op.entity_id);
 		return;
 	}
 
@@ -2088,7 +2415,7 @@ void USpatialReceiver::OnHeartbeatComponentUpdate(const Worker_ComponentUpdateOp
 			UE_LOG(LogSpatialReceiver, Verbose, TEXT("Received multiple heartbeat events in a single component update, entity %lld."), Op.entity_id);
 		}
 
-		NetConnection->OnHeartbeat();
+		HeartbeatTimeouts.Refresh(Op.entity_id, HeartbeatTime);
 	}
 
 	Schema_Object* FieldsObject = Schema_GetComponentUpdateFields(Op.update.schema_type);
@@ -2098,6 +2425,25 @@ void USpatialReceiver::OnHeartbeatComponentUpdate(const Worker_ComponentUpdateOp
 		// Client has disconnected, let's clean up their connection.
 		NetConnection->CleanUp();
 		AuthorityPlayerControllerConnectionMap.Remove(Op.entity_id);
+		HeartbeatTimeouts.Remove(Op.entity_id);
+	}
+}
+
+void USpatialReceiver::CheckHeartbeatTimeouts()
+{
+	HeartbeatTime += SpatialConstants::HEARTBEAT_TIMEOUT_CHECK_INTERVAL_SECONDS;
+
+	TArray<Worker_EntityId> TimedOutEntities;
+	HeartbeatTimeouts.Advance(HeartbeatTime, TimedOutEntities);
+
+	for (Worker_EntityId EntityId : TimedOutEntities)
+	{
+		TWeakObjectPtr<USpatialNetConnection> Connection;
+		if (AuthorityPlayerControllerConnectionMap.RemoveAndCopyValue(EntityId, Connection) && Connection.IsValid())
+		{
+			// This client timed out. Disconnect it and trigger OnDisconnected logic.
+			Connection->CleanUp();
+		}
 	}
 }
 
@@ -2112,3 +2458,15 @@ void USpatialReceiver::PeriodicallyProcessIncomingRPCs()
 		}
 	}, GetDefault<USpatialGDKSettings>()->QueuedIncomingRPCWaitTime, true);
 }
+
+void USpatialReceiver::PeriodicallyCheckHeartbeatTimeouts()
+{
+	FTimerHandle HeartbeatTimeoutCheckTimer;
+	TimerManager->SetTimer(HeartbeatTimeoutCheckTimer, [WeakThis = TWeakObjectPtr<USpatialReceiver>(this)]()
+	{
+		if (USpatialReceiver* SpatialReceiver = WeakThis.Get())
+		{
+			SpatialReceiver->CheckHeartbeatTimeouts();
+		}
+	}, SpatialConstants::HEARTBEAT_TIMEOUT_CHECK_INTERVAL_SECONDS, true);
+}
@@ -28,10 +28,12 @@
 #include "SpatialConstants.h"
 #include "Utils/ActorGroupManager.h"
 #include "Utils/ComponentFactory.h"
+#include "Utils/EntityAclTemplateCache.h"
 #include "Utils/InterestFactory.h"
 #include "Utils/RepLayoutUtils.h"
 #include "Utils/SpatialActorUtils.h"
 #include "Utils/SpatialMetrics.h"
+#include "Utils/WorkerAttributeTable.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialSender);
 
@@ -72,6 +74,9 @@ void USpatialSender::Init(USpatialNetDriver* InNetDriver, FTimerManager* InTimer
 	TimerManager = InTimerManager;
 
 	OutgoingRPCs.BindProcessingFunction(FProcessRPCDelegate::CreateUObject(this, &USpatialSender::SendRPC));
+	RPCWriter = MakeUnique<FSpatialNetBitWriter>(PackageMap);
+
+	EntityAclTemplates.Init(GetDefault<USpatialGDKSettings>()->ServerWorkerTypes);
 }
 
 Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel)
@@ -81,107 +86,30 @@ Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel)
 
 	FString ClientWorkerAttribute = GetOwnerWorkerAttribute(Actor);
 
-	WorkerRequirementSet AnyServerRequirementSet;
-	WorkerRequirementSet AnyServerOrClientRequirementSet = { SpatialConstants::UnrealClientAttributeSet };
-
-	WorkerAttributeSet OwningClientAttributeSet = { ClientWorkerAttribute };
-
-	WorkerRequirementSet AnyServerOrOwningClientRequirementSet = { OwningClientAttributeSet };
-	WorkerRequirementSet OwningClientOnlyRequirementSet = { OwningClientAttributeSet };
-
-	for (const FName& WorkerType : GetDefault<USpatialGDKSettings>()->ServerWorkerTypes)
-	{
-		WorkerAttributeSet ServerWorkerAttributeSet = { WorkerType.ToString() };
-
-		AnyServerRequirementSet.Add(ServerWorkerAttributeSet);
-		AnyServerOrClientRequirementSet.Add(ServerWorkerAttributeSet);
-		AnyServerOrOwningClientRequirementSet.Add(ServerWorkerAttributeSet);
-	}
+	const FClassInfo& Info = ClassInfoManager->GetOrCreateClassInfoByClass(Class);
 
-	WorkerRequirementSet ReadAcl;
-	if (Class->HasAnySpatialClassFlags(SPATIALCLASS_ServerOnly))
-	{
-		ReadAcl = AnyServerRequirementSet;
-	}
-	else if (Actor->IsA<APlayerController>())
-	{
-		ReadAcl = AnyServerOrOwningClientRequirementSet;
-	}
-	else
+	// Static subobjects aren't guaranteed to exist on actor instances, so the ACL template used depends on which are present.
+	TBitArray<> PresentSubobjects(false, Info.SubobjectInfo.Num());
+	int32 SubobjectIndex = 0;
+	for (auto& SubobjectInfoPair : Info.SubobjectInfo)
 	{
-		ReadAcl = AnyServerOrClientRequirementSet;
+		PresentSubobjects[SubobjectIndex++] = PackageMap->GetObjectFromUnrealObjectRef(FUnrealObjectRef(Channel->GetEntityId(), SubobjectInfoPair.Key)).IsValid();
 	}
 
-	const FClassInfo& Info = ClassInfoManager->GetOrCreateClassInfoByClass(Class);
-
-	const WorkerAttributeSet WorkerAttribute{ Info.WorkerType.ToString() };
-	const WorkerRequirementSet AuthoritativeWorkerRequirementSet = { WorkerAttribute };
+	const FEntityAclTemplate& AclTemplate = EntityAclTemplates.GetOrCreateTemplate(Class, Info, PresentSubobjects);
 
-	WriteAclMap ComponentWriteAcl;
-	ComponentWriteAcl.Add(SpatialConstants::POSITION_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-	ComponentWriteAcl.Add(SpatialConstants::INTEREST_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-	ComponentWriteAcl.Add(SpatialConstants::SPAWN_DATA_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-	ComponentWriteAcl.Add(SpatialConstants::ENTITY_ACL_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-	ComponentWriteAcl.Add(SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-	ComponentWriteAcl.Add(SpatialConstants::NETMULTICAST_RPCS_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-	ComponentWriteAcl.Add(SpatialConstants::DORMANT_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-	ComponentWriteAcl.Add(SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID, OwningClientOnlyRequirementSet);
-	ComponentWriteAcl.Add(SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+	// Write ACLs for components that aren't part of the class's template.
+	TArray<Worker_ComponentId> ExtraAclComponents;
 
 	if (Actor->IsNetStartupActor())
 	{
-		ComponentWriteAcl.Add(SpatialConstants::TOMBSTONE_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+		ExtraAclComponents.Add(SpatialConstants::TOMBSTONE_COMPONENT_ID);
 	}
 
 	// If there are pending RPCs, add this component.
 	if (OutgoingOnCreateEntityRPCs.Contains(Actor))
 	{
-		ComponentWriteAcl.Add(SpatialConstants::RPCS_ON_ENTITY_CREATION_ID, AuthoritativeWorkerRequirementSet);
-	}
-
-	// If Actor is a PlayerController, add the heartbeat component.
-	if (Actor->IsA<APlayerController>())
-	{
-#if !UE_BUILD_SHIPPING
-		ComponentWriteAcl.Add(SpatialConstants::DEBUG_METRICS_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-#endif // !UE_BUILD_SHIPPING
-		ComponentWriteAcl.Add(SpatialConstants::HEARTBEAT_COMPONENT_ID, OwningClientOnlyRequirementSet);
-	}
-
-	ComponentWriteAcl.Add(SpatialConstants::ALWAYS_RELEVANT_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-
-	ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
-	{
-		Worker_ComponentId ComponentId = Info.SchemaComponents[Type];
-		if (ComponentId == SpatialConstants::INVALID_COMPONENT_ID)
-		{
-			return;
-		}
-
-		ComponentWriteAcl.Add(ComponentId, AuthoritativeWorkerRequirementSet);
-	});
-
-	for (auto& SubobjectInfoPair : Info.SubobjectInfo)
-	{
-		const FClassInfo& SubobjectInfo = SubobjectInfoPair.Value.Get();
-
-		// Static subobjects aren't guaranteed to exist on actor instances, check they are present before adding write acls
-		TWeakObjectPtr<UObject> Subobject = PackageMap->GetObjectFromUnrealObjectRef(FUnrealObjectRef(Channel->GetEntityId(), SubobjectInfoPair.Key));
-		if (!Subobject.IsValid())
-		{
-			continue;
-		}
-
-		ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
-		{
-			Worker_ComponentId ComponentId = SubobjectInfo.SchemaComponents[Type];
-			if (ComponentId == SpatialConstants::INVALID_COMPONENT_ID)
-			{
-				return;
-			}
-
-			ComponentWriteAcl.Add(ComponentId, AuthoritativeWorkerRequirementSet);
-		});
+		ExtraAclComponents.Add(SpatialConstants::RPCS_ON_ENTITY_CREATION_ID);
 	}
 
 	// We want to have a stably named ref if this is a loaded Actor.
@@ -256,7 +184,7 @@ Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel)
 		ComponentDatas.Add(Heartbeat().CreateHeartbeatData());
 	}
 
-	ComponentFactory DataFactory(false, NetDriver);
+	ComponentFactory DataFactory(false, NetDriver, Channel->GetFastArrayBaselines());
 
 	FRepChangeState InitialRepChanges = Channel->CreateInitialRepChangeState(Actor);
 	FHandoverChangeState InitialHandoverChanges = Channel->CreateInitialHandoverChangeState(Info);
@@ -265,7 +193,9 @@ Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel)
 	ComponentDatas.Append(DynamicComponentDatas);
 
 	InterestFactory InterestDataFactory(Actor, Info, NetDriver->ClassInfoManager, NetDriver->PackageMap);
-	ComponentDatas.Add(InterestDataFactory.CreateInterestData());
+	Interest InitialInterest = InterestDataFactory.CreateInterest();
+	ComponentDatas.Add(InitialInterest.CreateInterestData());
+	SentInterest.Add(Channel->GetEntityId(), MoveTemp(InitialInterest));
 
 	ComponentDatas.Add(ClientRPCEndpoint().CreateRPCEndpointData());
 	ComponentDatas.Add(ServerRPCEndpoint().CreateRPCEndpointData());
@@ -303,7 +233,7 @@ Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel)
 			{
 				if (SubobjectInfo.SchemaComponents[Type] != SpatialConstants::INVALID_COMPONENT_ID)
 				{
-					ComponentWriteAcl.Add(SubobjectInfo.SchemaComponents[Type], AuthoritativeWorkerRequirementSet);
+					ExtraAclComponents.AddUnique(SubobjectInfo.SchemaComponents[Type]);
 				}
 			});
 
@@ -315,20 +245,19 @@ Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel)
 	// Or if the subobject has handover properties, add it as well.
 	// NOTE: this is only for subobjects that are a part of the CDO.
 	// NOT dynamic subobjects which have been added before entity creation.
+	SubobjectIndex = 0;
 	for (auto& SubobjectInfoPair : Info.SubobjectInfo)
 	{
 		const FClassInfo& SubobjectInfo = SubobjectInfoPair.Value.Get();
 
-		// Static subobjects aren't guaranteed to exist on actor instances, check they are present before adding write acls
-		TWeakObjectPtr<UObject> WeakSubobject = PackageMap->GetObjectFromUnrealObjectRef(FUnrealObjectRef(Channel->GetEntityId(), SubobjectInfoPair.Key));
-		if (!WeakSubobject.IsValid())
+		// The template's write ACLs already include the handover components of present static subobjects.
+		if (!PresentSubobjects[SubobjectIndex++] || SubobjectInfo.SchemaComponents[SCHEMA_Handover] == SpatialConstants::INVALID_COMPONENT_ID)
 		{
 			continue;
 		}
 
-		UObject* Subobject = WeakSubobject.Get();
-
-		if (SubobjectInfo.SchemaComponents[SCHEMA_Handover] == SpatialConstants::INVALID_COMPONENT_ID)
+		UObject* Subobject = PackageMap->GetObjectFromUnrealObjectRef(FUnrealObjectRef(Channel->GetEntityId(), SubobjectInfoPair.Key)).Get();
+		if (Subobject == nullptr)
 		{
 			continue;
 		}
@@ -343,11 +272,15 @@ Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel)
 
 		Worker_ComponentData SubobjectHandoverData = DataFactory.CreateHandoverComponentData(SubobjectInfo.SchemaComponents[SCHEMA_Handover], Subobject, SubobjectInfo, SubobjectHandoverChanges);
 		ComponentDatas.Add(SubobjectHandoverData);
-
-		ComponentWriteAcl.Add(SubobjectInfo.SchemaComponents[SCHEMA_Handover], AuthoritativeWorkerRequirementSet);
 	}
 
-	ComponentDatas.Add(EntityAcl(ReadAcl, ComponentWriteAcl).CreateEntityAclData());
+	ComponentDatas.Add(EntityAclTemplates.CreateEntityAclData(AclTemplate, ClientWorkerAttribute, ExtraAclComponents));
+
+	for (const Worker_ComponentData& ComponentData : ComponentDatas)
+	{
+		CreatedEntityBytes += Schema_GetWriteBufferLength(Schema_GetComponentDataFields(ComponentData.schema_type));
+	}
+	EntitiesCreated++;
 
 	Worker_EntityId EntityId = Channel->GetEntityId();
 	Worker_RequestId CreateEntityRequestId = Connection->SendCreateEntityRequest(MoveTemp(ComponentDatas), &EntityId);
@@ -380,7 +313,7 @@ void USpatialSender::SendAddComponent(USpatialActorChannel* Channel, UObject* Su
 	FRepChangeState SubobjectRepChanges = Channel->CreateInitialRepChangeState(Subobject);
 	FHandoverChangeState SubobjectHandoverChanges = Channel->CreateInitialHandoverChangeState(SubobjectInfo);
 
-	ComponentFactory DataFactory(false, NetDriver);
+	ComponentFactory DataFactory(false, NetDriver, Channel->GetFastArrayBaselines());
 
 	TArray<Worker_ComponentData> SubobjectDatas = DataFactory.CreateComponentDatas(Subobject, SubobjectInfo, SubobjectRepChanges, SubobjectHandoverChanges);
 
@@ -395,8 +328,8 @@ void USpatialSender::SendAddComponent(USpatialActorChannel* Channel, UObject* Su
 void USpatialSender::GainAuthorityThenAddComponent(USpatialActorChannel* Channel, UObject* Object, const FClassInfo* Info)
 {
 	const FClassInfo& ActorInfo = ClassInfoManager->GetOrCreateClassInfoByClass(Channel->Actor->GetClass());
-	const WorkerAttributeSet WorkerAttribute{ ActorInfo.WorkerType.ToString() };
-	const WorkerRequirementSet AuthoritativeWorkerRequirementSet = { WorkerAttribute };
+	FWorkerAttributeTable& AttributeTable = FWorkerAttributeTable::Get();
+	const FRequirementSetHandle AuthoritativeWorkerRequirementSet = AttributeTable.InternRequirementSet(AttributeTable.InternAttribute(ActorInfo.WorkerType.ToString()));
 
 	EntityAcl* EntityACL = StaticComponentView->GetComponentData<EntityAcl>(Channel->GetEntityId());
 
@@ -516,10 +449,23 @@ void USpatialSender::SendComponentUpdates(UObject* Object, const FClassInfo& Inf
 
 	UE_LOG(LogSpatialSender, Verbose, TEXT("Sending component update (object: %s, entity: %lld)"), *Object->GetName(), EntityId);
 
-	ComponentFactory UpdateFactory(Channel->GetInterestDirty(), NetDriver);
+	ComponentFactory UpdateFactory(Channel->GetInterestDirty(), NetDriver, Channel->GetFastArrayBaselines());
 
 	TArray<Worker_ComponentUpdate> ComponentUpdates = UpdateFactory.CreateComponentUpdates(Object, Info, EntityId, RepChanges, HandoverChanges);
 
+	// Only support Interest for Actors for now.
+	if (UpdateFactory.HasInterestChanged())
+	{
+		if (AActor* Actor = Cast<AActor>(Object))
+		{
+			Worker_ComponentUpdate InterestUpdate;
+			if (CreateInterestUpdateIfChanged(Actor, Info, EntityId, InterestUpdate))
+			{
+				ComponentUpdates.Add(InterestUpdate);
+			}
+		}
+	}
+
 	for (Worker_ComponentUpdate& Update : ComponentUpdates)
 	{
 		if (!NetDriver->StaticComponentView->HasAuthority(EntityId, Update.component_id))
@@ -593,7 +539,9 @@ void USpatialSender::FlushPackedRPCs()
 		Connection->SendComponentUpdate(PlayerControllerEntityId, &ComponentUpdate);
 	}
 
-	RPCsToPack.Empty();
+	// The payloads have been copied into the component updates, so the arena can be reused for the next frame.
+	RPCsToPack.Reset();
+	RPCArena.Reset();
 }
 
 void FillComponentInterests(const FClassInfo& Info, bool bNetOwned, TArray<Worker_InterestOverride>& ComponentInterest)
@@ -642,7 +590,9 @@ RPCPayload USpatialSender::CreateRPCPayloadFromParams(UObject* TargetObject, con
 {
 	const FRPCInfo& RPCInfo = ClassInfoManager->GetRPCInfo(TargetObject, Function);
 
-	FSpatialNetBitWriter PayloadWriter = PackRPCDataToSpatialNetBitWriter(Function, Params, ReliableRPCIndex);
+	FSpatialNetBitWriter& PayloadWriter = *RPCWriter;
+	PayloadWriter.Reset();
+	PackRPCDataToSpatialNetBitWriter(Function, Params, ReliableRPCIndex, PayloadWriter);
 
 	return RPCPayload(TargetObjectRef.Offset, RPCInfo.Index, TArray<uint8>(PayloadWriter.GetData(), PayloadWriter.GetNumBytes()));
 }
@@ -663,6 +613,15 @@ void USpatialSender::SendComponentInterestForSubobject(const FClassInfo& Info, W
 	NetDriver->Connection->SendComponentInterest(EntityId, MoveTemp(ComponentInterest));
 }
 
+void USpatialSender::SendHeartbeatComponentInterest(Worker_EntityId EntityId, bool bInterested)
+{
+	checkf(NetDriver->IsServer(), TEXT("Tried to set Heartbeat ComponentInterest on a client-worker. This should never happen!"));
+
+	TArray<Worker_InterestOverride> ComponentInterest;
+	ComponentInterest.Add({ SpatialConstants::HEARTBEAT_COMPONENT_ID, bInterested });
+	NetDriver->Connection->SendComponentInterest(EntityId, MoveTemp(ComponentInterest));
+}
+
 void USpatialSender::SendPositionUpdate(Worker_EntityId EntityId, const FVector& Location)
 {
 #if !UE_BUILD_SHIPPING
@@ -958,10 +917,8 @@ void USpatialSender::ProcessOrQueueOutgoingRPC(const FUnrealObjectRef& InTargetO
 	OutgoingRPCs.ProcessRPCs();
 }
 
-FSpatialNetBitWriter USpatialSender::PackRPCDataToSpatialNetBitWriter(UFunction* Function, void* Parameters, int ReliableRPCId) const
+void USpatialSender::PackRPCDataToSpatialNetBitWriter(UFunction* Function, void* Parameters, int ReliableRPCId, FSpatialNetBitWriter& PayloadWriter) const
 {
-	FSpatialNetBitWriter PayloadWriter(PackageMap);
-
 	if (GetDefault<USpatialGDKSettings>()->bCheckRPCOrder)
 	{
 		if (Function->HasAnyFunctionFlags(FUNC_NetReliable) && !Function->HasAnyFunctionFlags(FUNC_NetMulticast))
@@ -972,8 +929,6 @@ FSpatialNetBitWriter USpatialSender::PackRPCDataToSpatialNetBitWriter(UFunction*
 
 	TSharedPtr<FRepLayout> RepLayout = NetDriver->GetFunctionRepLayout(Function);
 	RepLayout_SendPropertiesForRPC(*RepLayout, PayloadWriter, Parameters);
-
-	return PayloadWriter;
 }
 
 Worker_CommandRequest USpatialSender::CreateRPCCommandRequest(UObject* TargetObject, const RPCPayload& Payload, Worker_ComponentId ComponentId, Schema_FieldId CommandIndex, Worker_EntityId& OutEntityId)
@@ -1065,8 +1020,7 @@ ERPCResult USpatialSender::AddPendingRPC(UObject* TargetObject, UFunction* Funct
 	FPendingRPC RPC;
 	RPC.Offset = TargetObjectRef.Offset;
 	RPC.Index = RPCIndex;
-	RPC.Data.SetNumUninitialized(Payload.PayloadData.Num());
-	FMemory::Memcpy(RPC.Data.GetData(), Payload.PayloadData.GetData(), Payload.PayloadData.Num());
+	RPC.Data = RPCArena.Copy(Payload.PayloadData.GetData(), Payload.PayloadData.Num());
 	RPC.Entity = TargetObjectRef.Entity;
 	RPCsToPack.FindOrAdd(ControllerObjectRef.Entity).Emplace(MoveTemp(RPC));
 	return ERPCResult::Success;
@@ -1104,8 +1058,8 @@ bool USpatialSender::UpdateEntityACLs(Worker_EntityId EntityId, const FString& O
 		return false;
 	}
 
-	WorkerAttributeSet OwningClientAttribute = { OwnerWorkerAttribute };
-	WorkerRequirementSet OwningClientOnly = { OwningClientAttribute };
+	FWorkerAttributeTable& AttributeTable = FWorkerAttributeTable::Get();
+	const FRequirementSetHandle OwningClientOnly = AttributeTable.InternRequirementSet(AttributeTable.InternAttribute(OwnerWorkerAttribute));
 
 	EntityACL->ComponentWriteAcl.Add(SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID, OwningClientOnly);
 	Worker_ComponentUpdate Update = EntityACL->CreateEntityAclUpdate();
@@ -1123,10 +1077,62 @@ void USpatialSender::UpdateInterestComponent(AActor* Actor)
 		return;
 	}
 
-	InterestFactory InterestUpdateFactory(Actor, ClassInfoManager->GetOrCreateClassInfoByObject(Actor), NetDriver->ClassInfoManager, NetDriver->PackageMap);
-	Worker_ComponentUpdate Update = InterestUpdateFactory.CreateInterestUpdate();
+	Worker_ComponentUpdate Update;
+	if (CreateInterestUpdateIfChanged(Actor, ClassInfoManager->GetOrCreateClassInfoByObject(Actor), EntityId, Update))
+	{
+		Connection->SendComponentUpdate(EntityId, &Update);
+	}
+}
+
+bool USpatialSender::CreateInterestUpdateIfChanged(AActor* Actor, const FClassInfo& Info, Worker_EntityId EntityId, Worker_ComponentUpdate& OutUpdate)
+{
+	InterestFactory InterestUpdateFactory(Actor, Info, NetDriver->ClassInfoManager, NetDriver->PackageMap);
+	Interest NewInterest = InterestUpdateFactory.CreateInterest();
 
-	Connection->SendComponentUpdate(EntityId, &Update);
+	if (const Interest* LastInterest = SentInterest.Find(EntityId))
+	{
+		const TArray<uint32> ChangedComponents = Interest::GetChangedComponents(*LastInterest, NewInterest);
+		if (ChangedComponents.Num() == 0)
+		{
+			InterestUpdatesSkipped++;
+			return false;
+		}
+
+		UE_LOG(LogSpatialSender, Verbose, TEXT("Interest changed for %d component(s) on entity %lld (%s)"), ChangedComponents.Num(), EntityId, *Actor->GetName());
+	}
+
+	// The Interest schema is a single map field, which an update can only replace in full.
+	OutUpdate = NewInterest.CreateInterestUpdate();
+	InterestBytesSent += Schema_GetWriteBufferLength(Schema_GetComponentUpdateFields(OutUpdate.schema_type));
+
+	SentInterest.Add(EntityId, MoveTemp(NewInterest));
+	return true;
+}
+
+void USpatialSender::ClearSentInterest(Worker_EntityId EntityId)
+{
+	SentInterest.Remove(EntityId);
+}
+
+void USpatialSender::ConsumeInterestStats(uint64& OutBytesSent, uint32& OutUpdatesSkipped)
+{
+	OutBytesSent = InterestBytesSent;
+	OutUpdatesSkipped = InterestUpdatesSkipped;
+	InterestBytesSent = 0;
+	InterestUpdatesSkipped = 0;
+}
+
+void USpatialSender::ConsumeEntityCreationStats(uint64& OutBytesSent, uint32& OutEntitiesCreated)
+{
+	OutBytesSent = CreatedEntityBytes;
+	OutEntitiesCreated = EntitiesCreated;
+	CreatedEntityBytes = 0;
+	EntitiesCreated = 0;
+}
+
+void USpatialSender::ConsumeRPCArenaStats(int32& OutHighWaterMark, int32& OutBlocksAllocated)
+{
+	RPCArena.ConsumeStats(OutHighWaterMark, OutBlocksAllocated);
 }
 
 void USpatialSender::RetireEntity(const Worker_EntityId EntityId)
@@ -11,6 +11,9 @@ UGridBasedLBStrategy::UGridBasedLBStrategy()
 	, Cols(1)
 	, WorldWidth(10000.f)
 	, WorldHeight(10000.f)
+	, BoundaryHysteresis(0.f)
+	, WorldMin(FVector2D::ZeroVector)
+	, InverseCellSize(FVector2D::ZeroVector)
 {
 }
 
@@ -29,6 +32,9 @@ void UGridBasedLBStrategy::Init(const USpatialNetDriver* InNetDriver)
 	const float ColumnWidth = WorldWidth / Cols;
 	const float RowHeight = WorldHeight / Rows;
 
+	WorldMin = FVector2D(WorldWidthMin, WorldHeightMin);
+	InverseCellSize = FVector2D(1.f / ColumnWidth, 1.f / RowHeight);
+
 	float XMin = WorldWidthMin;
 	float YMin = WorldHeightMin;
 	float XMax, YMax;
@@ -60,16 +66,25 @@ TSet<uint32> UGridBasedLBStrategy::GetVirtualWorkerIds() const
 }
 
 bool UGridBasedLBStrategy::ShouldRelinquishAuthority(const AActor& Actor) const
+{
+	return ShouldRelinquishAuthority(FVector2D(SpatialGDK::GetActorSpatialPosition(&Actor)));
+}
+
+bool UGridBasedLBStrategy::ShouldRelinquishAuthority(const FVector2D& Location) const
 {
 	if (!IsReady())
 	{
 		return false;
 	}
 
-	const FVector2D Actor2DLocation = FVector2D(SpatialGDK::GetActorSpatialPosition(&Actor));
+	const FBox2D& LocalCell = WorkerCells[LocalVirtualWorkerId - 1];
 
+	if (BoundaryHysteresis > 0.f)
+	{
+		return !IsInside(LocalCell.ExpandBy(BoundaryHysteresis), Location);
+	}
 
-	return !IsInside(WorkerCells[LocalVirtualWorkerId - 1], Actor2DLocation);
+	return !IsInside(LocalCell, Location);
 }
 
 uint32 UGridBasedLBStrategy::WhoShouldHaveAuthority(const AActor& Actor) const
@@ -79,17 +94,72 @@ uint32 UGridBasedLBStrategy::WhoShouldHaveAuthority(const AActor& Actor) const
 		return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
 	}
 
-	const FVector2D Actor2DLocation = FVector2D(SpatialGDK::GetActorSpatialPosition(&Actor));
+	return WhoShouldHaveAuthority(FVector2D(SpatialGDK::GetActorSpatialPosition(&Actor)));
+}
+
+uint32 UGridBasedLBStrategy::WhoShouldHaveAuthority(const FVector2D& Location) const
+{
+	const int32 CellIndex = GetCellIndex(Location);
+	return CellIndex != INDEX_NONE ? VirtualWorkerIds[CellIndex] : SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+}
+
+void UGridBasedLBStrategy::WhoShouldHaveAuthority(const TArray<FVector2D>& Locations, TArray<uint32>& OutVirtualWorkerIds) const
+{
+	OutVirtualWorkerIds.SetNumUninitialized(Locations.Num());
 
-	for (int i = 0; i < WorkerCells.Num(); i++)
+	const FVector2D* LocationData = Locations.GetData();
+	uint32* OutData = OutVirtualWorkerIds.GetData();
+	for (int32 i = 0; i < Locations.Num(); i++)
 	{
-		if (IsInside(WorkerCells[i], Actor2DLocation))
-		{
-			return VirtualWorkerIds[i];
-		}
+		const int32 CellIndex = GetCellIndex(LocationData[i]);
+		OutData[i] = CellIndex != INDEX_NONE ? VirtualWorkerIds[CellIndex] : SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	}
+}
+
+int32 UGridBasedLBStrategy::GetCellIndex(const FVector2D& Location) const
+{
+	if (WorkerCells.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 NumCols = (int32)Cols;
+	const int32 NumRows = (int32)Rows;
+
+	int32 Col = FMath::FloorToInt((Location.X - WorldMin.X) * InverseCellSize.X);
+	int32 Row = FMath::FloorToInt((Location.Y - WorldMin.Y) * InverseCellSize.Y);
+	if (Col < 0 || Col >= NumCols || Row < 0 || Row >= NumRows)
+	{
+		// Rounding can put a location just inside the world's edge outside it, so leave the final say to the cell bounds below.
+		Col = FMath::Clamp(Col, 0, NumCols - 1);
+		Row = FMath::Clamp(Row, 0, NumRows - 1);
+	}
+
+	// The multiplication can round across a cell edge, so correct by at most one cell against the cell's own bounds.
+	const FBox2D& Cell = WorkerCells[Col * NumRows + Row];
+	if (Location.X < Cell.Min.X)
+	{
+		Col--;
+	}
+	else if (Location.X >= Cell.Max.X)
+	{
+		Col++;
+	}
+	if (Location.Y < Cell.Min.Y)
+	{
+		Row--;
+	}
+	else if (Location.Y >= Cell.Max.Y)
+	{
+		Row++;
+	}
+
+	if (Col < 0 || Col >= NumCols || Row < 0 || Row >= NumRows)
+	{
+		return INDEX_NONE;
 	}
 
-	return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	return Col * NumRows + Row;
 }
 
 bool UGridBasedLBStrategy::IsInside(const FBox2D& Box, const FVector2D& Location)
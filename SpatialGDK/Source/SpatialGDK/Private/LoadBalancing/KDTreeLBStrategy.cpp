@@ -0,0 +1,292 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "LoadBalancing/KDTreeLBStrategy.h"
+
+#include "EngineClasses/SpatialNetDriver.h"
+#include "Utils/SpatialActorUtils.h"
+
+UKDTreeLBStrategy::UKDTreeLBStrategy()
+	: Super()
+	, NumWorkers(1)
+	, WorldWidth(10000.f)
+	, WorldHeight(10000.f)
+	, EntityCountWeight(0.001f)
+	, RebalanceThreshold(0.2f)
+	, MinRebalanceInterval(5.f)
+	, MaxSplitMoveFraction(0.1f)
+	, MinRegionSize(1000.f)
+	, LastRebalanceTime(-FLT_MAX)
+{
+}
+
+void UKDTreeLBStrategy::Init(const USpatialNetDriver* InNetDriver)
+{
+	Super::Init(InNetDriver);
+
+	VirtualWorkerIds.Reset();
+	for (uint32 i = 1; i <= NumWorkers; i++)
+	{
+		VirtualWorkerIds.Add(i);
+	}
+
+	Nodes.Reset();
+	WorkerLeaves.Init(INDEX_NONE, NumWorkers);
+	WorkerCosts.Init(0.0, NumWorkers);
+	LastRebalanceTime = -FLT_MAX;
+
+	const FVector2D WorldExtent(WorldWidth / 2.f, WorldHeight / 2.f);
+	BuildNode(FBox2D(-WorldExtent, WorldExtent), 0, NumWorkers);
+}
+
+int32 UKDTreeLBStrategy::BuildNode(const FBox2D& Bounds, uint32 FirstWorkerIndex, uint32 Count)
+{
+	const int32 NodeIndex = Nodes.AddDefaulted();
+	{
+		FNode& Node = Nodes[NodeIndex];
+		Node.Bounds = Bounds;
+		Node.Children[0] = Node.Children[1] = INDEX_NONE;
+		Node.FirstWorkerIndex = FirstWorkerIndex;
+		Node.NumWorkersBelow = Count;
+		Node.StepFraction = MaxSplitMoveFraction;
+		Node.LastMoveDirection = 0;
+	}
+
+	if (Count == 1)
+	{
+		WorkerLeaves[FirstWorkerIndex] = NodeIndex;
+		return NodeIndex;
+	}
+
+	// Split along the longer axis, giving each side an area in proportion to its number of workers.
+	const uint32 LeftCount = Count / 2;
+	const bool bSplitX = Bounds.GetSize().X >= Bounds.GetSize().Y;
+	const float SplitFraction = (float)LeftCount / Count;
+
+	FBox2D LeftBounds = Bounds;
+	FBox2D RightBounds = Bounds;
+	const float Split = bSplitX ? FMath::Lerp(Bounds.Min.X, Bounds.Max.X, SplitFraction) : FMath::Lerp(Bounds.Min.Y, Bounds.Max.Y, SplitFraction);
+	(bSplitX ? LeftBounds.Max.X : LeftBounds.Max.Y) = Split;
+	(bSplitX ? RightBounds.Min.X : RightBounds.Min.Y) = Split;
+
+	const int32 LeftChild = BuildNode(LeftBounds, FirstWorkerIndex, LeftCount);
+	const int32 RightChild = BuildNode(RightBounds, FirstWorkerIndex + LeftCount, Count - LeftCount);
+
+	// Nodes may have been reallocated while building the children.
+	FNode& Node = Nodes[NodeIndex];
+	Node.Children[0] = LeftChild;
+	Node.Children[1] = RightChild;
+	Node.bSplitX = bSplitX;
+	Node.SplitFraction = SplitFraction;
+	Node.Split = Split;
+
+	return NodeIndex;
+}
+
+void UKDTreeLBStrategy::UpdateBounds(int32 NodeIndex, const FBox2D& Bounds)
+{
+	FNode& Node = Nodes[NodeIndex];
+	Node.Bounds = Bounds;
+
+	if (Node.Children[0] == INDEX_NONE)
+	{
+		return;
+	}
+
+	FBox2D LeftBounds = Bounds;
+	FBox2D RightBounds = Bounds;
+	Node.Split = Node.bSplitX ? FMath::Lerp(Bounds.Min.X, Bounds.Max.X, Node.SplitFraction) : FMath::Lerp(Bounds.Min.Y, Bounds.Max.Y, Node.SplitFraction);
+	(Node.bSplitX ? LeftBounds.Max.X : LeftBounds.Max.Y) = Node.Split;
+	(Node.bSplitX ? RightBounds.Min.X : RightBounds.Min.Y) = Node.Split;
+
+	const int32 LeftChild = Node.Children[0];
+	const int32 RightChild = Node.Children[1];
+	UpdateBounds(LeftChild, LeftBounds);
+	UpdateBounds(RightChild, RightBounds);
+}
+
+TSet<uint32> UKDTreeLBStrategy::GetVirtualWorkerIds() const
+{
+	return TSet<uint32>(VirtualWorkerIds);
+}
+
+bool UKDTreeLBStrategy::ShouldRelinquishAuthority(const AActor& Actor) const
+{
+	if (!IsReady())
+	{
+		return false;
+	}
+
+	return WhoShouldHaveAuthority(Actor) != LocalVirtualWorkerId;
+}
+
+uint32 UKDTreeLBStrategy::WhoShouldHaveAuthority(const AActor& Actor) const
+{
+	if (!IsReady())
+	{
+		return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	}
+
+	return WhoShouldHaveAuthority(FVector2D(SpatialGDK::GetActorSpatialPosition(&Actor)));
+}
+
+uint32 UKDTreeLBStrategy::WhoShouldHaveAuthority(const FVector2D& Location) const
+{
+	const int32 LeafIndex = FindLeaf(Location);
+	if (LeafIndex == INDEX_NONE)
+	{
+		return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	}
+
+	return VirtualWorkerIds[Nodes[LeafIndex].FirstWorkerIndex];
+}
+
+int32 UKDTreeLBStrategy::FindLeaf(const FVector2D& Location) const
+{
+	if (Nodes.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	// Locations outside the world belong to the nearest region.
+	int32 NodeIndex = 0;
+	while (Nodes[NodeIndex].Children[0] != INDEX_NONE)
+	{
+		const FNode& Node = Nodes[NodeIndex];
+		const float Coordinate = Node.bSplitX ? Location.X : Location.Y;
+		NodeIndex = Node.Children[Coordinate < Node.Split ? 0 : 1];
+	}
+
+	return NodeIndex;
+}
+
+const FBox2D& UKDTreeLBStrategy::GetWorkerRegion(uint32 VirtualWorkerId) const
+{
+	check(VirtualWorkerId >= 1 && VirtualWorkerId <= (uint32)WorkerLeaves.Num());
+	return Nodes[WorkerLeaves[VirtualWorkerId - 1]].Bounds;
+}
+
+void UKDTreeLBStrategy::SetWorkerLoad(uint32 VirtualWorkerId, double Load, int32 EntityCount)
+{
+	if (VirtualWorkerId < 1 || VirtualWorkerId > (uint32)WorkerCosts.Num())
+	{
+		return;
+	}
+
+	WorkerCosts[VirtualWorkerId - 1] = Load + EntityCountWeight * EntityCount;
+}
+
+double UKDTreeLBStrategy::GetSubtreeCost(const FNode& Node) const
+{
+	double Cost = 0.0;
+	for (uint32 i = Node.FirstWorkerIndex; i < Node.FirstWorkerIndex + Node.NumWorkersBelow; i++)
+	{
+		Cost += WorkerCosts[i];
+	}
+	return Cost;
+}
+
+bool UKDTreeLBStrategy::Rebalance(float CurrentTime)
+{
+	if (Nodes.Num() <= 1 || CurrentTime - LastRebalanceTime < MinRebalanceInterval)
+	{
+		return false;
+	}
+
+	double TotalCost = 0.0;
+	double MaxCost = 0.0;
+	for (double Cost : WorkerCosts)
+	{
+		TotalCost += Cost;
+		MaxCost = FMath::Max(MaxCost, Cost);
+	}
+
+	const double MeanCost = TotalCost / WorkerCosts.Num();
+	if (MeanCost <= 0.0 || MaxCost <= MeanCost * (1.0 + RebalanceThreshold))
+	{
+		return false;
+	}
+
+	bool bChanged = false;
+	for (FNode& Node : Nodes)
+	{
+		if (Node.Children[0] != INDEX_NONE)
+		{
+			bChanged |= RebalanceNode(Node);
+		}
+	}
+
+	if (bChanged)
+	{
+		UpdateBounds(0, Nodes[0].Bounds);
+		LastRebalanceTime = CurrentTime;
+	}
+
+	return bChanged;
+}
+
+bool UKDTreeLBStrategy::RebalanceNode(FNode& Node)
+{
+	const FNode& Left = Nodes[Node.Children[0]];
+	const FNode& Right = Nodes[Node.Children[1]];
+
+	const double LeftCost = GetSubtreeCost(Left);
+	const double RightCost = GetSubtreeCost(Right);
+	const double LeftCostPerWorker = LeftCost / Left.NumWorkersBelow;
+	const double RightCostPerWorker = RightCost / Right.NumWorkersBelow;
+
+	const double Heavier = FMath::Max(LeftCostPerWorker, RightCostPerWorker);
+	const double Lighter = FMath::Min(LeftCostPerWorker, RightCostPerWorker);
+	if (Heavier <= 0.0 || Heavier <= Lighter * (1.0 + RebalanceThreshold))
+	{
+		return false;
+	}
+
+	const float Min = Node.bSplitX ? Node.Bounds.Min.X : Node.Bounds.Min.Y;
+	const float Max = Node.bSplitX ? Node.Bounds.Max.X : Node.Bounds.Max.Y;
+	const float Extent = Max - Min;
+	if (Extent <= 2.f * MinRegionSize)
+	{
+		return false;
+	}
+
+	// Assuming each side's cost is spread evenly along the axis, find where the cost to the left
+	// of the split is in proportion to the number of workers on that side.
+	const double TargetLeftCost = (LeftCost + RightCost) * Left.NumWorkersBelow / Node.NumWorkersBelow;
+	float TargetSplit;
+	if (TargetLeftCost <= LeftCost)
+	{
+		const double LeftDensity = LeftCost / FMath::Max(Node.Split - Min, KINDA_SMALL_NUMBER);
+		TargetSplit = Min + TargetLeftCost / LeftDensity;
+	}
+	else
+	{
+		const double RightDensity = RightCost / FMath::Max(Max - Node.Split, KINDA_SMALL_NUMBER);
+		TargetSplit = RightDensity > 0.0 ? Node.Split + (TargetLeftCost - LeftCost) / RightDensity : Max;
+	}
+
+	// Load is rarely even within a region, so the estimate overshoots when a crowd is near the split. The step shrinks
+	// each time the split changes direction and grows back while it keeps going the same way, homing in on the crowd.
+	const int8 MoveDirection = TargetSplit < Node.Split ? -1 : 1;
+	if (Node.LastMoveDirection != 0 && MoveDirection != Node.LastMoveDirection)
+	{
+		Node.StepFraction *= 0.5f;
+	}
+	else
+	{
+		Node.StepFraction = FMath::Min(Node.StepFraction * 1.5f, MaxSplitMoveFraction);
+	}
+	Node.LastMoveDirection = MoveDirection;
+
+	const float MaxMove = Node.StepFraction * Extent;
+	TargetSplit = FMath::Clamp(TargetSplit, Node.Split - MaxMove, Node.Split + MaxMove);
+	TargetSplit = FMath::Clamp(TargetSplit, Min + MinRegionSize, Max - MinRegionSize);
+
+	const float NewSplitFraction = (TargetSplit - Min) / Extent;
+	if (FMath::IsNearlyEqual(NewSplitFraction, Node.SplitFraction))
+	{
+		return false;
+	}
+
+	Node.SplitFraction = NewSplitFraction;
+	return true;
+}
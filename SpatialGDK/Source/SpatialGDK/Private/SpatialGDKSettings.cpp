@@ -22,6 +22,9 @@ USpatialGDKSettings::USpatialGDKSettings(const FObjectInitializer& ObjectInitial
 	, UseIsActorRelevantForConnection(false)
 	, OpsUpdateRate(1000.0f)
 	, bEnableHandover(true)
+	, bOnDemandHandover(false)
+	, HandoverCaptureIntervalSeconds(1.0f)
+	, bCoalesceOpLists(false)
 	, MaxNetCullDistanceSquared(900000000.0f) // Set to twice the default Actor NetCullDistanceSquared (300m)
 	, QueuedIncomingRPCWaitTime(1.0f)
 	, PositionUpdateFrequency(1.0f)
@@ -30,8 +33,18 @@ USpatialGDKSettings::USpatialGDKSettings(const FObjectInitializer& ObjectInitial
 	, bEnableMetricsDisplay(false)
 	, MetricsReportRate(2.0f)
 	, bUseFrameTimeAsLoad(false)
+	, bWriteLatencyHistogramsToFile(false)
 	, bCheckRPCOrder(false)
 	, bBatchSpatialPositionUpdates(true)
+	, bUseDormantColdStorage(false)
+	, bEnableActorPooling(false)
+	, EntityMaterializationBudgetMs(0.0f)
+	, bAsyncLoadEntityClasses(false)
+	, bOmitDefaultPropertiesFromInitialData(false)
+	, bUseFastArrayDeltaReplication(false)
+	, bUseCompactSchemaDatabase(false)
+	, bWarmUpClassInfo(false)
+	, ClassInfoWarmUpBudgetMs(0.0f)
 	, MaxDynamicallyAttachedSubobjectsPerClass(3)
 	, bEnableServerQBI(true)
 	, bPackRPCs(false)
@@ -41,6 +54,8 @@ USpatialGDKSettings::USpatialGDKSettings(const FObjectInitializer& ObjectInitial
 	, bEnableOffloading(false)
 	, ServerWorkerTypes({ SpatialConstants::DefaultServerWorkerType })
 	, WorkerLogLevel(ESettingsWorkerLogVerbosity::Warning)
+	, MaxBufferedLogMessages(1024)
+	, MaxLogMessagesPerCategoryPerSecond(100)
 	, bEnableUnrealLoadBalancer(false)
 {
 	DefaultReceptionistHost = SpatialConstants::LOCAL_HOST;
@@ -0,0 +1,132 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/ActorPool.h"
+
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+DEFINE_LOG_CATEGORY(LogActorPool);
+
+namespace SpatialGDK
+{
+
+void FActorPool::SetClassCap(const FSoftObjectPath& ClassPath, int32 Cap)
+{
+	ClassPathCaps.Add(ClassPath, FMath::Max(Cap, 0));
+	ClassCaps.Empty();
+}
+
+int32 FActorPool::GetClassCap(UClass* Class)
+{
+	if (ClassPathCaps.Num() == 0)
+	{
+		return 0;
+	}
+
+	if (int32* Cap = ClassCaps.Find(Class))
+	{
+		return *Cap;
+	}
+
+	const int32* PathCap = ClassPathCaps.Find(FSoftObjectPath(Class));
+	return ClassCaps.Add(Class, PathCap != nullptr ? *PathCap : 0);
+}
+
+AActor* FActorPool::Acquire(UWorld* World, UClass* Class, const FTransform& Transform)
+{
+	TArray<TWeakObjectPtr<AActor>>* Actors = IdleActors.Find(Class);
+	if (Actors == nullptr)
+	{
+		return nullptr;
+	}
+
+	while (Actors->Num() > 0)
+	{
+		AActor* Actor = Actors->Pop(/* bAllowShrinking */ false).Get();
+
+		// Idle actors can be destroyed by other code, or left behind by a level being unloaded.
+		if (Actor == nullptr || Actor->IsPendingKill() || Actor->GetWorld() != World)
+		{
+			continue;
+		}
+
+		const AActor* DefaultActor = Class->GetDefaultObject<AActor>();
+
+		Actor->SetActorTransform(Transform, /* bSweep */ false, nullptr, ETeleportType::ResetPhysics);
+		Actor->SetActorHiddenInGame(DefaultActor->bHidden);
+		Actor->SetActorEnableCollision(DefaultActor->GetActorEnableCollision());
+		Actor->SetActorTickEnabled(DefaultActor->PrimaryActorTick.bStartWithTickEnabled);
+
+		if (Actor->GetClass()->ImplementsInterface(USpatialPooledActor::StaticClass()))
+		{
+			ISpatialPooledActor::Execute_OnTakenFromPool(Actor);
+		}
+
+		NumReused++;
+		return Actor;
+	}
+
+	return nullptr;
+}
+
+bool FActorPool::Release(AActor* Actor)
+{
+	check(Actor != nullptr);
+
+	UClass* Class = Actor->GetClass();
+	const int32 Cap = GetClassCap(Class);
+	if (Cap <= 0)
+	{
+		return false;
+	}
+
+	TArray<TWeakObjectPtr<AActor>>& Actors = IdleActors.FindOrAdd(Class);
+	if (Actors.Num() >= Cap)
+	{
+		return false;
+	}
+
+	Actor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+	Actor->SetOwner(nullptr);
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+
+	if (Class->ImplementsInterface(USpatialPooledActor::StaticClass()))
+	{
+		ISpatialPooledActor::Execute_OnReturnedToPool(Actor);
+	}
+
+	Actors.Add(Actor);
+
+	UE_LOG(LogActorPool, Verbose, TEXT("Returned %s to the pool (%d/%d idle)."), *Actor->GetName(), Actors.Num(), Cap);
+	return true;
+}
+
+void FActorPool::Empty()
+{
+	for (auto& Pair : IdleActors)
+	{
+		for (const TWeakObjectPtr<AActor>& Actor : Pair.Value)
+		{
+			if (Actor.IsValid())
+			{
+				Actor->Destroy();
+			}
+		}
+	}
+
+	IdleActors.Empty();
+}
+
+int32 FActorPool::Num() const
+{
+	int32 Count = 0;
+	for (const auto& Pair : IdleActors)
+	{
+		Count += Pair.Value.Num();
+	}
+	return Count;
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,702 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/CompactSchemaDatabase.h"
+
+#include "HAL/PlatformFilemanager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+
+#include "Utils/SchemaDatabase.h"
+
+DEFINE_LOG_CATEGORY(LogCompactSchemaDatabase);
+
+namespace SpatialGDK
+{
+
+namespace
+{
+	const uint32 Alignment = 8;
+
+	class FBlobWriter
+	{
+	public:
+		uint32 Tell() const { return Blob.Num(); }
+
+		void Pad()
+		{
+			Blob.AddZeroed(Align(Blob.Num(), Alignment) - Blob.Num());
+		}
+
+		template <typename T>
+		uint32 WriteArray(const TArray<T>& Items)
+		{
+			Pad();
+			uint32 Offset = Tell();
+			Blob.Append(reinterpret_cast<const uint8*>(Items.GetData()), Items.Num() * sizeof(T));
+			return Offset;
+		}
+
+		TArray<uint8> Blob;
+	};
+
+	// Interns every path and name once, in first-seen order.
+	class FStringTableBuilder
+	{
+	public:
+		uint32 Intern(const FString& String)
+		{
+			if (const uint32* Existing = StringToId.Find(String))
+			{
+				return *Existing;
+			}
+
+			FTCHARToUTF8 Converted(*String);
+
+			FCompactSchemaDatabase::FStringEntry Entry;
+			Entry.Offset = StringData.Num();
+			Entry.Length = Converted.Length();
+			StringData.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+			StringData.Add(0);
+
+			uint32 Id = Entries.Add(Entry);
+			StringToId.Add(String, Id);
+			return Id;
+		}
+
+		uint64 Hash(uint32 StringId) const
+		{
+			const FCompactSchemaDatabase::FStringEntry& Entry = Entries[StringId];
+			return FCompactSchemaDatabase::HashPath(reinterpret_cast<const ANSICHAR*>(StringData.GetData() + Entry.Offset), Entry.Length);
+		}
+
+		TArray<FCompactSchemaDatabase::FStringEntry> Entries;
+		TArray<uint8> StringData;
+
+	private:
+		TMap<FString, uint32> StringToId;
+	};
+
+	void SortKeys(TArray<FCompactSchemaDatabase::FPathKey>& Keys)
+	{
+		Keys.Sort([](const FCompactSchemaDatabase::FPathKey& A, const FCompactSchemaDatabase::FPathKey& B)
+		{
+			return A.Hash < B.Hash;
+		});
+	}
+
+	template <typename T>
+	void SortEntries(TArray<TPair<FCompactSchemaDatabase::FPathKey, T>>& Entries)
+	{
+		Entries.Sort([](const TPair<FCompactSchemaDatabase::FPathKey, T>& A, const TPair<FCompactSchemaDatabase::FPathKey, T>& B)
+		{
+			return A.Key.Hash < B.Key.Hash;
+		});
+	}
+
+	bool IsRangeValid(uint32 Offset, uint32 Count, uint32 ElementSize, uint32 Size)
+	{
+		const uint64 End = uint64(Offset) + uint64(Count) * uint64(ElementSize);
+		return (Offset % Alignment) == 0 && End <= Size;
+	}
+} // anonymous namespace
+
+FCompactSchemaDatabase::~FCompactSchemaDatabase()
+{
+	Reset();
+}
+
+uint64 FCompactSchemaDatabase::HashPath(const ANSICHAR* Path, int32 Length)
+{
+	// 64-bit FNV-1a over the lower-cased bytes.
+	uint64 Hash = 14695981039346656037ull;
+	for (int32 i = 0; i < Length; i++)
+	{
+		Hash ^= uint64(uint8(FCharAnsi::ToLower(Path[i])));
+		Hash *= 1099511628211ull;
+	}
+	return Hash;
+}
+
+TArray<uint8> FCompactSchemaDatabase::Serialize(const USchemaDatabase& SchemaDatabase, const FMD5Hash& SchemaDatabaseHash)
+{
+	FStringTableBuilder Strings;
+
+	// Actor classes. Records are laid out in key order so a key's Value is simply its position.
+	TArray<TPair<FPathKey, const FActorSchemaData*>> ActorEntries;
+	for (const auto& Pair : SchemaDatabase.ActorClassPathToSchema)
+	{
+		uint32 StringId = Strings.Intern(Pair.Key);
+		ActorEntries.Emplace(FPathKey{ Strings.Hash(StringId), StringId, 0 }, &Pair.Value);
+	}
+	SortEntries(ActorEntries);
+
+	TArray<FPathKey> ActorKeys;
+	TArray<FActorRecord> Actors;
+	TArray<FActorSubobjectRecord> ActorSubobjects;
+	for (auto& Entry : ActorEntries)
+	{
+		const FActorSchemaData& ActorData = *Entry.Value;
+
+		FActorRecord Record;
+		Record.GeneratedSchemaNameId = Strings.Intern(ActorData.GeneratedSchemaName);
+		FMemory::Memcpy(Record.SchemaComponents, ActorData.SchemaComponents, sizeof(Record.SchemaComponents));
+		Record.FirstSubobject = ActorSubobjects.Num();
+		Record.NumSubobjects = ActorData.SubobjectData.Num();
+
+		TArray<uint32> Offsets;
+		ActorData.SubobjectData.GetKeys(Offsets);
+		Offsets.Sort();
+		for (uint32 Offset : Offsets)
+		{
+			const FActorSpecificSubobjectSchemaData& SubobjectData = ActorData.SubobjectData[Offset];
+
+			FActorSubobjectRecord SubobjectRecord;
+			SubobjectRecord.Offset = Offset;
+			SubobjectRecord.ClassPathId = Strings.Intern(SubobjectData.ClassPath);
+			SubobjectRecord.NameId = Strings.Intern(SubobjectData.Name.ToString());
+			FMemory::Memcpy(SubobjectRecord.SchemaComponents, SubobjectData.SchemaComponents, sizeof(SubobjectRecord.SchemaComponents));
+			ActorSubobjects.Add(SubobjectRecord);
+		}
+
+		Entry.Key.Value = Actors.Add(Record);
+		ActorKeys.Add(Entry.Key);
+	}
+
+	// Subobject classes.
+	TArray<TPair<FPathKey, const FSubobjectSchemaData*>> SubobjectClassEntries;
+	for (const auto& Pair : SchemaDatabase.SubobjectClassPathToSchema)
+	{
+		uint32 StringId = Strings.Intern(Pair.Key);
+		SubobjectClassEntries.Emplace(FPathKey{ Strings.Hash(StringId), StringId, 0 }, &Pair.Value);
+	}
+	SortEntries(SubobjectClassEntries);
+
+	TArray<FPathKey> SubobjectClassKeys;
+	TArray<FSubobjectClassRecord> SubobjectClasses;
+	TArray<FDynamicSubobjectRecord> DynamicSubobjects;
+	for (auto& Entry : SubobjectClassEntries)
+	{
+		const FSubobjectSchemaData& SubobjectData = *Entry.Value;
+
+		FSubobjectClassRecord Record;
+		Record.GeneratedSchemaNameId = Strings.Intern(SubobjectData.GeneratedSchemaName);
+		Record.FirstDynamicSubobject = DynamicSubobjects.Num();
+		Record.NumDynamicSubobjects = SubobjectData.DynamicSubobjectComponents.Num();
+
+		for (const FDynamicSubobjectSchemaData& DynamicData : SubobjectData.DynamicSubobjectComponents)
+		{
+			FDynamicSubobjectRecord DynamicRecord;
+			FMemory::Memcpy(DynamicRecord.SchemaComponents, DynamicData.SchemaComponents, sizeof(DynamicRecord.SchemaComponents));
+			DynamicSubobjects.Add(DynamicRecord);
+		}
+
+		Entry.Key.Value = SubobjectClasses.Add(Record);
+		SubobjectClassKeys.Add(Entry.Key);
+	}
+
+	// Levels. The key value is the level's component ID.
+	TArray<FPathKey> LevelKeys;
+	for (const auto& Pair : SchemaDatabase.LevelPathToComponentId)
+	{
+		uint32 StringId = Strings.Intern(Pair.Key);
+		LevelKeys.Add(FPathKey{ Strings.Hash(StringId), StringId, Pair.Value });
+	}
+	SortKeys(LevelKeys);
+
+	TArray<FComponentClassPathRecord> ComponentClassPaths;
+	for (const auto& Pair : SchemaDatabase.ComponentIdToClassPath)
+	{
+		ComponentClassPaths.Add(FComponentClassPathRecord{ Pair.Key, Strings.Intern(Pair.Value) });
+	}
+	ComponentClassPaths.Sort([](const FComponentClassPathRecord& A, const FComponentClassPathRecord& B)
+	{
+		return A.ComponentId < B.ComponentId;
+	});
+
+	TArray<uint32> LevelComponentIds = SchemaDatabase.LevelComponentIds.Array();
+	LevelComponentIds.Sort();
+
+	FBlobWriter Writer;
+	Writer.Blob.AddZeroed(sizeof(FHeader));
+
+	FHeader Header;
+	FMemory::Memzero(Header);
+	Header.Magic = Magic;
+	Header.Version = Version;
+	Header.SchemaComponentCount = SCHEMA_Count;
+	Header.NextAvailableComponentId = SchemaDatabase.NextAvailableComponentId;
+	if (SchemaDatabaseHash.IsValid())
+	{
+		check(SchemaDatabaseHash.GetSize() == sizeof(Header.SchemaDatabaseHash));
+		FMemory::Memcpy(Header.SchemaDatabaseHash, SchemaDatabaseHash.GetBytes(), sizeof(Header.SchemaDatabaseHash));
+	}
+
+	Header.NumStrings = Strings.Entries.Num();
+	Header.StringsOffset = Writer.WriteArray(Strings.Entries);
+	Header.StringDataSize = Strings.StringData.Num();
+	Header.StringDataOffset = Writer.WriteArray(Strings.StringData);
+
+	Header.NumActors = Actors.Num();
+	Header.ActorKeysOffset = Writer.WriteArray(ActorKeys);
+	Header.ActorsOffset = Writer.WriteArray(Actors);
+
+	Header.NumActorSubobjects = ActorSubobjects.Num();
+	Header.ActorSubobjectsOffset = Writer.WriteArray(ActorSubobjects);
+
+	Header.NumSubobjectClasses = SubobjectClasses.Num();
+	Header.SubobjectClassKeysOffset = Writer.WriteArray(SubobjectClassKeys);
+	Header.SubobjectClassesOffset = Writer.WriteArray(SubobjectClasses);
+
+	Header.NumDynamicSubobjects = DynamicSubobjects.Num();
+	Header.DynamicSubobjectsOffset = Writer.WriteArray(DynamicSubobjects);
+
+	Header.NumLevels = LevelKeys.Num();
+	Header.LevelKeysOffset = Writer.WriteArray(LevelKeys);
+
+	Header.NumComponentClassPaths = ComponentClassPaths.Num();
+	Header.ComponentClassPathsOffset = Writer.WriteArray(ComponentClassPaths);
+
+	Header.NumLevelComponentIds = LevelComponentIds.Num();
+	Header.LevelComponentIdsOffset = Writer.WriteArray(LevelComponentIds);
+
+	Writer.Pad();
+	FMemory::Memcpy(Writer.Blob.GetData(), &Header, sizeof(FHeader));
+
+	return MoveTemp(Writer.Blob);
+}
+
+bool FCompactSchemaDatabase::WriteToFile(const USchemaDatabase& SchemaDatabase, const FMD5Hash& SchemaDatabaseHash, const FString& Filename)
+{
+	TArray<uint8> Blob = Serialize(SchemaDatabase, SchemaDatabaseHash);
+	if (!FFileHelper::SaveArrayToFile(Blob, *Filename))
+	{
+		UE_LOG(LogCompactSchemaDatabase, Error, TEXT("Failed to write compact schema database to %s"), *Filename);
+		return false;
+	}
+
+	UE_LOG(LogCompactSchemaDatabase, Log, TEXT("Wrote compact schema database to %s (%d bytes)"), *Filename, Blob.Num());
+	return true;
+}
+
+FString FCompactSchemaDatabase::GetDefaultFilename()
+{
+	return FPaths::Combine(FPaths::ProjectContentDir(), SpatialConstants::COMPACT_SCHEMA_DATABASE_FILE_PATH);
+}
+
+FString FCompactSchemaDatabase::GetSchemaDatabaseAssetFilename()
+{
+	return FPaths::Combine(FPaths::ProjectContentDir(), SpatialConstants::SCHEMA_DATABASE_FILE_PATH + FPackageName::GetAssetPackageExtension());
+}
+
+bool FCompactSchemaDatabase::IsBakedFrom(const FMD5Hash& SchemaDatabaseHash) const
+{
+	const FHeader& Header = GetHeader();
+	return SchemaDatabaseHash.IsValid() && SchemaDatabaseHash.GetSize() == sizeof(Header.SchemaDatabaseHash)
+		&& FMemory::Memcmp(Header.SchemaDatabaseHash, SchemaDatabaseHash.GetBytes(), sizeof(Header.SchemaDatabaseHash)) == 0;
+}
+
+bool FCompactSchemaDatabase::LoadFromFile(const FString& Filename)
+{
+	Reset();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.FileExists(*Filename))
+	{
+		return false;
+	}
+
+	MappedFile.Reset(PlatformFile.OpenMapped(*Filename));
+	if (MappedFile.IsValid())
+	{
+		MappedRegion.Reset(MappedFile->MapRegion());
+		if (MappedRegion.IsValid() && SetData(MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize()))
+		{
+			return true;
+		}
+
+		Reset();
+	}
+
+	// Platforms (and pak files) without mapping support fall back to a single read.
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, *Filename))
+	{
+		return false;
+	}
+
+	return LoadFromMemory(MoveTemp(FileData));
+}
+
+bool FCompactSchemaDatabase::LoadFromMemory(TArray<uint8>&& InData)
+{
+	Reset();
+	OwnedData = MoveTemp(InData);
+	if (!SetData(OwnedData.GetData(), OwnedData.Num()))
+	{
+		Reset();
+		return false;
+	}
+	return true;
+}
+
+void FCompactSchemaDatabase::Reset()
+{
+	Data = nullptr;
+	Size = 0;
+	OwnedData.Empty();
+	MappedRegion.Reset();
+	MappedFile.Reset();
+}
+
+bool FCompactSchemaDatabase::SetData(const uint8* InData, uint32 InSize)
+{
+	Data = InData;
+	Size = InSize;
+
+	if (!Validate())
+	{
+		Data = nullptr;
+		Size = 0;
+		return false;
+	}
+
+	return true;
+}
+
+bool FCompactSchemaDatabase::Validate() const
+{
+	if (Data == nullptr || Size < sizeof(FHeader))
+	{
+		UE_LOG(LogCompactSchemaDatabase, Warning, TEXT("Compact schema database is truncated."));
+		return false;
+	}
+
+	const FHeader& Header = *reinterpret_cast<const FHeader*>(Data);
+	if (Header.Magic != Magic || Header.Version != Version || Header.SchemaComponentCount != SCHEMA_Count)
+	{
+		UE_LOG(LogCompactSchemaDatabase, Warning, TEXT("Compact schema database has an incompatible format (magic %x, version %u). Regenerate schema to rebuild it."), Header.Magic, Header.Version);
+		return false;
+	}
+
+	const bool bValid = IsRangeValid(Header.StringsOffset, Header.NumStrings, sizeof(FStringEntry), Size)
+		&& IsRangeValid(Header.StringDataOffset, Header.StringDataSize, 1, Size)
+		&& IsRangeValid(Header.ActorKeysOffset, Header.NumActors, sizeof(FPathKey), Size)
+		&& IsRangeValid(Header.ActorsOffset, Header.NumActors, sizeof(FActorRecord), Size)
+		&& IsRangeValid(Header.ActorSubobjectsOffset, Header.NumActorSubobjects, sizeof(FActorSubobjectRecord), Size)
+		&& IsRangeValid(Header.SubobjectClassKeysOffset, Header.NumSubobjectClasses, sizeof(FPathKey), Size)
+		&& IsRangeValid(Header.SubobjectClassesOffset, Header.NumSubobjectClasses, sizeof(FSubobjectClassRecord), Size)
+		&& IsRangeValid(Header.DynamicSubobjectsOffset, Header.NumDynamicSubobjects, sizeof(FDynamicSubobjectRecord), Size)
+		&& IsRangeValid(Header.LevelKeysOffset, Header.NumLevels, sizeof(FPathKey), Size)
+		&& IsRangeValid(Header.ComponentClassPathsOffset, Header.NumComponentClassPaths, sizeof(FComponentClassPathRecord), Size)
+		&& IsRangeValid(Header.LevelComponentIdsOffset, Header.NumLevelComponentIds, sizeof(uint32), Size);
+
+	if (!bValid)
+	{
+		UE_LOG(LogCompactSchemaDatabase, Warning, TEXT("Compact schema database is corrupt: a table lies outside of the file."));
+		return false;
+	}
+
+	if (!ValidateRecords())
+	{
+		UE_LOG(LogCompactSchemaDatabase, Warning, TEXT("Compact schema database is corrupt: a record refers outside of its table."));
+		return false;
+	}
+
+	return true;
+}
+
+bool FCompactSchemaDatabase::ValidateRecords() const
+{
+	// Checked once here so that lookups can index the tables without bounds checks.
+	const FHeader& Header = GetHeader();
+
+	const auto IsStringId = [&Header](uint32 StringId)
+	{
+		return StringId < Header.NumStrings;
+	};
+	const auto IsSpanValid = [](uint32 First, uint32 Num, uint32 TableSize)
+	{
+		return uint64(First) + uint64(Num) <= uint64(TableSize);
+	};
+	const auto AreKeysValid = [&](uint32 KeysOffset, uint32 NumKeys, uint32 NumValues)
+	{
+		const FPathKey* Keys = GetArray<FPathKey>(KeysOffset);
+		for (uint32 i = 0; i < NumKeys; i++)
+		{
+			if (!IsStringId(Keys[i].StringId) || (NumValues > 0 && Keys[i].Value >= NumValues) || (i > 0 && Keys[i - 1].Hash > Keys[i].Hash))
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+
+	const FStringEntry* Strings = GetArray<FStringEntry>(Header.StringsOffset);
+	for (uint32 i = 0; i < Header.NumStrings; i++)
+	{
+		// Each string is followed by its null terminator.
+		if (uint64(Strings[i].Offset) + uint64(Strings[i].Length) + 1 > uint64(Header.StringDataSize))
+		{
+			return false;
+		}
+	}
+
+	// Level keys hold component IDs rather than record indices, so only their strings are checked.
+	if (!AreKeysValid(Header.ActorKeysOffset, Header.NumActors, Header.NumActors)
+		|| !AreKeysValid(Header.SubobjectClassKeysOffset, Header.NumSubobjectClasses, Header.NumSubobjectClasses)
+		|| !AreKeysValid(Header.LevelKeysOffset, Header.NumLevels, 0))
+	{
+		return false;
+	}
+
+	const FActorRecord* Actors = GetArray<FActorRecord>(Header.ActorsOffset);
+	for (uint32 i = 0; i < Header.NumActors; i++)
+	{
+		if (!IsStringId(Actors[i].GeneratedSchemaNameId) || !IsSpanValid(Actors[i].FirstSubobject, Actors[i].NumSubobjects, Header.NumActorSubobjects))
+		{
+			return false;
+		}
+	}
+
+	const FActorSubobjectRecord* ActorSubobjects = GetArray<FActorSubobjectRecord>(Header.ActorSubobjectsOffset);
+	for (uint32 i = 0; i < Header.NumActorSubobjects; i++)
+	{
+		if (!IsStringId(ActorSubobjects[i].ClassPathId) || !IsStringId(ActorSubobjects[i].NameId))
+		{
+			return false;
+		}
+	}
+
+	const FSubobjectClassRecord* SubobjectClasses = GetArray<FSubobjectClassRecord>(Header.SubobjectClassesOffset);
+	for (uint32 i = 0; i < Header.NumSubobjectClasses; i++)
+	{
+		if (!IsStringId(SubobjectClasses[i].GeneratedSchemaNameId)
+			|| !IsSpanValid(SubobjectClasses[i].FirstDynamicSubobject, SubobjectClasses[i].NumDynamicSubobjects, Header.NumDynamicSubobjects))
+		{
+			return false;
+		}
+	}
+
+	const FComponentClassPathRecord* ComponentClassPaths = GetArray<FComponentClassPathRecord>(Header.ComponentClassPathsOffset);
+	for (uint32 i = 0; i < Header.NumComponentClassPaths; i++)
+	{
+		if (!IsStringId(ComponentClassPaths[i].ClassPathId) || (i > 0 && ComponentClassPaths[i - 1].ComponentId >= ComponentClassPaths[i].ComponentId))
+		{
+			return false;
+		}
+	}
+
+	const uint32* LevelComponentIds = GetArray<uint32>(Header.LevelComponentIdsOffset);
+	for (uint32 i = 1; i < Header.NumLevelComponentIds; i++)
+	{
+		if (LevelComponentIds[i - 1] >= LevelComponentIds[i])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+const FCompactSchemaDatabase::FPathKey* FCompactSchemaDatabase::FindPathKey(uint32 KeysOffset, uint32 NumKeys, const FString& Path) const
+{
+	if (NumKeys == 0)
+	{
+		return nullptr;
+	}
+
+	FTCHARToUTF8 Converted(*Path);
+	const uint64 Hash = HashPath(Converted.Get(), Converted.Length());
+
+	const FPathKey* Keys = GetArray<FPathKey>(KeysOffset);
+
+	// Lower bound on the hash.
+	uint32 Low = 0;
+	uint32 High = NumKeys;
+	while (Low < High)
+	{
+		const uint32 Mid = Low + (High - Low) / 2;
+		if (Keys[Mid].Hash < Hash)
+		{
+			Low = Mid + 1;
+		}
+		else
+		{
+			High = Mid;
+		}
+	}
+
+	const FStringEntry* StringEntries = GetArray<FStringEntry>(GetHeader().StringsOffset);
+	const ANSICHAR* StringData = GetArray<ANSICHAR>(GetHeader().StringDataOffset);
+
+	// Walk all keys sharing this hash; collisions are expected to be vanishingly rare.
+	for (uint32 i = Low; i < NumKeys && Keys[i].Hash == Hash; i++)
+	{
+		const FStringEntry& Entry = StringEntries[Keys[i].StringId];
+		if (Entry.Length == uint32(Converted.Length()) && FCStringAnsi::Strnicmp(StringData + Entry.Offset, Converted.Get(), Entry.Length) == 0)
+		{
+			return &Keys[i];
+		}
+	}
+
+	return nullptr;
+}
+
+const FCompactSchemaDatabase::FActorRecord* FCompactSchemaDatabase::FindActor(const FString& ClassPath) const
+{
+	const FHeader& Header = GetHeader();
+	if (const FPathKey* Key = FindPathKey(Header.ActorKeysOffset, Header.NumActors, ClassPath))
+	{
+		return &GetArray<FActorRecord>(Header.ActorsOffset)[Key->Value];
+	}
+	return nullptr;
+}
+
+const uint32* FCompactSchemaDatabase::FindActorSchemaComponents(const FString& ClassPath) const
+{
+	const FActorRecord* Actor = FindActor(ClassPath);
+	return Actor != nullptr ? Actor->SchemaComponents : nullptr;
+}
+
+const FCompactSchemaDatabase::FSubobjectClassRecord* FCompactSchemaDatabase::FindSubobjectClass(const FString& ClassPath) const
+{
+	const FHeader& Header = GetHeader();
+	if (const FPathKey* Key = FindPathKey(Header.SubobjectClassKeysOffset, Header.NumSubobjectClasses, ClassPath))
+	{
+		return &GetArray<FSubobjectClassRecord>(Header.SubobjectClassesOffset)[Key->Value];
+	}
+	return nullptr;
+}
+
+bool FCompactSchemaDatabase::ContainsClassPath(const FString& ClassPath) const
+{
+	return FindActor(ClassPath) != nullptr || FindSubobjectClass(ClassPath) != nullptr;
+}
+
+void FCompactSchemaDatabase::ForEachClassPath(TFunctionRef<void(const FString&)> Callback) const
+{
+	const FHeader& Header = GetHeader();
+
+	const FPathKey* ActorKeys = GetArray<FPathKey>(Header.ActorKeysOffset);
+	for (uint32 i = 0; i < Header.NumActors; i++)
+	{
+		Callback(GetString(ActorKeys[i].StringId));
+	}
+
+	const FPathKey* SubobjectClassKeys = GetArray<FPathKey>(Header.SubobjectClassKeysOffset);
+	for (uint32 i = 0; i < Header.NumSubobjectClasses; i++)
+	{
+		Callback(GetString(SubobjectClassKeys[i].StringId));
+	}
+}
+
+void FCompactSchemaDatabase::ForEachActorSubobject(const FActorRecord& Actor, TFunctionRef<void(const FActorSubobjectRecord&)> Callback) const
+{
+	const FActorSubobjectRecord* Subobjects = GetArray<FActorSubobjectRecord>(GetHeader().ActorSubobjectsOffset);
+	for (uint32 i = 0; i < Actor.NumSubobjects; i++)
+	{
+		Callback(Subobjects[Actor.FirstSubobject + i]);
+	}
+}
+
+void FCompactSchemaDatabase::ForEachDynamicSubobject(const FSubobjectClassRecord& SubobjectClass, TFunctionRef<void(const FDynamicSubobjectRecord&)> Callback) const
+{
+	const FDynamicSubobjectRecord* DynamicSubobjects = GetArray<FDynamicSubobjectRecord>(GetHeader().DynamicSubobjectsOffset);
+	for (uint32 i = 0; i < SubobjectClass.NumDynamicSubobjects; i++)
+	{
+		Callback(DynamicSubobjects[SubobjectClass.FirstDynamicSubobject + i]);
+	}
+}
+
+bool FCompactSchemaDatabase::FindClassPathForComponentId(Worker_ComponentId ComponentId, FString& OutClassPath) const
+{
+	const FHeader& Header = GetHeader();
+	const FComponentClassPathRecord* Records = GetArray<FComponentClassPathRecord>(Header.ComponentClassPathsOffset);
+
+	uint32 Low = 0;
+	uint32 High = Header.NumComponentClassPaths;
+	while (Low < High)
+	{
+		const uint32 Mid = Low + (High - Low) / 2;
+		if (Records[Mid].ComponentId < ComponentId)
+		{
+			Low = Mid + 1;
+		}
+		else
+		{
+			High = Mid;
+		}
+	}
+
+	if (Low < Header.NumComponentClassPaths && Records[Low].ComponentId == ComponentId)
+	{
+		OutClassPath = GetString(Records[Low].ClassPathId);
+		return true;
+	}
+
+	return false;
+}
+
+uint32 FCompactSchemaDatabase::FindComponentIdForLevelPath(const FString& LevelPath) const
+{
+	const FHeader& Header = GetHeader();
+	if (const FPathKey* Key = FindPathKey(Header.LevelKeysOffset, Header.NumLevels, LevelPath))
+	{
+		return Key->Value;
+	}
+	return SpatialConstants::INVALID_COMPONENT_ID;
+}
+
+bool FCompactSchemaDatabase::IsLevelComponent(Worker_ComponentId ComponentId) const
+{
+	const FHeader& Header = GetHeader();
+	const uint32* LevelComponentIds = GetArray<uint32>(Header.LevelComponentIdsOffset);
+
+	uint32 Low = 0;
+	uint32 High = Header.NumLevelComponentIds;
+	while (Low < High)
+	{
+		const uint32 Mid = Low + (High - Low) / 2;
+		if (LevelComponentIds[Mid] < ComponentId)
+		{
+			Low = Mid + 1;
+		}
+		else
+		{
+			High = Mid;
+		}
+	}
+
+	return Low < Header.NumLevelComponentIds && LevelComponentIds[Low] == ComponentId;
+}
+
+void FCompactSchemaDatabase::ForEachLevelComponentId(TFunctionRef<void(Worker_ComponentId)> Callback) const
+{
+	const FHeader& Header = GetHeader();
+	const uint32* LevelComponentIds = GetArray<uint32>(Header.LevelComponentIdsOffset);
+	for (uint32 i = 0; i < Header.NumLevelComponentIds; i++)
+	{
+		Callback(LevelComponentIds[i]);
+	}
+}
+
+FString FCompactSchemaDatabase::GetString(uint32 StringId) const
+{
+	const FHeader& Header = GetHeader();
+	if (StringId >= Header.NumStrings)
+	{
+		return FString();
+	}
+
+	const FStringEntry& Entry = GetArray<FStringEntry>(Header.StringsOffset)[StringId];
+	FUTF8ToTCHAR Converted(GetArray<ANSICHAR>(Header.StringDataOffset) + Entry.Offset, Entry.Length);
+	return FString(Converted.Length(), Converted.Get());
+}
+
+FName FCompactSchemaDatabase::GetName(uint32 StringId) const
+{
+	return FName(*GetString(StringId));
+}
+
+} // namespace SpatialGDK
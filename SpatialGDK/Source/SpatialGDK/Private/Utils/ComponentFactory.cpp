@@ -14,21 +14,21 @@
 #include "Schema/Interest.h"
 #include "SpatialConstants.h"
 #include "Utils/RepLayoutUtils.h"
-#include "Utils/InterestFactory.h"
 
 DEFINE_LOG_CATEGORY(LogComponentFactory);
 
 namespace SpatialGDK
 {
 
-ComponentFactory::ComponentFactory(bool bInterestDirty, USpatialNetDriver* InNetDriver)
+ComponentFactory::ComponentFactory(bool bInterestDirty, USpatialNetDriver* InNetDriver, FSpatialFastArrayBaselines* InFastArrayBaselines /*= nullptr*/)
 	: NetDriver(InNetDriver)
 	, PackageMap(InNetDriver->PackageMap)
 	, ClassInfoManager(InNetDriver->ClassInfoManager)
+	, FastArrayBaselines(InFastArrayBaselines)
 	, bInterestHasChanged(bInterestDirty)
 { }
 
-bool ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObject* Object, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, bool bIsInitialData, TArray<Schema_FieldId>* ClearedIds /*= nullptr*/)
+bool ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObject* Object, const FClassInfo& Info, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, bool bIsInitialData, TArray<Schema_FieldId>* ClearedIds /*= nullptr*/)
 {
 	bool bWroteSomething = false;
 
@@ -59,11 +59,19 @@ bool ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObject*
 					// Check if this is a FastArraySerializer array and if so, call our custom delta serialization
 					if (UScriptStruct* NetDeltaStruct = GetFastArraySerializerProperty(ArrayProperty))
 					{
-						FSpatialNetBitWriter ValueDataWriter(PackageMap);
-
-						if (FSpatialNetDeltaSerializeInfo::DeltaSerializeWrite(NetDriver, ValueDataWriter, Object, Parent.ArrayIndex, Parent.Property, NetDeltaStruct) || bIsInitialData)
+						if (FastArrayBaselines != nullptr)
 						{
-							AddBytesToSchema(ComponentObject, HandleIterator.Handle, ValueDataWriter);
+							FSpatialFastArrayBaseline& Baseline = FastArrayBaselines->FindOrAdd(Object, HandleIterator.Handle);
+							FSpatialNetDeltaSerializeInfo::DeltaSerializeWriteWithBaseline(NetDriver, ComponentObject, HandleIterator.Handle, Object, Parent.ArrayIndex, Parent.Property, NetDeltaStruct, Baseline, bIsInitialData);
+						}
+						else
+						{
+							FSpatialNetBitWriter ValueDataWriter(PackageMap);
+
+							if (FSpatialNetDeltaSerializeInfo::DeltaSerializeWrite(NetDriver, ValueDataWriter, Object, Parent.ArrayIndex, Parent.Property, NetDeltaStruct) || bIsInitialData)
+							{
+								AddBytesToSchema(ComponentObject, HandleIterator.Handle, ValueDataWriter);
+							}
 						}
 
 						bProcessedFastArrayProperty = true;
@@ -72,7 +80,10 @@ bool ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObject*
 
 				if (!bProcessedFastArrayProperty)
 				{
-					AddProperty(ComponentObject, HandleIterator.Handle, Cmd.Property, Data, ClearedIds);
+					FPropertyPlanStep FallbackStep;
+					const FPropertyPlanStep& Step = Info.SerializationPlan.FindReplicatedOrCompile(HandleIterator.Handle, Cmd.Property, Cmd.Offset, FallbackStep);
+
+					AddProperty(ComponentObject, HandleIterator.Handle, Step, Data, ClearedIds);
 				}
 
 				bWroteSomething = true;
@@ -102,7 +113,7 @@ bool ComponentFactory::FillHandoverSchemaObject(Schema_Object* ComponentObject,
 
 		const uint8* Data = (uint8*)Object + PropertyInfo.Offset;
 
-		AddProperty(ComponentObject, ChangedHandle, PropertyInfo.Property, Data, ClearedIds);
+		AddProperty(ComponentObject, ChangedHandle, Info.SerializationPlan.Handover[ChangedHandle - 1], Data, ClearedIds);
 
 		bWroteSomething = true;
 	}
@@ -110,15 +121,46 @@ bool ComponentFactory::FillHandoverSchemaObject(Schema_Object* ComponentObject,
 	return bWroteSomething;
 }
 
-void ComponentFactory::AddProperty(Schema_Object* Object, Schema_FieldId FieldId, UProperty* Property, const uint8* Data, TArray<Schema_FieldId>* ClearedIds)
+void ComponentFactory::AddProperty(Schema_Object* Object, Schema_FieldId FieldId, const FPropertyPlanStep& Step, const uint8* Data, TArray<Schema_FieldId>* ClearedIds)
+{
+	if (Step.Op == EPropertyOp::DynamicArray)
+	{
+		const FScriptArray* Array = reinterpret_cast<const FScriptArray*>(Data);
+		const uint8* Elements = static_cast<const uint8*>(Array->GetData());
+		for (int32 i = 0; i < Array->Num(); i++)
+		{
+			AddElement(Object, FieldId, Step.ElementOp, Step.ElementProperty, Elements + i * Step.ElementSize);
+		}
+
+		if (Array->Num() == 0 && ClearedIds)
+		{
+			ClearedIds->Add(FieldId);
+		}
+	}
+	else
+	{
+		AddElement(Object, FieldId, Step.Op, Step.Property, Data);
+	}
+}
+
+void ComponentFactory::AddElement(Schema_Object* Object, Schema_FieldId FieldId, EPropertyOp Op, UProperty* Property, const uint8* Data)
 {
-	if (UStructProperty* StructProperty = Cast<UStructProperty>(Property))
+	if (IsPrimitivePropertyOp(Op))
+	{
+		AddPrimitiveToSchema(Object, FieldId, Op, Property, Data);
+		return;
+	}
+
+	switch (Op)
+	{
+	case EPropertyOp::NetSerializeStruct:
+	case EPropertyOp::Struct:
 	{
-		UScriptStruct* Struct = StructProperty->Struct;
+		UScriptStruct* Struct = static_cast<UStructProperty*>(Property)->Struct;
 		FSpatialNetBitWriter ValueDataWriter(PackageMap);
 		bool bHasUnmapped = false;
 
-		if (Struct->StructFlags & STRUCT_NetSerializeNative)
+		if (Op == EPropertyOp::NetSerializeStruct)
 		{
 			UScriptStruct::ICppStructOps* CppStructOps = Struct->GetCppStructOps();
 			check(CppStructOps); // else should not have STRUCT_NetSerializeNative
@@ -143,53 +185,11 @@ void ComponentFactory::AddProperty(Schema_Object* Object, Schema_FieldId FieldId
 		}
 
 		AddBytesToSchema(Object, FieldId, ValueDataWriter);
+		break;
 	}
-	else if (UBoolProperty* BoolProperty = Cast<UBoolProperty>(Property))
-	{
-		Schema_AddBool(Object, FieldId, (uint8)BoolProperty->GetPropertyValue(Data));
-	}
-	else if (UFloatProperty* FloatProperty = Cast<UFloatProperty>(Property))
-	{
-		Schema_AddFloat(Object, FieldId, FloatProperty->GetPropertyValue(Data));
-	}
-	else if (UDoubleProperty* DoubleProperty = Cast<UDoubleProperty>(Property))
-	{
-		Schema_AddDouble(Object, FieldId, DoubleProperty->GetPropertyValue(Data));
-	}
-	else if (UInt8Property* Int8Property = Cast<UInt8Property>(Property))
-	{
-		Schema_AddInt32(Object, FieldId, (int32)Int8Property->GetPropertyValue(Data));
-	}
-	else if (UInt16Property* Int16Property = Cast<UInt16Property>(Property))
-	{
-		Schema_AddInt32(Object, FieldId, (int32)Int16Property->GetPropertyValue(Data));
-	}
-	else if (UIntProperty* IntProperty = Cast<UIntProperty>(Property))
-	{
-		Schema_AddInt32(Object, FieldId, IntProperty->GetPropertyValue(Data));
-	}
-	else if (UInt64Property* Int64Property = Cast<UInt64Property>(Property))
-	{
-		Schema_AddInt64(Object, FieldId, Int64Property->GetPropertyValue(Data));
-	}
-	else if (UByteProperty* ByteProperty = Cast<UByteProperty>(Property))
-	{
-		Schema_AddUint32(Object, FieldId, (uint32)ByteProperty->GetPropertyValue(Data));
-	}
-	else if (UUInt16Property* UInt16Property = Cast<UUInt16Property>(Property))
-	{
-		Schema_AddUint32(Object, FieldId, (uint32)UInt16Property->GetPropertyValue(Data));
-	}
-	else if (UUInt32Property* UInt32Property = Cast<UUInt32Property>(Property))
-	{
-		Schema_AddUint32(Object, FieldId, UInt32Property->GetPropertyValue(Data));
-	}
-	else if (UUInt64Property* UInt64Property = Cast<UUInt64Property>(Property))
-	{
-		Schema_AddUint64(Object, FieldId, UInt64Property->GetPropertyValue(Data));
-	}
-	else if (UObjectPropertyBase* ObjectProperty = Cast<UObjectPropertyBase>(Property))
+	case EPropertyOp::Object:
 	{
+		UObjectPropertyBase* ObjectProperty = static_cast<UObjectPropertyBase*>(Property);
 		UObject* ObjectValue = ObjectProperty->GetObjectPropertyValue(Data);
 
 		if (ObjectProperty->PropertyFlags & CPF_AlwaysInterested)
@@ -198,58 +198,25 @@ void ComponentFactory::AddProperty(Schema_Object* Object, Schema_FieldId FieldId
 		}
 
 		AddObjectRefToSchema(Object, FieldId, FUnrealObjectRef::FromObjectPtr(ObjectValue, PackageMap));
+		break;
 	}
-	else if (UNameProperty* NameProperty = Cast<UNameProperty>(Property))
-	{
-		AddStringToSchema(Object, FieldId, NameProperty->GetPropertyValue(Data).ToString());
-	}
-	else if (UStrProperty* StrProperty = Cast<UStrProperty>(Property))
-	{
-		AddStringToSchema(Object, FieldId, StrProperty->GetPropertyValue(Data));
-	}
-	else if (UTextProperty* TextProperty = Cast<UTextProperty>(Property))
-	{
-		AddStringToSchema(Object, FieldId, TextProperty->GetPropertyValue(Data).ToString());
-	}
-	else if (UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property))
-	{
-		FScriptArrayHelper ArrayHelper(ArrayProperty, Data);
-		for (int i = 0; i < ArrayHelper.Num(); i++)
-		{
-			AddProperty(Object, FieldId, ArrayProperty->Inner, ArrayHelper.GetRawPtr(i), ClearedIds);
-		}
-
-		if (ArrayHelper.Num() == 0 && ClearedIds)
+	case EPropertyOp::Ignored:
+		// These properties can be set to replicate, but won't serialize across the network.
+		break;
+	default:
+		if (Property->IsA<UMapProperty>())
 		{
-			ClearedIds->Add(FieldId);
+			UE_LOG(LogComponentFactory, Error, TEXT("Class %s with name %s in field %d: Replicated TMaps are not supported."), *Property->GetClass()->GetName(), *Property->GetName(), FieldId);
 		}
-	}
-	else if (UEnumProperty* EnumProperty = Cast<UEnumProperty>(Property))
-	{
-		if (EnumProperty->ElementSize < 4)
+		else if (Property->IsA<USetProperty>())
 		{
-			Schema_AddUint32(Object, FieldId, (uint32)EnumProperty->GetUnderlyingProperty()->GetUnsignedIntPropertyValue(Data));
+			UE_LOG(LogComponentFactory, Error, TEXT("Class %s with name %s in field %d: Replicated TSets are not supported."), *Property->GetClass()->GetName(), *Property->GetName(), FieldId);
 		}
 		else
 		{
-			AddProperty(Object, FieldId, EnumProperty->GetUnderlyingProperty(), Data, ClearedIds);
+			UE_LOG(LogComponentFactory, Error, TEXT("Class %s with name %s in field %d: Attempted to add unknown property type."), *Property->GetClass()->GetName(), *Property->GetName(), FieldId);
 		}
-	}
-	else if (Property->IsA<UDelegateProperty>() || Property->IsA<UMulticastDelegateProperty>() || Property->IsA<UInterfaceProperty>())
-	{
-		// These properties can be set to replicate, but won't serialize across the network.
-	}
-	else if (Property->IsA<UMapProperty>())
-	{
-		UE_LOG(LogComponentFactory, Error, TEXT("Class %s with name %s in field %d: Replicated TMaps are not supported."), *Property->GetClass()->GetName(), *Property->GetName(), FieldId);
-	}
-	else if (Property->IsA<USetProperty>())
-	{
-		UE_LOG(LogComponentFactory, Error, TEXT("Class %s with name %s in field %d: Replicated TSets are not supported."), *Property->GetClass()->GetName(), *Property->GetName(), FieldId);
-	}
-	else
-	{
-		UE_LOG(LogComponentFactory, Error, TEXT("Class %s with name %s in field %d: Attempted to add unknown property type."), *Property->GetClass()->GetName(), *Property->GetName(), FieldId);
+		break;
 	}
 }
 
@@ -259,12 +226,12 @@ TArray<Worker_ComponentData> ComponentFactory::CreateComponentDatas(UObject* Obj
 
 	if (Info.SchemaComponents[SCHEMA_Data] != SpatialConstants::INVALID_COMPONENT_ID)
 	{
-		ComponentDatas.Add(CreateComponentData(Info.SchemaComponents[SCHEMA_Data], Object, RepChangeState, SCHEMA_Data));
+		ComponentDatas.Add(CreateComponentData(Info.SchemaComponents[SCHEMA_Data], Object, Info, RepChangeState, SCHEMA_Data));
 	}
 
 	if (Info.SchemaComponents[SCHEMA_OwnerOnly] != SpatialConstants::INVALID_COMPONENT_ID)
 	{
-		ComponentDatas.Add(CreateComponentData(Info.SchemaComponents[SCHEMA_OwnerOnly], Object, RepChangeState, SCHEMA_OwnerOnly));
+		ComponentDatas.Add(CreateComponentData(Info.SchemaComponents[SCHEMA_OwnerOnly], Object, Info, RepChangeState, SCHEMA_OwnerOnly));
 	}
 
 	if (Info.SchemaComponents[SCHEMA_Handover] != SpatialConstants::INVALID_COMPONENT_ID)
@@ -275,7 +242,7 @@ TArray<Worker_ComponentData> ComponentFactory::CreateComponentDatas(UObject* Obj
 	return ComponentDatas;
 }
 
-Worker_ComponentData ComponentFactory::CreateComponentData(Worker_ComponentId ComponentId, UObject* Object, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup)
+Worker_ComponentData ComponentFactory::CreateComponentData(Worker_ComponentId ComponentId, UObject* Object, const FClassInfo& Info, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup)
 {
 	Worker_ComponentData ComponentData = {};
 	ComponentData.component_id = ComponentId;
@@ -284,7 +251,7 @@ Worker_ComponentData ComponentFactory::CreateComponentData(Worker_ComponentId Co
 
 	// We're currently ignoring ClearedId fields, which is problematic if the initial replicated state
 	// is different to what the default state is (the client will have the incorrect data). UNR:959
-	FillSchemaObject(ComponentObject, Object, Changes, PropertyGroup, true);
+	FillSchemaObject(ComponentObject, Object, Info, Changes, PropertyGroup, true);
 
 	return ComponentData;
 }
@@ -317,7 +284,7 @@ TArray<Worker_ComponentUpdate> ComponentFactory::CreateComponentUpdates(UObject*
 		if (Info.SchemaComponents[SCHEMA_Data] != SpatialConstants::INVALID_COMPONENT_ID)
 		{
 			bool bWroteSomething = false;
-			Worker_ComponentUpdate MultiClientUpdate = CreateComponentUpdate(Info.SchemaComponents[SCHEMA_Data], Object, *RepChangeState, SCHEMA_Data, bWroteSomething);
+			Worker_ComponentUpdate MultiClientUpdate = CreateComponentUpdate(Info.SchemaComponents[SCHEMA_Data], Object, Info, *RepChangeState, SCHEMA_Data, bWroteSomething);
 			if (bWroteSomething)
 			{
 				ComponentUpdates.Add(MultiClientUpdate);
@@ -327,7 +294,7 @@ TArray<Worker_ComponentUpdate> ComponentFactory::CreateComponentUpdates(UObject*
 		if (Info.SchemaComponents[SCHEMA_OwnerOnly] != SpatialConstants::INVALID_COMPONENT_ID)
 		{
 			bool bWroteSomething = false;
-			Worker_ComponentUpdate SingleClientUpdate = CreateComponentUpdate(Info.SchemaComponents[SCHEMA_OwnerOnly], Object, *RepChangeState, SCHEMA_OwnerOnly, bWroteSomething);
+			Worker_ComponentUpdate SingleClientUpdate = CreateComponentUpdate(Info.SchemaComponents[SCHEMA_OwnerOnly], Object, Info, *RepChangeState, SCHEMA_OwnerOnly, bWroteSomething);
 			if (bWroteSomething)
 			{
 				ComponentUpdates.Add(SingleClientUpdate);
@@ -348,17 +315,10 @@ TArray<Worker_ComponentUpdate> ComponentFactory::CreateComponentUpdates(UObject*
 		}
 	}
 
-	// Only support Interest for Actors for now.
-	if (Object->IsA<AActor>() && bInterestHasChanged)
-	{
-		InterestFactory InterestUpdateFactory(Cast<AActor>(Object), Info, NetDriver->ClassInfoManager, NetDriver->PackageMap);
-		ComponentUpdates.Add(InterestUpdateFactory.CreateInterestUpdate());
-	}
-
 	return ComponentUpdates;
 }
 
-Worker_ComponentUpdate ComponentFactory::CreateComponentUpdate(Worker_ComponentId ComponentId, UObject* Object, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, bool& bWroteSomething)
+Worker_ComponentUpdate ComponentFactory::CreateComponentUpdate(Worker_ComponentId ComponentId, UObject* Object, const FClassInfo& Info, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, bool& bWroteSomething)
 {
 	Worker_ComponentUpdate ComponentUpdate = {};
 
@@ -368,7 +328,7 @@ Worker_ComponentUpdate ComponentFactory::CreateComponentUpdate(Worker_ComponentI
 
 	TArray<Schema_FieldId> ClearedIds;
 
-	bWroteSomething = FillSchemaObject(ComponentObject, Object, Changes, PropertyGroup, false, &ClearedIds);
+	bWroteSomething = FillSchemaObject(ComponentObject, Object, Info, Changes, PropertyGroup, false, &ClearedIds);
 
 	for (Schema_FieldId Id : ClearedIds)
 	{
@@ -0,0 +1,61 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/ComponentInfoTable.h"
+
+#include "Interop/SpatialClassInfoManager.h"
+
+namespace SpatialGDK
+{
+
+namespace
+{
+	// Caps the dense array at 16MB in case the schema database reports a nonsensical component ID range.
+	const uint32 MaxDenseComponentIds = 1 << 20;
+} // anonymous namespace
+
+void FComponentInfoTable::Init(Worker_ComponentId FirstComponentId, Worker_ComponentId EndComponentId)
+{
+	Empty();
+
+	FirstDenseComponentId = FirstComponentId;
+	if (EndComponentId > FirstComponentId)
+	{
+		DenseInfos.SetNum(FMath::Min(EndComponentId - FirstComponentId, MaxDenseComponentIds));
+	}
+}
+
+void FComponentInfoTable::Empty()
+{
+	FirstDenseComponentId = 0;
+	DenseInfos.Empty();
+	SparseInfos.Empty();
+	ClassInfoOwners.Empty();
+}
+
+FComponentInfo& FComponentInfoTable::FindOrAdd(Worker_ComponentId ComponentId)
+{
+	const uint32 DenseIndex = ComponentId - FirstDenseComponentId;
+	if (DenseIndex < static_cast<uint32>(DenseInfos.Num()))
+	{
+		return DenseInfos[DenseIndex];
+	}
+
+	return SparseInfos.FindOrAdd(ComponentId);
+}
+
+void FComponentInfoTable::SetClassInfo(Worker_ComponentId ComponentId, const TSharedRef<const FClassInfo>& ClassInfo, uint32 Offset, ESchemaComponentType Category)
+{
+	FComponentInfo& Info = FindOrAdd(ComponentId);
+	Info.ClassInfo = &ClassInfo.Get();
+	Info.Offset = Offset;
+	Info.Category = static_cast<int16>(Category);
+
+	ClassInfoOwners.Add(ComponentId, ClassInfo);
+}
+
+void FComponentInfoTable::MarkSublevel(Worker_ComponentId ComponentId)
+{
+	FindOrAdd(ComponentId).bIsSublevel = true;
+}
+
+} // namespace SpatialGDK
@@ -11,6 +11,7 @@
 #include "EngineClasses/SpatialNetBitReader.h"
 #include "Interop/SpatialConditionMapFilter.h"
 #include "SpatialConstants.h"
+#include "SpatialGDKSettings.h"
 #include "Utils/SchemaUtils.h"
 #include "Utils/RepLayoutUtils.h"
 
@@ -106,10 +107,53 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject*
 
 	FSpatialConditionMapFilter ConditionMap(Channel, bIsClient);
 
+	const FPropertySerializationPlan& Plan = ClassInfoManager->GetClassInfoByComponentId(ComponentId).SerializationPlan;
+
 	TArray<UProperty*> RepNotifies;
 
+	if (bIsInitialData && GetDefault<USpatialGDKSettings>()->bOmitDefaultPropertiesFromInitialData)
+	{
+		RestoreOmittedProperties(Object, *Replicator->RepLayout, ConditionMap, UpdatedIds, ComponentId);
+	}
+
+	// Workers checking the entity out apply fast array snapshots before the changes made since them. See FSpatialFastArrayBaseline.
+	if (bIsInitialData && GetDefault<USpatialGDKSettings>()->bUseFastArrayDeltaReplication)
+	{
+		for (Schema_FieldId FieldId : UpdatedIds)
+		{
+			const int32 Handle = (int32)FieldId - SpatialConstants::FAST_ARRAY_BASELINE_FIELD_ID_OFFSET;
+			if (Handle <= 0 || Handle > BaseHandleToCmdIndex.Num())
+			{
+				continue;
+			}
+
+			const FRepLayoutCmd& Cmd = Cmds[BaseHandleToCmdIndex[Handle - 1].CmdIndex];
+			const FRepParentCmd& Parent = Parents[Cmd.ParentIndex];
+			if (Cmd.Type != ERepLayoutCmdType::DynamicArray || !(NetDriver->IsServer() || ConditionMap.IsRelevant(Parent.Condition)))
+			{
+				continue;
+			}
+
+			if (UScriptStruct* NetDeltaStruct = GetFastArraySerializerProperty(Cast<UArrayProperty>(Cmd.Property)))
+			{
+				ApplyFastArray(ComponentObject, FieldId, Object, Cmd, Parent, NetDeltaStruct);
+
+				if (Parent.Property->HasAnyPropertyFlags(CPF_RepNotify))
+				{
+					RepNotifies.AddUnique(Parent.Property);
+				}
+			}
+		}
+	}
+
 	for (uint32 FieldId : UpdatedIds)
 	{
+		// Fast array snapshots were applied above if this worker needed them.
+		if (FieldId > SpatialConstants::FAST_ARRAY_BASELINE_FIELD_ID_OFFSET)
+		{
+			continue;
+		}
+
 		// FieldId is the same as rep handle
 		if (FieldId == 0 || (int)FieldId - 1 >= BaseHandleToCmdIndex.Num())
 		{
@@ -129,6 +173,9 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject*
 
 			uint8* Data = (uint8*)Object + SwappedCmd.Offset;
 
+			FPropertyPlanStep FallbackStep;
+			const FPropertyPlanStep& Step = Plan.FindReplicatedOrCompile(FieldId, Cmd.Property, Cmd.Offset, FallbackStep);
+
 			if (Cmd.Type == ERepLayoutCmdType::DynamicArray)
 			{
 				UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Cmd.Property);
@@ -141,34 +188,16 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject*
 				// Check if this is a FastArraySerializer array and if so, call our custom delta serialization
 				if (UScriptStruct* NetDeltaStruct = GetFastArraySerializerProperty(ArrayProperty))
 				{
-					TArray<uint8> ValueData = GetBytesFromSchema(ComponentObject, FieldId);
-					int64 CountBits = ValueData.Num() * 8;
-					TSet<FUnrealObjectRef> NewUnresolvedRefs;
-					FSpatialNetBitReader ValueDataReader(PackageMap, ValueData.GetData(), CountBits, NewUnresolvedRefs);
-
-					if (ValueData.Num() > 0)
-					{
-						FSpatialNetDeltaSerializeInfo::DeltaSerializeRead(NetDriver, ValueDataReader, Object, Parent.ArrayIndex, Parent.Property, NetDeltaStruct);
-					}
-
-					if (NewUnresolvedRefs.Num() > 0)
-					{
-						RootObjectReferencesMap.Add(SwappedCmd.Offset, FObjectReferences(ValueData, CountBits, NewUnresolvedRefs, ShadowOffset, Cmd.ParentIndex, ArrayProperty, /* bFastArrayProp */ true));
-						UnresolvedRefs.Append(NewUnresolvedRefs);
-					}
-					else if (RootObjectReferencesMap.Find(SwappedCmd.Offset))
-					{
-						RootObjectReferencesMap.Remove(SwappedCmd.Offset);
-					}
+					ApplyFastArray(ComponentObject, FieldId, Object, Cmd, Parent, NetDeltaStruct);
 				}
 				else
 				{
-					ApplyArray(ComponentObject, FieldId, RootObjectReferencesMap, ArrayProperty, Data, SwappedCmd.Offset, ShadowOffset, Cmd.ParentIndex);
+					ApplyArray(ComponentObject, FieldId, RootObjectReferencesMap, Step, Data, SwappedCmd.Offset, ShadowOffset, Cmd.ParentIndex);
 				}
 			}
 			else
 			{
-				ApplyProperty(ComponentObject, FieldId, RootObjectReferencesMap, 0, Cmd.Property, Data, SwappedCmd.Offset, ShadowOffset, Cmd.ParentIndex);
+				ApplyProperty(ComponentObject, FieldId, RootObjectReferencesMap, 0, Step.Op, Step.Property, Data, SwappedCmd.Offset, ShadowOffset, Cmd.ParentIndex);
 			}
 
 			if (Cmd.Property->GetFName() == NAME_RemoteRole)
@@ -216,6 +245,42 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject*
 	Channel->PostReceiveSpatialUpdate(Object, RepNotifies);
 }
 
+void ComponentReader::ApplyFastArray(Schema_Object* ComponentObject, Schema_FieldId FieldId, UObject* Object, const FRepLayoutCmd& Cmd, const FRepParentCmd& Parent, UScriptStruct* NetDeltaStruct)
+{
+	TArrayView<const uint8> ValueData = GetBytesViewFromSchema(ComponentObject, FieldId);
+	int64 CountBits = ValueData.Num() * 8;
+	TSet<FUnrealObjectRef> NewUnresolvedRefs;
+	FSpatialNetBitReader ValueDataReader(PackageMap, const_cast<uint8*>(ValueData.GetData()), CountBits, NewUnresolvedRefs);
+
+	if (ValueData.Num() > 0)
+	{
+		FSpatialNetDeltaSerializeInfo::DeltaSerializeRead(NetDriver, ValueDataReader, Object, Parent.ArrayIndex, Parent.Property, NetDeltaStruct);
+	}
+
+	// A snapshot and the changes since it share the array's offset, so only the last of them to have unresolved references is retried.
+	if (NewUnresolvedRefs.Num() > 0)
+	{
+		RootObjectReferencesMap.Add(Cmd.Offset, FObjectReferences(ValueData, CountBits, NewUnresolvedRefs, Cmd.ShadowOffset, Cmd.ParentIndex, Cast<UArrayProperty>(Cmd.Property), /* bFastArrayProp */ true));
+		UnresolvedRefs.Append(NewUnresolvedRefs);
+	}
+	else if (RootObjectReferencesMap.Find(Cmd.Offset))
+	{
+		RootObjectReferencesMap.Remove(Cmd.Offset);
+	}
+}
+
+void ComponentReader::RestoreOmittedProperties(UObject* Object, const FRepLayout& RepLayout, const FSpatialConditionMapFilter& ConditionMap, const TArray<Schema_FieldId>& UpdatedIds, Worker_ComponentId ComponentId)
+{
+	// Only properties belonging to this component are restored, as the object's other components are applied separately.
+	const ESchemaComponentType PropertyGroup = ClassInfoManager->GetCategoryByComponentId(ComponentId);
+	const bool bIsServer = NetDriver->IsServer();
+
+	SpatialGDK::RestoreOmittedProperties(RepLayout, Object, UpdatedIds, [&](const FRepParentCmd& Parent)
+	{
+		return GetGroupFromCondition(Parent.Condition) == PropertyGroup && (bIsServer || ConditionMap.IsRelevant(Parent.Condition));
+	});
+}
+
 void ComponentReader::ApplyHandoverSchemaObject(Schema_Object* ComponentObject, UObject* Object, USpatialActorChannel* Channel, bool bIsInitialData, const TArray<Schema_FieldId>& UpdatedIds, Worker_ComponentId ComponentId)
 {
 	FObjectReplicator* Replicator = Channel->PreReceiveSpatialUpdate(Object);
@@ -236,34 +301,45 @@ void ComponentReader::ApplyHandoverSchemaObject(Schema_Object* ComponentObject,
 			continue;
 		}
 		const FHandoverPropertyInfo& PropertyInfo = ClassInfo.HandoverProperties[FieldId - 1];
+		const FPropertyPlanStep& Step = ClassInfo.SerializationPlan.Handover[FieldId - 1];
 
 		uint8* Data = (uint8*)Object + PropertyInfo.Offset;
 
-		if (UArrayProperty* ArrayProperty = Cast<UArrayProperty>(PropertyInfo.Property))
+		if (Step.Op == EPropertyOp::DynamicArray)
 		{
-			ApplyArray(ComponentObject, FieldId, RootObjectReferencesMap, ArrayProperty, Data, PropertyInfo.Offset, -1, -1);
+			ApplyArray(ComponentObject, FieldId, RootObjectReferencesMap, Step, Data, PropertyInfo.Offset, -1, -1);
 		}
 		else
 		{
-			ApplyProperty(ComponentObject, FieldId, RootObjectReferencesMap, 0, PropertyInfo.Property, Data, PropertyInfo.Offset, -1, -1);
+			ApplyProperty(ComponentObject, FieldId, RootObjectReferencesMap, 0, Step.Op, Step.Property, Data, PropertyInfo.Offset, -1, -1);
 		}
 	}
 
 	Channel->PostReceiveSpatialUpdate(Object, TArray<UProperty*>());
 }
 
-void ComponentReader::ApplyProperty(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, uint32 Index, UProperty* Property, uint8* Data, int32 Offset, int32 ShadowOffset, int32 ParentIndex)
+void ComponentReader::ApplyProperty(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, uint32 Index, EPropertyOp Op, UProperty* Property, uint8* Data, int32 Offset, int32 ShadowOffset, int32 ParentIndex)
 {
-	if (UStructProperty* StructProperty = Cast<UStructProperty>(Property))
+	if (IsPrimitivePropertyOp(Op))
+	{
+		ApplyPrimitiveFromSchema(Object, FieldId, Index, Op, Property, Data);
+		return;
+	}
+
+	switch (Op)
 	{
-		TArray<uint8> ValueData = IndexBytesFromSchema(Object, FieldId, Index);
+	case EPropertyOp::NetSerializeStruct:
+	case EPropertyOp::Struct:
+	{
+		// Read straight from the op's buffer. FObjectReferences takes a copy if the struct has to be read again later.
+		TArrayView<const uint8> ValueData = IndexBytesViewFromSchema(Object, FieldId, Index);
 		// A bit hacky, we should probably include the number of bits with the data instead.
 		int64 CountBits = ValueData.Num() * 8;
 		TSet<FUnrealObjectRef> NewUnresolvedRefs;
-		FSpatialNetBitReader ValueDataReader(PackageMap, ValueData.GetData(), CountBits, NewUnresolvedRefs);
+		FSpatialNetBitReader ValueDataReader(PackageMap, const_cast<uint8*>(ValueData.GetData()), CountBits, NewUnresolvedRefs);
 		bool bHasUnmapped = false;
 
-		ReadStructProperty(ValueDataReader, StructProperty, NetDriver, Data, bHasUnmapped);
+		ReadStructProperty(ValueDataReader, static_cast<UStructProperty*>(Property), NetDriver, Data, bHasUnmapped);
 
 		if (bHasUnmapped)
 		{
@@ -274,53 +350,11 @@ void ComponentReader::ApplyProperty(Schema_Object* Object, Schema_FieldId FieldI
 		{
 			InObjectReferencesMap.Remove(Offset);
 		}
+		break;
 	}
-	else if (UBoolProperty* BoolProperty = Cast<UBoolProperty>(Property))
-	{
-		BoolProperty->SetPropertyValue(Data, Schema_IndexBool(Object, FieldId, Index) != 0);
-	}
-	else if (UFloatProperty* FloatProperty = Cast<UFloatProperty>(Property))
-	{
-		FloatProperty->SetPropertyValue(Data, Schema_IndexFloat(Object, FieldId, Index));
-	}
-	else if (UDoubleProperty* DoubleProperty = Cast<UDoubleProperty>(Property))
-	{
-		DoubleProperty->SetPropertyValue(Data, Schema_IndexDouble(Object, FieldId, Index));
-	}
-	else if (UInt8Property* Int8Property = Cast<UInt8Property>(Property))
-	{
-		Int8Property->SetPropertyValue(Data, (int8)Schema_IndexInt32(Object, FieldId, Index));
-	}
-	else if (UInt16Property* Int16Property = Cast<UInt16Property>(Property))
-	{
-		Int16Property->SetPropertyValue(Data, (int16)Schema_IndexInt32(Object, FieldId, Index));
-	}
-	else if (UIntProperty* IntProperty = Cast<UIntProperty>(Property))
-	{
-		IntProperty->SetPropertyValue(Data, Schema_IndexInt32(Object, FieldId, Index));
-	}
-	else if (UInt64Property* Int64Property = Cast<UInt64Property>(Property))
-	{
-		Int64Property->SetPropertyValue(Data, Schema_IndexInt64(Object, FieldId, Index));
-	}
-	else if (UByteProperty* ByteProperty = Cast<UByteProperty>(Property))
-	{
-		ByteProperty->SetPropertyValue(Data, (uint8)Schema_IndexUint32(Object, FieldId, Index));
-	}
-	else if (UUInt16Property* UInt16Property = Cast<UUInt16Property>(Property))
-	{
-		UInt16Property->SetPropertyValue(Data, (uint16)Schema_IndexUint32(Object, FieldId, Index));
-	}
-	else if (UUInt32Property* UInt32Property = Cast<UUInt32Property>(Property))
-	{
-		UInt32Property->SetPropertyValue(Data, Schema_IndexUint32(Object, FieldId, Index));
-	}
-	else if (UUInt64Property* UInt64Property = Cast<UUInt64Property>(Property))
-	{
-		UInt64Property->SetPropertyValue(Data, Schema_IndexUint64(Object, FieldId, Index));
-	}
-	else if (UObjectPropertyBase* ObjectProperty = Cast<UObjectPropertyBase>(Property))
+	case EPropertyOp::Object:
 	{
+		UObjectPropertyBase* ObjectProperty = static_cast<UObjectPropertyBase*>(Property);
 		FUnrealObjectRef ObjectRef = IndexObjectRefFromSchema(Object, FieldId, Index);
 		check(ObjectRef != FUnrealObjectRef::UNRESOLVED_OBJECT_REF);
 		bool bUnresolved = false;
@@ -345,38 +379,18 @@ void ComponentReader::ApplyProperty(Schema_Object* Object, Schema_FieldId FieldI
 		{
 			InObjectReferencesMap.Remove(Offset);
 		}
+		break;
 	}
-	else if (UNameProperty* NameProperty = Cast<UNameProperty>(Property))
-	{
-		NameProperty->SetPropertyValue(Data, FName(*IndexStringFromSchema(Object, FieldId, Index)));
-	}
-	else if (UStrProperty* StrProperty = Cast<UStrProperty>(Property))
-	{
-		StrProperty->SetPropertyValue(Data, IndexStringFromSchema(Object, FieldId, Index));
-	}
-	else if (UTextProperty* TextProperty = Cast<UTextProperty>(Property))
-	{
-		TextProperty->SetPropertyValue(Data, FText::FromString(IndexStringFromSchema(Object, FieldId, Index)));
-	}
-	else if (UEnumProperty* EnumProperty = Cast<UEnumProperty>(Property))
-	{
-		if (EnumProperty->ElementSize < 4)
-		{
-			EnumProperty->GetUnderlyingProperty()->SetIntPropertyValue(Data, (uint64)Schema_IndexUint32(Object, FieldId, Index));
-		}
-		else
-		{
-			ApplyProperty(Object, FieldId, InObjectReferencesMap, Index, EnumProperty->GetUnderlyingProperty(), Data, Offset, ShadowOffset, ParentIndex);
-		}
-	}
-	else
-	{
+	default:
 		checkf(false, TEXT("Tried to read unknown property in field %d"), FieldId);
+		break;
 	}
 }
 
-void ComponentReader::ApplyArray(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, UArrayProperty* Property, uint8* Data, int32 Offset, int32 ShadowOffset, int32 ParentIndex)
+void ComponentReader::ApplyArray(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, const FPropertyPlanStep& Step, uint8* Data, int32 Offset, int32 ShadowOffset, int32 ParentIndex)
 {
+	UArrayProperty* Property = static_cast<UArrayProperty*>(Step.Property);
+
 	FObjectReferencesMap* ArrayObjectReferences;
 	bool bNewArrayMap = false;
 	if (FObjectReferences* ExistingEntry = InObjectReferencesMap.Find(Offset))
@@ -393,13 +407,14 @@ void ComponentReader::ApplyArray(Schema_Object* Object, Schema_FieldId FieldId,
 
 	FScriptArrayHelper ArrayHelper(Property, Data);
 
-	int Count = GetPropertyCount(Object, FieldId, Property->Inner);
+	int Count = GetSchemaCountForOp(Object, FieldId, Step.ElementOp);
 	ArrayHelper.Resize(Count);
 
+	uint8* Elements = ArrayHelper.GetRawPtr(0);
 	for (int i = 0; i < Count; i++)
 	{
-		int32 ElementOffset = i * Property->Inner->ElementSize;
-		ApplyProperty(Object, FieldId, *ArrayObjectReferences, i, Property->Inner, ArrayHelper.GetRawPtr(i), ElementOffset, ElementOffset, ParentIndex);
+		int32 ElementOffset = i * Step.ElementSize;
+		ApplyProperty(Object, FieldId, *ArrayObjectReferences, i, Step.ElementOp, Step.ElementProperty, Elements + ElementOffset, ElementOffset, ElementOffset, ParentIndex);
 	}
 
 	if (ArrayObjectReferences->Num() > 0)
@@ -423,92 +438,4 @@ void ComponentReader::ApplyArray(Schema_Object* Object, Schema_FieldId FieldId,
 	}
 }
 
-uint32 ComponentReader::GetPropertyCount(const Schema_Object* Object, Schema_FieldId FieldId, UProperty* Property)
-{
-	if (UStructProperty* StructProperty = Cast<UStructProperty>(Property))
-	{
-		return Schema_GetBytesCount(Object, FieldId);
-	}
-	else if (UBoolProperty* BoolProperty = Cast<UBoolProperty>(Property))
-	{
-		return Schema_GetBoolCount(Object, FieldId);
-	}
-	else if (UFloatProperty* FloatProperty = Cast<UFloatProperty>(Property))
-	{
-		return Schema_GetFloatCount(Object, FieldId);
-	}
-	else if (UDoubleProperty* DoubleProperty = Cast<UDoubleProperty>(Property))
-	{
-		return Schema_GetDoubleCount(Object, FieldId);
-	}
-	else if (UInt8Property* Int8Property = Cast<UInt8Property>(Property))
-	{
-		return Schema_GetInt32Count(Object, FieldId);
-	}
-	else if (UInt16Property* Int16Property = Cast<UInt16Property>(Property))
-	{
-		return Schema_GetInt32Count(Object, FieldId);
-	}
-	else if (UIntProperty* IntProperty = Cast<UIntProperty>(Property))
-	{
-		return Schema_GetInt32Count(Object, FieldId);
-	}
-	else if (UInt64Property* Int64Property = Cast<UInt64Property>(Property))
-	{
-		return Schema_GetInt64Count(Object, FieldId);
-	}
-	else if (UByteProperty* ByteProperty = Cast<UByteProperty>(Property))
-	{
-		return Schema_GetUint32Count(Object, FieldId);
-	}
-	else if (UUInt16Property* UInt16Property = Cast<UUInt16Property>(Property))
-	{
-		return Schema_GetUint32Count(Object, FieldId);
-	}
-	else if (UUInt32Property* UInt32Property = Cast<UUInt32Property>(Property))
-	{
-		return Schema_GetUint32Count(Object, FieldId);
-	}
-	else if (UUInt64Property* UInt64Property = Cast<UUInt64Property>(Property))
-	{
-		return Schema_GetUint64Count(Object, FieldId);
-	}
-	else if (UObjectPropertyBase* ObjectProperty = Cast<UObjectPropertyBase>(Property))
-	{
-		return Schema_GetObjectCount(Object, FieldId);
-	}
-	else if (UNameProperty* NameProperty = Cast<UNameProperty>(Property))
-	{
-		return Schema_GetBytesCount(Object, FieldId);
-	}
-	else if (UStrProperty* StrProperty = Cast<UStrProperty>(Property))
-	{
-		return Schema_GetBytesCount(Object, FieldId);
-	}
-	else if (UTextProperty* TextProperty = Cast<UTextProperty>(Property))
-	{
-		return Schema_GetBytesCount(Object, FieldId);
-	}
-	else if (UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property))
-	{
-		return GetPropertyCount(Object, FieldId, ArrayProperty->Inner);
-	}
-	else if (UEnumProperty* EnumProperty = Cast<UEnumProperty>(Property))
-	{
-		if (EnumProperty->ElementSize < 4)
-		{
-			return Schema_GetUint32Count(Object, FieldId);
-		}
-		else
-		{
-			return GetPropertyCount(Object, FieldId, EnumProperty->GetUnderlyingProperty());
-		}
-	}
-	else
-	{
-		checkf(false, TEXT("Tried to get count of unknown property in field %d"), FieldId);
-		return 0;
-	}
-}
-
 } // namespace SpatialGDK
@@ -0,0 +1,88 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/DormantColdStorage.h"
+
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/UObjectHash.h"
+
+DEFINE_LOG_CATEGORY(LogDormantColdStorage);
+
+namespace SpatialGDK
+{
+
+namespace
+{
+	// Each replicated object holds one shadow buffer in its replicator and one in its changelist state, both sized to the class's properties.
+	uint32 EstimateReplicationStateSize(const UObject* Object)
+	{
+		return 2 * static_cast<uint32>(Object->GetClass()->GetPropertiesSize());
+	}
+}
+
+void FDormantColdStorage::Store(Worker_EntityId EntityId, AActor* Actor, UNetConnection* NetConnection, UNetDriver* NetDriver)
+{
+	check(Actor != nullptr);
+
+	uint32 Bytes = 0;
+
+	if (NetConnection != nullptr)
+	{
+		for (auto It = NetConnection->DormantReplicatorMap.CreateIterator(); It; ++It)
+		{
+			const UObject* Object = It.Key().Get();
+			if (Object == nullptr || Object == Actor || Object->IsIn(Actor))
+			{
+				if (Object != nullptr)
+				{
+					Bytes += EstimateReplicationStateSize(Object);
+				}
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	NetDriver->ReplicationChangeListMap.Remove(Actor);
+	ForEachObjectWithOuter(Actor, [NetDriver](UObject* Subobject)
+	{
+		NetDriver->ReplicationChangeListMap.Remove(Subobject);
+	});
+
+	if (FRecord* Existing = Records.Find(EntityId))
+	{
+		ReleasedBytes -= Existing->ReleasedBytes;
+	}
+
+	Records.Add(EntityId, FRecord{ Actor, FPlatformTime::Seconds(), Bytes });
+	ReleasedBytes += Bytes;
+
+	UE_LOG(LogDormantColdStorage, Verbose, TEXT("Moved dormant actor %s (entity %lld) to cold storage, releasing ~%u bytes."), *Actor->GetName(), EntityId, Bytes);
+}
+
+void FDormantColdStorage::TrackWake(Worker_EntityId EntityId, double RebuildSeconds)
+{
+	FRecord Record;
+	if (!Records.RemoveAndCopyValue(EntityId, Record))
+	{
+		return;
+	}
+
+	ReleasedBytes -= Record.ReleasedBytes;
+	WakeLatency.Record(RebuildSeconds);
+
+	UE_LOG(LogDormantColdStorage, Verbose, TEXT("Woke entity %lld from cold storage after %.1fs dormant, rebuilding state took %.3fms."),
+		EntityId, FPlatformTime::Seconds() - Record.DormantSinceTime, RebuildSeconds * 1000.0);
+}
+
+void FDormantColdStorage::Remove(Worker_EntityId EntityId)
+{
+	FRecord Record;
+	if (Records.RemoveAndCopyValue(EntityId, Record))
+	{
+		ReleasedBytes -= Record.ReleasedBytes;
+	}
+}
+
+} // namespace SpatialGDK
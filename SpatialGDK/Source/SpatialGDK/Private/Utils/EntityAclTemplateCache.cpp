@@ -0,0 +1,238 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/EntityAclTemplateCache.h"
+
+#include "GameFramework/PlayerController.h"
+
+#include "SpatialConstants.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+namespace SpatialGDK
+{
+
+namespace
+{
+	// An attribute copied into an entity's schema data, shared by every requirement set in it that uses the attribute.
+	struct FSchemaAttribute
+	{
+		const uint8* Bytes = nullptr;
+		uint32 Length = 0;
+	};
+
+	FSchemaAttribute AllocateSchemaAttribute(Schema_Object* Object, const ANSICHAR* Chars, uint32 Length)
+	{
+		uint8* Buffer = Schema_AllocateBuffer(Object, Length);
+		FMemory::Memcpy(Buffer, Chars, Length);
+		return FSchemaAttribute{ Buffer, Length };
+	}
+
+	void AddAttributeSetToSchema(Schema_Object* RequirementSetObject, const FSchemaAttribute& Attribute)
+	{
+		Schema_Object* AttributeSetObject = Schema_AddObject(RequirementSetObject, 1);
+		Schema_AddBytes(AttributeSetObject, 1, Attribute.Bytes, Attribute.Length);
+	}
+
+	void AddWriteAclEntryToSchema(Schema_Object* ComponentObject, Worker_ComponentId ComponentId, const FSchemaAttribute& Attribute)
+	{
+		Schema_Object* KVPairObject = Schema_AddObject(ComponentObject, 2);
+		Schema_AddUint32(KVPairObject, SCHEMA_MAP_KEY_FIELD_ID, ComponentId);
+		AddAttributeSetToSchema(Schema_AddObject(KVPairObject, SCHEMA_MAP_VALUE_FIELD_ID), Attribute);
+	}
+
+	void AddSchemaComponents(const FClassInfo& Info, TArray<Worker_ComponentId>& OutComponents)
+	{
+		ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
+		{
+			if (Info.SchemaComponents[Type] != SpatialConstants::INVALID_COMPONENT_ID)
+			{
+				OutComponents.Add(Info.SchemaComponents[Type]);
+			}
+		});
+	}
+} // anonymous namespace
+
+void FEntityAclTemplateCache::Init(const TArray<FName>& ServerWorkerTypes)
+{
+	Empty();
+
+	// Server worker types are added unconditionally so that they occupy indices 1 to NumServerAttributes.
+	FWorkerAttributeTable& AttributeTable = FWorkerAttributeTable::Get();
+
+	Attributes.Reset();
+	Attributes.Add(AttributeTable.InternAttribute(SpatialConstants::DefaultClientWorkerType.ToString()));
+	for (const FName& WorkerType : ServerWorkerTypes)
+	{
+		Attributes.Add(AttributeTable.InternAttribute(WorkerType.ToString()));
+	}
+	NumServerAttributes = ServerWorkerTypes.Num();
+}
+
+int32 FEntityAclTemplateCache::FindOrAddAttribute(const FString& Attribute)
+{
+	const FWorkerAttributeHandle Handle = FWorkerAttributeTable::Get().InternAttribute(Attribute);
+	const int32 Index = Attributes.Find(Handle);
+	return Index != INDEX_NONE ? Index : Attributes.Add(Handle);
+}
+
+const FEntityAclTemplate& FEntityAclTemplateCache::GetOrCreateTemplate(UClass* Class, const FClassInfo& Info, const TBitArray<>& PresentSubobjects)
+{
+	TArray<FEntityAclTemplate>& ClassTemplates = Templates.FindOrAdd(Class);
+	for (const FEntityAclTemplate& Template : ClassTemplates)
+	{
+		if (Template.PresentSubobjects == PresentSubobjects)
+		{
+			return Template;
+		}
+	}
+
+	FEntityAclTemplate& Template = ClassTemplates[ClassTemplates.AddDefaulted()];
+	Template.PresentSubobjects = PresentSubobjects;
+
+	const bool bIsPlayerController = Class->IsChildOf(APlayerController::StaticClass());
+	if (Class->HasAnySpatialClassFlags(SPATIALCLASS_ServerOnly))
+	{
+		Template.ReadAcl = FEntityAclTemplate::EReadAcl::AnyServer;
+	}
+	else if (bIsPlayerController)
+	{
+		Template.ReadAcl = FEntityAclTemplate::EReadAcl::AnyServerOrOwningClient;
+	}
+	else
+	{
+		Template.ReadAcl = FEntityAclTemplate::EReadAcl::AnyServerOrClient;
+	}
+
+	Template.AuthoritativeAttribute = FindOrAddAttribute(Info.WorkerType.ToString());
+
+	Template.AuthoritativeComponents = {
+		SpatialConstants::POSITION_COMPONENT_ID,
+		SpatialConstants::INTEREST_COMPONENT_ID,
+		SpatialConstants::SPAWN_DATA_COMPONENT_ID,
+		SpatialConstants::ENTITY_ACL_COMPONENT_ID,
+		SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID,
+		SpatialConstants::NETMULTICAST_RPCS_COMPONENT_ID,
+		SpatialConstants::DORMANT_COMPONENT_ID,
+		SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID,
+		SpatialConstants::ALWAYS_RELEVANT_COMPONENT_ID
+	};
+	Template.OwningClientComponents.Add(SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID);
+
+	if (bIsPlayerController)
+	{
+#if !UE_BUILD_SHIPPING
+		Template.AuthoritativeComponents.Add(SpatialConstants::DEBUG_METRICS_COMPONENT_ID);
+#endif // !UE_BUILD_SHIPPING
+		Template.OwningClientComponents.Add(SpatialConstants::HEARTBEAT_COMPONENT_ID);
+	}
+
+	AddSchemaComponents(Info, Template.AuthoritativeComponents);
+
+	int32 SubobjectIndex = 0;
+	for (const auto& SubobjectInfoPair : Info.SubobjectInfo)
+	{
+		if (PresentSubobjects.IsValidIndex(SubobjectIndex) && PresentSubobjects[SubobjectIndex])
+		{
+			AddSchemaComponents(SubobjectInfoPair.Value.Get(), Template.AuthoritativeComponents);
+		}
+		SubobjectIndex++;
+	}
+
+	Template.Components.Append(Template.AuthoritativeComponents);
+	Template.Components.Append(Template.OwningClientComponents);
+
+	return Template;
+}
+
+Worker_ComponentData FEntityAclTemplateCache::CreateEntityAclData(const FEntityAclTemplate& Template, const FString& OwnerAttribute, const TArray<Worker_ComponentId>& ExtraAuthoritativeComponents) const
+{
+	Worker_ComponentData Data = {};
+	Data.component_id = SpatialConstants::ENTITY_ACL_COMPONENT_ID;
+	Data.schema_type = Schema_CreateComponentData();
+	Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data.schema_type);
+
+	FWorkerAttributeTable& AttributeTable = FWorkerAttributeTable::Get();
+
+	auto AllocateInternedAttribute = [&AttributeTable, ComponentObject](FWorkerAttributeHandle Attribute)
+	{
+		const TArray<ANSICHAR>& UTF8 = AttributeTable.GetAttributeUTF8(Attribute);
+		return AllocateSchemaAttribute(ComponentObject, UTF8.GetData(), UTF8.Num());
+	};
+
+	auto AllocateAttribute = [this, &AllocateInternedAttribute](int32 Index)
+	{
+		return AllocateInternedAttribute(Attributes[Index]);
+	};
+
+	FSchemaAttribute OwnerSchemaAttribute;
+	if (Template.ReadAcl == FEntityAclTemplate::EReadAcl::AnyServerOrOwningClient || Template.OwningClientComponents.Num() > 0)
+	{
+		OwnerSchemaAttribute = AllocateInternedAttribute(AttributeTable.InternAttribute(OwnerAttribute));
+	}
+
+	// Read ACL
+	Schema_Object* ReadAclObject = Schema_AddObject(ComponentObject, 1);
+	if (Template.ReadAcl == FEntityAclTemplate::EReadAcl::AnyServerOrClient)
+	{
+		AddAttributeSetToSchema(ReadAclObject, AllocateAttribute(0));
+	}
+	else if (Template.ReadAcl == FEntityAclTemplate::EReadAcl::AnyServerOrOwningClient)
+	{
+		AddAttributeSetToSchema(ReadAclObject, OwnerSchemaAttribute);
+	}
+
+	FSchemaAttribute AuthoritativeSchemaAttribute;
+	for (int32 i = 1; i <= NumServerAttributes; i++)
+	{
+		FSchemaAttribute ServerSchemaAttribute = AllocateAttribute(i);
+		AddAttributeSetToSchema(ReadAclObject, ServerSchemaAttribute);
+
+		if (i == Template.AuthoritativeAttribute)
+		{
+			AuthoritativeSchemaAttribute = ServerSchemaAttribute;
+		}
+	}
+
+	if (AuthoritativeSchemaAttribute.Bytes == nullptr)
+	{
+		AuthoritativeSchemaAttribute = AllocateAttribute(Template.AuthoritativeAttribute);
+	}
+
+	// Write ACL
+	for (Worker_ComponentId ComponentId : Template.AuthoritativeComponents)
+	{
+		AddWriteAclEntryToSchema(ComponentObject, ComponentId, AuthoritativeSchemaAttribute);
+	}
+
+	for (Worker_ComponentId ComponentId : ExtraAuthoritativeComponents)
+	{
+		if (!Template.Components.Contains(ComponentId))
+		{
+			AddWriteAclEntryToSchema(ComponentObject, ComponentId, AuthoritativeSchemaAttribute);
+		}
+	}
+
+	for (Worker_ComponentId ComponentId : Template.OwningClientComponents)
+	{
+		AddWriteAclEntryToSchema(ComponentObject, ComponentId, OwnerSchemaAttribute);
+	}
+
+	return Data;
+}
+
+int32 FEntityAclTemplateCache::Num() const
+{
+	int32 Count = 0;
+	for (const auto& Pair : Templates)
+	{
+		Count += Pair.Value.Num();
+	}
+	return Count;
+}
+
+void FEntityAclTemplateCache::Empty()
+{
+	Templates.Empty();
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,74 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/FrameArena.h"
+
+namespace SpatialGDK
+{
+
+FFrameArena::FFrameArena(int32 InBlockSize)
+	: BlockSize(InBlockSize)
+{
+}
+
+uint8* FFrameArena::Allocate(int32 NumBytes)
+{
+	check(NumBytes >= 0);
+
+	// Move on to the next block, reusing one kept from an earlier frame when it is big enough.
+	while (!Blocks.IsValidIndex(CurrentBlock) || CurrentOffset + NumBytes > Blocks[CurrentBlock].Num())
+	{
+		if (Blocks.IsValidIndex(CurrentBlock))
+		{
+			CurrentBlock++;
+			CurrentOffset = 0;
+		}
+
+		if (!Blocks.IsValidIndex(CurrentBlock))
+		{
+			// Oversized allocations get a block of their own, which is kept like any other.
+			TArray<uint8>& Block = Blocks.AddDefaulted_GetRef();
+			Block.SetNumUninitialized(FMath::Max(BlockSize, NumBytes));
+			BlocksAllocated++;
+		}
+	}
+
+	uint8* Result = Blocks[CurrentBlock].GetData() + CurrentOffset;
+	CurrentOffset += NumBytes;
+	BytesAllocated += NumBytes;
+	return Result;
+}
+
+TArrayView<const uint8> FFrameArena::Copy(const uint8* Data, int32 NumBytes)
+{
+	uint8* Buffer = Allocate(NumBytes);
+	FMemory::Memcpy(Buffer, Data, NumBytes);
+	return TArrayView<const uint8>(Buffer, NumBytes);
+}
+
+void FFrameArena::Reset()
+{
+	HighWaterMark = FMath::Max(HighWaterMark, BytesAllocated);
+	BytesAllocated = 0;
+	CurrentBlock = 0;
+	CurrentOffset = 0;
+}
+
+void FFrameArena::ConsumeStats(int32& OutHighWaterMark, int32& OutBlocksAllocated)
+{
+	OutHighWaterMark = FMath::Max(HighWaterMark, BytesAllocated);
+	OutBlocksAllocated = BlocksAllocated;
+	HighWaterMark = 0;
+	BlocksAllocated = 0;
+}
+
+int32 FFrameArena::GetReservedBytes() const
+{
+	int32 ReservedBytes = 0;
+	for (const TArray<uint8>& Block : Blocks)
+	{
+		ReservedBytes += Block.Num();
+	}
+	return ReservedBytes;
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,70 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/HandoverShadowData.h"
+
+#include "UObject/UnrealType.h"
+
+#include "Interop/SpatialClassInfoManager.h"
+
+namespace SpatialGDK
+{
+
+void InitializeHandoverShadowData(const TArray<FHandoverPropertyInfo>& HandoverProperties, TArray<uint8>& ShadowData)
+{
+	uint32 Size = 0;
+	for (const FHandoverPropertyInfo& PropertyInfo : HandoverProperties)
+	{
+		if (PropertyInfo.ArrayIdx == 0) // For static arrays, the first element will handle the whole array
+		{
+			// Make sure we conform to Unreal's alignment requirements; this is matched below and in GetHandoverChangeList()
+			Size = Align(Size, PropertyInfo.Property->GetMinAlignment());
+			Size += PropertyInfo.Property->GetSize();
+		}
+	}
+	ShadowData.AddZeroed(Size);
+	uint32 Offset = 0;
+	for (const FHandoverPropertyInfo& PropertyInfo : HandoverProperties)
+	{
+		if (PropertyInfo.ArrayIdx == 0)
+		{
+			Offset = Align(Offset, PropertyInfo.Property->GetMinAlignment());
+			PropertyInfo.Property->InitializeValue(ShadowData.GetData() + Offset);
+			Offset += PropertyInfo.Property->GetSize();
+		}
+	}
+}
+
+FHandoverChangeState GetHandoverChangeList(const TArray<FHandoverPropertyInfo>& HandoverProperties, TArray<uint8>& ShadowData, const uint8* Object, bool bForceAll)
+{
+	FHandoverChangeState HandoverChanged;
+
+	uint32 ShadowDataOffset = 0;
+	for (const FHandoverPropertyInfo& PropertyInfo : HandoverProperties)
+	{
+		ShadowDataOffset = Align(ShadowDataOffset, PropertyInfo.Property->GetMinAlignment());
+
+		const uint8* Data = Object + PropertyInfo.Offset;
+		uint8* StoredData = ShadowData.GetData() + ShadowDataOffset;
+		const int32 ElementSize = PropertyInfo.Property->ElementSize;
+
+		// Compare and assign.
+		if (PropertyInfo.bPlainOldData)
+		{
+			if (bForceAll || FMemory::Memcmp(StoredData, Data, ElementSize) != 0)
+			{
+				HandoverChanged.Add(PropertyInfo.Handle);
+				FMemory::Memcpy(StoredData, Data, ElementSize);
+			}
+		}
+		else if (bForceAll || !PropertyInfo.Property->Identical(StoredData, Data))
+		{
+			HandoverChanged.Add(PropertyInfo.Handle);
+			PropertyInfo.Property->CopySingleValue(StoredData, Data);
+		}
+		ShadowDataOffset += ElementSize;
+	}
+
+	return HandoverChanged;
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,98 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/HeartbeatTimingWheel.h"
+
+namespace SpatialGDK
+{
+
+FHeartbeatTimingWheel::FHeartbeatTimingWheel()
+	: TimeoutSeconds(0.f)
+	, ResolutionSeconds(1.f)
+	, StartTime(0.0)
+	, CurrentTick(0)
+{
+}
+
+void FHeartbeatTimingWheel::Init(float InTimeoutSeconds, float InResolutionSeconds, double CurrentTime)
+{
+	check(InResolutionSeconds > 0.f);
+
+	TimeoutSeconds = FMath::Max(InTimeoutSeconds, 0.f);
+	ResolutionSeconds = InResolutionSeconds;
+	StartTime = CurrentTime;
+	CurrentTick = 0;
+
+	// Deadlines are at most this many ticks ahead, so no two live deadlines share a slot.
+	const int32 NumSlots = FMath::CeilToInt(TimeoutSeconds / ResolutionSeconds) + 2;
+	Slots.Reset();
+	Slots.SetNum(NumSlots);
+	Deadlines.Reset();
+}
+
+int64 FHeartbeatTimingWheel::GetTick(double Time) const
+{
+	return FMath::Max<int64>((int64)FMath::FloorToDouble((Time - StartTime) / ResolutionSeconds), 0);
+}
+
+void FHeartbeatTimingWheel::Refresh(Worker_EntityId EntityId, double CurrentTime)
+{
+	check(Slots.Num() > 0);
+
+	// Round up so that an entity never times out early.
+	const int64 Deadline = FMath::Max((int64)FMath::CeilToDouble((CurrentTime - StartTime + TimeoutSeconds) / ResolutionSeconds), CurrentTick + 1);
+
+	int64& StoredDeadline = Deadlines.FindOrAdd(EntityId);
+	if (StoredDeadline == Deadline)
+	{
+		return;
+	}
+
+	StoredDeadline = Deadline;
+	Slots[Deadline % Slots.Num()].Add(EntityId);
+}
+
+void FHeartbeatTimingWheel::Remove(Worker_EntityId EntityId)
+{
+	// The entity's slot entry is dropped when that slot is advanced over.
+	Deadlines.Remove(EntityId);
+}
+
+void FHeartbeatTimingWheel::Advance(double CurrentTime, TArray<Worker_EntityId>& OutTimedOut)
+{
+	if (Slots.Num() == 0)
+	{
+		return;
+	}
+
+	const int64 TargetTick = GetTick(CurrentTime);
+
+	// After a long hitch, visiting each slot once is enough to find every expired entity.
+	const int64 FirstTick = FMath::Max(CurrentTick + 1, TargetTick - Slots.Num() + 1);
+	for (int64 Tick = FirstTick; Tick <= TargetTick; Tick++)
+	{
+		const int32 SlotIndex = Tick % Slots.Num();
+		TArray<Worker_EntityId>& Slot = Slots[SlotIndex];
+
+		for (int32 i = Slot.Num() - 1; i >= 0; i--)
+		{
+			const Worker_EntityId EntityId = Slot[i];
+			const int64* Deadline = Deadlines.Find(EntityId);
+
+			// Entries for removed entities, or for entities refreshed since they were added, are stale.
+			if (Deadline == nullptr || *Deadline % Slots.Num() != SlotIndex)
+			{
+				Slot.RemoveAtSwap(i, 1, /* bAllowShrinking */ false);
+			}
+			else if (*Deadline <= TargetTick)
+			{
+				OutTimedOut.Add(EntityId);
+				Deadlines.Remove(EntityId);
+				Slot.RemoveAtSwap(i, 1, /* bAllowShrinking */ false);
+			}
+		}
+	}
+
+	CurrentTick = FMath::Max(CurrentTick, TargetTick);
+}
+
+} // namespace SpatialGDK
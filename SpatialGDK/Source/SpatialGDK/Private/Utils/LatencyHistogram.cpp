@@ -0,0 +1,166 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/LatencyHistogram.h"
+
+#include "HAL/PlatformAtomics.h"
+
+namespace SpatialGDK
+{
+
+FLatencyHistogram::FLatencyHistogram()
+	: SumMicroseconds(0)
+	, MaxMicroseconds(0)
+{
+	FMemory::Memzero((void*)Counts, sizeof(Counts));
+}
+
+int32 FLatencyHistogram::GetBucketIndex(uint64 Microseconds)
+{
+	if (Microseconds < SubBucketCount)
+	{
+		return static_cast<int32>(Microseconds);
+	}
+
+	const int32 HighestBit = static_cast<int32>(FMath::FloorLog2_64(Microseconds));
+	if (HighestBit >= MaxValueBits)
+	{
+		return NumBuckets - 1;
+	}
+
+	const int32 SubBucket = static_cast<int32>((Microseconds >> (HighestBit - SubBucketBits)) & (SubBucketCount - 1));
+	return SubBucketCount * (HighestBit - SubBucketBits + 1) + SubBucket;
+}
+
+uint64 FLatencyHistogram::GetBucketLowerBound(int32 BucketIndex)
+{
+	if (BucketIndex < SubBucketCount)
+	{
+		return BucketIndex;
+	}
+
+	const int32 HighestBit = BucketIndex / SubBucketCount + SubBucketBits - 1;
+	const uint64 SubBucket = BucketIndex % SubBucketCount;
+	return (SubBucketCount + SubBucket) << (HighestBit - SubBucketBits);
+}
+
+uint64 FLatencyHistogram::GetBucketUpperBound(int32 BucketIndex)
+{
+	if (BucketIndex < SubBucketCount)
+	{
+		return BucketIndex + 1;
+	}
+
+	const int32 HighestBit = BucketIndex / SubBucketCount + SubBucketBits - 1;
+	return GetBucketLowerBound(BucketIndex) + (uint64(1) << (HighestBit - SubBucketBits));
+}
+
+void FLatencyHistogram::Record(double Seconds)
+{
+	RecordMicroseconds(Seconds > 0.0 ? static_cast<uint64>(Seconds * 1e6) : 0);
+}
+
+void FLatencyHistogram::RecordMicroseconds(uint64 Microseconds)
+{
+	FPlatformAtomics::InterlockedIncrement(&Counts[GetBucketIndex(Microseconds)]);
+	FPlatformAtomics::InterlockedAdd(&SumMicroseconds, static_cast<int64>(Microseconds));
+
+	int64 CurrentMax = MaxMicroseconds;
+	while (static_cast<int64>(Microseconds) > CurrentMax)
+	{
+		const int64 PreviousMax = FPlatformAtomics::InterlockedCompareExchange(&MaxMicroseconds, static_cast<int64>(Microseconds), CurrentMax);
+		if (PreviousMax == CurrentMax)
+		{
+			break;
+		}
+		CurrentMax = PreviousMax;
+	}
+}
+
+void FLatencyHistogram::Drain(FLatencyHistogramSnapshot& OutSnapshot)
+{
+	// Samples recorded while draining land either in this snapshot or the next one; none are lost.
+	OutSnapshot.Counts.SetNumUninitialized(NumBuckets);
+	OutSnapshot.TotalCount = 0;
+	for (int32 i = 0; i < NumBuckets; i++)
+	{
+		OutSnapshot.Counts[i] = static_cast<uint32>(FPlatformAtomics::InterlockedExchange(&Counts[i], 0));
+		OutSnapshot.TotalCount += OutSnapshot.Counts[i];
+	}
+
+	OutSnapshot.SumMicroseconds = static_cast<uint64>(FPlatformAtomics::InterlockedExchange(&SumMicroseconds, 0));
+	OutSnapshot.MaxMicroseconds = static_cast<uint64>(FPlatformAtomics::InterlockedExchange(&MaxMicroseconds, 0));
+}
+
+double FLatencyHistogramSnapshot::GetPercentile(double Fraction) const
+{
+	if (TotalCount == 0)
+	{
+		return 0.0;
+	}
+
+	const uint64 Threshold = FMath::Max<uint64>(1, static_cast<uint64>(FMath::CeilToDouble(FMath::Clamp(Fraction, 0.0, 1.0) * TotalCount)));
+
+	uint64 Cumulative = 0;
+	for (int32 i = 0; i < Counts.Num(); i++)
+	{
+		Cumulative += Counts[i];
+		if (Cumulative >= Threshold)
+		{
+			// Report the bucket's upper bound, clamped to the real maximum so p100 is exact.
+			const uint64 UpperBound = FMath::Min(FLatencyHistogram::GetBucketUpperBound(i), MaxMicroseconds);
+			return UpperBound / 1e6;
+		}
+	}
+
+	return GetMaxSeconds();
+}
+
+double FLatencyHistogramSnapshot::GetMeanSeconds() const
+{
+	return TotalCount > 0 ? (SumMicroseconds / 1e6) / TotalCount : 0.0;
+}
+
+HistogramMetric FLatencyHistogramSnapshot::ToHistogramMetric(const FString& Key) const
+{
+	HistogramMetric Metric;
+	Metric.Key = TCHAR_TO_UTF8(*Key);
+	Metric.Sum = SumMicroseconds / 1e6;
+
+	if (TotalCount == 0)
+	{
+		return Metric;
+	}
+
+	uint64 Cumulative = 0;
+	for (int32 i = 0; i < Counts.Num(); i++)
+	{
+		Cumulative += Counts[i];
+
+		// Only emit a bucket at the end of each power of two to keep the message small.
+		if ((i % FLatencyHistogram::SubBucketCount) == FLatencyHistogram::SubBucketCount - 1)
+		{
+			HistogramMetricBucket Bucket;
+			Bucket.UpperBound = FLatencyHistogram::GetBucketUpperBound(i) / 1e6;
+			Bucket.Samples = static_cast<uint32>(Cumulative);
+			Metric.Buckets.Add(Bucket);
+		}
+
+		if (Cumulative == TotalCount)
+		{
+			break;
+		}
+	}
+
+	// The last bucket always covers every sample.
+	if (Metric.Buckets.Num() == 0 || Metric.Buckets.Last().Samples != TotalCount)
+	{
+		HistogramMetricBucket Bucket;
+		Bucket.UpperBound = GetMaxSeconds();
+		Bucket.Samples = static_cast<uint32>(TotalCount);
+		Metric.Buckets.Add(Bucket);
+	}
+
+	return Metric;
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,294 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/PropertySerializationPlan.h"
+
+#include "Net/RepLayout.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/TextProperty.h"
+#include "UObject/UnrealType.h"
+
+#include "Utils/SchemaUtils.h"
+
+namespace SpatialGDK
+{
+
+EPropertyOp GetPropertyOp(UProperty* Property)
+{
+	if (UStructProperty* StructProperty = Cast<UStructProperty>(Property))
+	{
+		return (StructProperty->Struct->StructFlags & STRUCT_NetSerializeNative) ? EPropertyOp::NetSerializeStruct : EPropertyOp::Struct;
+	}
+	else if (Property->IsA<UBoolProperty>())
+	{
+		return EPropertyOp::Bool;
+	}
+	else if (Property->IsA<UFloatProperty>())
+	{
+		return EPropertyOp::Float;
+	}
+	else if (Property->IsA<UDoubleProperty>())
+	{
+		return EPropertyOp::Double;
+	}
+	else if (Property->IsA<UInt8Property>())
+	{
+		return EPropertyOp::Int8;
+	}
+	else if (Property->IsA<UInt16Property>())
+	{
+		return EPropertyOp::Int16;
+	}
+	else if (Property->IsA<UIntProperty>())
+	{
+		return EPropertyOp::Int32;
+	}
+	else if (Property->IsA<UInt64Property>())
+	{
+		return EPropertyOp::Int64;
+	}
+	else if (Property->IsA<UByteProperty>())
+	{
+		return EPropertyOp::Byte;
+	}
+	else if (Property->IsA<UUInt16Property>())
+	{
+		return EPropertyOp::UInt16;
+	}
+	else if (Property->IsA<UUInt32Property>())
+	{
+		return EPropertyOp::UInt32;
+	}
+	else if (Property->IsA<UUInt64Property>())
+	{
+		return EPropertyOp::UInt64;
+	}
+	else if (Property->IsA<UObjectPropertyBase>())
+	{
+		return EPropertyOp::Object;
+	}
+	else if (Property->IsA<UNameProperty>())
+	{
+		return EPropertyOp::Name;
+	}
+	else if (Property->IsA<UStrProperty>())
+	{
+		return EPropertyOp::String;
+	}
+	else if (Property->IsA<UTextProperty>())
+	{
+		return EPropertyOp::Text;
+	}
+	else if (Property->IsA<UArrayProperty>())
+	{
+		return EPropertyOp::DynamicArray;
+	}
+	else if (UEnumProperty* EnumProperty = Cast<UEnumProperty>(Property))
+	{
+		return EnumProperty->ElementSize < 4 ? EPropertyOp::SmallEnum : GetPropertyOp(EnumProperty->GetUnderlyingProperty());
+	}
+	else if (Property->IsA<UDelegateProperty>() || Property->IsA<UMulticastDelegateProperty>() || Property->IsA<UInterfaceProperty>())
+	{
+		return EPropertyOp::Ignored;
+	}
+
+	return EPropertyOp::Unsupported;
+}
+
+FPropertyPlanStep CompilePropertyStep(UProperty* Property, int32 Offset)
+{
+	FPropertyPlanStep Step;
+	Step.Offset = Offset;
+
+	if (Property == nullptr)
+	{
+		return Step;
+	}
+
+	Step.Property = Property;
+	Step.ElementProperty = Property;
+	Step.ElementSize = Property->ElementSize;
+	Step.Op = GetPropertyOp(Property);
+	Step.ElementOp = Step.Op;
+
+	if (Step.Op == EPropertyOp::DynamicArray)
+	{
+		UProperty* Inner = static_cast<UArrayProperty*>(Property)->Inner;
+		Step.ElementProperty = Inner;
+		Step.ElementSize = Inner->ElementSize;
+		Step.ElementOp = GetPropertyOp(Inner);
+	}
+
+	return Step;
+}
+
+void FPropertySerializationPlan::CompileReplicated(const FRepLayout& RepLayout)
+{
+	Replicated.Empty(RepLayout.BaseHandleToCmdIndex.Num());
+
+	for (const FHandleToCmdIndex& HandleToCmdIndex : RepLayout.BaseHandleToCmdIndex)
+	{
+		const FRepLayoutCmd& Cmd = RepLayout.Cmds[HandleToCmdIndex.CmdIndex];
+		Replicated.Add(CompilePropertyStep(Cmd.Property, Cmd.Offset));
+	}
+}
+
+const FPropertyPlanStep& FPropertySerializationPlan::FindReplicatedOrCompile(uint32 Handle, UProperty* Property, int32 Offset, FPropertyPlanStep& OutFallback) const
+{
+	const FPropertyPlanStep* Step = FindReplicated(Handle);
+	if (Step != nullptr && Step->Property == Property)
+	{
+		return *Step;
+	}
+
+	OutFallback = CompilePropertyStep(Property, Offset);
+	return OutFallback;
+}
+
+void AddPrimitiveToSchema(Schema_Object* Object, Schema_FieldId FieldId, EPropertyOp Op, UProperty* Property, const uint8* Data)
+{
+	switch (Op)
+	{
+	case EPropertyOp::Bool:
+		Schema_AddBool(Object, FieldId, (uint8)static_cast<UBoolProperty*>(Property)->GetPropertyValue(Data));
+		break;
+	case EPropertyOp::Float:
+		Schema_AddFloat(Object, FieldId, *reinterpret_cast<const float*>(Data));
+		break;
+	case EPropertyOp::Double:
+		Schema_AddDouble(Object, FieldId, *reinterpret_cast<const double*>(Data));
+		break;
+	case EPropertyOp::Int8:
+		Schema_AddInt32(Object, FieldId, (int32)*reinterpret_cast<const int8*>(Data));
+		break;
+	case EPropertyOp::Int16:
+		Schema_AddInt32(Object, FieldId, (int32)*reinterpret_cast<const int16*>(Data));
+		break;
+	case EPropertyOp::Int32:
+		Schema_AddInt32(Object, FieldId, *reinterpret_cast<const int32*>(Data));
+		break;
+	case EPropertyOp::Int64:
+		Schema_AddInt64(Object, FieldId, *reinterpret_cast<const int64*>(Data));
+		break;
+	case EPropertyOp::Byte:
+		Schema_AddUint32(Object, FieldId, (uint32)*Data);
+		break;
+	case EPropertyOp::UInt16:
+		Schema_AddUint32(Object, FieldId, (uint32)*reinterpret_cast<const uint16*>(Data));
+		break;
+	case EPropertyOp::UInt32:
+		Schema_AddUint32(Object, FieldId, *reinterpret_cast<const uint32*>(Data));
+		break;
+	case EPropertyOp::UInt64:
+		Schema_AddUint64(Object, FieldId, *reinterpret_cast<const uint64*>(Data));
+		break;
+	case EPropertyOp::SmallEnum:
+		Schema_AddUint32(Object, FieldId, (uint32)static_cast<UEnumProperty*>(Property)->GetUnderlyingProperty()->GetUnsignedIntPropertyValue(Data));
+		break;
+	case EPropertyOp::Name:
+		AddStringToSchema(Object, FieldId, reinterpret_cast<const FName*>(Data)->ToString());
+		break;
+	case EPropertyOp::String:
+		AddStringToSchema(Object, FieldId, *reinterpret_cast<const FString*>(Data));
+		break;
+	case EPropertyOp::Text:
+		AddStringToSchema(Object, FieldId, reinterpret_cast<const FText*>(Data)->ToString());
+		break;
+	default:
+		checkf(false, TEXT("Tried to add non-primitive property op %d in field %d"), (int32)Op, FieldId);
+		break;
+	}
+}
+
+void ApplyPrimitiveFromSchema(const Schema_Object* Object, Schema_FieldId FieldId, uint32 Index, EPropertyOp Op, UProperty* Property, uint8* Data)
+{
+	switch (Op)
+	{
+	case EPropertyOp::Bool:
+		static_cast<UBoolProperty*>(Property)->SetPropertyValue(Data, Schema_IndexBool(Object, FieldId, Index) != 0);
+		break;
+	case EPropertyOp::Float:
+		*reinterpret_cast<float*>(Data) = Schema_IndexFloat(Object, FieldId, Index);
+		break;
+	case EPropertyOp::Double:
+		*reinterpret_cast<double*>(Data) = Schema_IndexDouble(Object, FieldId, Index);
+		break;
+	case EPropertyOp::Int8:
+		*reinterpret_cast<int8*>(Data) = (int8)Schema_IndexInt32(Object, FieldId, Index);
+		break;
+	case EPropertyOp::Int16:
+		*reinterpret_cast<int16*>(Data) = (int16)Schema_IndexInt32(Object, FieldId, Index);
+		break;
+	case EPropertyOp::Int32:
+		*reinterpret_cast<int32*>(Data) = Schema_IndexInt32(Object, FieldId, Index);
+		break;
+	case EPropertyOp::Int64:
+		*reinterpret_cast<int64*>(Data) = Schema_IndexInt64(Object, FieldId, Index);
+		break;
+	case EPropertyOp::Byte:
+		*Data = (uint8)Schema_IndexUint32(Object, FieldId, Index);
+		break;
+	case EPropertyOp::UInt16:
+		*reinterpret_cast<uint16*>(Data) = (uint16)Schema_IndexUint32(Object, FieldId, Index);
+		break;
+	case EPropertyOp::UInt32:
+		*reinterpret_cast<uint32*>(Data) = Schema_IndexUint32(Object, FieldId, Index);
+		break;
+	case EPropertyOp::UInt64:
+		*reinterpret_cast<uint64*>(Data) = Schema_IndexUint64(Object, FieldId, Index);
+		break;
+	case EPropertyOp::SmallEnum:
+		static_cast<UEnumProperty*>(Property)->GetUnderlyingProperty()->SetIntPropertyValue(Data, (uint64)Schema_IndexUint32(Object, FieldId, Index));
+		break;
+	case EPropertyOp::Name:
+		*reinterpret_cast<FName*>(Data) = FName(*IndexStringFromSchema(Object, FieldId, Index));
+		break;
+	case EPropertyOp::String:
+		*reinterpret_cast<FString*>(Data) = IndexStringFromSchema(Object, FieldId, Index);
+		break;
+	case EPropertyOp::Text:
+		*reinterpret_cast<FText*>(Data) = FText::FromString(IndexStringFromSchema(Object, FieldId, Index));
+		break;
+	default:
+		checkf(false, TEXT("Tried to read non-primitive property op %d in field %d"), (int32)Op, FieldId);
+		break;
+	}
+}
+
+uint32 GetSchemaCountForOp(const Schema_Object* Object, Schema_FieldId FieldId, EPropertyOp Op)
+{
+	switch (Op)
+	{
+	case EPropertyOp::Bool:
+		return Schema_GetBoolCount(Object, FieldId);
+	case EPropertyOp::Float:
+		return Schema_GetFloatCount(Object, FieldId);
+	case EPropertyOp::Double:
+		return Schema_GetDoubleCount(Object, FieldId);
+	case EPropertyOp::Int8:
+	case EPropertyOp::Int16:
+	case EPropertyOp::Int32:
+		return Schema_GetInt32Count(Object, FieldId);
+	case EPropertyOp::Int64:
+		return Schema_GetInt64Count(Object, FieldId);
+	case EPropertyOp::Byte:
+	case EPropertyOp::UInt16:
+	case EPropertyOp::UInt32:
+	case EPropertyOp::SmallEnum:
+		return Schema_GetUint32Count(Object, FieldId);
+	case EPropertyOp::UInt64:
+		return Schema_GetUint64Count(Object, FieldId);
+	case EPropertyOp::Object:
+		return Schema_GetObjectCount(Object, FieldId);
+	case EPropertyOp::Name:
+	case EPropertyOp::String:
+	case EPropertyOp::Text:
+	case EPropertyOp::NetSerializeStruct:
+	case EPropertyOp::Struct:
+		return Schema_GetBytesCount(Object, FieldId);
+	default:
+		checkf(false, TEXT("Tried to get count of unknown property op %d in field %d"), (int32)Op, FieldId);
+		return 0;
+	}
+}
+
+} // namespace SpatialGDK
@@ -5,11 +5,14 @@
 #include "Engine/Engine.h"
 #include "EngineGlobals.h"
 #include "GameFramework/PlayerController.h"
+#include "Misc/Paths.h"
 
 #include "EngineClasses/SpatialNetConnection.h"
 #include "EngineClasses/SpatialNetDriver.h"
 #include "EngineClasses/SpatialPackageMapClient.h"
 #include "Interop/Connection/SpatialWorkerConnection.h"
+#include "Interop/SpatialReceiver.h"
+#include "Interop/SpatialSender.h"
 #include "SpatialGDKSettings.h"
 #include "Utils/SchemaUtils.h"
 
@@ -49,12 +52,176 @@ void USpatialMetrics::TickMetrics()
 	DynamicFPSMetrics.GaugeMetrics.Add(DynamicFPSGauge);
 	DynamicFPSMetrics.Load = WorkerLoad;
 
+	ReportLatency(OpListProcessingLatency, SpatialConstants::SPATIALOS_METRICS_OP_LIST_PROCESSING_TIME, DynamicFPSMetrics);
+	ReportLatency(NetDriver->Connection->GetOutgoingMessageLatency(), SpatialConstants::SPATIALOS_METRICS_OUTGOING_MESSAGE_TIME, DynamicFPSMetrics);
+	ReportLatency(CreateEntityLatency, SpatialConstants::SPATIALOS_METRICS_CREATE_ENTITY_TIME, DynamicFPSMetrics);
+	ReportLatency(CommandResponseLatency, SpatialConstants::SPATIALOS_METRICS_COMMAND_RESPONSE_TIME, DynamicFPSMetrics);
+	ReportLatency(NetDriver->GetDormantColdStorage().GetWakeLatency(), SpatialConstants::SPATIALOS_METRICS_DORMANT_WAKE_TIME, DynamicFPSMetrics);
+	ReportLatency(NetDriver->Receiver->GetEntityMaterializationQueue().GetFrameTime(), SpatialConstants::SPATIALOS_METRICS_MATERIALIZATION_FRAME_TIME, DynamicFPSMetrics);
+	ReportLatency(NetDriver->Receiver->GetEntityMaterializationQueue().GetWaitTime(), SpatialConstants::SPATIALOS_METRICS_MATERIALIZATION_WAIT_TIME, DynamicFPSMetrics);
+	ReportLatency(NetDriver->Receiver->GetFirstCheckoutLatency(), SpatialConstants::SPATIALOS_METRICS_FIRST_CHECKOUT_TIME, DynamicFPSMetrics);
+	ReportLatency(NetDriver->Receiver->GetEntityMaterializationQueue().GetClassLoadTime(), SpatialConstants::SPATIALOS_METRICS_ENTITY_CLASS_LOAD_TIME, DynamicFPSMetrics);
+
+	uint64 InterestBytesSent;
+	uint32 InterestUpdatesSkipped;
+	NetDriver->Sender->ConsumeInterestStats(InterestBytesSent, InterestUpdatesSkipped);
+
+	SpatialGDK::GaugeMetric InterestBytesGauge;
+	InterestBytesGauge.Key = TCHAR_TO_UTF8(*SpatialConstants::SPATIALOS_METRICS_INTEREST_BYTES_PER_SECOND);
+	InterestBytesGauge.Value = TimeSinceLastReport > 0.f ? InterestBytesSent / TimeSinceLastReport : 0.0;
+	DynamicFPSMetrics.GaugeMetrics.Add(InterestBytesGauge);
+
+	SpatialGDK::GaugeMetric InterestSkippedGauge;
+	InterestSkippedGauge.Key = TCHAR_TO_UTF8(*SpatialConstants::SPATIALOS_METRICS_INTEREST_UPDATES_SKIPPED);
+	InterestSkippedGauge.Value = InterestUpdatesSkipped;
+	DynamicFPSMetrics.GaugeMetrics.Add(InterestSkippedGauge);
+
+	uint64 CreatedEntityBytes;
+	uint32 EntitiesCreated;
+	NetDriver->Sender->ConsumeEntityCreationStats(CreatedEntityBytes, EntitiesCreated);
+
+	if (EntitiesCreated > 0)
+	{
+		SpatialGDK::GaugeMetric CreatedEntityBytesGauge;
+		CreatedEntityBytesGauge.Key = TCHAR_TO_UTF8(*SpatialConstants::SPATIALOS_METRICS_CREATED_ENTITY_BYTES);
+		CreatedEntityBytesGauge.Value = double(CreatedEntityBytes) / EntitiesCreated;
+		DynamicFPSMetrics.GaugeMetrics.Add(CreatedEntityBytesGauge);
+	}
+
+	if (GetDefault<USpatialGDKSettings>()->EntityMaterializationBudgetMs > 0.f)
+	{
+		SpatialGDK::GaugeMetric MaterializationQueueGauge;
+		MaterializationQueueGauge.Key = TCHAR_TO_UTF8(*SpatialConstants::SPATIALOS_METRICS_MATERIALIZATION_QUEUE_DEPTH);
+		MaterializationQueueGauge.Value = NetDriver->Receiver->GetEntityMaterializationQueue().Num();
+		DynamicFPSMetrics.GaugeMetrics.Add(MaterializationQueueGauge);
+	}
+
+	if (GetDefault<USpatialGDKSettings>()->bAsyncLoadEntityClasses)
+	{
+		SpatialGDK::GaugeMetric ParkedEntitiesGauge;
+		ParkedEntitiesGauge.Key = TCHAR_TO_UTF8(*SpatialConstants::SPATIALOS_METRICS_ENTITIES_AWAITING_CLASS_LOAD);
+		ParkedEntitiesGauge.Value = NetDriver->Receiver->GetEntityMaterializationQueue().NumParked();
+		DynamicFPSMetrics.GaugeMetrics.Add(ParkedEntitiesGauge);
+	}
+
+	if (GetDefault<USpatialGDKSettings>()->bUseDormantColdStorage)
+	{
+		SpatialGDK::GaugeMetric ColdStorageEntitiesGauge;
+		ColdStorageEntitiesGauge.Key = TCHAR_TO_UTF8(*SpatialConstants::SPATIALOS_METRICS_COLD_STORAGE_ENTITIES);
+		ColdStorageEntitiesGauge.Value = NetDriver->GetDormantColdStorage().Num();
+		DynamicFPSMetrics.GaugeMetrics.Add(ColdStorageEntitiesGauge);
+
+		SpatialGDK::GaugeMetric ColdStorageBytesGauge;
+		ColdStorageBytesGauge.Key = TCHAR_TO_UTF8(*SpatialConstants::SPATIALOS_METRICS_COLD_STORAGE_BYTES);
+		ColdStorageBytesGauge.Value = NetDriver->GetDormantColdStorage().GetReleasedBytes();
+		DynamicFPSMetrics.GaugeMetrics.Add(ColdStorageBytesGauge);
+	}
+
+	if (GetDefault<USpatialGDKSettings>()->bPackRPCs)
+	{
+		int32 RPCArenaHighWaterMark;
+		int32 RPCArenaBlocksAllocated;
+		NetDriver->Sender->ConsumeRPCArenaStats(RPCArenaHighWaterMark, RPCArenaBlocksAllocated);
+
+		SpatialGDK::GaugeMetric RPCArenaHighWaterMarkGauge;
+		RPCArenaHighWaterMarkGauge.Key = TCHAR_TO_UTF8(*SpatialConstants::SPATIALOS_METRICS_RPC_ARENA_HIGH_WATER_MARK);
+		RPCArenaHighWaterMarkGauge.Value = RPCArenaHighWaterMark;
+		DynamicFPSMetrics.GaugeMetrics.Add(RPCArenaHighWaterMarkGauge);
+
+		SpatialGDK::GaugeMetric RPCArenaBlocksGauge;
+		RPCArenaBlocksGauge.Key = TCHAR_TO_UTF8(*SpatialConstants::SPATIALOS_METRICS_RPC_ARENA_BLOCKS_ALLOCATED);
+		RPCArenaBlocksGauge.Value = RPCArenaBlocksAllocated;
+		DynamicFPSMetrics.GaugeMetrics.Add(RPCArenaBlocksGauge);
+	}
+
+	int32 OpListTicks;
+	int32 OpListsReceived;
+	int32 OpsReceived;
+	uint64 OpBytesReceived;
+	NetDriver->GetOpListBatch().ConsumeStats(OpListTicks, OpListsReceived, OpsReceived, OpBytesReceived);
+
+	if (OpListTicks > 0)
+	{
+		SpatialGDK::GaugeMetric OpListsPerTickGauge;
+		OpListsPerTickGauge.Key = TCHAR_TO_UTF8(*SpatialConstants::SPATIALOS_METRICS_OP_LISTS_PER_TICK);
+		OpListsPerTickGauge.Value = double(OpListsReceived) / OpListTicks;
+		DynamicFPSMetrics.GaugeMetrics.Add(OpListsPerTickGauge);
+
+		SpatialGDK::GaugeMetric OpsPerTickGauge;
+		OpsPerTickGauge.Key = TCHAR_TO_UTF8(*SpatialConstants::SPATIALOS_METRICS_OPS_PER_TICK);
+		OpsPerTickGauge.Value = double(OpsReceived) / OpListTicks;
+		DynamicFPSMetrics.GaugeMetrics.Add(OpsPerTickGauge);
+	}
+
+	SpatialGDK::GaugeMetric OpBytesGauge;
+	OpBytesGauge.Key = TCHAR_TO_UTF8(*SpatialConstants::SPATIALOS_METRICS_OP_BYTES_PER_SECOND);
+	OpBytesGauge.Value = TimeSinceLastReport > 0.f ? OpBytesReceived / TimeSinceLastReport : 0.0;
+	DynamicFPSMetrics.GaugeMetrics.Add(OpBytesGauge);
+
 	TimeOfLastReport = NetDriver->Time;
 	FramesSinceLastReport = 0;
 
 	NetDriver->Connection->SendMetrics(DynamicFPSMetrics);
 }
 
+void USpatialMetrics::ReportLatency(SpatialGDK::FLatencyHistogram& Histogram, const FString& Key, SpatialGDK::SpatialMetrics& OutMetrics)
+{
+	SpatialGDK::FLatencyHistogramSnapshot Snapshot;
+	Histogram.Drain(Snapshot);
+
+	if (Snapshot.TotalCount == 0)
+	{
+		return;
+	}
+
+	OutMetrics.HistogramMetrics.Add(Snapshot.ToHistogramMetric(Key));
+
+	// The Runtime does not derive percentiles from histogram metrics, so also report the interesting ones as gauges.
+	const TPair<const TCHAR*, double> Percentiles[] = { { TEXT("p50"), 0.5 }, { TEXT("p99"), 0.99 }, { TEXT("p999"), 0.999 } };
+	for (const TPair<const TCHAR*, double>& Percentile : Percentiles)
+	{
+		SpatialGDK::GaugeMetric Gauge;
+		Gauge.Key = TCHAR_TO_UTF8(*FString::Printf(TEXT("%s.%s"), *Key, Percentile.Key));
+		Gauge.Value = Snapshot.GetPercentile(Percentile.Value);
+		OutMetrics.GaugeMetrics.Add(Gauge);
+	}
+
+	if (GetDefault<USpatialGDKSettings>()->bWriteLatencyHistogramsToFile)
+	{
+		WriteLatencyToFile(Key, Snapshot);
+	}
+}
+
+void USpatialMetrics::WriteLatencyToFile(const FString& Key, const SpatialGDK::FLatencyHistogramSnapshot& Snapshot)
+{
+	if (!LatencyFile.IsValid())
+	{
+		const FString Filename = FPaths::Combine(FPaths::ProjectLogDir(), FString::Printf(TEXT("SpatialLatency-%s.csv"), *NetDriver->Connection->GetWorkerId()));
+		const bool bWriteHeader = !IFileManager::Get().FileExists(*Filename);
+
+		LatencyFile.Reset(IFileManager::Get().CreateFileWriter(*Filename, FILEWRITE_Append | FILEWRITE_AllowRead));
+		if (!LatencyFile.IsValid())
+		{
+			UE_LOG(LogSpatialMetrics, Warning, TEXT("Could not open %s for writing latency histograms."), *Filename);
+			return;
+		}
+
+		if (bWriteHeader)
+		{
+			const ANSICHAR Header[] = "Timestamp,Metric,Count,Mean,P50,P99,P999,Max\n";
+			LatencyFile->Serialize((void*)Header, sizeof(Header) - 1);
+		}
+	}
+
+	// All latencies are written in seconds.
+	const FString Line = FString::Printf(TEXT("%s,%s,%llu,%f,%f,%f,%f,%f\n"), *FDateTime::UtcNow().ToIso8601(), *Key, Snapshot.TotalCount,
+		Snapshot.GetMeanSeconds(), Snapshot.GetPercentile(0.5), Snapshot.GetPercentile(0.99), Snapshot.GetPercentile(0.999), Snapshot.GetMaxSeconds());
+
+	FTCHARToUTF8 UTF8Line(*Line);
+	LatencyFile->Serialize((void*)UTF8Line.Get(), UTF8Line.Length());
+	LatencyFile->Flush();
+}
+
 // Load defined as performance relative to target frame time or just frame time based on config value.
 double USpatialMetrics::CalculateLoad() const
 {
@@ -293,6 +460,29 @@ void USpatialMetrics::TrackSentRPC(UFunction* Function, ESchemaComponentType RPC
 	Stat.TotalPayload += PayloadSize;
 }
 
+void USpatialMetrics::TrackOpListProcessingTime(double Seconds)
+{
+	OpListProcessingLatency.Record(Seconds);
+}
+
+void USpatialMetrics::TrackCreateEntityResponse(Worker_RequestId RequestId)
+{
+	double Seconds;
+	if (NetDriver->Connection->ConsumeRequestLatency(RequestId, Seconds))
+	{
+		CreateEntityLatency.Record(Seconds);
+	}
+}
+
+void USpatialMetrics::TrackCommandResponse(Worker_RequestId RequestId)
+{
+	double Seconds;
+	if (NetDriver->Connection->ConsumeRequestLatency(RequestId, Seconds))
+	{
+		CommandResponseLatency.Record(Seconds);
+	}
+}
+
 void USpatialMetrics::HandleWorkerMetrics(Worker_Op* Op)
 {
 	if (WorkerMetricsRecieved.IsBound())
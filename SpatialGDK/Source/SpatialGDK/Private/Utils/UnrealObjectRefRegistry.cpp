@@ -0,0 +1,131 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/UnrealObjectRefRegistry.h"
+
+#include "SpatialConstants.h"
+
+namespace SpatialGDK
+{
+
+void FUnrealObjectRefRegistry::Register(const FNetworkGUID& NetGUID, const FUnrealObjectRef& ObjectRef)
+{
+	NetGUIDToUnrealObjectRef.Emplace(NetGUID, ObjectRef);
+	UnrealObjectRefToNetGUID.Emplace(ObjectRef, NetGUID);
+
+	if (ObjectRef.Entity != SpatialConstants::INVALID_ENTITY_ID)
+	{
+		AddEntityRef(ObjectRef.Entity, NetGUID, ObjectRef);
+	}
+}
+
+void FUnrealObjectRefRegistry::AddAlias(const FUnrealObjectRef& ObjectRef, const FNetworkGUID& NetGUID, Worker_EntityId OwningEntityId)
+{
+	UnrealObjectRefToNetGUID.Emplace(ObjectRef, NetGUID);
+	AddEntityRef(OwningEntityId, NetGUID, ObjectRef);
+}
+
+void FUnrealObjectRefRegistry::Unregister(const FUnrealObjectRef& ObjectRef)
+{
+	FNetworkGUID NetGUID;
+	if (!UnrealObjectRefToNetGUID.RemoveAndCopyValue(ObjectRef, NetGUID))
+	{
+		return;
+	}
+
+	FUnrealObjectRef MappedRef;
+	NetGUIDToUnrealObjectRef.RemoveAndCopyValue(NetGUID, MappedRef);
+
+	// An alias, such as a stable name, is recorded against the entity of the ref its NetGUID maps to. Once the NetGUID
+	// no longer maps to a ref, its remaining refs on that entity are unreachable, so they are removed as well.
+	const Worker_EntityId EntityId = ObjectRef.Entity != SpatialConstants::INVALID_ENTITY_ID ? ObjectRef.Entity : MappedRef.Entity;
+	TArray<FEntityRef>* Refs = EntityRefs.Find(EntityId);
+	if (Refs == nullptr)
+	{
+		return;
+	}
+
+	for (int32 i = Refs->Num() - 1; i >= 0; i--)
+	{
+		if ((*Refs)[i].NetGUID == NetGUID)
+		{
+			RemoveMapping((*Refs)[i]);
+			Refs->RemoveAtSwap(i, 1, /* bAllowShrinking */ false);
+		}
+	}
+
+	if (Refs->Num() == 0)
+	{
+		EntityRefs.Remove(EntityId);
+	}
+}
+
+void FUnrealObjectRefRegistry::RemoveNetGUIDOf(const FUnrealObjectRef& ObjectRef)
+{
+	const FNetworkGUID* NetGUIDPtr = UnrealObjectRefToNetGUID.Find(ObjectRef);
+	if (NetGUIDPtr == nullptr)
+	{
+		return;
+	}
+	const FNetworkGUID NetGUID = *NetGUIDPtr;
+
+	TArray<FEntityRef>* Refs = EntityRefs.Find(ObjectRef.Entity);
+	if (Refs == nullptr)
+	{
+		RemoveMapping(FEntityRef{ NetGUID, ObjectRef });
+		return;
+	}
+
+	// Aliases of the NetGUID, such as a subobject's stable name, were recorded against the same entity.
+	for (int32 i = Refs->Num() - 1; i >= 0; i--)
+	{
+		if ((*Refs)[i].NetGUID == NetGUID)
+		{
+			RemoveMapping((*Refs)[i]);
+			Refs->RemoveAtSwap(i, 1, /* bAllowShrinking */ false);
+		}
+	}
+
+	if (Refs->Num() == 0)
+	{
+		EntityRefs.Remove(ObjectRef.Entity);
+	}
+}
+
+void FUnrealObjectRefRegistry::RemoveEntity(Worker_EntityId EntityId)
+{
+	TArray<FEntityRef>* Refs = EntityRefs.Find(EntityId);
+	if (Refs == nullptr)
+	{
+		return;
+	}
+
+	for (const FEntityRef& EntityRef : *Refs)
+	{
+		RemoveMapping(EntityRef);
+	}
+
+	EntityRefs.Remove(EntityId);
+}
+
+void FUnrealObjectRefRegistry::AddEntityRef(Worker_EntityId EntityId, const FNetworkGUID& NetGUID, const FUnrealObjectRef& ObjectRef)
+{
+	EntityRefs.FindOrAdd(EntityId).AddUnique(FEntityRef{ NetGUID, ObjectRef });
+}
+
+void FUnrealObjectRefRegistry::RemoveMapping(const FEntityRef& EntityRef)
+{
+	// Only remove mappings that still belong to this ref, as either side may have been registered again since.
+	const FNetworkGUID* NetGUID = UnrealObjectRefToNetGUID.Find(EntityRef.ObjectRef);
+	if (NetGUID != nullptr && *NetGUID == EntityRef.NetGUID)
+	{
+		UnrealObjectRefToNetGUID.Remove(EntityRef.ObjectRef);
+	}
+
+	const FUnrealObjectRef* ObjectRef = NetGUIDToUnrealObjectRef.Find(EntityRef.NetGUID);
+	if (ObjectRef != nullptr && *ObjectRef == EntityRef.ObjectRef)
+	{
+		NetGUIDToUnrealObjectRef.Remove(EntityRef.NetGUID);
+	}
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,216 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/WorkerAttributeTable.h"
+
+#include "Misc/Crc.h"
+
+namespace SpatialGDK
+{
+
+namespace
+{
+	template <typename ArrayType>
+	uint32 HashKey(const ArrayType& Key)
+	{
+		return FCrc::MemCrc32(Key.GetData(), Key.Num() * sizeof(FWorkerAttributeHandle));
+	}
+} // anonymous namespace
+
+const FRequirementSetHandle FWorkerAttributeTable::EmptyRequirementSet;
+
+FWorkerAttributeTable& FWorkerAttributeTable::Get()
+{
+	static FWorkerAttributeTable Table;
+	return Table;
+}
+
+FWorkerAttributeTable::FWorkerAttributeTable()
+{
+	FRequirementSetKey EmptyKey = { 0 };
+	verify(FindOrAddRequirementSet(EmptyKey) == EmptyRequirementSet);
+}
+
+FWorkerAttributeHandle FWorkerAttributeTable::InternAttribute(const FString& Attribute)
+{
+	FTCHARToUTF8 Conversion(*Attribute);
+	return InternAttribute(Conversion.Get(), Conversion.Length());
+}
+
+FWorkerAttributeHandle FWorkerAttributeTable::InternAttribute(const ANSICHAR* UTF8Chars, int32 Length)
+{
+	const uint32 Hash = FCrc::MemCrc32(UTF8Chars, Length);
+	for (auto It = AttributeLookup.CreateConstKeyIterator(Hash); It; ++It)
+	{
+		const TArray<ANSICHAR>& Existing = Attributes[It.Value()].UTF8;
+		if (Existing.Num() == Length && FMemory::Memcmp(Existing.GetData(), UTF8Chars, Length) == 0)
+		{
+			return It.Value();
+		}
+	}
+
+	const FWorkerAttributeHandle Handle = Attributes.Num();
+	FAttribute& Attribute = Attributes[Attributes.AddDefaulted()];
+	Attribute.UTF8.Append(UTF8Chars, Length);
+	FUTF8ToTCHAR Conversion(UTF8Chars, Length);
+	Attribute.String = FString(Conversion.Length(), Conversion.Get());
+	AttributeLookup.Add(Hash, Handle);
+
+	return Handle;
+}
+
+FRequirementSetHandle FWorkerAttributeTable::InternRequirementSet(FWorkerAttributeHandle Attribute)
+{
+	FRequirementSetKey Key = { 1, 1, Attribute };
+	return FindOrAddRequirementSet(Key);
+}
+
+FRequirementSetHandle FWorkerAttributeTable::InternRequirementSet(const TArray<TArray<FWorkerAttributeHandle>>& AttributeSets)
+{
+	FRequirementSetKey Key;
+	Key.Add(AttributeSets.Num());
+	for (const TArray<FWorkerAttributeHandle>& AttributeSet : AttributeSets)
+	{
+		Key.Add(AttributeSet.Num());
+		Key.Append(AttributeSet);
+	}
+	return FindOrAddRequirementSet(Key);
+}
+
+FRequirementSetHandle FWorkerAttributeTable::InternRequirementSet(const WorkerRequirementSet& RequirementSet)
+{
+	FRequirementSetKey Key;
+	Key.Add(RequirementSet.Num());
+	for (const WorkerAttributeSet& AttributeSet : RequirementSet)
+	{
+		Key.Add(AttributeSet.Num());
+		for (const FString& Attribute : AttributeSet)
+		{
+			Key.Add(InternAttribute(Attribute));
+		}
+	}
+	return FindOrAddRequirementSet(Key);
+}
+
+FRequirementSetHandle FWorkerAttributeTable::FindOrAddRequirementSet(const FRequirementSetKey& Key)
+{
+	const uint32 Hash = HashKey(Key);
+	for (auto It = RequirementSetLookup.CreateConstKeyIterator(Hash); It; ++It)
+	{
+		const TArray<FWorkerAttributeHandle>& Existing = RequirementSets[It.Value()].Key;
+		if (Existing.Num() == Key.Num() && FMemory::Memcmp(Existing.GetData(), Key.GetData(), Key.Num() * sizeof(FWorkerAttributeHandle)) == 0)
+		{
+			return It.Value();
+		}
+	}
+
+	const FRequirementSetHandle Handle = RequirementSets.Num();
+	FRequirementSet& RequirementSet = RequirementSets[RequirementSets.AddDefaulted()];
+	RequirementSet.Key.Append(Key.GetData(), Key.Num());
+
+	int32 Index = 1;
+	RequirementSet.AttributeSets.SetNum(Key[0]);
+	for (TArray<FWorkerAttributeHandle>& AttributeSet : RequirementSet.AttributeSets)
+	{
+		const int32 NumAttributes = Key[Index++];
+		AttributeSet.Append(Key.GetData() + Index, NumAttributes);
+		Index += NumAttributes;
+	}
+
+	RequirementSetLookup.Add(Hash, Handle);
+
+	return Handle;
+}
+
+WorkerRequirementSet FWorkerAttributeTable::ToWorkerRequirementSet(FRequirementSetHandle RequirementSet) const
+{
+	const TArray<TArray<FWorkerAttributeHandle>>& AttributeSets = GetAttributeSets(RequirementSet);
+
+	WorkerRequirementSet Result;
+	Result.Reserve(AttributeSets.Num());
+	for (const TArray<FWorkerAttributeHandle>& AttributeSet : AttributeSets)
+	{
+		WorkerAttributeSet& ResultSet = Result[Result.AddDefaulted()];
+		ResultSet.Reserve(AttributeSet.Num());
+		for (FWorkerAttributeHandle Attribute : AttributeSet)
+		{
+			ResultSet.Add(GetAttribute(Attribute));
+		}
+	}
+	return Result;
+}
+
+bool FWorkerAttributeTable::ContainsAnyAttribute(FRequirementSetHandle RequirementSet, const TArray<FString>& WorkerAttributes) const
+{
+	for (const TArray<FWorkerAttributeHandle>& AttributeSet : GetAttributeSets(RequirementSet))
+	{
+		for (FWorkerAttributeHandle Attribute : AttributeSet)
+		{
+			if (WorkerAttributes.Contains(GetAttribute(Attribute)))
+			{
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+void FWorkerAttributeTable::AddRequirementSetToSchema(Schema_Object* Object, Schema_FieldId Id, FRequirementSetHandle RequirementSet) const
+{
+	Schema_Object* RequirementSetObject = Schema_AddObject(Object, Id);
+	for (const TArray<FWorkerAttributeHandle>& AttributeSet : GetAttributeSets(RequirementSet))
+	{
+		Schema_Object* AttributeSetObject = Schema_AddObject(RequirementSetObject, 1);
+
+		for (FWorkerAttributeHandle Attribute : AttributeSet)
+		{
+			const TArray<ANSICHAR>& UTF8 = GetAttributeUTF8(Attribute);
+			uint8* Buffer = Schema_AllocateBuffer(AttributeSetObject, UTF8.Num());
+			FMemory::Memcpy(Buffer, UTF8.GetData(), UTF8.Num());
+			Schema_AddBytes(AttributeSetObject, 1, Buffer, UTF8.Num());
+		}
+	}
+}
+
+FRequirementSetHandle FWorkerAttributeTable::GetRequirementSetFromSchema(Schema_Object* Object, Schema_FieldId Id)
+{
+	Schema_Object* RequirementSetObject = Schema_GetObject(Object, Id);
+
+	const uint32 AttributeSetCount = Schema_GetObjectCount(RequirementSetObject, 1);
+
+	FRequirementSetKey Key;
+	Key.Add(AttributeSetCount);
+	for (uint32 i = 0; i < AttributeSetCount; i++)
+	{
+		Schema_Object* AttributeSetObject = Schema_IndexObject(RequirementSetObject, 1, i);
+
+		const uint32 AttributeCount = Schema_GetBytesCount(AttributeSetObject, 1);
+		Key.Add(AttributeCount);
+		for (uint32 j = 0; j < AttributeCount; j++)
+		{
+			const ANSICHAR* Chars = reinterpret_cast<const ANSICHAR*>(Schema_IndexBytes(AttributeSetObject, 1, j));
+			Key.Add(InternAttribute(Chars, (int32)Schema_IndexBytesLength(AttributeSetObject, 1, j)));
+		}
+	}
+
+	return FindOrAddRequirementSet(Key);
+}
+
+SIZE_T FWorkerAttributeTable::GetAllocatedSize() const
+{
+	SIZE_T Size = Attributes.GetAllocatedSize() + RequirementSets.GetAllocatedSize() + AttributeLookup.GetAllocatedSize() + RequirementSetLookup.GetAllocatedSize();
+	for (const FAttribute& Attribute : Attributes)
+	{
+		Size += Attribute.String.GetAllocatedSize() + Attribute.UTF8.GetAllocatedSize();
+	}
+	for (const FRequirementSet& RequirementSet : RequirementSets)
+	{
+		Size += RequirementSet.Key.GetAllocatedSize() + RequirementSet.AttributeSets.GetAllocatedSize();
+		for (const TArray<FWorkerAttributeHandle>& AttributeSet : RequirementSet.AttributeSets)
+		{
+			Size += AttributeSet.GetAllocatedSize();
+		}
+	}
+	return Size;
+}
+
+} // namespace SpatialGDK
@@ -4,6 +4,7 @@
 
 #include "Engine/ActorChannel.h"
 
+#include "EngineClasses/SpatialFastArrayNetSerialize.h"
 #include "EngineClasses/SpatialNetDriver.h"
 #include "Interop/Connection/SpatialWorkerConnection.h"
 #include "Interop/SpatialClassInfoManager.h"
@@ -74,18 +75,9 @@ public:
 
 		if (const SpatialGDK::EntityAcl* EntityACL = NetDriver->StaticComponentView->GetComponentData<SpatialGDK::EntityAcl>(EntityId))
 		{
-			if (const WorkerRequirementSet* WorkerRequirementsSet = EntityACL->ComponentWriteAcl.Find(SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID))
+			if (const SpatialGDK::FRequirementSetHandle* WorkerRequirementsSet = EntityACL->ComponentWriteAcl.Find(SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID))
 			{
-				for (const WorkerAttributeSet& AttributeSet : *WorkerRequirementsSet)
-				{
-					for (const FString& Attribute : AttributeSet)
-					{
-						if (WorkerAttributes.Contains(Attribute))
-						{
-							return true;
-						}
-					}
-				}
+				return SpatialGDK::FWorkerAttributeTable::Get().ContainsAnyAttribute(*WorkerRequirementsSet, WorkerAttributes);
 			}
 		}
 
@@ -158,8 +150,15 @@ public:
 	FORCEINLINE void MarkInterestDirty() { bInterestDirty = true; }
 	FORCEINLINE bool GetInterestDirty() const { return bInterestDirty; }
 
+	// With on-demand handover, compares and sends handover properties the next time the actor replicates, as it is about to lose authority.
+	FORCEINLINE void RequestHandoverCapture() { bHandoverCaptureRequested = true; }
+
 	bool IsListening() const;
 
+	// Null unless fast arrays are replicated as changes; see USpatialGDKSettings::bUseFastArrayDeltaReplication.
+	SpatialGDK::FSpatialFastArrayBaselines* GetFastArrayBaselines();
+	void ResetFastArrayBaselines() { FastArrayBaselines.Empty(); }
+
 protected:
 	// Begin UChannel interface
 	virtual bool CleanUp(const bool bForDestroy, EChannelCloseReason CloseReason) override;
@@ -175,9 +174,12 @@ private:
 
 	void InitializeHandoverShadowData(TArray<uint8>& ShadowData, UObject* Object);
 	FHandoverChangeState GetHandoverChangeList(TArray<uint8>& ShadowData, UObject* Object);
+	bool ShouldCaptureHandover() const;
 	
 	void UpdateEntityACLToNewOwner();
 
+	void SeedFastArrayBaselines();
+
 public:
 	// If this actor channel is responsible for creating a new entity, this will be set to true once the entity creation request is issued.
 	bool bCreatedEntity;
@@ -216,4 +218,11 @@ private:
 	// when those properties change.
 	TArray<uint8>* ActorHandoverShadowData;
 	TMap<TWeakObjectPtr<UObject>, TSharedRef<TArray<uint8>>> HandoverShadowDataMap;
+
+	// See USpatialGDKSettings::bOnDemandHandover.
+	bool bHandoverCaptureRequested;
+	float TimeWhenHandoverLastCaptured;
+
+	// What was last written for each fast array property while authoritative.
+	SpatialGDK::FSpatialFastArrayBaselines FastArrayBaselines;
 };
@@ -6,6 +6,8 @@
 
 #include "Utils/RepLayoutUtils.h"
 
+#include <WorkerSDK/improbable/c_schema.h>
+
 class FSpatialNetBitReader;
 class FSpatialNetBitWriter;
 class USpatialNetDriver;
@@ -35,15 +37,58 @@ private:
 	USpatialNetDriver* NetDriver;
 };
 
+// The last full state of a fast array written by an authoritative worker, which later updates are written relative to.
+//
+// SpatialOS keeps only the latest value of each schema field, so a delta written to the property's field would be lost
+// for workers that check the entity out later. Each fast array therefore has two fields: the snapshot, which is only
+// rewritten occasionally, and the property's own field, which holds every change made since the snapshot, including
+// removals. Workers holding the entity apply the latter, while workers checking it out apply the snapshot and then the
+// changes. Once the changes grow past half the size of the snapshot, a new snapshot is taken.
+//
+// As every change since the snapshot is sent with each update, workers holding the entity receive items that changed
+// in an earlier update again, and get PostReplicatedChange for them each time, until the next snapshot is taken.
+struct FSpatialFastArrayBaseline
+{
+	TSharedPtr<INetDeltaBaseState> SnapshotState;
+	int32 SnapshotBytes = 0;
+
+	// IDs of the items added since the snapshot, which are written as removed once they are gone.
+	TSet<int32> AddedItemIds;
+
+	// Set when the state was taken without writing a snapshot, such as when gaining authority over an entity.
+	bool bNeedsSnapshot = false;
+};
+
+// The baselines of every fast array property of an actor and its subobjects, owned by the actor's channel.
+class SPATIALGDK_API FSpatialFastArrayBaselines
+{
+public:
+	FSpatialFastArrayBaseline& FindOrAdd(UObject* Object, uint16 Handle);
+
+	// Starts baselines for an object's fast arrays from their current state, so that the first update after gaining
+	// authority only has to send a new snapshot along with what has changed since.
+	void Seed(USpatialNetDriver* NetDriver, UObject* Object, const FRepLayout& RepLayout);
+
+	int32 Num() const { return Baselines.Num(); }
+	void Empty() { Baselines.Empty(); }
+
+private:
+	TMap<TPair<TWeakObjectPtr<UObject>, uint16>, FSpatialFastArrayBaseline> Baselines;
+};
+
 struct FSpatialNetDeltaSerializeInfo : FNetDeltaSerializeInfo
 {
-	FSpatialNetDeltaSerializeInfo()
-	{
-		bIsSpatialType = true;
-	}
+	FSpatialNetDeltaSerializeInfo();
 
 	static bool DeltaSerializeRead(USpatialNetDriver* NetDriver, FSpatialNetBitReader& Reader, UObject* Object, int32 ArrayIndex, UProperty* ParentProperty, UScriptStruct* NetDeltaStruct);
-	static bool DeltaSerializeWrite(USpatialNetDriver* NetDriver, FSpatialNetBitWriter& Writer, UObject* Object, int32 ArrayIndex, UProperty* ParentProperty, UScriptStruct* NetDeltaStruct);
+
+	// OldState and NewState are only used when fast arrays are replicated as changes; see USpatialGDKSettings::bUseFastArrayDeltaReplication.
+	static bool DeltaSerializeWrite(USpatialNetDriver* NetDriver, FSpatialNetBitWriter& Writer, UObject* Object, int32 ArrayIndex, UProperty* ParentProperty, UScriptStruct* NetDeltaStruct,
+		INetDeltaBaseState* OldState = nullptr, TSharedPtr<INetDeltaBaseState>* NewState = nullptr);
+
+	// Writes the property's field, and its snapshot field when one is taken, relative to Baseline.
+	static void DeltaSerializeWriteWithBaseline(USpatialNetDriver* NetDriver, Schema_Object* ComponentObject, Schema_FieldId FieldId, UObject* Object, int32 ArrayIndex, UProperty* ParentProperty, UScriptStruct* NetDeltaStruct,
+		FSpatialFastArrayBaseline& Baseline, bool bIsInitialData);
 };
 
 PRAGMA_ENABLE_DEPRECATION_WARNINGS // TODO: UNR-2371 - Remove when we update our usage of FNetDeltaSerializeInfo
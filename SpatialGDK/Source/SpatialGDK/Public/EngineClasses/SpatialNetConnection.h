@@ -44,12 +44,10 @@ public:
 	// End NetConnection Interface
 
 	void InitHeartbeat(class FTimerManager* InTimerManager, Worker_EntityId InPlayerControllerEntity);
-	void SetHeartbeatTimeoutTimer();
 	void SetHeartbeatEventTimer();
 
 	void DisableHeartbeat();
 
-	void OnHeartbeat();
 	void UpdateActorInterest(AActor* Actor);
 
 	void ClientNotifyClientHasQuit();
@@ -11,9 +11,11 @@
 
 #include "EngineClasses/SpatialVirtualWorkerTranslator.h"
 #include "Interop/Connection/ConnectionConfig.h"
+#include "Interop/Connection/OpListBatch.h"
 #include "Interop/SpatialOutputDevice.h"
 #include "SpatialConstants.h"
 #include "SpatialGDKSettings.h"
+#include "Utils/DormantColdStorage.h"
 
 #include <WorkerSDK/improbable/c_worker.h>
 
@@ -113,6 +115,8 @@ public:
 	void RegisterDormantEntityId(Worker_EntityId EntityId);
 	void UnregisterDormantEntityId(Worker_EntityId EntityId);
 	bool IsDormantEntity(Worker_EntityId EntityId) const;
+	SpatialGDK::FDormantColdStorage& GetDormantColdStorage() { return DormantColdStorage; }
+	SpatialGDK::FOpListBatch& GetOpListBatch() { return OpListBatch; }
 
 	DECLARE_DELEGATE(PostWorldWipeDelegate);
 
@@ -195,6 +199,8 @@ private:
 	TArray<Worker_OpList*> QueuedStartupOpLists;
 	TSet<Worker_EntityId_Key> DormantEntities;
 	TSet<TWeakObjectPtr<USpatialActorChannel>> PendingDormantChannels;
+	SpatialGDK::FDormantColdStorage DormantColdStorage;
+	SpatialGDK::FOpListBatch OpListBatch;
 
 	FTimerManager TimerManager;
 
@@ -7,6 +7,7 @@
 
 #include "Schema/UnrealMetadata.h"
 #include "Schema/UnrealObjectRef.h"
+#include "Utils/UnrealObjectRefRegistry.h"
 
 #include <WorkerSDK/improbable/c_worker.h>
 
@@ -105,7 +106,6 @@ private:
 	FNetworkGUID RegisterNetGUIDFromPathForStaticObject(const FString& PathName, const FNetworkGUID& OuterGUID, bool bNoLoadOnClient);
 	FNetworkGUID GenerateNewNetGUID(const int32 IsStatic);
 
-	TMap<FNetworkGUID, FUnrealObjectRef> NetGUIDToUnrealObjectRef;
-	TMap<FUnrealObjectRef, FNetworkGUID> UnrealObjectRefToNetGUID;
+	SpatialGDK::FUnrealObjectRefRegistry ObjectRefRegistry;
 };
 
@@ -0,0 +1,66 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+namespace SpatialGDK
+{
+
+// Bounded buffer for log messages forwarded to SpatialOS.
+//
+// Log lines can be added from any thread and are flushed in one batch by the worker connection's ops thread.
+// Identical lines (same level, category and text) that are still waiting to be flushed are coalesced into a single
+// entry with a repeat count. New lines are dropped, and counted, once a category has exceeded its per-second budget
+// or the buffer is full, so a burst of warnings costs a bounded amount of memory and bandwidth.
+class SPATIALGDK_API FLogBuffer
+{
+public:
+	struct FEntry
+	{
+		uint8 Level;
+		FName LoggerName;
+		FName Category;
+		FString Message;
+		uint32 RepeatCount;
+	};
+
+	FLogBuffer(int32 InMaxBufferedMessages = 1024, int32 InMaxMessagesPerCategoryPerSecond = 100);
+
+	// Returns false if the message was dropped.
+	bool Add(uint8 Level, const FName& LoggerName, const FName& Category, const TCHAR* Message);
+
+	// Hands every buffered message to the callback in the order they were first added, and resets the buffer.
+	// Messages that were coalesced get their repeat count appended, and a summary line is emitted if any were dropped.
+	void Flush(TFunctionRef<void(uint8 Level, const FName& LoggerName, const TCHAR* Message)> Callback);
+
+	int32 GetNumBufferedMessages() const;
+	uint64 GetNumDroppedMessages() const { return TotalDroppedMessages; }
+
+	void SetLimits(int32 InMaxBufferedMessages, int32 InMaxMessagesPerCategoryPerSecond);
+
+private:
+	struct FCategoryRate
+	{
+		double WindowStartTime = 0.0;
+		int32 NumMessagesInWindow = 0;
+	};
+
+	static uint32 GetEntryHash(uint8 Level, const FName& Category, const TCHAR* Message);
+
+	mutable FCriticalSection Mutex;
+
+	TArray<FEntry> Entries;
+	// Maps an entry hash to its index in Entries, for coalescing.
+	TMap<uint32, int32> EntryIndices;
+	TMap<FName, FCategoryRate> CategoryRates;
+
+	int32 MaxBufferedMessages;
+	int32 MaxMessagesPerCategoryPerSecond;
+
+	uint32 DroppedSinceLastFlush = 0;
+	FName DroppedLoggerName;
+	uint64 TotalDroppedMessages = 0;
+};
+
+} // namespace SpatialGDK
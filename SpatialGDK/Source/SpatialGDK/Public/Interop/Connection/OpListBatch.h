@@ -0,0 +1,75 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+// What was received in one tick's op lists.
+struct FOpListBatchStats
+{
+	int32 NumOpLists = 0;
+	int32 NumOps = 0;
+
+	// Serialized schema bytes of component data, updates and command payloads. Only counted if the batch counts bytes.
+	uint64 NumBytes = 0;
+
+	// Indexed by Worker_OpType.
+	TArray<int32> OpsByType;
+
+	int32 GetNumOpsOfType(Worker_OpType OpType) const { return OpsByType.IsValidIndex(OpType) ? OpsByType[OpType] : 0; }
+};
+
+// The op lists taken from USpatialWorkerConnection in one tick. The batch is kept by the net driver and reused every tick,
+// so taking op lists doesn't allocate once it has grown to the size of a busy tick.
+//
+// The batch can also coalesce consecutive op lists into fewer, larger op lists for USpatialDispatcher::ProcessOps, so that
+// the work done at the end of every op list is done once for a burst of small op lists. Ops are concatenated in the order
+// they were received. USpatialDispatcher applies remove component ops at the end of an op list, so a coalesced op list
+// ends after each op list that removes a component, and those removals are never moved after ops that were received later.
+//
+// The batch doesn't own its op lists. Coalesced op lists point into them, so they are only valid until the op lists are destroyed.
+class SPATIALGDK_API FOpListBatch
+{
+public:
+	void SetCountBytes(bool bInCountBytes) { bCountBytes = bInCountBytes; }
+
+	void Add(Worker_OpList* OpList);
+
+	bool IsEmpty() const { return OpLists.Num() == 0; }
+	const TArray<Worker_OpList*>& GetOpLists() const { return OpLists; }
+
+	// Concatenates consecutive op lists, and returns the op lists to process in their place.
+	const TArray<Worker_OpList>& Coalesce();
+
+	// Forgets the op lists, without destroying them, and starts the next tick's stats.
+	void Reset();
+
+	const FOpListBatchStats& GetStats() const { return Stats; }
+
+	// Totals since the stats were last consumed, for reporting as metrics.
+	void ConsumeStats(int32& OutNumTicks, int32& OutNumOpLists, int32& OutNumOps, uint64& OutNumBytes);
+
+private:
+	TArray<Worker_OpList*> OpLists;
+
+	// For each op list, whether it contains a remove component op.
+	TArray<bool> RemovesComponents;
+
+	TArray<Worker_Op> CoalescedOps;
+	TArray<Worker_OpList> CoalescedOpLists;
+
+	FOpListBatchStats Stats;
+	bool bCountBytes = false;
+
+	int32 TicksSinceConsumed = 0;
+	int32 OpListsSinceConsumed = 0;
+	int32 OpsSinceConsumed = 0;
+	uint64 BytesSinceConsumed = 0;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,122 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Interop/Connection/OutgoingMessages.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+#include <WorkerSDK/improbable/c_worker.h>
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSpatialOpListRecording, Log, All);
+
+class FArchive;
+
+namespace SpatialGDK
+{
+
+// An op list read back from a recording. It owns its ops, strings and schema objects, so it can be passed to
+// USpatialDispatcher::ProcessOps in place of an op list from the Worker SDK.
+class SPATIALGDK_API FRecordedOpList
+{
+public:
+	FRecordedOpList() = default;
+	~FRecordedOpList();
+
+	FRecordedOpList(const FRecordedOpList&) = delete;
+	FRecordedOpList& operator=(const FRecordedOpList&) = delete;
+
+	Worker_OpList* Get() { return &OpList; }
+	const Worker_OpList* Get() const { return &OpList; }
+
+	// Seconds between the recording starting and the op list being received.
+	double Time = 0.0;
+
+private:
+	friend class FOpListRecording;
+
+	Worker_OpList OpList = {};
+	TArray<Worker_Op> Ops;
+
+	// Storage that the ops point into.
+	TArray<TArray<ANSICHAR>> Strings;
+	TArray<TArray<const char*>> StringLists;
+	TArray<TArray<Worker_Entity>> EntityLists;
+	TArray<TArray<Worker_ComponentData>> ComponentDataLists;
+	TArray<TArray<Worker_GaugeMetric>> GaugeMetricLists;
+	TArray<TUniquePtr<double>> Loads;
+
+	TArray<Schema_ComponentData*> SchemaComponentData;
+	TArray<Schema_ComponentUpdate*> SchemaComponentUpdates;
+	TArray<Schema_CommandRequest*> SchemaCommandRequests;
+	TArray<Schema_CommandResponse*> SchemaCommandResponses;
+};
+
+// An outgoing message read back from a recording. Messages are recorded by type, target and schema payload,
+// which is enough to compare what two runs sent, but not to send them again.
+struct SPATIALGDK_API FRecordedOutgoingMessage
+{
+	EOutgoingMessageType Type = EOutgoingMessageType::ComponentUpdate;
+
+	// Seconds between the recording starting and the message being handed to the Worker SDK.
+	double Time = 0.0;
+
+	Worker_EntityId EntityId = 0;
+	Worker_ComponentId ComponentId = 0;
+
+	// Serialized schema data of added components, component updates, commands and new entities, and the overrides
+	// of component interest messages. Empty for other messages.
+	TArray<uint8> Payload;
+};
+
+// Writes the op lists a worker receives and the messages it sends to a file, in the order they happen on the ops thread.
+//
+// Metrics ops only keep their load and gauge metrics, and entity query requests only keep their type.
+class SPATIALGDK_API FOpListRecorder
+{
+public:
+	FOpListRecorder();
+	~FOpListRecorder();
+
+	bool Open(const FString& Filename, const FString& WorkerId, const TArray<FString>& WorkerAttributes);
+	void Close();
+	bool IsOpen() const { return Archive.IsValid(); }
+
+	void RecordOpList(const Worker_OpList& OpList);
+
+	// Must be called before the message is handed to the Worker SDK, which takes ownership of its schema data.
+	void RecordOutgoingMessage(const FOutgoingMessage& Message);
+
+	int64 GetBytesWritten() const;
+
+private:
+	void WriteOp(const Worker_Op& Op);
+
+	TUniquePtr<FArchive> Archive;
+	double StartTime;
+};
+
+// A recording read back from a file written by FOpListRecorder.
+class SPATIALGDK_API FOpListRecording
+{
+public:
+	bool Load(const FString& Filename);
+
+	const FString& GetWorkerId() const { return WorkerId; }
+	const TArray<FString>& GetWorkerAttributes() const { return WorkerAttributes; }
+
+	TArray<TUniquePtr<FRecordedOpList>> OpLists;
+	TArray<FRecordedOutgoingMessage> OutgoingMessages;
+
+private:
+	static bool ReadOp(FArchive& Ar, FRecordedOpList& OpList, Worker_Op& OutOp);
+
+	FString WorkerId;
+	TArray<FString> WorkerAttributes;
+};
+
+// Frees the schema data of a message that will not be handed to the Worker SDK.
+SPATIALGDK_API void DiscardOutgoingMessage(FOutgoingMessage& Message);
+
+} // namespace SpatialGDK
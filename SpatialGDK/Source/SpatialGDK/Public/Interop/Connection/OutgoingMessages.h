@@ -27,7 +27,6 @@ enum class EOutgoingMessageType : int32
 	CommandRequest,
 	CommandResponse,
 	CommandFailure,
-	LogMessage,
 	ComponentInterest,
 	EntityQueryRequest,
 	Metrics
@@ -35,10 +34,13 @@ enum class EOutgoingMessageType : int32
 
 struct FOutgoingMessage
 {
-	FOutgoingMessage(const EOutgoingMessageType& InType) : Type(InType) {}
+	FOutgoingMessage(const EOutgoingMessageType& InType) : Type(InType), EnqueueTime(0.0) {}
 	virtual ~FOutgoingMessage() {}
 
 	EOutgoingMessageType Type;
+
+	// FPlatformTime::Seconds() when the message was queued on the game thread.
+	double EnqueueTime;
 };
 
 struct FReserveEntityIdsRequest : FOutgoingMessage
@@ -147,20 +149,6 @@ struct FCommandFailure : FOutgoingMessage
 	FString Message;
 };
 
-struct FLogMessage : FOutgoingMessage
-{
-	FLogMessage(uint8_t InLevel, const FName& InLoggerName, const FString& InMessage)
-		: FOutgoingMessage(EOutgoingMessageType::LogMessage)
-		, Level(InLevel)
-		, LoggerName(InLoggerName)
-		, Message(InMessage)
-	{}
-
-	uint8_t Level;
-	FName LoggerName;
-	FString Message;
-};
-
 struct FComponentInterest : FOutgoingMessage
 {
 	FComponentInterest(Worker_EntityId InEntityId, TArray<Worker_InterestOverride>&& InInterests)
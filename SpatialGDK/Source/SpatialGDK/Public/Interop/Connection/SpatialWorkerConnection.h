@@ -6,9 +6,14 @@
 #include "HAL/ThreadSafeBool.h"
 
 #include "Interop/Connection/ConnectionConfig.h"
+#include "Interop/Connection/LogBuffer.h"
+#include "Interop/Connection/OpListBatch.h"
+#include "Interop/Connection/OpListRecording.h"
 #include "Interop/Connection/OutgoingMessages.h"
+#include "SpatialCommonTypes.h"
 #include "SpatialGDKSettings.h"
 #include "UObject/WeakObjectPtr.h"
+#include "Utils/LatencyHistogram.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
 #include <WorkerSDK/improbable/c_worker.h>
@@ -50,7 +55,9 @@ public:
 	FORCEINLINE bool IsConnected() { return bIsConnected; }
 
 	// Worker Connection Interface
-	TArray<Worker_OpList*> GetOpList();
+	// Adds the op lists received since the last call to OutBatch.
+	void GetOpLists(SpatialGDK::FOpListBatch& OutBatch);
+	void DestroyOpList(Worker_OpList* OpList);
 	Worker_RequestId SendReserveEntityIdsRequest(uint32_t NumOfEntities);
 	Worker_RequestId SendCreateEntityRequest(TArray<Worker_ComponentData>&& Components, const Worker_EntityId* EntityId);
 	Worker_RequestId SendDeleteEntityRequest(Worker_EntityId EntityId);
@@ -60,7 +67,7 @@ public:
 	Worker_RequestId SendCommandRequest(Worker_EntityId EntityId, const Worker_CommandRequest* Request, uint32_t CommandId);
 	void SendCommandResponse(Worker_RequestId RequestId, const Worker_CommandResponse* Response);
 	void SendCommandFailure(Worker_RequestId RequestId, const FString& Message);
-	void SendLogMessage(uint8_t Level, const FName& LoggerName, const TCHAR* Message);
+	void SendLogMessage(uint8_t Level, const FName& LoggerName, const TCHAR* Message, const FName& Category = NAME_None);
 	void SendComponentInterest(Worker_EntityId EntityId, TArray<Worker_InterestOverride>&& ComponentInterest);
 	Worker_RequestId SendEntityQueryRequest(const Worker_EntityQuery* EntityQuery);
 	void SendMetrics(const SpatialGDK::SpatialMetrics& Metrics);
@@ -68,6 +75,18 @@ public:
 	FString GetWorkerId() const;
 	const TArray<FString>& GetWorkerAttributes() const;
 
+	// Total number of log messages dropped by the log rate limit since the connection was created.
+	uint64 GetNumDroppedLogMessages() const { return LogBuffer.GetNumDroppedMessages(); }
+
+	// Time between a message being queued on the game thread and being handed to the Worker SDK on the ops thread.
+	SpatialGDK::FLatencyHistogram& GetOutgoingMessageLatency() { return OutgoingMessageLatency; }
+
+	// Returns the time since the create entity or command request with this ID was sent, and stops tracking it.
+	bool ConsumeRequestLatency(Worker_RequestId RequestId, double& OutSeconds);
+
+	// Whether op lists are read from a recording passed with -SpatialReplayOps rather than from SpatialOS.
+	bool IsReplaying() const { return Replay.IsValid(); }
+
 	FReceptionistConfig ReceptionistConfig;
 	FLocatorConfig LocatorConfig;
 
@@ -83,6 +102,7 @@ private:
 	void ConnectToReceptionist(bool bConnectAsClient, uint32 PlayInEditorID);
 	void ConnectToLocator();
 	void FinishConnecting(Worker_ConnectionFuture* ConnectionFuture);
+	void ConnectToReplay(const FString& Filename);
 
 	void OnConnectionSuccess();
 	void OnPreConnectionFailure(const FString& Reason);
@@ -100,7 +120,9 @@ private:
 
 	void InitializeOpsProcessingThread();
 	void QueueLatestOpList();
+	void QueueReplayedOpLists();
 	void ProcessOutgoingMessages();
+	void FlushLogMessages();
 
 	void StartDevelopmentAuth(FString DevAuthToken);
 	static void OnPlayerIdentityToken(void* UserData, const Worker_Alpha_PlayerIdentityTokenResponse* PIToken);
@@ -129,5 +151,21 @@ private:
 
 	// RequestIds per worker connection start at 0 and incrementally go up each command sent.
 	Worker_RequestId NextRequestId = 0;
+
+	// Send times of in-flight create entity and command requests. Only accessed on the game thread.
+	TMap<Worker_RequestId_Key, double> RequestSendTimes;
+
+	SpatialGDK::FLatencyHistogram OutgoingMessageLatency;
+
+	// Log messages are batched here rather than in OutgoingMessagesQueue, so bursts of logging cannot crowd out replication.
+	SpatialGDK::FLogBuffer LogBuffer;
+
+	// Records received op lists and sent messages when -SpatialCaptureOps is passed. Only accessed on the ops thread once it has started.
+	SpatialGDK::FOpListRecorder OpListRecorder;
+
+	TUniquePtr<SpatialGDK::FOpListRecording> Replay;
+	int32 NextReplayedOpList = 0;
+	double ReplayStartTime = 0.0;
+
 	LoginTokenResponseCallback LoginTokenResCallback;
 };
@@ -0,0 +1,180 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+
+#include "Schema/DynamicComponent.h"
+#include "SpatialCommonTypes.h"
+#include "SpatialConstants.h"
+#include "Utils/LatencyHistogram.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+struct PendingAddComponentWrapper
+{
+	PendingAddComponentWrapper() = default;
+	PendingAddComponentWrapper(Worker_EntityId InEntityId, Worker_ComponentId InComponentId, const Worker_ComponentData& InData)
+		: EntityId(InEntityId), ComponentId(InComponentId), Data(InData) {}
+
+	Worker_EntityId EntityId;
+	Worker_ComponentId ComponentId;
+
+	// Held inline rather than behind a pointer; the wrapper is moved, never copied, when buffers grow.
+	SpatialGDK::DynamicComponent Data;
+};
+
+// AddComponent ops received during a critical section, keyed by entity. Each entity's components are kept in the order they arrived.
+using FPendingAddComponentMap = TMap<Worker_EntityId_Key, TArray<PendingAddComponentWrapper>>;
+
+namespace SpatialGDK
+{
+
+// A component update received for an entity whose actor has not been created yet.
+struct FPendingComponentUpdate
+{
+	explicit FPendingComponentUpdate(const Worker_ComponentUpdate& InUpdate)
+		: Update(Worker_AcquireComponentUpdate(&InUpdate))
+	{
+	}
+
+	FPendingComponentUpdate(FPendingComponentUpdate&& Other)
+		: Update(Other.Update)
+	{
+		Other.Update = nullptr;
+	}
+
+	FPendingComponentUpdate(const FPendingComponentUpdate&) = delete;
+	FPendingComponentUpdate& operator=(const FPendingComponentUpdate&) = delete;
+	FPendingComponentUpdate& operator=(FPendingComponentUpdate&&) = delete;
+
+	~FPendingComponentUpdate()
+	{
+		if (Update != nullptr)
+		{
+			Worker_ReleaseComponentUpdate(Update);
+		}
+	}
+
+	Worker_ComponentUpdate* Update;
+};
+
+// Entities that have entered view but whose actors have not been created yet.
+//
+// Creating an actor for each entity in a large critical section in a single frame causes long hitches on clients,
+// so the receiver queues them here and creates them over several frames under a time budget. Entities of classes with
+// a higher priority come out first, then those closest to the viewer. Component data, removals and updates that arrive
+// for a queued entity are kept with it so that they can be applied, in order, once its actor exists.
+//
+// Entities whose class is still loading are parked here too. They are kept like any other queued entity, but do not
+// come out of Pop(FEntry&) until OnClassLoaded is called for their class.
+class SPATIALGDK_API FEntityMaterializationQueue
+{
+public:
+	struct FEntry
+	{
+		Worker_EntityId EntityId = SpatialConstants::INVALID_ENTITY_ID;
+		double EnqueueTime = 0.0;
+		TArray<PendingAddComponentWrapper> Components;
+		TArray<FPendingComponentUpdate> Updates;
+	};
+
+	// Entities of classes with a higher priority are materialized first. Classes not set have priority 0.
+	void SetClassPriority(const FSoftObjectPath& ClassPath, int32 Priority);
+	int32 GetClassPriority(const FString& ClassPath) const;
+
+	void Enqueue(Worker_EntityId EntityId, int32 ClassPriority, float DistanceSquared, TArray<PendingAddComponentWrapper>&& Components);
+
+	// Queues an entity that can't be materialized until its class has loaded. Returns true if no other entity is waiting
+	// for the class, in which case the caller should start loading it.
+	bool Park(Worker_EntityId EntityId, const FSoftObjectPath& ClassPath, int32 ClassPriority, float DistanceSquared, TArray<PendingAddComponentWrapper>&& Components);
+
+	// Lets the entities parked for the class come out of the queue, whether or not it loaded successfully.
+	void OnClassLoaded(const FSoftObjectPath& ClassPath);
+
+	bool Contains(Worker_EntityId EntityId) const { return Entries.Contains(EntityId); }
+	int32 Num() const { return Entries.Num(); }
+	int32 NumParked() const { return NumParkedEntities; }
+	int32 NumLoadingClasses() const { return LoadingClasses.Num(); }
+
+	// Each of these returns false, and does nothing, if the entity is not queued.
+	bool AddComponent(Worker_EntityId EntityId, const Worker_ComponentData& Data);
+	bool RemoveComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId);
+	bool AddUpdate(Worker_EntityId EntityId, const Worker_ComponentUpdate& Update);
+	bool Remove(Worker_EntityId EntityId);
+
+	// Removes the highest priority entity. Returns false if the queue is empty.
+	bool Pop(FEntry& OutEntry);
+
+	// Removes a specific entity, for when its actor is needed straight away. Parked entities are removed too, leaving the
+	// caller to load their class synchronously.
+	bool Pop(Worker_EntityId EntityId, FEntry& OutEntry);
+
+	// Time spent creating queued actors in each frame that created any.
+	FLatencyHistogram& GetFrameTime() { return FrameTime; }
+
+	// Time between an entity being queued and its actor being created.
+	FLatencyHistogram& GetWaitTime() { return WaitTime; }
+
+	// Time between the first entity of a class being parked and the class loading.
+	FLatencyHistogram& GetClassLoadTime() { return ClassLoadTime; }
+
+private:
+	struct FHeapNode
+	{
+		int32 ClassPriority;
+		float DistanceSquared;
+		uint32 Sequence;
+		Worker_EntityId EntityId;
+
+		bool operator<(const FHeapNode& Other) const
+		{
+			if (ClassPriority != Other.ClassPriority)
+			{
+				return ClassPriority > Other.ClassPriority;
+			}
+			if (DistanceSquared != Other.DistanceSquared)
+			{
+				return DistanceSquared < Other.DistanceSquared;
+			}
+			return Sequence < Other.Sequence;
+		}
+	};
+
+	struct FQueuedEntity
+	{
+		uint32 Sequence;
+		int32 ClassPriority;
+		float DistanceSquared;
+		bool bParked;
+		FEntry Entry;
+	};
+
+	struct FLoadingClass
+	{
+		double StartTime;
+
+		// Paired with the sequence number each entity was parked with, so that entities that left the queue are skipped.
+		TArray<TPair<Worker_EntityId, uint32>> Entities;
+	};
+
+	FQueuedEntity& Add(Worker_EntityId EntityId, int32 ClassPriority, float DistanceSquared, TArray<PendingAddComponentWrapper>&& Components);
+	void TakeEntry(Worker_EntityId EntityId, FQueuedEntity& Queued, FEntry& OutEntry);
+
+	// Heap nodes are not removed when an entity leaves the queue early; they are skipped when popped if their sequence number is stale.
+	TArray<FHeapNode> Heap;
+	TMap<Worker_EntityId_Key, FQueuedEntity> Entries;
+	uint32 NextSequence = 0;
+
+	TMap<FSoftObjectPath, FLoadingClass> LoadingClasses;
+	int32 NumParkedEntities = 0;
+
+	TMap<FSoftObjectPath, int32> ClassPriorities;
+
+	FLatencyHistogram FrameTime;
+	FLatencyHistogram WaitTime;
+	FLatencyHistogram ClassLoadTime;
+};
+
+} // namespace SpatialGDK
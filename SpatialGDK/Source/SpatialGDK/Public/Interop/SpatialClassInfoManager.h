@@ -3,6 +3,10 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Engine/StreamableManager.h"
+#include "Utils/CompactSchemaDatabase.h"
+#include "Utils/ComponentInfoTable.h"
+#include "Utils/PropertySerializationPlan.h"
 #include "Utils/SchemaDatabase.h"
 
 #include <WorkerSDK/improbable/c_worker.h>
@@ -41,6 +45,8 @@ struct FHandoverPropertyInfo
 	int32 Offset;
 	int32 ArrayIdx;
 	UProperty* Property;
+	// Compared and copied as raw memory when looking for changes. Bools are excluded, as they may share a byte with other bitfields.
+	bool bPlainOldData = false;
 };
 
 struct FInterestPropertyInfo
@@ -62,6 +68,9 @@ struct FClassInfo
 	TArray<FHandoverPropertyInfo> HandoverProperties;
 	TArray<FInterestPropertyInfo> InterestProperties;
 
+	// How each replicated and handover property is serialized, compiled from the class's rep layout and handover properties.
+	SpatialGDK::FPropertySerializationPlan SerializationPlan;
+
 	// For Actors and default Subobjects belonging to Actors
 	Worker_ComponentId SchemaComponents[ESchemaComponentType::SCHEMA_Count] = {};
 
@@ -92,6 +101,9 @@ public:
 
 	bool TryInit(USpatialNetDriver* NetDriver, UActorGroupManager* ActorGroupManager);
 
+	// Initializes from a SchemaDatabase that has already been loaded, as TryInit does once it has loaded the asset.
+	void InitWithSchemaDatabase(USpatialNetDriver* NetDriver, UActorGroupManager* ActorGroupManager, USchemaDatabase* SchemaDatabase);
+
 	// Checks whether a class is supported and quits the game if not. This is to avoid crashing
 	// when running with an out-of-date schema database.
 	bool ValidateOrExit_IsSupportedClass(const FString& PathName);
@@ -100,6 +112,13 @@ public:
 	// In PIE, PathName must be NetworkRemapped (bReading = false)
 	bool IsSupportedClass(const FString& PathName) const;
 
+	// Starts async loading the classes configured by bWarmUpClassInfo. Their class info is built by TickWarmUp once they have loaded.
+	void StartWarmUp();
+	void TickWarmUp();
+	bool IsWarmingUp() const { return NextWarmUpClass < WarmUpClassPaths.Num(); }
+
+	bool HasClassInfo(UClass* Class) const { return ClassInfoMap.Contains(Class); }
+
 	const FClassInfo& GetOrCreateClassInfoByClass(UClass* Class);
 	const FClassInfo& GetOrCreateClassInfoByObject(UObject* Object);
 	const FClassInfo& GetClassInfoByComponentId(Worker_ComponentId ComponentId);
@@ -127,7 +146,15 @@ private:
 	void TryCreateClassInfoForComponentId(Worker_ComponentId ComponentId);
 
 	void FinishConstructingActorClassInfo(const FString& ClassPath, TSharedRef<FClassInfo>& Info);
+	void FinishConstructingActorSubobjectClassInfo(const FString& ActorClassPath, TSharedRef<FClassInfo>& Info, uint32 Offset, FString SubobjectClassPath, FName SubobjectName, const uint32* SubobjectSchemaComponents);
 	void FinishConstructingSubobjectClassInfo(const FString& ClassPath, TSharedRef<FClassInfo>& Info);
+	void AddDynamicSubobjectClassInfo(TSharedRef<FClassInfo>& Info, const uint32* DynamicSubobjectSchemaComponents);
+
+	bool LoadCompactSchemaDatabase();
+	void InitComponentInfoTable();
+
+	TArray<FSoftObjectPath> GatherWarmUpClassPaths() const;
+	void OnWarmUpClassesLoaded();
 
 	void QuitGame();
 
@@ -138,8 +165,20 @@ private:
 	UPROPERTY()
 	UActorGroupManager* ActorGroupManager;
 
+	// When loaded, replaces SchemaDatabase for all lookups.
+	SpatialGDK::FCompactSchemaDatabase CompactSchemaDatabase;
+
 	TMap<TWeakObjectPtr<UClass>, TSharedRef<FClassInfo>> ClassInfoMap;
-	TMap<Worker_ComponentId, TSharedRef<FClassInfo>> ComponentToClassInfoMap;
-	TMap<Worker_ComponentId, uint32> ComponentToOffsetMap;
-	TMap<Worker_ComponentId, ESchemaComponentType> ComponentToCategoryMap;
+	SpatialGDK::FComponentInfoTable ComponentInfoTable;
+
+	// The handle keeps warmed up classes loaded for as long as the worker runs.
+	FStreamableManager StreamableManager;
+	TSharedPtr<FStreamableHandle> WarmUpHandle;
+	TArray<FSoftObjectPath> WarmUpClassPaths;
+	int32 NextWarmUpClass = 0;
+	bool bWarmUpClassesLoaded = false;
+	double WarmUpStartTime = 0.0;
+	double WarmUpLoadSeconds = 0.0;
+	double WarmUpBuildSeconds = 0.0;
+	int32 WarmUpFrames = 0;
 };
@@ -3,10 +3,12 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Engine/StreamableManager.h"
 
 #include "EngineClasses/SpatialActorChannel.h"
 #include "EngineClasses/SpatialNetDriver.h"
 #include "EngineClasses/SpatialPackageMapClient.h"
+#include "Interop/EntityMaterializationQueue.h"
 #include "Interop/SpatialClassInfoManager.h"
 #include "Schema/DynamicComponent.h"
 #include "Schema/RPCPayload.h"
@@ -14,6 +16,9 @@
 #include "Schema/StandardLibrary.h"
 #include "Schema/UnrealObjectRef.h"
 #include "SpatialCommonTypes.h"
+#include "Utils/ActorPool.h"
+#include "Utils/HeartbeatTimingWheel.h"
+#include "Utils/LatencyHistogram.h"
 #include "Utils/RPCContainer.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
@@ -27,17 +32,6 @@ class USpatialNetConnection;
 class USpatialSender;
 class UGlobalStateManager;
 
-struct PendingAddComponentWrapper
-{
-	PendingAddComponentWrapper() = default;
-	PendingAddComponentWrapper(Worker_EntityId InEntityId, Worker_ComponentId InComponentId, TUniquePtr<SpatialGDK::DynamicComponent>&& InData)
-		: EntityId(InEntityId), ComponentId(InComponentId), Data(MoveTemp(InData)) {}
-
-	Worker_EntityId EntityId;
-	Worker_ComponentId ComponentId;
-	TUniquePtr<SpatialGDK::DynamicComponent> Data;
-};
-
 struct FObjectReferences
 {
 	FObjectReferences() = default;
@@ -59,9 +53,9 @@ struct FObjectReferences
 		UnresolvedRefs.Add(InUnresolvedRef);
 	}
 
-	// Struct (memory stream) constructor
-	FObjectReferences(const TArray<uint8>& InBuffer, int32 InNumBufferBits, const TSet<FUnrealObjectRef>& InUnresolvedRefs, int32 InCmdIndex, int32 InParentIndex, UProperty* InProperty, bool InFastArrayProp = false)
-		: UnresolvedRefs(InUnresolvedRefs), bSingleProp(false), bFastArrayProp(InFastArrayProp), Buffer(InBuffer), NumBufferBits(InNumBufferBits), ShadowOffset(InCmdIndex), ParentIndex(InParentIndex), Property(InProperty) {}
+	// Struct (memory stream) constructor. Copies the buffer, as it is usually a view into an op that is about to be destroyed.
+	FObjectReferences(TArrayView<const uint8> InBuffer, int32 InNumBufferBits, const TSet<FUnrealObjectRef>& InUnresolvedRefs, int32 InCmdIndex, int32 InParentIndex, UProperty* InProperty, bool InFastArrayProp = false)
+		: UnresolvedRefs(InUnresolvedRefs), bSingleProp(false), bFastArrayProp(InFastArrayProp), Buffer(InBuffer.GetData(), InBuffer.Num()), NumBufferBits(InNumBufferBits), ShadowOffset(InCmdIndex), ParentIndex(InParentIndex), Property(InProperty) {}
 
 	// Array constructor
 	FObjectReferences(FObjectReferencesMap* InArray, int32 InCmdIndex, int32 InParentIndex, UProperty* InProperty)
@@ -153,12 +147,27 @@ public:
 	void RemoveActor(Worker_EntityId EntityId);
 	bool IsPendingOpsOnChannel(USpatialActorChannel* Channel);
 
+	// Creates actors for queued entities until this frame's materialization budget is spent.
+	void ProcessEntityMaterializationQueue();
+	SpatialGDK::FEntityMaterializationQueue& GetEntityMaterializationQueue() { return MaterializationQueue; }
+
+	// Time taken to check out the first entity of each actor class, from loading its class to creating its actor.
+	SpatialGDK::FLatencyHistogram& GetFirstCheckoutLatency() { return FirstCheckoutLatency; }
+
 private:
 	void EnterCriticalSection();
 	void LeaveCriticalSection();
 
 	void ReceiveActor(Worker_EntityId EntityId);
+	void QueuePendingAddEntities();
+	TArray<PendingAddComponentWrapper> TakePendingAddComponents(Worker_EntityId EntityId);
+	bool NeedsEntityClassLoad(Worker_EntityId EntityId, FSoftObjectPath& OutClassPath) const;
+	void ParkEntityUntilClassLoaded(Worker_EntityId EntityId, const FSoftObjectPath& ClassPath, int32 ClassPriority, float DistanceSquared);
+	void OnEntityClassLoaded(FSoftObjectPath ClassPath);
+	void MaterializeEntity(SpatialGDK::FEntityMaterializationQueue::FEntry& Entry);
+	void MaterializeQueuedEntity(Worker_EntityId EntityId);
 	void DestroyActor(AActor* Actor, Worker_EntityId EntityId);
+	bool CanReturnActorToPool(AActor* Actor, USpatialActorChannel* Channel);
 
 	AActor* TryGetOrCreateActor(SpatialGDK::UnrealMetadata* UnrealMetadata, SpatialGDK::SpawnData* SpawnData);
 	AActor* CreateActor(SpatialGDK::UnrealMetadata* UnrealMetadata, SpatialGDK::SpawnData* SpawnData);
@@ -203,8 +212,10 @@ private:
 	AActor* FindSingletonActor(UClass* SingletonClass);
 
 	void OnHeartbeatComponentUpdate(const Worker_ComponentUpdateOp& Op);
+	void CheckHeartbeatTimeouts();
 
 	void PeriodicallyProcessIncomingRPCs();
+	void PeriodicallyCheckHeartbeatTimeouts();
 
 public:
 	TMap<FUnrealObjectRef, TSet<FChannelObjectPair>> IncomingRefsMap;
@@ -242,7 +253,7 @@ private:
 	bool bInCriticalSection;
 	TArray<Worker_EntityId> PendingAddEntities;
 	TArray<Worker_AuthorityChangeOp> PendingAuthorityChanges;
-	TArray<PendingAddComponentWrapper> PendingAddComponents;
+	FPendingAddComponentMap PendingAddComponents;
 	TArray<Worker_RemoveComponentOp> QueuedRemoveComponentOps;
 
 	TMap<Worker_RequestId_Key, TWeakObjectPtr<USpatialActorChannel>> PendingActorRequests;
@@ -257,5 +268,25 @@ private:
 	// lifecycle logic (Heartbeat component updates, disconnection logic).
 	TMap<Worker_EntityId_Key, TWeakObjectPtr<USpatialNetConnection>> AuthorityPlayerControllerConnectionMap;
 
+	// Heartbeat timeouts for the PlayerControllers in AuthorityPlayerControllerConnectionMap, timed by the seconds
+	// elapsed on the timer that checks them. Only used on servers.
+	SpatialGDK::FHeartbeatTimingWheel HeartbeatTimeouts;
+	double HeartbeatTime;
+
 	TMap<TPair<Worker_EntityId_Key, Worker_ComponentId>, PendingAddComponentWrapper> PendingDynamicSubobjectComponents;
+
+	// Idle actors of pooled classes, reused by CreateActor. Only used on clients.
+	SpatialGDK::FActorPool ActorPool;
+
+	// Entities whose actors are created over several frames. Only used on clients with a materialization budget.
+	SpatialGDK::FEntityMaterializationQueue MaterializationQueue;
+
+	TSet<TWeakObjectPtr<UClass>> CheckedOutClasses;
+
+	// Handles for entity classes loading in the background. Once a class has loaded, its handle moves to LoadedEntityClassHandles,
+	// keeping the class loaded until the queue holds only parked entities, so that every entity let out by the load has its actor.
+	FStreamableManager EntityClassStreamableManager;
+	TMap<FSoftObjectPath, TSharedPtr<FStreamableHandle>> EntityClassLoadHandles;
+	TArray<TSharedPtr<FStreamableHandle>> LoadedEntityClassHandles;
+	SpatialGDK::FLatencyHistogram FirstCheckoutLatency;
 };
@@ -6,8 +6,11 @@
 
 #include "EngineClasses/SpatialNetBitWriter.h"
 #include "Interop/SpatialClassInfoManager.h"
+#include "Schema/Interest.h"
 #include "Schema/RPCPayload.h"
 #include "TimerManager.h"
+#include "Utils/EntityAclTemplateCache.h"
+#include "Utils/FrameArena.h"
 #include "Utils/RepDataUtils.h"
 #include "Utils/RPCContainer.h"
 
@@ -51,7 +54,8 @@ struct FPendingRPC
 
 	uint32 Offset;
 	Schema_FieldId Index;
-	TArray<uint8> Data;
+	// Points into USpatialSender's RPC arena, which is reset once packed RPCs are flushed.
+	TArrayView<const uint8> Data;
 	Schema_EntityId Entity;
 };
 
@@ -74,6 +78,7 @@ public:
 	void SendComponentUpdates(UObject* Object, const FClassInfo& Info, USpatialActorChannel* Channel, const FRepChangeState* RepChanges, const FHandoverChangeState* HandoverChanges);
 	void SendComponentInterestForActor(USpatialActorChannel* Channel, Worker_EntityId EntityId, bool bNetOwned);
 	void SendComponentInterestForSubobject(const FClassInfo& Info, Worker_EntityId EntityId, bool bNetOwned);
+	void SendHeartbeatComponentInterest(Worker_EntityId EntityId, bool bInterested);
 	void SendPositionUpdate(Worker_EntityId EntityId, const FVector& Location);
 	FRPCErrorInfo SendRPC(const FPendingRPCParams& Params);
 	ERPCResult SendRPCInternal(UObject* TargetObject, UFunction* Function, const RPCPayload& Payload);
@@ -101,6 +106,18 @@ public:
 	bool UpdateEntityACLs(Worker_EntityId EntityId, const FString& OwnerWorkerAttribute);
 	void UpdateInterestComponent(AActor* Actor);
 
+	// Forget the last Interest sent for this entity, so the next interest update is sent in full.
+	void ClearSentInterest(Worker_EntityId EntityId);
+
+	// Interest bytes sent and interest updates skipped as unchanged since the last call.
+	void ConsumeInterestStats(uint64& OutBytesSent, uint32& OutUpdatesSkipped);
+
+	// Initial data bytes of the entities created since the last call, and how many were created.
+	void ConsumeEntityCreationStats(uint64& OutBytesSent, uint32& OutEntitiesCreated);
+
+	// Most bytes held by the RPC arena in one frame, and arena blocks allocated from the heap, since the last call.
+	void ConsumeRPCArenaStats(int32& OutHighWaterMark, int32& OutBlocksAllocated);
+
 	void ProcessOrQueueOutgoingRPC(const FUnrealObjectRef& InTargetObjectRef, SpatialGDK::RPCPayload&& InPayload);
 	void ProcessUpdatesQueuedUntilAuthority(Worker_EntityId EntityId, Worker_ComponentId ComponentId);
 
@@ -122,7 +139,7 @@ private:
 	void AddTombstoneToEntity(const Worker_EntityId EntityId);
 
 	// RPC Construction
-	FSpatialNetBitWriter PackRPCDataToSpatialNetBitWriter(UFunction* Function, void* Parameters, int ReliableRPCId) const;
+	void PackRPCDataToSpatialNetBitWriter(UFunction* Function, void* Parameters, int ReliableRPCId, FSpatialNetBitWriter& PayloadWriter) const;
 
 	Worker_CommandRequest CreateRPCCommandRequest(UObject* TargetObject, const RPCPayload& Payload, Worker_ComponentId ComponentId, Schema_FieldId CommandIndex, Worker_EntityId& OutEntityId);
 	Worker_CommandRequest CreateRetryRPCCommandRequest(const FReliableRPCForRetry& RPC, uint32 TargetObjectOffset);
@@ -131,6 +148,9 @@ private:
 
 	TArray<Worker_InterestOverride> CreateComponentInterestForActor(USpatialActorChannel* Channel, bool bIsNetOwned);
 
+	// Returns false if the actor's Interest is unchanged since it was last sent, in which case no update is needed.
+	bool CreateInterestUpdateIfChanged(AActor* Actor, const FClassInfo& Info, Worker_EntityId EntityId, Worker_ComponentUpdate& OutUpdate);
+
 private:
 	UPROPERTY()
 	USpatialNetDriver* NetDriver;
@@ -165,4 +185,19 @@ private:
 	FChannelsToUpdatePosition ChannelsToUpdatePosition;
 
 	TMap<Worker_EntityId_Key, TArray<FPendingRPC>> RPCsToPack;
+
+	// Packed RPC payloads live here until FlushPackedRPCs, and RPC parameters are written with the same writer each
+	// time, so that sending an RPC doesn't grow a new writer and copy its payload into a new array on every call.
+	SpatialGDK::FFrameArena RPCArena;
+	TUniquePtr<FSpatialNetBitWriter> RPCWriter;
+
+	SpatialGDK::FEntityAclTemplateCache EntityAclTemplates;
+
+	// Interest is always sent as a full replacement, so the last one sent is kept per entity to skip redundant updates.
+	TMap<Worker_EntityId_Key, SpatialGDK::Interest> SentInterest;
+	uint64 InterestBytesSent = 0;
+	uint32 InterestUpdatesSkipped = 0;
+
+	uint64 CreatedEntityBytes = 0;
+	uint32 EntitiesCreated = 0;
 };
@@ -14,6 +14,8 @@
  * Given a Point, for each Cell:
  * Point is inside Cell iff Min(Cell) <= Point < Max(Cell)
  *
+ * A worker keeps authority over actors until they are BoundaryHysteresis cm outside its cell.
+ *
  * Intended Usage: Create a data-only blueprint subclass and change
  * the Cols, Rows, WorldWidth, WorldHeight.
  */
@@ -34,6 +36,12 @@ public:
 	virtual uint32 WhoShouldHaveAuthority(const AActor& Actor) const override;
 /* End UAbstractLBStrategy Interface */
 
+	bool ShouldRelinquishAuthority(const FVector2D& Location) const;
+	uint32 WhoShouldHaveAuthority(const FVector2D& Location) const;
+
+	// Looks up many locations at once, such as those of every actor being replicated in a tick.
+	void WhoShouldHaveAuthority(const TArray<FVector2D>& Locations, TArray<uint32>& OutVirtualWorkerIds) const;
+
 protected:
 	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "Grid Based Load Balancing")
 	uint32 Rows;
@@ -47,11 +55,21 @@ protected:
 	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "Grid Based Load Balancing")
 	float WorldHeight;
 
+	/** How far outside its cell, in cm, an actor can be before its worker relinquishes authority over it. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "Grid Based Load Balancing")
+	float BoundaryHysteresis;
+
 private:
 
 	TArray<uint32> VirtualWorkerIds;
 
 	TArray<FBox2D> WorkerCells;
 
+	FVector2D WorldMin;
+	FVector2D InverseCellSize;
+
+	// Index into WorkerCells, or INDEX_NONE if Location is outside the world.
+	int32 GetCellIndex(const FVector2D& Location) const;
+
 	static bool IsInside(const FBox2D& Box, const FVector2D& Location);
 };
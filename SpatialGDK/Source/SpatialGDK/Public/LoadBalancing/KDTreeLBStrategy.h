@@ -0,0 +1,129 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LoadBalancing/AbstractLBStrategy.h"
+#include "KDTreeLBStrategy.generated.h"
+
+/**
+ * A load balancing strategy that divides the world into regions using a k-d tree,
+ * and moves region boundaries towards the workers with less load.
+ *
+ * The world, WorldWidth by WorldHeight cm centred on the origin, starts divided into
+ * NumWorkers regions of equal area by repeatedly splitting along the longer axis.
+ * Each split is stored as a fraction of its node's extent, so moving a split scales
+ * the regions below it rather than crossing them.
+ *
+ * Workers report their load through SetWorkerLoad, e.g. from USpatialMetrics::GetWorkerLoad
+ * and the number of entities they are authoritative over. Rebalance then moves each split
+ * towards the side with more load per worker, assuming load is spread evenly within a region.
+ * To avoid boundaries oscillating and actors being handed over back and forth:
+ * - Nothing moves until the most loaded worker exceeds the mean by RebalanceThreshold,
+ *   and a split only moves if its sides differ by at least as much.
+ * - Rebalancing happens at most once every MinRebalanceInterval seconds.
+ * - A split moves at most MaxSplitMoveFraction of its node's extent per rebalance, and
+ *   half as far as before each time it reverses direction.
+ *
+ * Given the same loads, every worker computes the same regions.
+ *
+ * Intended Usage: Create a data-only blueprint subclass and change the properties below.
+ */
+UCLASS(Blueprintable)
+class SPATIALGDK_API UKDTreeLBStrategy : public UAbstractLBStrategy
+{
+	GENERATED_BODY()
+
+public:
+	UKDTreeLBStrategy();
+
+/* UAbstractLBStrategy Interface */
+	virtual void Init(const class USpatialNetDriver* InNetDriver) override;
+
+	virtual TSet<uint32> GetVirtualWorkerIds() const override;
+
+	virtual bool ShouldRelinquishAuthority(const AActor& Actor) const override;
+	virtual uint32 WhoShouldHaveAuthority(const AActor& Actor) const override;
+/* End UAbstractLBStrategy Interface */
+
+	uint32 WhoShouldHaveAuthority(const FVector2D& Location) const;
+
+	void SetWorkerLoad(uint32 VirtualWorkerId, double Load, int32 EntityCount);
+
+	// Returns whether any region changed.
+	bool Rebalance(float CurrentTime);
+
+	const FBox2D& GetWorkerRegion(uint32 VirtualWorkerId) const;
+
+protected:
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "KD Tree Load Balancing")
+	uint32 NumWorkers;
+
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "KD Tree Load Balancing")
+	float WorldWidth;
+
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "KD Tree Load Balancing")
+	float WorldHeight;
+
+	/** Load added for each entity a worker is authoritative over. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "KD Tree Load Balancing")
+	float EntityCountWeight;
+
+	/** How far above the mean, as a fraction, load must be before boundaries move. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "KD Tree Load Balancing")
+	float RebalanceThreshold;
+
+	/** Minimum time between rebalances, in seconds. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "KD Tree Load Balancing")
+	float MinRebalanceInterval;
+
+	/** Largest fraction of a node's extent its split can move by in one rebalance. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0", ClampMax = "1"), Category = "KD Tree Load Balancing")
+	float MaxSplitMoveFraction;
+
+	/** Smallest extent a region can be given along a split axis, in cm. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "KD Tree Load Balancing")
+	float MinRegionSize;
+
+private:
+	struct FNode
+	{
+		FBox2D Bounds;
+
+		// INDEX_NONE for leaves.
+		int32 Children[2];
+
+		bool bSplitX;
+		float SplitFraction;
+		float Split;
+
+		// Largest fraction of the extent the split can move by in the next rebalance, and the direction it last moved in.
+		float StepFraction;
+		int8 LastMoveDirection;
+
+		uint32 FirstWorkerIndex;
+		uint32 NumWorkersBelow;
+	};
+
+	int32 BuildNode(const FBox2D& Bounds, uint32 FirstWorkerIndex, uint32 Count);
+	void UpdateBounds(int32 NodeIndex, const FBox2D& Bounds);
+
+	int32 FindLeaf(const FVector2D& Location) const;
+
+	double GetSubtreeCost(const FNode& Node) const;
+
+	// Returns whether the node's split moved.
+	bool RebalanceNode(FNode& Node);
+
+	TArray<uint32> VirtualWorkerIds;
+
+	// Nodes[0] is the root.
+	TArray<FNode> Nodes;
+
+	// Leaf node index for each worker, in VirtualWorkerIds order.
+	TArray<int32> WorkerLeaves;
+
+	TArray<double> WorkerCosts;
+
+	float LastRebalanceTime;
+};
@@ -19,12 +19,43 @@ struct DynamicComponent : Component
 	{
 	}
 
+	// Movable but not copyable, so buffered component data is never acquired or released more than once.
+	DynamicComponent(DynamicComponent&& Other)
+		: ComponentData(Other.ComponentData)
+	{
+		Other.ComponentData = nullptr;
+	}
+
+	DynamicComponent& operator=(DynamicComponent&& Other)
+	{
+		if (this != &Other)
+		{
+			Release();
+			ComponentData = Other.ComponentData;
+			Other.ComponentData = nullptr;
+		}
+		return *this;
+	}
+
+	DynamicComponent(const DynamicComponent&) = delete;
+	DynamicComponent& operator=(const DynamicComponent&) = delete;
+
 	~DynamicComponent()
 	{
-		Worker_ReleaseComponentData(ComponentData);
+		Release();
 	}
 
-	Worker_ComponentData* ComponentData;
+	Worker_ComponentData* ComponentData = nullptr;
+
+private:
+	void Release()
+	{
+		if (ComponentData != nullptr)
+		{
+			Worker_ReleaseComponentData(ComponentData);
+			ComponentData = nullptr;
+		}
+	}
 };
 
 } // namespace SpatialGDK
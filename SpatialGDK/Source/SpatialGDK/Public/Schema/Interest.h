@@ -137,6 +137,51 @@ struct ComponentInterest
 	TArray<Query> Queries;
 };
 
+// Structural equality, used to avoid sending Interest updates that would not change anything.
+inline bool operator==(const Coordinates& Lhs, const Coordinates& Rhs)
+{
+	return Lhs.X == Rhs.X && Lhs.Y == Rhs.Y && Lhs.Z == Rhs.Z;
+}
+
+inline bool operator==(const SphereConstraint& Lhs, const SphereConstraint& Rhs) { return Lhs.Center == Rhs.Center && Lhs.Radius == Rhs.Radius; }
+inline bool operator==(const CylinderConstraint& Lhs, const CylinderConstraint& Rhs) { return Lhs.Center == Rhs.Center && Lhs.Radius == Rhs.Radius; }
+inline bool operator==(const BoxConstraint& Lhs, const BoxConstraint& Rhs) { return Lhs.Center == Rhs.Center && Lhs.EdgeLength == Rhs.EdgeLength; }
+inline bool operator==(const RelativeSphereConstraint& Lhs, const RelativeSphereConstraint& Rhs) { return Lhs.Radius == Rhs.Radius; }
+inline bool operator==(const RelativeCylinderConstraint& Lhs, const RelativeCylinderConstraint& Rhs) { return Lhs.Radius == Rhs.Radius; }
+inline bool operator==(const RelativeBoxConstraint& Lhs, const RelativeBoxConstraint& Rhs) { return Lhs.EdgeLength == Rhs.EdgeLength; }
+
+inline bool operator==(const QueryConstraint& Lhs, const QueryConstraint& Rhs)
+{
+	return Lhs.SphereConstraint == Rhs.SphereConstraint
+		&& Lhs.CylinderConstraint == Rhs.CylinderConstraint
+		&& Lhs.BoxConstraint == Rhs.BoxConstraint
+		&& Lhs.RelativeSphereConstraint == Rhs.RelativeSphereConstraint
+		&& Lhs.RelativeCylinderConstraint == Rhs.RelativeCylinderConstraint
+		&& Lhs.RelativeBoxConstraint == Rhs.RelativeBoxConstraint
+		&& Lhs.EntityIdConstraint == Rhs.EntityIdConstraint
+		&& Lhs.ComponentConstraint == Rhs.ComponentConstraint
+		&& Lhs.AndConstraint == Rhs.AndConstraint
+		&& Lhs.OrConstraint == Rhs.OrConstraint;
+}
+
+inline bool operator==(const Query& Lhs, const Query& Rhs)
+{
+	return Lhs.Constraint == Rhs.Constraint
+		&& Lhs.FullSnapshotResult == Rhs.FullSnapshotResult
+		&& Lhs.ResultComponentId == Rhs.ResultComponentId
+		&& Lhs.Frequency == Rhs.Frequency;
+}
+
+inline bool operator==(const ComponentInterest& Lhs, const ComponentInterest& Rhs)
+{
+	return Lhs.Queries == Rhs.Queries;
+}
+
+inline bool operator!=(const ComponentInterest& Lhs, const ComponentInterest& Rhs)
+{
+	return !(Lhs == Rhs);
+}
+
 inline void AddQueryConstraintToQuerySchema(Schema_Object* QueryObject, Schema_FieldId Id, const QueryConstraint& Constraint)
 {
 	Schema_Object* QueryConstraintObject = Schema_AddObject(QueryObject, Id);
@@ -477,6 +522,31 @@ struct Interest : Component
 		}
 	}
 
+	// Returns the IDs of components whose interest was added, removed or changed between Old and New.
+	static TArray<uint32> GetChangedComponents(const Interest& Old, const Interest& New)
+	{
+		TArray<uint32> ChangedComponents;
+
+		for (const auto& KVPair : New.ComponentInterestMap)
+		{
+			const ComponentInterest* OldInterest = Old.ComponentInterestMap.Find(KVPair.Key);
+			if (OldInterest == nullptr || *OldInterest != KVPair.Value)
+			{
+				ChangedComponents.Add(KVPair.Key);
+			}
+		}
+
+		for (const auto& KVPair : Old.ComponentInterestMap)
+		{
+			if (!New.ComponentInterestMap.Contains(KVPair.Key))
+			{
+				ChangedComponents.Add(KVPair.Key);
+			}
+		}
+
+		return ChangedComponents;
+	}
+
 	TMap<uint32, ComponentInterest> ComponentInterestMap;
 };
 
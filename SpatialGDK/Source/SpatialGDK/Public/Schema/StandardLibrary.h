@@ -10,6 +10,7 @@
 #include "UObject/UObjectGlobals.h"
 #include "UObject/Package.h"
 #include "Utils/SchemaUtils.h"
+#include "Utils/WorkerAttributeTable.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
 #include <WorkerSDK/improbable/c_worker.h>
@@ -67,54 +68,51 @@ inline Coordinates GetCoordinateFromSchema(Schema_Object* Object, Schema_FieldId
 	return Coordinate;
 }
 
+// Holds handles to requirement sets interned in FWorkerAttributeTable rather than copies of the worker attributes.
 struct EntityAcl : Component
 {
 	static const Worker_ComponentId ComponentId = SpatialConstants::ENTITY_ACL_COMPONENT_ID;
 
 	EntityAcl() = default;
 
-	EntityAcl(const WorkerRequirementSet& InReadAcl, const WriteAclMap& InComponentWriteAcl)
+	EntityAcl(FRequirementSetHandle InReadAcl, const FInternedWriteAclMap& InComponentWriteAcl)
 		: ReadAcl(InReadAcl), ComponentWriteAcl(InComponentWriteAcl) {}
 
-	EntityAcl(const Worker_ComponentData& Data)
+	EntityAcl(const WorkerRequirementSet& InReadAcl, const WriteAclMap& InComponentWriteAcl)
 	{
-		Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data.schema_type);
+		FWorkerAttributeTable& AttributeTable = FWorkerAttributeTable::Get();
 
-		ReadAcl = GetWorkerRequirementSetFromSchema(ComponentObject, 1);
+		ReadAcl = AttributeTable.InternRequirementSet(InReadAcl);
 
-		uint32 KVPairCount = Schema_GetObjectCount(ComponentObject, 2);
-		for (uint32 i = 0; i < KVPairCount; i++)
+		ComponentWriteAcl.Reserve(InComponentWriteAcl.Num());
+		for (const auto& KVPair : InComponentWriteAcl)
 		{
-			Schema_Object* KVPairObject = Schema_IndexObject(ComponentObject, 2, i);
-			uint32 Key = Schema_GetUint32(KVPairObject, SCHEMA_MAP_KEY_FIELD_ID);
-			WorkerRequirementSet Value = GetWorkerRequirementSetFromSchema(KVPairObject, SCHEMA_MAP_VALUE_FIELD_ID);
-
-			ComponentWriteAcl.Add(Key, Value);
+			ComponentWriteAcl.Add(KVPair.Key, AttributeTable.InternRequirementSet(KVPair.Value));
 		}
 	}
 
+	EntityAcl(const Worker_ComponentData& Data)
+	{
+		Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data.schema_type);
+
+		ReadAcl = FWorkerAttributeTable::Get().GetRequirementSetFromSchema(ComponentObject, 1);
+		ReadComponentWriteAcl(ComponentObject);
+	}
+
 	void ApplyComponentUpdate(const Worker_ComponentUpdate& Update)
 	{
 		Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(Update.schema_type);
 
 		if (Schema_GetObjectCount(ComponentObject, 1) > 0)
 		{
-			ReadAcl = GetWorkerRequirementSetFromSchema(ComponentObject, 1);
+			ReadAcl = FWorkerAttributeTable::Get().GetRequirementSetFromSchema(ComponentObject, 1);
 		}
 
 		// This is never emptied, so does not need an additional check for cleared fields
-		uint32 KVPairCount = Schema_GetObjectCount(ComponentObject, 2);
-		if (KVPairCount > 0)
+		if (Schema_GetObjectCount(ComponentObject, 2) > 0)
 		{
-			ComponentWriteAcl.Empty();
-			for (uint32 i = 0; i < KVPairCount; i++)
-			{
-				Schema_Object* KVPairObject = Schema_IndexObject(ComponentObject, 2, i);
-				uint32 Key = Schema_GetUint32(KVPairObject, SCHEMA_MAP_KEY_FIELD_ID);
-				WorkerRequirementSet Value = GetWorkerRequirementSetFromSchema(KVPairObject, SCHEMA_MAP_VALUE_FIELD_ID);
-
-				ComponentWriteAcl.Add(Key, Value);
-			}
+			ComponentWriteAcl.Reset();
+			ReadComponentWriteAcl(ComponentObject);
 		}
 	}
 
@@ -125,14 +123,7 @@ struct EntityAcl : Component
 		Data.schema_type = Schema_CreateComponentData();
 		Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data.schema_type);
 
-		AddWorkerRequirementSetToSchema(ComponentObject, 1, ReadAcl);
-
-		for (const auto& KVPair : ComponentWriteAcl)
-		{
-			Schema_Object* KVPairObject = Schema_AddObject(ComponentObject, 2);
-			Schema_AddUint32(KVPairObject, SCHEMA_MAP_KEY_FIELD_ID, KVPair.Key);
-			AddWorkerRequirementSetToSchema(KVPairObject, SCHEMA_MAP_VALUE_FIELD_ID, KVPair.Value);
-		}
+		WriteFields(ComponentObject);
 
 		return Data;
 	}
@@ -144,20 +135,42 @@ struct EntityAcl : Component
 		ComponentUpdate.schema_type = Schema_CreateComponentUpdate();
 		Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(ComponentUpdate.schema_type);
 
-		AddWorkerRequirementSetToSchema(ComponentObject, 1, ReadAcl);
+		WriteFields(ComponentObject);
+
+		return ComponentUpdate;
+	}
+
+	FRequirementSetHandle ReadAcl = FWorkerAttributeTable::EmptyRequirementSet;
+	FInternedWriteAclMap ComponentWriteAcl;
+
+private:
+	void ReadComponentWriteAcl(Schema_Object* ComponentObject)
+	{
+		FWorkerAttributeTable& AttributeTable = FWorkerAttributeTable::Get();
+
+		uint32 KVPairCount = Schema_GetObjectCount(ComponentObject, 2);
+		ComponentWriteAcl.Reserve(KVPairCount);
+		for (uint32 i = 0; i < KVPairCount; i++)
+		{
+			Schema_Object* KVPairObject = Schema_IndexObject(ComponentObject, 2, i);
+			uint32 Key = Schema_GetUint32(KVPairObject, SCHEMA_MAP_KEY_FIELD_ID);
+			ComponentWriteAcl.Add(Key, AttributeTable.GetRequirementSetFromSchema(KVPairObject, SCHEMA_MAP_VALUE_FIELD_ID));
+		}
+	}
+
+	void WriteFields(Schema_Object* ComponentObject) const
+	{
+		const FWorkerAttributeTable& AttributeTable = FWorkerAttributeTable::Get();
+
+		AttributeTable.AddRequirementSetToSchema(ComponentObject, 1, ReadAcl);
 
 		for (const auto& KVPair : ComponentWriteAcl)
 		{
 			Schema_Object* KVPairObject = Schema_AddObject(ComponentObject, 2);
 			Schema_AddUint32(KVPairObject, SCHEMA_MAP_KEY_FIELD_ID, KVPair.Key);
-			AddWorkerRequirementSetToSchema(KVPairObject, SCHEMA_MAP_VALUE_FIELD_ID, KVPair.Value);
+			AttributeTable.AddRequirementSetToSchema(KVPairObject, SCHEMA_MAP_VALUE_FIELD_ID, KVPair.Value);
 		}
-
-		return ComponentUpdate;
 	}
-
-	WorkerRequirementSet ReadAcl;
-	WriteAclMap ComponentWriteAcl;
 };
 
 struct Metadata : Component
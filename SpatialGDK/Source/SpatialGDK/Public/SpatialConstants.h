@@ -161,6 +161,9 @@ namespace SpatialConstants
 	const Schema_FieldId UNREAL_OBJECT_REF_OUTER_ID							= 5;
 	const Schema_FieldId UNREAL_OBJECT_REF_USE_SINGLETON_CLASS_PATH_ID		= 6;
 
+	// Added to a FastArraySerializer property's handle for the field holding its snapshot; see FSpatialFastArrayBaseline.
+	const Schema_FieldId FAST_ARRAY_BASELINE_FIELD_ID_OFFSET				= 1 << 16;
+
 	// UnrealRPCPayload Field IDs
 	const Schema_FieldId UNREAL_RPC_PAYLOAD_OFFSET_ID						= 1;
 	const Schema_FieldId UNREAL_RPC_PAYLOAD_RPC_INDEX_ID					= 2;
@@ -223,10 +226,34 @@ namespace SpatialConstants
 
 	const float ENTITY_QUERY_RETRY_WAIT_SECONDS = 3.0f;
 
+	// Servers check for heartbeat timeouts at this interval, so clients can be disconnected up to this much later than HeartbeatTimeoutSeconds.
+	const float HEARTBEAT_TIMEOUT_CHECK_INTERVAL_SECONDS = 0.5f;
+
 	const Worker_ComponentId MIN_EXTERNAL_SCHEMA_ID = 1000;
 	const Worker_ComponentId MAX_EXTERNAL_SCHEMA_ID = 2000;
 
 	const FString SPATIALOS_METRICS_DYNAMIC_FPS = TEXT("Dynamic.FPS");
+	const FString SPATIALOS_METRICS_OP_LIST_PROCESSING_TIME = TEXT("Latency.OpListProcessing");
+	const FString SPATIALOS_METRICS_OUTGOING_MESSAGE_TIME   = TEXT("Latency.OutgoingMessage");
+	const FString SPATIALOS_METRICS_CREATE_ENTITY_TIME      = TEXT("Latency.CreateEntity");
+	const FString SPATIALOS_METRICS_COMMAND_RESPONSE_TIME   = TEXT("Latency.CommandResponse");
+	const FString SPATIALOS_METRICS_DORMANT_WAKE_TIME       = TEXT("Latency.DormantWake");
+	const FString SPATIALOS_METRICS_FIRST_CHECKOUT_TIME     = TEXT("Latency.FirstCheckout");
+	const FString SPATIALOS_METRICS_COLD_STORAGE_ENTITIES   = TEXT("Dormancy.ColdStorageEntities");
+	const FString SPATIALOS_METRICS_COLD_STORAGE_BYTES      = TEXT("Dormancy.ColdStorageReleasedBytes");
+	const FString SPATIALOS_METRICS_INTEREST_BYTES_PER_SECOND = TEXT("Interest.BytesPerSecond");
+	const FString SPATIALOS_METRICS_INTEREST_UPDATES_SKIPPED  = TEXT("Interest.UpdatesSkipped");
+	const FString SPATIALOS_METRICS_MATERIALIZATION_QUEUE_DEPTH = TEXT("Materialization.QueueDepth");
+	const FString SPATIALOS_METRICS_MATERIALIZATION_FRAME_TIME  = TEXT("Materialization.FrameTime");
+	const FString SPATIALOS_METRICS_MATERIALIZATION_WAIT_TIME   = TEXT("Materialization.WaitTime");
+	const FString SPATIALOS_METRICS_ENTITIES_AWAITING_CLASS_LOAD = TEXT("Materialization.EntitiesAwaitingClassLoad");
+	const FString SPATIALOS_METRICS_ENTITY_CLASS_LOAD_TIME      = TEXT("Materialization.ClassLoadTime");
+	const FString SPATIALOS_METRICS_CREATED_ENTITY_BYTES        = TEXT("EntityCreation.BytesPerEntity");
+	const FString SPATIALOS_METRICS_RPC_ARENA_HIGH_WATER_MARK   = TEXT("RPC.ArenaHighWaterMarkBytes");
+	const FString SPATIALOS_METRICS_RPC_ARENA_BLOCKS_ALLOCATED  = TEXT("RPC.ArenaBlocksAllocated");
+	const FString SPATIALOS_METRICS_OP_LISTS_PER_TICK           = TEXT("Ops.OpListsPerTick");
+	const FString SPATIALOS_METRICS_OPS_PER_TICK                = TEXT("Ops.OpsPerTick");
+	const FString SPATIALOS_METRICS_OP_BYTES_PER_SECOND         = TEXT("Ops.BytesPerSecond");
 
 	const FString LOCATOR_HOST    = TEXT("locator.improbable.io");
 	const FString LOCATOR_HOST_CN = TEXT("locator.spatialoschina.com");
@@ -236,6 +263,7 @@ namespace SpatialConstants
 
 	const FString SCHEMA_DATABASE_FILE_PATH  = TEXT("Spatial/SchemaDatabase");
 	const FString SCHEMA_DATABASE_ASSET_PATH = TEXT("/Game/Spatial/SchemaDatabase");
+	const FString COMPACT_SCHEMA_DATABASE_FILE_PATH = TEXT("Spatial/SchemaDatabase.gsdb");
 
 } // ::SpatialConstants
 
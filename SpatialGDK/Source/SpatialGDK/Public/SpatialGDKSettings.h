@@ -118,6 +118,18 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false))
 	bool bEnableHandover;
 
+	/** Only compare and send handover properties when an actor is about to lose authority, signalled by an update to its AuthorityIntent or by USpatialActorChannel::RequestHandoverCapture, instead of every time it replicates. */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, EditCondition = "bEnableHandover"))
+	bool bOnDemandHandover;
+
+	/** With on-demand handover, also capture handover properties at this interval, as authority changes made by the SpatialOS load balancer give no warning. Set to 0 to only capture on demand. */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, EditCondition = "bOnDemandHandover", ClampMin = "0.0"))
+	float HandoverCaptureIntervalSeconds;
+
+	/** Process the op lists received in a tick as fewer, larger op lists, keeping the order ops were received in. Reduces per op list overhead when many small op lists arrive in a tick. */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false))
+	bool bCoalesceOpLists;
+
 	/** Maximum NetCullDistanceSquared value used in Spatial networking. Set to 0.0 to disable. This is temporary and will be removed when the runtime issue is resolved.*/
 	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false))
 	float MaxNetCullDistanceSquared;
@@ -154,6 +166,10 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (ConfigRestartRequired = false))
 	bool bUseFrameTimeAsLoad;
 
+	/** Append latency percentiles to a CSV file in the project log directory every time metrics are reported.*/
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (ConfigRestartRequired = false))
+	bool bWriteLatencyHistogramsToFile;
+
 	// TODO: UNR-1653 Redesign bCheckRPCOrder Tests functionality
 	/** Include an order index with reliable RPCs and warn if they are executed out of order.*/
 	UPROPERTY(config, meta = (ConfigRestartRequired = false))
@@ -163,6 +179,78 @@ public:
 	UPROPERTY(config, meta = (ConfigRestartRequired = false))
 	bool bBatchSpatialPositionUpdates;
 
+	/**
+	 * Release the replication state of actors while they are dormant, keeping only a small record per entity.
+	 * Saves memory with many dormant actors, at the cost of resending an actor's non-default replicated properties when it wakes.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false))
+	bool bUseDormantColdStorage;
+
+	/** On clients, keep the actors of entities that leave view and reuse them for entities of the same class entering view, instead of destroying and spawning them. Only classes in PooledActorClasses are pooled. */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = true))
+	bool bEnableActorPooling;
+
+	/** Actor classes to pool, with the maximum number of idle actors kept for each. Actors implementing SpatialPooledActor are notified when they are pooled and reused. */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = true, EditCondition = "bEnableActorPooling"))
+	TMap<TSoftClassPtr<AActor>, int32> PooledActorClasses;
+
+	/**
+	 * On clients, the time in milliseconds that may be spent each frame creating actors for entities that entered view.
+	 * Entities over the budget are queued and their actors are created on later frames, nearest to the viewer first. 0 creates them all straight away.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, ClampMin = "0"))
+	float EntityMaterializationBudgetMs;
+
+	/** Actor classes whose entities are created before others when entity creation is spread over several frames. Higher values go first; classes not listed have priority 0. */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = true))
+	TMap<TSoftClassPtr<AActor>, int32> EntityMaterializationClassPriorities;
+
+	/**
+	 * Load the class of an entity that entered view in the background if it isn't loaded yet, rather than blocking the game thread.
+	 * The entity's actor is created once the class has loaded, with any component data, updates and RPCs received in the meantime.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false))
+	bool bAsyncLoadEntityClasses;
+
+	/**
+	 * Leave replicated properties that equal their class default's value out of the initial data of new entities, much as native Unreal
+	 * does for initial replication. Workers receiving the entity restore omitted properties from the class default. Must match on all workers.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = true))
+	bool bOmitDefaultPropertiesFromInitialData;
+
+	/**
+	 * Replicate changes to FastArraySerializer properties, including removed items, rather than their full contents with every update.
+	 * Each fast array keeps a full snapshot in a second schema field for workers that check the entity out later. Must match on all workers.
+	 * Items changed since the snapshot are sent again with every update, so PostReplicatedChange can be called for them more than once.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = true))
+	bool bUseFastArrayDeltaReplication;
+
+	/**
+	 * Load the compact, memory-mapped schema database that is baked alongside the SchemaDatabase asset instead of the asset itself.
+	 * Falls back to the asset if the baked file is missing, or, in the editor and uncooked builds, if it was baked from a different
+	 * version of the asset. Cooked builds can't check this, so regenerate schema before packaging. For packaged builds, add
+	 * Content/Spatial to "Additional Non-Asset Directories to Package" so the baked file is staged.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Schema Generation", meta = (ConfigRestartRequired = true))
+	bool bUseCompactSchemaDatabase;
+
+	/**
+	 * Load the classes in the schema database and build the information needed to replicate them while the worker starts,
+	 * rather than the first time an entity of each class is checked out.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Schema Generation", meta = (ConfigRestartRequired = true))
+	bool bWarmUpClassInfo;
+
+	/** Classes to warm up, along with their subobject classes. All classes in the schema database are warmed up if empty. */
+	UPROPERTY(EditAnywhere, config, Category = "Schema Generation", meta = (ConfigRestartRequired = true, EditCondition = "bWarmUpClassInfo"))
+	TArray<FSoftClassPath> ClassInfoWarmUpClasses;
+
+	/** The time in milliseconds that may be spent each frame building class information once warm-up classes have loaded. 0 builds it all at once. */
+	UPROPERTY(EditAnywhere, config, Category = "Schema Generation", meta = (ConfigRestartRequired = true, ClampMin = "0", EditCondition = "bWarmUpClassInfo"))
+	float ClassInfoWarmUpBudgetMs;
+
 	/** Maximum number of ActorComponents/Subobjects of the same class that can be attached to an Actor.*/
 	UPROPERTY(EditAnywhere, config, Category = "Schema Generation", meta = (ConfigRestartRequired = false), DisplayName = "Maximum Dynamically Attached Subobjects Per Class")
 	uint32 MaxDynamicallyAttachedSubobjectsPerClass;
@@ -215,6 +303,14 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Logging", meta = (ConfigRestartRequired = false, DisplayName = "Worker Log Level"))
 	TEnumAsByte<ESettingsWorkerLogVerbosity::Type> WorkerLogLevel;
 
+	/** Maximum number of distinct log messages buffered between two sends to SpatialOS. Further messages are dropped and counted. */
+	UPROPERTY(EditAnywhere, config, Category = "Logging", meta = (ConfigRestartRequired = true, ClampMin = "1"))
+	int32 MaxBufferedLogMessages;
+
+	/** Maximum number of distinct log messages per log category sent to SpatialOS each second. Repeated lines are coalesced and do not count towards this. */
+	UPROPERTY(EditAnywhere, config, Category = "Logging", meta = (ConfigRestartRequired = true, ClampMin = "1"))
+	int32 MaxLogMessagesPerCategoryPerSecond;
+
 	/** EXPERIMENTAL: Disable runtime load balancing and use a worker to do it instead. */
 	UPROPERTY(EditAnywhere, Config, Category = "Load Balancing")
 		bool bEnableUnrealLoadBalancer;
@@ -0,0 +1,80 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "UObject/Interface.h"
+#include "UObject/SoftObjectPath.h"
+
+#include "ActorPool.generated.h"
+
+class AActor;
+class UWorld;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogActorPool, Log, All);
+
+UINTERFACE(MinimalAPI, Blueprintable)
+class USpatialPooledActor : public UInterface
+{
+	GENERATED_BODY()
+};
+
+// Optional reset hooks for actors of pooled classes.
+// Replicated properties are overwritten by the entity's initial data when a pooled actor is reused, but any
+// local state (timers, effects, cached references) must be reset here. BeginPlay is only called once per actor.
+class SPATIALGDK_API ISpatialPooledActor
+{
+	GENERATED_BODY()
+
+public:
+	// Called after the actor's entity has left view and the actor has been deactivated and stored.
+	UFUNCTION(BlueprintNativeEvent, Category = "SpatialOS|Actor Pool")
+	void OnReturnedToPool();
+
+	// Called when the actor is reused for a new entity, after it has been moved and reactivated but before its initial data is applied.
+	UFUNCTION(BlueprintNativeEvent, Category = "SpatialOS|Actor Pool")
+	void OnTakenFromPool();
+};
+
+namespace SpatialGDK
+{
+
+// Keeps idle actors of configured classes so that entities entering view can reuse them instead of spawning.
+//
+// Only classes given a cap with SetClassCap are pooled. Returned actors are hidden, and have collision and ticking
+// disabled; they stay in their level, so they are kept alive by it rather than by the pool.
+class SPATIALGDK_API FActorPool
+{
+public:
+	// Sets the maximum number of idle actors kept for the class at ClassPath. A cap of 0 disables pooling for it.
+	void SetClassCap(const FSoftObjectPath& ClassPath, int32 Cap);
+
+	bool IsPooledClass(UClass* Class) { return GetClassCap(Class) > 0; }
+
+	// Returns an idle actor of exactly this class, moved to Transform and reactivated, or nullptr if there is none.
+	AActor* Acquire(UWorld* World, UClass* Class, const FTransform& Transform);
+
+	// Deactivates Actor and keeps it for reuse. Returns false, leaving the actor untouched, if the class is not pooled or its pool is full.
+	bool Release(AActor* Actor);
+
+	// Destroys all idle actors.
+	void Empty();
+
+	int32 Num() const;
+	uint64 GetNumReused() const { return NumReused; }
+
+private:
+	int32 GetClassCap(UClass* Class);
+
+	TMap<FSoftObjectPath, int32> ClassPathCaps;
+
+	// Caps resolved from ClassPathCaps, so that path names are only built once per class.
+	TMap<TWeakObjectPtr<UClass>, int32> ClassCaps;
+
+	TMap<TWeakObjectPtr<UClass>, TArray<TWeakObjectPtr<AActor>>> IdleActors;
+
+	uint64 NumReused = 0;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,198 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Misc/SecureHash.h"
+#include "SpatialConstants.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+class USchemaDatabase;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogCompactSchemaDatabase, Log, All);
+
+namespace SpatialGDK
+{
+
+// Read-only, build-time baked version of USchemaDatabase.
+//
+// USchemaDatabase stays the editor-side source of truth. When schema is generated, the same data is also written out
+// as a flat binary blob in which every class and level path is interned once into a string table, and every lookup
+// table is a sorted array of POD records. The blob is memory-mapped at worker startup, so there is no UObject
+// deserialization and no FString allocation or hashing of the whole database. Path lookups hash the query once and
+// binary search a sorted array of 64-bit hashes; component ID lookups binary search directly on the ID.
+//
+// The header records an MD5 hash of the SchemaDatabase asset it was baked from, so that a baked file left behind by an older
+// schema generation can be detected and ignored wherever the asset's package file is on disk.
+//
+// All offsets in the file are relative to the start of the blob and every table starts on an 8-byte boundary.
+class SPATIALGDK_API FCompactSchemaDatabase
+{
+public:
+	static const uint32 Magic = 0x42445347; // 'GSDB'
+	static const uint32 Version = 2;
+
+	struct FHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint32 SchemaComponentCount;
+		uint32 NextAvailableComponentId;
+
+		// MD5 hash of the SchemaDatabase asset's package file, or zero if it wasn't known when baking.
+		uint8 SchemaDatabaseHash[16];
+
+		uint32 NumStrings;
+		uint32 StringsOffset;
+		uint32 StringDataOffset;
+		uint32 StringDataSize;
+
+		uint32 NumActors;
+		uint32 ActorKeysOffset;
+		uint32 ActorsOffset;
+
+		uint32 NumActorSubobjects;
+		uint32 ActorSubobjectsOffset;
+
+		uint32 NumSubobjectClasses;
+		uint32 SubobjectClassKeysOffset;
+		uint32 SubobjectClassesOffset;
+
+		uint32 NumDynamicSubobjects;
+		uint32 DynamicSubobjectsOffset;
+
+		uint32 NumLevels;
+		uint32 LevelKeysOffset;
+
+		uint32 NumComponentClassPaths;
+		uint32 ComponentClassPathsOffset;
+
+		uint32 NumLevelComponentIds;
+		uint32 LevelComponentIdsOffset;
+	};
+
+	// An entry in the string table. Strings are stored as null-terminated UTF-8.
+	struct FStringEntry
+	{
+		uint32 Offset;
+		uint32 Length;
+	};
+
+	// Sorted by Hash. Value is a record index for actor and subobject classes, and a component ID for levels.
+	struct FPathKey
+	{
+		uint64 Hash;
+		uint32 StringId;
+		uint32 Value;
+	};
+
+	struct FActorRecord
+	{
+		uint32 GeneratedSchemaNameId;
+		uint32 SchemaComponents[SCHEMA_Count];
+		uint32 FirstSubobject;
+		uint32 NumSubobjects;
+	};
+
+	struct FActorSubobjectRecord
+	{
+		uint32 Offset;
+		uint32 ClassPathId;
+		uint32 NameId;
+		uint32 SchemaComponents[SCHEMA_Count];
+	};
+
+	struct FSubobjectClassRecord
+	{
+		uint32 GeneratedSchemaNameId;
+		uint32 FirstDynamicSubobject;
+		uint32 NumDynamicSubobjects;
+	};
+
+	struct FDynamicSubobjectRecord
+	{
+		uint32 SchemaComponents[SCHEMA_Count];
+	};
+
+	// Sorted by ComponentId.
+	struct FComponentClassPathRecord
+	{
+		uint32 ComponentId;
+		uint32 ClassPathId;
+	};
+
+	FCompactSchemaDatabase() = default;
+	~FCompactSchemaDatabase();
+
+	// Not copyable, as the views point into the owned (or mapped) blob.
+	FCompactSchemaDatabase(const FCompactSchemaDatabase&) = delete;
+	FCompactSchemaDatabase& operator=(const FCompactSchemaDatabase&) = delete;
+
+	// Bakes the given database into the binary format. SchemaDatabaseHash is the hash of the asset's package file, if saved.
+	static TArray<uint8> Serialize(const USchemaDatabase& SchemaDatabase, const FMD5Hash& SchemaDatabaseHash = FMD5Hash());
+	static bool WriteToFile(const USchemaDatabase& SchemaDatabase, const FMD5Hash& SchemaDatabaseHash, const FString& Filename);
+
+	// Returns the path of the baked database that sits next to the SchemaDatabase asset.
+	static FString GetDefaultFilename();
+
+	// Returns the path of the SchemaDatabase asset's package file. It is only on disk in the editor and uncooked builds.
+	static FString GetSchemaDatabaseAssetFilename();
+
+	// Memory-maps the file if the platform supports it, otherwise reads it into memory.
+	bool LoadFromFile(const FString& Filename);
+	bool LoadFromMemory(TArray<uint8>&& Data);
+	void Reset();
+
+	bool IsLoaded() const { return Data != nullptr; }
+	uint32 GetSize() const { return Size; }
+	const FHeader& GetHeader() const { check(IsLoaded()); return *reinterpret_cast<const FHeader*>(Data); }
+
+	// Whether the database was baked from the SchemaDatabase asset with this package file hash.
+	bool IsBakedFrom(const FMD5Hash& SchemaDatabaseHash) const;
+
+	// Returns a pointer to SCHEMA_Count component IDs, or nullptr if the class is not an Actor class in the database.
+	const uint32* FindActorSchemaComponents(const FString& ClassPath) const;
+	const FActorRecord* FindActor(const FString& ClassPath) const;
+	const FSubobjectClassRecord* FindSubobjectClass(const FString& ClassPath) const;
+	bool ContainsClassPath(const FString& ClassPath) const;
+
+	// Iterates the paths of all Actor classes, then all Subobject classes.
+	void ForEachClassPath(TFunctionRef<void(const FString&)> Callback) const;
+
+	// Iterates the default subobjects of an Actor class, or the dynamic subobject components of a Subobject class.
+	void ForEachActorSubobject(const FActorRecord& Actor, TFunctionRef<void(const FActorSubobjectRecord&)> Callback) const;
+	void ForEachDynamicSubobject(const FSubobjectClassRecord& SubobjectClass, TFunctionRef<void(const FDynamicSubobjectRecord&)> Callback) const;
+
+	bool FindClassPathForComponentId(Worker_ComponentId ComponentId, FString& OutClassPath) const;
+	uint32 FindComponentIdForLevelPath(const FString& LevelPath) const;
+	bool IsLevelComponent(Worker_ComponentId ComponentId) const;
+	void ForEachLevelComponentId(TFunctionRef<void(Worker_ComponentId)> Callback) const;
+
+	FString GetString(uint32 StringId) const;
+	FName GetName(uint32 StringId) const;
+
+	// Hash used for all path keys. Case-insensitive over ASCII to match the FString keys in USchemaDatabase,
+	// and stable across platforms so the editor and cooked workers agree.
+	static uint64 HashPath(const ANSICHAR* Path, int32 Length);
+
+private:
+	bool SetData(const uint8* InData, uint32 InSize);
+	bool Validate() const;
+	bool ValidateRecords() const;
+
+	template <typename T>
+	const T* GetArray(uint32 Offset) const { return reinterpret_cast<const T*>(Data + Offset); }
+
+	const FPathKey* FindPathKey(uint32 KeysOffset, uint32 NumKeys, const FString& Path) const;
+
+	const uint8* Data = nullptr;
+	uint32 Size = 0;
+
+	TArray<uint8> OwnedData;
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,87 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SpatialConstants.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+struct FClassInfo;
+
+namespace SpatialGDK
+{
+
+// What USpatialClassInfoManager knows about a schema component: the class info it belongs to, the offset of the
+// subobject it replicates (0 for actors) and which of the class's schema components it is.
+//
+// Entries are 16 bytes, so four share a cache line.
+struct FComponentInfo
+{
+	ESchemaComponentType GetCategory() const { return static_cast<ESchemaComponentType>(Category); }
+	bool HasClassInfo() const { return ClassInfo != nullptr; }
+
+	const FClassInfo* ClassInfo = nullptr;
+	uint32 Offset = 0;
+	int16 Category = SCHEMA_Invalid;
+	bool bIsSublevel = false;
+};
+
+static_assert(sizeof(FComponentInfo) == 16, "FComponentInfo should stay small enough for four to share a cache line");
+
+// Lookup table from component ID to FComponentInfo, consulted for almost every op a worker receives.
+//
+// Generated component IDs are handed out contiguously from SpatialConstants::STARTING_GENERATED_COMPONENT_ID, so they
+// index straight into a dense array sized from the schema database's NextAvailableComponentId. Anything outside that
+// range, such as components added after the table was sized, goes into a sparse map.
+class SPATIALGDK_API FComponentInfoTable
+{
+public:
+	// Sizes the dense range as [FirstComponentId, EndComponentId), clearing all entries.
+	void Init(Worker_ComponentId FirstComponentId, Worker_ComponentId EndComponentId);
+	void Empty();
+
+	// Replaces any class info previously set for the component. The table keeps the class info alive until then.
+	void SetClassInfo(Worker_ComponentId ComponentId, const TSharedRef<const FClassInfo>& ClassInfo, uint32 Offset, ESchemaComponentType Category);
+	void MarkSublevel(Worker_ComponentId ComponentId);
+
+	// Returns nullptr if nothing is known about the component.
+	FORCEINLINE const FComponentInfo* Find(Worker_ComponentId ComponentId) const
+	{
+		const uint32 DenseIndex = ComponentId - FirstDenseComponentId;
+		if (DenseIndex < static_cast<uint32>(DenseInfos.Num()))
+		{
+			return &DenseInfos[DenseIndex];
+		}
+
+		return SparseInfos.Find(ComponentId);
+	}
+
+	// Returns nullptr if no class info has been set for the component.
+	FORCEINLINE const FComponentInfo* FindClassInfo(Worker_ComponentId ComponentId) const
+	{
+		const FComponentInfo* Info = Find(ComponentId);
+		return Info != nullptr && Info->HasClassInfo() ? Info : nullptr;
+	}
+
+	FORCEINLINE bool IsSublevel(Worker_ComponentId ComponentId) const
+	{
+		const FComponentInfo* Info = Find(ComponentId);
+		return Info != nullptr && Info->bIsSublevel;
+	}
+
+	int32 GetNumDense() const { return DenseInfos.Num(); }
+	int32 GetNumSparse() const { return SparseInfos.Num(); }
+
+private:
+	FComponentInfo& FindOrAdd(Worker_ComponentId ComponentId);
+
+	Worker_ComponentId FirstDenseComponentId = 0;
+	TArray<FComponentInfo> DenseInfos;
+	TMap<Worker_ComponentId, FComponentInfo> SparseInfos;
+
+	// Owning references to the class infos in the entries above, kept out of the entries so they stay small.
+	TMap<Worker_ComponentId, TSharedRef<const FClassInfo>> ClassInfoOwners;
+};
+
+} // namespace SpatialGDK
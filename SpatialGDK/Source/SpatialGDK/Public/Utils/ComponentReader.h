@@ -4,9 +4,12 @@
 
 #include "EngineClasses/SpatialNetBitReader.h"
 #include "Interop/SpatialReceiver.h"
+#include "Utils/PropertySerializationPlan.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatialComponentReader, All, All);
 
+class FSpatialConditionMapFilter;
+
 namespace SpatialGDK
 {
 
@@ -20,12 +23,15 @@ public:
 
 private:
 	void ApplySchemaObject(Schema_Object* ComponentObject, UObject* Object, USpatialActorChannel* Channel, bool bIsInitialData, const TArray<Schema_FieldId>& UpdatedIds, Worker_ComponentId ComponentId);
+	// Applies one schema field of a FastArraySerializer property: its full contents or snapshot, or the changes since the snapshot. See FSpatialFastArrayBaseline.
+	void ApplyFastArray(Schema_Object* ComponentObject, Schema_FieldId FieldId, UObject* Object, const FRepLayoutCmd& Cmd, const FRepParentCmd& Parent, UScriptStruct* NetDeltaStruct);
+	// Initial data leaves out properties equal to the baseline when bOmitDefaultPropertiesFromInitialData is set.
+	// They are restored here, as the object may have been reused or loaded with other values.
+	void RestoreOmittedProperties(UObject* Object, const FRepLayout& RepLayout, const FSpatialConditionMapFilter& ConditionMap, const TArray<Schema_FieldId>& UpdatedIds, Worker_ComponentId ComponentId);
 	void ApplyHandoverSchemaObject(Schema_Object* ComponentObject, UObject* Object, USpatialActorChannel* Channel, bool bIsInitialData, const TArray<Schema_FieldId>& UpdatedIds, Worker_ComponentId ComponentId);
 
-	void ApplyProperty(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, uint32 Index, UProperty* Property, uint8* Data, int32 Offset, int32 CmdIndex, int32 ParentIndex);
-	void ApplyArray(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, UArrayProperty* Property, uint8* Data, int32 Offset, int32 CmdIndex, int32 ParentIndex);
-
-	uint32 GetPropertyCount(const Schema_Object* Object, Schema_FieldId Id, UProperty* Property);
+	void ApplyProperty(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, uint32 Index, EPropertyOp Op, UProperty* Property, uint8* Data, int32 Offset, int32 CmdIndex, int32 ParentIndex);
+	void ApplyArray(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, const FPropertyPlanStep& Step, uint8* Data, int32 Offset, int32 CmdIndex, int32 ParentIndex);
 
 private:
 	class USpatialPackageMapClient* PackageMap;
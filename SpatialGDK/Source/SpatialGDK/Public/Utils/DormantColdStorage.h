@@ -0,0 +1,58 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "SpatialCommonTypes.h"
+#include "Utils/LatencyHistogram.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+class AActor;
+class UNetConnection;
+class UNetDriver;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogDormantColdStorage, Log, All);
+
+namespace SpatialGDK
+{
+
+// Releases the replication state of dormant actors.
+//
+// When an actor channel closes for dormancy, Unreal keeps the actor's FObjectReplicators (with their shadow buffers)
+// in the connection's DormantReplicatorMap, and the driver keeps an FRepChangelistState for every replicated object,
+// so that the channel can pick up where it left off when the actor wakes. For large numbers of long-lived dormant
+// props this state dominates server memory. Cold storage drops it and keeps only a small record per entity. When the
+// actor is flushed from dormancy, a fresh replicator is built from the actor, which costs one resend of its
+// non-default replicated properties.
+class SPATIALGDK_API FDormantColdStorage
+{
+public:
+	struct FRecord
+	{
+		TWeakObjectPtr<AActor> Actor;
+		double DormantSinceTime;
+		uint32 ReleasedBytes;
+	};
+
+	// Releases the state kept for Actor and its subobjects. Must be called after the actor's channel has been closed for dormancy.
+	void Store(Worker_EntityId EntityId, AActor* Actor, UNetConnection* NetConnection, UNetDriver* NetDriver);
+
+	// Called when the entity's actor channel has been recreated. Records how long rebuilding its replication state took.
+	void TrackWake(Worker_EntityId EntityId, double RebuildSeconds);
+
+	void Remove(Worker_EntityId EntityId);
+
+	bool Contains(Worker_EntityId EntityId) const { return Records.Contains(EntityId); }
+	int32 Num() const { return Records.Num(); }
+	uint64 GetReleasedBytes() const { return ReleasedBytes; }
+	FLatencyHistogram& GetWakeLatency() { return WakeLatency; }
+
+private:
+	TMap<Worker_EntityId_Key, FRecord> Records;
+	uint64 ReleasedBytes = 0;
+	FLatencyHistogram WakeLatency;
+};
+
+} // namespace SpatialGDK
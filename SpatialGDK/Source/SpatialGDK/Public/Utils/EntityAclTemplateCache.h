@@ -0,0 +1,72 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/BitArray.h"
+
+#include "Interop/SpatialClassInfoManager.h"
+#include "Utils/WorkerAttributeTable.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+// The parts of an actor entity's EntityAcl that only depend on its class and on which of the class's static subobjects exist.
+struct FEntityAclTemplate
+{
+	enum class EReadAcl : uint8
+	{
+		AnyServer,
+		AnyServerOrClient,
+		AnyServerOrOwningClient
+	};
+
+	// One bit per entry of the class's FClassInfo::SubobjectInfo, in iteration order.
+	TBitArray<> PresentSubobjects;
+
+	EReadAcl ReadAcl = EReadAcl::AnyServerOrClient;
+
+	// Index into FEntityAclTemplateCache's attribute table of the worker type authoritative over the class.
+	int32 AuthoritativeAttribute = 0;
+
+	// Components writable by the authoritative worker, and by the owning client only.
+	TArray<Worker_ComponentId> AuthoritativeComponents;
+	TArray<Worker_ComponentId> OwningClientComponents;
+
+	// All components above, so that per-entity extras can skip ones already present.
+	TSet<Worker_ComponentId> Components;
+};
+
+// Builds EntityAcl data for newly created actor entities from per-class templates.
+//
+// Working out the read and write ACLs of an entity walks every schema component of its class and subobjects and copies
+// worker attributes into nested arrays, which is a significant part of entity creation cost when spawning many actors of
+// the same classes. The cache does that once per class and set of present static subobjects, substituting only the owning
+// client's attribute per entity. Attributes are interned in FWorkerAttributeTable, so their UTF-8 encoding is reused, and
+// each is written into an entity's data once, with every requirement set that uses it sharing that copy.
+class SPATIALGDK_API FEntityAclTemplateCache
+{
+public:
+	void Init(const TArray<FName>& ServerWorkerTypes);
+
+	const FEntityAclTemplate& GetOrCreateTemplate(UClass* Class, const FClassInfo& Info, const TBitArray<>& PresentSubobjects);
+
+	// ExtraAuthoritativeComponents are added to the template's authoritative components, such as those of dynamic subobjects.
+	Worker_ComponentData CreateEntityAclData(const FEntityAclTemplate& Template, const FString& OwnerAttribute, const TArray<Worker_ComponentId>& ExtraAuthoritativeComponents) const;
+
+	int32 Num() const;
+	void Empty();
+
+private:
+	int32 FindOrAddAttribute(const FString& Attribute);
+
+	// Worker attributes used by templates. Index 0 is the client worker type, followed by the server worker types.
+	TArray<FWorkerAttributeHandle> Attributes;
+	int32 NumServerAttributes = 0;
+
+	TMap<TWeakObjectPtr<UClass>, TArray<FEntityAclTemplate>> Templates;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,46 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace SpatialGDK
+{
+
+// Bump allocator for byte buffers that only live until the end of the frame, such as packed RPC payloads waiting for
+// FlushPackedRPCs. Memory is handed out from a few large blocks which are kept across Reset, so once the arena has grown
+// to a frame's worth of data, allocating from it doesn't touch the heap.
+class SPATIALGDK_API FFrameArena
+{
+public:
+	explicit FFrameArena(int32 InBlockSize = 64 * 1024);
+
+	// Returns NumBytes of uninitialized memory, valid until the next Reset.
+	uint8* Allocate(int32 NumBytes);
+
+	TArrayView<const uint8> Copy(const uint8* Data, int32 NumBytes);
+
+	// Releases everything allocated since the last reset, keeping the blocks for the next frame.
+	void Reset();
+
+	// Bytes allocated since the last reset.
+	int32 GetBytesAllocated() const { return BytesAllocated; }
+
+	// Most bytes allocated between two resets since the last call, and blocks allocated from the heap since the last call.
+	void ConsumeStats(int32& OutHighWaterMark, int32& OutBlocksAllocated);
+
+	int32 GetReservedBytes() const;
+
+private:
+	int32 BlockSize;
+
+	TArray<TArray<uint8>> Blocks;
+	int32 CurrentBlock = 0;
+	int32 CurrentOffset = 0;
+
+	int32 BytesAllocated = 0;
+	int32 HighWaterMark = 0;
+	int32 BlocksAllocated = 0;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,22 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Utils/RepDataUtils.h"
+
+struct FHandoverPropertyInfo;
+
+namespace SpatialGDK
+{
+
+// Shadow data holds the values of an object's handover properties as they were last sent, so that only changed
+// properties are sent. Static arrays are laid out whole at their first element.
+SPATIALGDK_API void InitializeHandoverShadowData(const TArray<FHandoverPropertyInfo>& HandoverProperties, TArray<uint8>& ShadowData);
+
+// Returns the handles of the handover properties of Object that differ from the shadow data, or all of them if bForceAll
+// is set, and copies their values into the shadow data. Plain old data properties are compared and copied as raw memory.
+SPATIALGDK_API FHandoverChangeState GetHandoverChangeList(const TArray<FHandoverPropertyInfo>& HandoverProperties, TArray<uint8>& ShadowData, const uint8* Object, bool bForceAll);
+
+} // namespace SpatialGDK
@@ -0,0 +1,49 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+// Tracks heartbeat timeouts for many PlayerController entities with a single timing wheel.
+//
+// Time is divided into ticks of Resolution seconds, and each entity is kept in the slot for the tick its timeout
+// expires on. Refreshing an entity only updates its deadline and appends it to the new slot; the copy in the old
+// slot is dropped when that slot is next advanced over. Timeouts fire no earlier than TimeoutSeconds after the
+// last refresh, and at most one tick later.
+class SPATIALGDK_API FHeartbeatTimingWheel
+{
+public:
+	FHeartbeatTimingWheel();
+
+	void Init(float InTimeoutSeconds, float InResolutionSeconds, double CurrentTime);
+
+	// Starts tracking the entity, or pushes its timeout back if it is already tracked.
+	void Refresh(Worker_EntityId EntityId, double CurrentTime);
+	void Remove(Worker_EntityId EntityId);
+
+	// Adds the entities that timed out by CurrentTime to OutTimedOut, and stops tracking them.
+	void Advance(double CurrentTime, TArray<Worker_EntityId>& OutTimedOut);
+
+	bool Contains(Worker_EntityId EntityId) const { return Deadlines.Contains(EntityId); }
+	int32 Num() const { return Deadlines.Num(); }
+
+private:
+	int64 GetTick(double Time) const;
+
+	float TimeoutSeconds;
+	float ResolutionSeconds;
+	double StartTime;
+
+	// The last tick that was advanced over.
+	int64 CurrentTick;
+
+	TArray<TArray<Worker_EntityId>> Slots;
+	TMap<Worker_EntityId, int64> Deadlines;
+};
+
+} // namespace SpatialGDK
@@ -26,10 +26,11 @@ public:
 	Worker_ComponentData CreateInterestData() const;
 	Worker_ComponentUpdate CreateInterestUpdate() const;
 
+	Interest CreateInterest() const;
+
 	static Interest CreateServerWorkerInterest();
 
 private:
-	Interest CreateInterest() const;
 
 	// Only uses Defined Constraint
 	Interest CreateActorInterest() const;
@@ -0,0 +1,66 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Interop/Connection/OutgoingMessages.h"
+
+namespace SpatialGDK
+{
+
+// A point-in-time copy of an FLatencyHistogram, used for percentile queries and export.
+struct SPATIALGDK_API FLatencyHistogramSnapshot
+{
+	TArray<uint32> Counts;
+	uint64 TotalCount = 0;
+	uint64 SumMicroseconds = 0;
+	uint64 MaxMicroseconds = 0;
+
+	// Returns the latency, in seconds, below which the given fraction (0-1) of samples fall.
+	double GetPercentile(double Fraction) const;
+	double GetMeanSeconds() const;
+	double GetMaxSeconds() const { return MaxMicroseconds / 1e6; }
+
+	// Converts to the cumulative bucket format expected by the SpatialOS metrics API.
+	// Buckets are reported at power-of-two microsecond boundaries up to the largest recorded sample.
+	HistogramMetric ToHistogramMetric(const FString& Key) const;
+};
+
+// Fixed-size latency histogram with HDR-style logarithmic buckets.
+//
+// Samples are recorded in microseconds. Values below 8us get their own bucket; above that, every power of two is
+// split into 8 linear sub-buckets, which bounds the relative error of any percentile to 12.5% across the whole
+// range (1us to ~19 hours) in about 1KB of memory. Record() only uses atomic increments, so it is safe to call
+// concurrently from the game thread and the ops thread without locks. Drain() copies and resets the counts.
+class SPATIALGDK_API FLatencyHistogram
+{
+public:
+	static const int32 SubBucketBits = 3;
+	static const int32 SubBucketCount = 1 << SubBucketBits;
+	static const int32 MaxValueBits = 36;
+	static const int32 NumBuckets = SubBucketCount * (MaxValueBits - SubBucketBits + 1);
+
+	FLatencyHistogram();
+
+	// Not copyable, as it is shared between threads by reference.
+	FLatencyHistogram(const FLatencyHistogram&) = delete;
+	FLatencyHistogram& operator=(const FLatencyHistogram&) = delete;
+
+	void Record(double Seconds);
+	void RecordMicroseconds(uint64 Microseconds);
+
+	// Copies the current state into OutSnapshot and resets the histogram.
+	void Drain(FLatencyHistogramSnapshot& OutSnapshot);
+
+	static int32 GetBucketIndex(uint64 Microseconds);
+	static uint64 GetBucketLowerBound(int32 BucketIndex);
+	static uint64 GetBucketUpperBound(int32 BucketIndex);
+
+private:
+	volatile int32 Counts[NumBuckets];
+	volatile int64 SumMicroseconds;
+	volatile int64 MaxMicroseconds;
+};
+
+} // namespace SpatialGDK
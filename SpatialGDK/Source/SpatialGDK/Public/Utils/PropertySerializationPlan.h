@@ -0,0 +1,101 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+class FRepLayout;
+class UProperty;
+
+namespace SpatialGDK
+{
+
+// How a property is written to and read from schema. Chosen once per property when its class info is created, so that
+// serializing an update switches on this instead of casting the property to each property type in turn.
+enum class EPropertyOp : uint8
+{
+	Bool,
+	Float,
+	Double,
+	Int8,
+	Int16,
+	Int32,
+	Int64,
+	Byte,
+	UInt16,
+	UInt32,
+	UInt64,
+	// Enums narrower than 32 bits, which are sent as uint32 whatever their underlying type. Wider enums use the op of their underlying type.
+	SmallEnum,
+	Name,
+	String,
+	Text,
+	Object,
+	// Structs with a native NetSerialize.
+	NetSerializeStruct,
+	// Other structs, serialized through their own rep layout.
+	Struct,
+	// Each element is serialized with the step's ElementOp.
+	DynamicArray,
+	// Delegates and interfaces, which can be marked as replicated but aren't sent over the network.
+	Ignored,
+	Unsupported,
+};
+
+// One entry of a serialization plan.
+//
+// Static arrays take one step per element, each with its own offset, as replication and handover give each element its
+// own handle. Nested structs without a native NetSerialize are flattened into their members by the rep layout, so only
+// structs that are replicated as a whole get a struct op.
+struct FPropertyPlanStep
+{
+	UProperty* Property = nullptr;
+
+	// For dynamic arrays, the array's inner property. Otherwise the same as Property.
+	UProperty* ElementProperty = nullptr;
+
+	int32 Offset = 0;
+	int32 ElementSize = 0;
+	EPropertyOp Op = EPropertyOp::Unsupported;
+	EPropertyOp ElementOp = EPropertyOp::Unsupported;
+};
+
+// The steps for the properties of a class, indexed by handle - 1 so that a field ID leads straight to its step.
+struct SPATIALGDK_API FPropertySerializationPlan
+{
+	void CompileReplicated(const FRepLayout& RepLayout);
+
+	const FPropertyPlanStep* FindReplicated(uint32 Handle) const
+	{
+		return Handle - 1 < static_cast<uint32>(Replicated.Num()) ? &Replicated[Handle - 1] : nullptr;
+	}
+
+	const FPropertyPlanStep* FindHandover(uint32 Handle) const
+	{
+		return Handle - 1 < static_cast<uint32>(Handover.Num()) ? &Handover[Handle - 1] : nullptr;
+	}
+
+	// Returns the step for a rep layout command, compiling one into OutFallback if the plan was compiled for another rep layout.
+	const FPropertyPlanStep& FindReplicatedOrCompile(uint32 Handle, UProperty* Property, int32 Offset, FPropertyPlanStep& OutFallback) const;
+
+	TArray<FPropertyPlanStep> Replicated;
+	TArray<FPropertyPlanStep> Handover;
+};
+
+SPATIALGDK_API EPropertyOp GetPropertyOp(UProperty* Property);
+SPATIALGDK_API FPropertyPlanStep CompilePropertyStep(UProperty* Property, int32 Offset);
+
+// Ops that only need the property's value, as opposed to objects, structs and arrays, which need a package map or recurse.
+FORCEINLINE bool IsPrimitivePropertyOp(EPropertyOp Op)
+{
+	return Op <= EPropertyOp::Text;
+}
+
+// Interpreters for primitive ops, shared by ComponentFactory and ComponentReader.
+SPATIALGDK_API void AddPrimitiveToSchema(Schema_Object* Object, Schema_FieldId FieldId, EPropertyOp Op, UProperty* Property, const uint8* Data);
+SPATIALGDK_API void ApplyPrimitiveFromSchema(const Schema_Object* Object, Schema_FieldId FieldId, uint32 Index, EPropertyOp Op, UProperty* Property, uint8* Data);
+SPATIALGDK_API uint32 GetSchemaCountForOp(const Schema_Object* Object, Schema_FieldId FieldId, EPropertyOp Op);
+
+} // namespace SpatialGDK
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "GameFramework/Actor.h"
 #include "HAL/Platform.h"
 #include "Net/RepLayout.h"
 
@@ -157,6 +158,76 @@ inline void ReadStructProperty(FSpatialNetBitReader& Reader, UStructProperty* Pr
 	}
 }
 
+// The object whose property values are omitted from initial data when bOmitDefaultPropertiesFromInitialData is set, and restored
+// from on receipt. This is the class default, or the matching subobject of the owning actor's class default, rather than the
+// archetype, as an actor spawned from a template has a different archetype on the workers that check it out.
+inline UObject* GetInitialDataBaseline(UObject* Object)
+{
+	UClass* Class = Object->GetClass();
+
+	if (Object->IsDefaultSubobject())
+	{
+		if (AActor* Owner = Cast<AActor>(Object->GetOuter()))
+		{
+			UObject* OwnerDefault = Owner->GetClass()->GetDefaultObject();
+			UObject* DefaultSubobject = OwnerDefault->GetDefaultSubobjectByName(Object->GetFName());
+			if (DefaultSubobject != nullptr && DefaultSubobject->GetClass() == Class)
+			{
+				return DefaultSubobject;
+			}
+		}
+	}
+
+	return Class->GetDefaultObject();
+}
+
+// Whether a top-level replicated property may be omitted from initial data when it equals the baseline's value.
+// Dynamic arrays keep their element handles in the changelist and roles are swapped on receipt, so both are always sent.
+inline bool CanOmitPropertyFromInitialData(const FRepLayout& RepLayout, const FRepLayoutCmd& Cmd)
+{
+	return Cmd.Type != ERepLayoutCmdType::DynamicArray && Cmd.Type != ERepLayoutCmdType::Return && RepLayout.Parents[Cmd.ParentIndex].RoleSwapIndex == -1;
+}
+
+// Whether a top-level replicated property is left out of initial data, given the baseline from GetInitialDataBaseline.
+inline bool IsPropertyOmittedFromInitialData(const FRepLayout& RepLayout, const FRepLayoutCmd& Cmd, const uint8* Data, const uint8* Baseline)
+{
+	return CanOmitPropertyFromInitialData(RepLayout, Cmd) && Cmd.Property->Identical(Data + Cmd.Offset, Baseline + Cmd.Offset);
+}
+
+// Copies the properties that may have been left out of Object's initial data back from its baseline. These are the top-level
+// properties that can be omitted, weren't among the received handles, and for whose parent ShouldRestore returns true.
+template <typename TShouldRestore>
+void RestoreOmittedProperties(const FRepLayout& RepLayout, UObject* Object, const TArray<uint32>& ReceivedHandles, TShouldRestore&& ShouldRestore)
+{
+	const uint8* Baseline = (const uint8*)GetInitialDataBaseline(Object);
+	const int32 HandleCount = RepLayout.BaseHandleToCmdIndex.Num();
+
+	TBitArray<> Received(false, HandleCount + 1);
+	for (uint32 Handle : ReceivedHandles)
+	{
+		if ((int32)Handle <= HandleCount)
+		{
+			Received[Handle] = true;
+		}
+	}
+
+	for (int32 Handle = 1; Handle <= HandleCount; Handle++)
+	{
+		if (Received[Handle])
+		{
+			continue;
+		}
+
+		const FRepLayoutCmd& Cmd = RepLayout.Cmds[RepLayout.BaseHandleToCmdIndex[Handle - 1].CmdIndex];
+		if (!CanOmitPropertyFromInitialData(RepLayout, Cmd) || !ShouldRestore(RepLayout.Parents[Cmd.ParentIndex]))
+		{
+			continue;
+		}
+
+		Cmd.Property->CopySingleValue((uint8*)Object + Cmd.Offset, Baseline + Cmd.Offset);
+	}
+}
+
 inline TArray<UFunction*> GetClassRPCFunctions(const UClass* Class)
 {
 	// Get all remote functions from the class. This includes parents super functions and child override functions.
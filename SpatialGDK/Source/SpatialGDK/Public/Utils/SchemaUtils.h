@@ -66,6 +66,19 @@ inline TArray<uint8> GetBytesFromSchema(const Schema_Object* Object, Schema_Fiel
 	return IndexBytesFromSchema(Object, Id, 0);
 }
 
+// Views into the schema object's own buffer. Only valid while the schema object is alive, which for received data is
+// until the op list is destroyed, so copy the bytes into a TArray if they need to be kept past the op.
+inline TArrayView<const uint8> IndexBytesViewFromSchema(const Schema_Object* Object, Schema_FieldId Id, uint32 Index)
+{
+	int32 PayloadSize = (int32)Schema_IndexBytesLength(Object, Id, Index);
+	return TArrayView<const uint8>((const uint8*)Schema_IndexBytes(Object, Id, Index), PayloadSize);
+}
+
+inline TArrayView<const uint8> GetBytesViewFromSchema(const Schema_Object* Object, Schema_FieldId Id)
+{
+	return IndexBytesViewFromSchema(Object, Id, 0);
+}
+
 inline void AddWorkerRequirementSetToSchema(Schema_Object* Object, Schema_FieldId Id, const WorkerRequirementSet& Value)
 {
 	Schema_Object* RequirementSetObject = Schema_AddObject(Object, Id);
@@ -4,7 +4,9 @@
 
 #include "CoreMinimal.h"
 
+#include "HAL/FileManager.h"
 #include "SpatialConstants.h"
+#include "Utils/LatencyHistogram.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
 #include <WorkerSDK/improbable/c_worker.h>
@@ -45,6 +47,11 @@ public:
 
 	void TrackSentRPC(UFunction* Function, ESchemaComponentType RPCType, int PayloadSize);
 
+	// Latency tracking. These are recorded into fixed-size histograms and reported as percentiles in TickMetrics.
+	void TrackOpListProcessingTime(double Seconds);
+	void TrackCreateEntityResponse(Worker_RequestId RequestId);
+	void TrackCommandResponse(Worker_RequestId RequestId);
+
 	void HandleWorkerMetrics(Worker_Op* Op);
 
 	// The user can bind their own delegate to handle worker metrics.
@@ -78,5 +85,15 @@ private:
 	TMap<FString, RPCStat> RecentRPCs;
 	bool bRPCTrackingEnabled;
 	float RPCTrackingStartTime;
+
+	void ReportLatency(SpatialGDK::FLatencyHistogram& Histogram, const FString& Key, SpatialGDK::SpatialMetrics& OutMetrics);
+	void WriteLatencyToFile(const FString& Key, const SpatialGDK::FLatencyHistogramSnapshot& Snapshot);
+
+	SpatialGDK::FLatencyHistogram OpListProcessingLatency;
+	SpatialGDK::FLatencyHistogram CreateEntityLatency;
+	SpatialGDK::FLatencyHistogram CommandResponseLatency;
+
+	// Opened on the first report when bWriteLatencyHistogramsToFile is set.
+	TUniquePtr<FArchive> LatencyFile;
 };
 
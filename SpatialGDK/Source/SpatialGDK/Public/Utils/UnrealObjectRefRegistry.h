@@ -0,0 +1,64 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/NetworkGuid.h"
+
+#include "Schema/UnrealObjectRef.h"
+#include "SpatialCommonTypes.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+// The mapping between NetGUIDs and the object refs that name them, used by FSpatialNetGUIDCache.
+//
+// A NetGUID maps to one object ref, but several object refs can map to the same NetGUID, such as the entity ID and stable
+// name of a startup actor. Every mapping added for an entity is also recorded against that entity, so that removing the
+// entity only visits its own refs, without needing its class info or building stably named refs to look them up.
+class SPATIALGDK_API FUnrealObjectRefRegistry
+{
+public:
+	// Maps NetGUID to ObjectRef and ObjectRef to NetGUID, replacing the ref NetGUID mapped to before.
+	void Register(const FNetworkGUID& NetGUID, const FUnrealObjectRef& ObjectRef);
+
+	// Maps another ObjectRef to NetGUID without changing the ref NetGUID maps to. The alias is removed with OwningEntityId.
+	void AddAlias(const FUnrealObjectRef& ObjectRef, const FNetworkGUID& NetGUID, Worker_EntityId OwningEntityId);
+
+	// Removes ObjectRef and the ref its NetGUID maps to, along with the NetGUID's other refs recorded against that entity.
+	void Unregister(const FUnrealObjectRef& ObjectRef);
+
+	// Removes ObjectRef's NetGUID along with every ref that maps to it.
+	void RemoveNetGUIDOf(const FUnrealObjectRef& ObjectRef);
+
+	// Removes everything registered for the entity: its actor, its subobjects and their aliases.
+	void RemoveEntity(Worker_EntityId EntityId);
+
+	const FUnrealObjectRef* FindObjectRef(const FNetworkGUID& NetGUID) const { return NetGUIDToUnrealObjectRef.Find(NetGUID); }
+	const FNetworkGUID* FindNetGUID(const FUnrealObjectRef& ObjectRef) const { return UnrealObjectRefToNetGUID.Find(ObjectRef); }
+
+	int32 NumNetGUIDs() const { return NetGUIDToUnrealObjectRef.Num(); }
+	int32 NumObjectRefs() const { return UnrealObjectRefToNetGUID.Num(); }
+	int32 NumEntities() const { return EntityRefs.Num(); }
+
+private:
+	struct FEntityRef
+	{
+		FNetworkGUID NetGUID;
+		FUnrealObjectRef ObjectRef;
+
+		bool operator==(const FEntityRef& Other) const { return NetGUID == Other.NetGUID && ObjectRef == Other.ObjectRef; }
+	};
+
+	void AddEntityRef(Worker_EntityId EntityId, const FNetworkGUID& NetGUID, const FUnrealObjectRef& ObjectRef);
+	void RemoveMapping(const FEntityRef& EntityRef);
+
+	TMap<FNetworkGUID, FUnrealObjectRef> NetGUIDToUnrealObjectRef;
+	TMap<FUnrealObjectRef, FNetworkGUID> UnrealObjectRefToNetGUID;
+
+	TMap<Worker_EntityId_Key, TArray<FEntityRef>> EntityRefs;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,91 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "SpatialCommonTypes.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+// Small integer handles to worker attributes and requirement sets interned in FWorkerAttributeTable.
+// Equal attributes, and equal requirement sets, always have the same handle, so they can be compared as integers.
+using FWorkerAttributeHandle = uint32;
+using FRequirementSetHandle = uint32;
+using FInternedWriteAclMap = TMap<Worker_ComponentId, FRequirementSetHandle>;
+
+// Interns worker attributes and requirement sets, so that EntityAcl components hold handles instead of nested arrays of strings.
+//
+// Each attribute is stored once, along with its UTF-8 encoding, so writing it to schema doesn't convert it again and
+// reading it from schema doesn't create a string unless it hasn't been seen before. Requirement sets are immutable and
+// shared by every ACL that uses them. Neither is ever removed: a deployment only has as many distinct attributes as it
+// has worker types and connected workers, and only a few distinct requirement sets per attribute.
+//
+// Only used on the game thread.
+class SPATIALGDK_API FWorkerAttributeTable
+{
+public:
+	// The requirement set with no attribute sets.
+	static const FRequirementSetHandle EmptyRequirementSet = 0;
+
+	static FWorkerAttributeTable& Get();
+
+	FWorkerAttributeTable();
+
+	FWorkerAttributeHandle InternAttribute(const FString& Attribute);
+	FWorkerAttributeHandle InternAttribute(const ANSICHAR* UTF8Chars, int32 Length);
+
+	// The requirement set satisfied only by workers with Attribute, such as a worker type or a client's worker ID.
+	FRequirementSetHandle InternRequirementSet(FWorkerAttributeHandle Attribute);
+	// Each inner array is an attribute set, all of whose attributes a worker needs to satisfy it.
+	FRequirementSetHandle InternRequirementSet(const TArray<TArray<FWorkerAttributeHandle>>& AttributeSets);
+	FRequirementSetHandle InternRequirementSet(const WorkerRequirementSet& RequirementSet);
+
+	const FString& GetAttribute(FWorkerAttributeHandle Attribute) const { return Attributes[Attribute].String; }
+	const TArray<ANSICHAR>& GetAttributeUTF8(FWorkerAttributeHandle Attribute) const { return Attributes[Attribute].UTF8; }
+
+	const TArray<TArray<FWorkerAttributeHandle>>& GetAttributeSets(FRequirementSetHandle RequirementSet) const { return RequirementSets[RequirementSet].AttributeSets; }
+	WorkerRequirementSet ToWorkerRequirementSet(FRequirementSetHandle RequirementSet) const;
+
+	// True if any attribute in the requirement set is one of WorkerAttributes.
+	bool ContainsAnyAttribute(FRequirementSetHandle RequirementSet, const TArray<FString>& WorkerAttributes) const;
+
+	void AddRequirementSetToSchema(Schema_Object* Object, Schema_FieldId Id, FRequirementSetHandle RequirementSet) const;
+	FRequirementSetHandle GetRequirementSetFromSchema(Schema_Object* Object, Schema_FieldId Id);
+
+	int32 NumAttributes() const { return Attributes.Num(); }
+	int32 NumRequirementSets() const { return RequirementSets.Num(); }
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	// Requirement sets are looked up by their attribute sets flattened into one array: the number of attribute sets,
+	// then for each attribute set its number of attributes followed by its attributes.
+	using FRequirementSetKey = TArray<FWorkerAttributeHandle, TInlineAllocator<16>>;
+
+	struct FAttribute
+	{
+		FString String;
+		TArray<ANSICHAR> UTF8;
+	};
+
+	struct FRequirementSet
+	{
+		TArray<FWorkerAttributeHandle> Key;
+		TArray<TArray<FWorkerAttributeHandle>> AttributeSets;
+	};
+
+	FRequirementSetHandle FindOrAddRequirementSet(const FRequirementSetKey& Key);
+
+	TArray<FAttribute> Attributes;
+	TArray<FRequirementSet> RequirementSets;
+
+	// Keyed by a hash of the UTF-8 attribute and of the requirement set key. Worker attributes are case sensitive, unlike FString keys.
+	TMultiMap<uint32, FWorkerAttributeHandle> AttributeLookup;
+	TMultiMap<uint32, FRequirementSetHandle> RequirementSetLookup;
+};
+
+} // namespace SpatialGDK
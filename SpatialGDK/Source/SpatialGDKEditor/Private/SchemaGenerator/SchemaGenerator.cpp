@@ -8,10 +8,12 @@
 #include "UObject/TextProperty.h"
 
 #include "Interop/SpatialClassInfoManager.h"
+#include "SpatialConstants.h"
 #include "SpatialGDKSettings.h"
 #include "Utils/CodeWriter.h"
 #include "Utils/ComponentIdGenerator.h"
 #include "Utils/DataTypeUtilities.h"
+#include "Utils/RepLayoutUtils.h"
 #include "SpatialGDKEditorSchemaGenerator.h"
 
 using namespace SpatialGDKEditor::Schema;
@@ -123,6 +125,17 @@ void WriteSchemaRepField(FCodeWriter& Writer, const TSharedPtr<FUnrealProperty>
 		*SchemaFieldName(RepProp),
 		FieldCounter
 	);
+
+	// Fast arrays replicated as changes keep a full snapshot for workers checking the entity out. See FSpatialFastArrayBaseline.
+	// The field is always generated so that schema doesn't depend on the setting.
+	UArrayProperty* ArrayProperty = Cast<UArrayProperty>(RepProp->Property);
+	if (ArrayProperty != nullptr && SpatialGDK::GetFastArraySerializerProperty(ArrayProperty) != nullptr)
+	{
+		Writer.Printf("bytes {0}_baseline = {1};",
+			*SchemaFieldName(RepProp),
+			FieldCounter + SpatialConstants::FAST_ARRAY_BASELINE_FIELD_ID_OFFSET
+		);
+	}
 }
 
 void WriteSchemaHandoverField(FCodeWriter& Writer, const TSharedPtr<FUnrealProperty> HandoverProp, const int FieldCounter)
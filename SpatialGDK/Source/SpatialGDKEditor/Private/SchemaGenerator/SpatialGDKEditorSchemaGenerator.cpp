@@ -32,6 +32,7 @@
 #include "TypeStructure.h"
 #include "UObject/StrongObjectPtr.h"
 #include "Utils/CodeWriter.h"
+#include "Utils/CompactSchemaDatabase.h"
 #include "Utils/ComponentIdGenerator.h"
 #include "Utils/DataTypeUtilities.h"
 #include "Utils/SchemaDatabase.h"
@@ -412,7 +413,8 @@ bool SaveSchemaDatabase(const FString& PackagePath)
 	Package->GetMetaData();
 
 	FString FilePath = FString::Printf(TEXT("%s%s"), *PackagePath, *FPackageName::GetAssetPackageExtension());
-	bool bSuccess = UPackage::SavePackage(Package, SchemaDatabase, EObjectFlags::RF_Public | EObjectFlags::RF_Standalone, *FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension()), GError, nullptr, false, true, SAVE_NoError);
+	const FString PackageFilename = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
+	bool bSuccess = UPackage::SavePackage(Package, SchemaDatabase, EObjectFlags::RF_Public | EObjectFlags::RF_Standalone, *PackageFilename, GError, nullptr, false, true, SAVE_NoError);
 
 	if (!bSuccess)
 	{
@@ -421,7 +423,10 @@ bool SaveSchemaDatabase(const FString& PackagePath)
 		FMessageDialog::Debugf(FText::FromString(FString::Printf(TEXT("Unable to save Schema Database to '%s'! The file may be locked by another process."), *FullPath)));
 		return false;
 	}
-	return true;
+
+	// The asset stays the source of truth; the compact copy is what workers load at startup. It records the hash of the saved
+	// package so that workers can tell when it no longer matches the asset.
+	return SpatialGDK::FCompactSchemaDatabase::WriteToFile(*SchemaDatabase, FMD5Hash::HashFile(*PackageFilename), SpatialGDK::FCompactSchemaDatabase::GetDefaultFilename());
 }
 
 bool IsSupportedClass(const UClass* SupportedClass)
@@ -670,6 +675,14 @@ bool DeleteSchemaDatabase(const FString& PackagePath)
 		}
 	}
 
+	// Don't leave a stale compact database behind for workers to pick up.
+	const FString CompactDatabasePath = SpatialGDK::FCompactSchemaDatabase::GetDefaultFilename();
+	if (FPlatformFileManager::Get().GetPlatformFile().FileExists(*CompactDatabasePath) && !FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*CompactDatabasePath))
+	{
+		UE_LOG(LogSpatialGDKSchemaGenerator, Error, TEXT("Unable to delete compact schema database at %s"), *CompactDatabasePath);
+		return false;
+	}
+
 	return true;
 }
 
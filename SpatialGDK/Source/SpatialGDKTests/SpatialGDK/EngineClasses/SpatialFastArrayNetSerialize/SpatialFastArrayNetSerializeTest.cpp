@@ -0,0 +1,306 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestDefinitions.h"
+#include "TestFastArray.h"
+
+#include "EngineClasses/SpatialFastArrayNetSerialize.h"
+#include "EngineClasses/SpatialNetBitReader.h"
+#include "EngineClasses/SpatialNetBitWriter.h"
+#include "EngineClasses/SpatialNetDriver.h"
+#include "SpatialConstants.h"
+#include "SpatialGDKSettings.h"
+#include "Utils/SchemaUtils.h"
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+#define SPATIALFASTARRAYNETSERIALIZE_TEST(TestName) \
+	GDK_TEST(Core, FSpatialFastArrayNetSerialize, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	const Schema_FieldId TestFieldId = 1;
+	const Schema_FieldId TestBaselineFieldId = TestFieldId + SpatialConstants::FAST_ARRAY_BASELINE_FIELD_ID_OFFSET;
+
+	using FWrittenFields = TMap<Schema_FieldId, TArray<uint8>>;
+
+	// Turns on fast array delta replication for the lifetime of a test.
+	struct FDeltaReplicationScope
+	{
+		FDeltaReplicationScope()
+			: bWasEnabled(GetDefault<USpatialGDKSettings>()->bUseFastArrayDeltaReplication)
+		{
+			GetMutableDefault<USpatialGDKSettings>()->bUseFastArrayDeltaReplication = true;
+		}
+
+		~FDeltaReplicationScope()
+		{
+			GetMutableDefault<USpatialGDKSettings>()->bUseFastArrayDeltaReplication = bWasEnabled;
+		}
+
+		bool bWasEnabled;
+	};
+
+	UStructProperty* GetArrayProperty()
+	{
+		return FindField<UStructProperty>(UTestFastArrayObject::StaticClass(), GET_MEMBER_NAME_CHECKED(UTestFastArrayObject, Array));
+	}
+
+	// Writes the object's fast array the way ComponentFactory does, returning the bytes of each field written.
+	FWrittenFields WriteFields(USpatialNetDriver* NetDriver, UTestFastArrayObject* Object, FSpatialFastArrayBaseline& Baseline, bool bIsInitialData)
+	{
+		Schema_ComponentUpdate* Update = Schema_CreateComponentUpdate();
+		Schema_Object* Fields = Schema_GetComponentUpdateFields(Update);
+
+		FSpatialNetDeltaSerializeInfo::DeltaSerializeWriteWithBaseline(NetDriver, Fields, TestFieldId, Object, 0, GetArrayProperty(), FTestFastArray::StaticStruct(), Baseline, bIsInitialData);
+
+		FWrittenFields Written;
+		for (Schema_FieldId FieldId : { TestFieldId, TestBaselineFieldId })
+		{
+			if (Schema_GetBytesCount(Fields, FieldId) > 0)
+			{
+				Written.Add(FieldId, GetBytesFromSchema(Fields, FieldId));
+			}
+		}
+
+		Schema_DestroyComponentUpdate(Update);
+		return Written;
+	}
+
+	int32 FullStateBytes(USpatialNetDriver* NetDriver, UTestFastArrayObject* Object)
+	{
+		FSpatialNetBitWriter Writer(NetDriver->PackageMap);
+		FSpatialNetDeltaSerializeInfo::DeltaSerializeWrite(NetDriver, Writer, Object, 0, GetArrayProperty(), FTestFastArray::StaticStruct());
+		return Writer.GetNumBytes();
+	}
+
+	void ApplyField(USpatialNetDriver* NetDriver, UTestFastArrayObject* Object, const FWrittenFields& Fields, Schema_FieldId FieldId)
+	{
+		const TArray<uint8>* Bytes = Fields.Find(FieldId);
+		if (Bytes == nullptr || Bytes->Num() == 0)
+		{
+			return;
+		}
+
+		TArray<uint8> Data = *Bytes;
+		TSet<FUnrealObjectRef> UnresolvedRefs;
+		FSpatialNetBitReader Reader(NetDriver->PackageMap, Data.GetData(), Data.Num() * 8, UnresolvedRefs);
+		FSpatialNetDeltaSerializeInfo::DeltaSerializeRead(NetDriver, Reader, Object, 0, GetArrayProperty(), FTestFastArray::StaticStruct());
+	}
+
+	// Items are compared by ID, as removals on the receiving side don't keep the array's order.
+	bool ArraysMatch(const FTestFastArray& Expected, const FTestFastArray& Actual)
+	{
+		if (Expected.Items.Num() != Actual.Items.Num())
+		{
+			return false;
+		}
+
+		TMap<int32, int32> ExpectedValues;
+		for (const FTestFastArrayItem& Item : Expected.Items)
+		{
+			ExpectedValues.Add(Item.ReplicationID, Item.Value);
+		}
+
+		for (const FTestFastArrayItem& Item : Actual.Items)
+		{
+			const int32* Value = ExpectedValues.Find(Item.ReplicationID);
+			if (Value == nullptr || *Value != Item.Value)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void AddItem(FTestFastArray& Array, int32 Value)
+	{
+		FTestFastArrayItem& Item = Array.Items[Array.Items.AddDefaulted()];
+		Item.Value = Value;
+		Array.MarkItemDirty(Item);
+	}
+
+	void ChangeItem(FTestFastArray& Array, int32 Index, int32 Value)
+	{
+		Array.Items[Index].Value = Value;
+		Array.MarkItemDirty(Array.Items[Index]);
+	}
+
+	void RemoveItem(FTestFastArray& Array, int32 Index)
+	{
+		Array.Items.RemoveAt(Index);
+		Array.MarkArrayDirty();
+	}
+} // anonymous namespace
+
+SPATIALFASTARRAYNETSERIALIZE_TEST(GIVEN_a_baseline_WHEN_items_are_changed_added_and_removed_THEN_existing_and_new_readers_match_the_writer)
+{
+	FDeltaReplicationScope DeltaReplicationScope;
+
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	UTestFastArrayObject* Source = NewObject<UTestFastArrayObject>();
+	UTestFastArrayObject* ExistingReader = NewObject<UTestFastArrayObject>();
+
+	for (int32 i = 0; i < 100; i++)
+	{
+		AddItem(Source->Array, i);
+	}
+
+	FSpatialFastArrayBaseline Baseline;
+	FWrittenFields Stored = WriteFields(NetDriver, Source, Baseline, /* bIsInitialData */ true);
+	TestTrue("Initial data only holds the snapshot", Stored.Contains(TestBaselineFieldId) && !Stored.Contains(TestFieldId));
+
+	ApplyField(NetDriver, ExistingReader, Stored, TestBaselineFieldId);
+	TestTrue("Reader of the initial data matches the writer", ArraysMatch(Source->Array, ExistingReader->Array));
+
+	for (int32 Round = 0; Round < 3; Round++)
+	{
+		ChangeItem(Source->Array, Round, 1000 + Round);
+		RemoveItem(Source->Array, Source->Array.Items.Num() - 1);
+		AddItem(Source->Array, 2000 + Round);
+
+		const FWrittenFields Update = WriteFields(NetDriver, Source, Baseline, /* bIsInitialData */ false);
+		TestFalse("Small changes keep the snapshot", Update.Contains(TestBaselineFieldId));
+		Stored.Append(Update);
+
+		ApplyField(NetDriver, ExistingReader, Update, TestFieldId);
+		TestTrue(FString::Printf(TEXT("Existing reader matches the writer after round %d"), Round), ArraysMatch(Source->Array, ExistingReader->Array));
+
+		UTestFastArrayObject* NewReader = NewObject<UTestFastArrayObject>();
+		ApplyField(NetDriver, NewReader, Stored, TestBaselineFieldId);
+		ApplyField(NetDriver, NewReader, Stored, TestFieldId);
+		TestTrue(FString::Printf(TEXT("Reader checking the entity out matches the writer after round %d"), Round), ArraysMatch(Source->Array, NewReader->Array));
+	}
+
+	for (int32 i = 0; i < Source->Array.Items.Num(); i++)
+	{
+		ChangeItem(Source->Array, i, 3000 + i);
+	}
+	RemoveItem(Source->Array, 0);
+
+	const FWrittenFields Update = WriteFields(NetDriver, Source, Baseline, /* bIsInitialData */ false);
+	TestTrue("Changes larger than the snapshot take a new one", Update.Contains(TestBaselineFieldId) && Update.Contains(TestFieldId));
+	Stored.Append(Update);
+
+	ApplyField(NetDriver, ExistingReader, Update, TestFieldId);
+	TestTrue("Existing reader matches the writer after a new snapshot", ArraysMatch(Source->Array, ExistingReader->Array));
+
+	UTestFastArrayObject* NewReader = NewObject<UTestFastArrayObject>();
+	ApplyField(NetDriver, NewReader, Stored, TestBaselineFieldId);
+	ApplyField(NetDriver, NewReader, Stored, TestFieldId);
+	TestTrue("Reader checking the entity out matches the writer after a new snapshot", ArraysMatch(Source->Array, NewReader->Array));
+
+	return true;
+}
+
+SPATIALFASTARRAYNETSERIALIZE_TEST(GIVEN_a_worker_that_received_the_array_WHEN_it_writes_without_a_snapshot_THEN_existing_readers_drop_removed_items)
+{
+	FDeltaReplicationScope DeltaReplicationScope;
+
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	UTestFastArrayObject* FirstWriter = NewObject<UTestFastArrayObject>();
+	UTestFastArrayObject* NextWriter = NewObject<UTestFastArrayObject>();
+	UTestFastArrayObject* ExistingReader = NewObject<UTestFastArrayObject>();
+
+	for (int32 i = 0; i < 10; i++)
+	{
+		AddItem(FirstWriter->Array, i);
+	}
+
+	FSpatialFastArrayBaseline FirstBaseline;
+	const FWrittenFields Initial = WriteFields(NetDriver, FirstWriter, FirstBaseline, /* bIsInitialData */ true);
+	ApplyField(NetDriver, NextWriter, Initial, TestBaselineFieldId);
+	ApplyField(NetDriver, ExistingReader, Initial, TestBaselineFieldId);
+
+	// The next authoritative worker has no snapshot, as when its baselines were not seeded on gaining authority.
+	RemoveItem(NextWriter->Array, NextWriter->Array.Items.Num() - 1);
+	RemoveItem(NextWriter->Array, 0);
+	ChangeItem(NextWriter->Array, 0, 1000);
+	AddItem(NextWriter->Array, 2000);
+
+	FSpatialFastArrayBaseline NextBaseline;
+	const FWrittenFields Update = WriteFields(NetDriver, NextWriter, NextBaseline, /* bIsInitialData */ false);
+	TestTrue("Writing without a snapshot takes one", Update.Contains(TestBaselineFieldId) && Update.Contains(TestFieldId));
+
+	TSet<int32> ItemIds;
+	for (const FTestFastArrayItem& Item : NextWriter->Array.Items)
+	{
+		ItemIds.Add(Item.ReplicationID);
+	}
+	TestEqual("Added item doesn't reuse a received ID", ItemIds.Num(), NextWriter->Array.Items.Num());
+
+	ApplyField(NetDriver, ExistingReader, Update, TestFieldId);
+	TestTrue("Existing reader matches the writer", ArraysMatch(NextWriter->Array, ExistingReader->Array));
+
+	UTestFastArrayObject* NewReader = NewObject<UTestFastArrayObject>();
+	ApplyField(NetDriver, NewReader, Update, TestBaselineFieldId);
+	ApplyField(NetDriver, NewReader, Update, TestFieldId);
+	TestTrue("Reader checking the entity out matches the writer", ArraysMatch(NextWriter->Array, NewReader->Array));
+
+	return true;
+}
+
+// Simulates an inventory-like fast array where a small fraction of items changes between updates.
+SPATIALFASTARRAYNETSERIALIZE_TEST(GIVEN_1000_items_with_1_percent_churn_WHEN_updates_are_written_THEN_report_bytes_sent)
+{
+	const int32 NumItems = 1000;
+	const int32 NumChangesPerUpdate = NumItems / 100;
+	const int32 NumUpdates = 200;
+
+	FDeltaReplicationScope DeltaReplicationScope;
+
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	UTestFastArrayObject* Source = NewObject<UTestFastArrayObject>();
+	UTestFastArrayObject* Reader = NewObject<UTestFastArrayObject>();
+
+	for (int32 i = 0; i < NumItems; i++)
+	{
+		AddItem(Source->Array, i);
+	}
+
+	FSpatialFastArrayBaseline Baseline;
+	ApplyField(NetDriver, Reader, WriteFields(NetDriver, Source, Baseline, /* bIsInitialData */ true), TestBaselineFieldId);
+
+	FRandomStream Random(NumItems);
+	int64 FullStateTotalBytes = 0;
+	int64 DeltaTotalBytes = 0;
+	int32 NumSnapshots = 0;
+	double DeltaTime = 0.0;
+
+	for (int32 Update = 0; Update < NumUpdates; Update++)
+	{
+		for (int32 i = 0; i < NumChangesPerUpdate; i++)
+		{
+			ChangeItem(Source->Array, Random.RandRange(0, NumItems - 1), Random.RandHelper(MAX_int32));
+		}
+
+		FullStateTotalBytes += FullStateBytes(NetDriver, Source);
+
+		const double StartTime = FPlatformTime::Seconds();
+		const FWrittenFields Written = WriteFields(NetDriver, Source, Baseline, /* bIsInitialData */ false);
+		DeltaTime += FPlatformTime::Seconds() - StartTime;
+
+		for (const auto& Field : Written)
+		{
+			DeltaTotalBytes += Field.Value.Num();
+		}
+		NumSnapshots += Written.Contains(TestBaselineFieldId) ? 1 : 0;
+
+		ApplyField(NetDriver, Reader, Written, TestFieldId);
+	}
+
+	TestTrue("Reader matches the writer after all updates", ArraysMatch(Source->Array, Reader->Array));
+	TestTrue("Changes are smaller than the full state", DeltaTotalBytes < FullStateTotalBytes);
+
+	AddInfo(FString::Printf(TEXT("%d updates of %d items with %d changes each: full state %.0f bytes per update, changes %.0f bytes per update (%.1fx smaller, %d snapshots), %.2fus to write each"),
+		NumUpdates, NumItems, NumChangesPerUpdate, (double)FullStateTotalBytes / NumUpdates, (double)DeltaTotalBytes / NumUpdates,
+		DeltaTotalBytes > 0 ? (double)FullStateTotalBytes / DeltaTotalBytes : 0.0, NumSnapshots, DeltaTime * 1e6 / NumUpdates));
+
+	return true;
+}
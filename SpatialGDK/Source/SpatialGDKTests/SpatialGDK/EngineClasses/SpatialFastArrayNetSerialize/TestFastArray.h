@@ -0,0 +1,69 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/NetSerialization.h"
+#include "UObject/Object.h"
+#include "TestFastArray.generated.h"
+
+/**
+ * These types are for testing purposes only.
+ */
+USTRUCT()
+struct FTestFastArrayItem : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Value = 0;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+	{
+		Ar << Value;
+		bOutSuccess = true;
+		return true;
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FTestFastArrayItem> : public TStructOpsTypeTraitsBase2<FTestFastArrayItem>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
+
+USTRUCT()
+struct FTestFastArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FTestFastArrayItem> Items;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FTestFastArrayItem, FTestFastArray>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FTestFastArray> : public TStructOpsTypeTraitsBase2<FTestFastArray>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
+
+UCLASS(HideDropdown)
+class SPATIALGDKTESTS_API UTestFastArrayObject : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	FTestFastArray Array;
+};
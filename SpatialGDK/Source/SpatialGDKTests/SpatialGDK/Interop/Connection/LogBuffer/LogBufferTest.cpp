@@ -0,0 +1,94 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestDefinitions.h"
+
+#include "Interop/Connection/LogBuffer.h"
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+#define LOGBUFFER_TEST(TestName) \
+	GDK_TEST(Core, FLogBuffer, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	const FName TestLoggerName(TEXT("TestWorker"));
+	const FName TestCategory(TEXT("LogTest"));
+
+	TArray<FString> FlushToArray(FLogBuffer& Buffer)
+	{
+		TArray<FString> Messages;
+		Buffer.Flush([&Messages](uint8 Level, const FName& LoggerName, const TCHAR* Message)
+		{
+			Messages.Add(Message);
+		});
+		return Messages;
+	}
+} // anonymous namespace
+
+LOGBUFFER_TEST(GIVEN_repeated_log_lines_WHEN_flushed_THEN_they_are_coalesced_with_a_count)
+{
+	FLogBuffer Buffer(16, 100);
+
+	for (int32 i = 0; i < 5; i++)
+	{
+		Buffer.Add(WORKER_LOG_LEVEL_WARN, TestLoggerName, TestCategory, TEXT("Something went wrong"));
+	}
+	Buffer.Add(WORKER_LOG_LEVEL_WARN, TestLoggerName, TestCategory, TEXT("Something else went wrong"));
+
+	TestEqual("Repeated lines only take one slot", Buffer.GetNumBufferedMessages(), 2);
+
+	TArray<FString> Messages = FlushToArray(Buffer);
+	if (TestTrue("Number of flushed messages", Messages.Num() == 2))
+	{
+		TestEqual("Coalesced message", Messages[0], FString(TEXT("Something went wrong (repeated 5 times)")));
+		TestEqual("Single message", Messages[1], FString(TEXT("Something else went wrong")));
+	}
+
+	TestEqual("Buffer is empty after flushing", Buffer.GetNumBufferedMessages(), 0);
+
+	return true;
+}
+
+LOGBUFFER_TEST(GIVEN_a_burst_of_distinct_lines_WHEN_the_category_budget_is_exceeded_THEN_extra_lines_are_dropped_and_counted)
+{
+	FLogBuffer Buffer(1000, 10);
+
+	for (int32 i = 0; i < 50; i++)
+	{
+		Buffer.Add(WORKER_LOG_LEVEL_WARN, TestLoggerName, TestCategory, *FString::Printf(TEXT("Warning %d"), i));
+	}
+	Buffer.Add(WORKER_LOG_LEVEL_WARN, TestLoggerName, FName(TEXT("LogOther")), TEXT("Other category"));
+
+	TestEqual("Only the budget was buffered, plus the other category", Buffer.GetNumBufferedMessages(), 11);
+	TestTrue("Dropped messages were counted", Buffer.GetNumDroppedMessages() == 40);
+
+	TArray<FString> Messages = FlushToArray(Buffer);
+	if (TestTrue("Flushed messages include a drop summary", Messages.Num() == 12))
+	{
+		TestTrue("Drop summary reports the count", Messages.Last().Contains(TEXT("Dropped 40")));
+	}
+
+	return true;
+}
+
+LOGBUFFER_TEST(GIVEN_a_full_buffer_WHEN_adding_a_line_THEN_it_is_dropped)
+{
+	FLogBuffer Buffer(4, 100);
+
+	for (int32 i = 0; i < 4; i++)
+	{
+		TestTrue("Line fits in the buffer", Buffer.Add(WORKER_LOG_LEVEL_INFO, TestLoggerName, TestCategory, *FString::Printf(TEXT("Line %d"), i)));
+	}
+
+	TestFalse("Line is dropped when the buffer is full", Buffer.Add(WORKER_LOG_LEVEL_INFO, TestLoggerName, TestCategory, TEXT("One too many")));
+	TestTrue("Repeats of a buffered line are still accepted", Buffer.Add(WORKER_LOG_LEVEL_INFO, TestLoggerName, TestCategory, TEXT("Line 0")));
+
+	FlushToArray(Buffer);
+	TestTrue("Buffer accepts lines again after flushing", Buffer.Add(WORKER_LOG_LEVEL_INFO, TestLoggerName, FName(TEXT("LogOther")), TEXT("One too many")));
+
+	return true;
+}
@@ -0,0 +1,210 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestDefinitions.h"
+
+#include "Interop/Connection/OpListBatch.h"
+#include "Schema/StandardLibrary.h"
+#include "SpatialConstants.h"
+
+#include "Containers/Queue.h"
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+#include <WorkerSDK/improbable/c_worker.h>
+
+#define OPLISTBATCH_TEST(TestName) \
+	GDK_TEST(Core, FOpListBatch, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	// Op lists built in the test, standing in for ones from the Worker SDK.
+	struct FTestOpLists
+	{
+		TArray<TArray<Worker_Op>> Ops;
+		TArray<Worker_OpList> OpLists;
+
+		~FTestOpLists()
+		{
+			for (TArray<Worker_Op>& ListOps : Ops)
+			{
+				for (Worker_Op& Op : ListOps)
+				{
+					if (Op.op_type == WORKER_OP_TYPE_COMPONENT_UPDATE && Op.op.component_update.update.schema_type != nullptr)
+					{
+						Schema_DestroyComponentUpdate(Op.op.component_update.update.schema_type);
+					}
+				}
+			}
+		}
+
+		TArray<Worker_Op>& AddOpList()
+		{
+			return Ops.AddDefaulted_GetRef();
+		}
+
+		// Called once all op lists are added, as the op lists point into Ops.
+		void Finish()
+		{
+			for (TArray<Worker_Op>& ListOps : Ops)
+			{
+				Worker_OpList& OpList = OpLists.AddZeroed_GetRef();
+				OpList.ops = ListOps.GetData();
+				OpList.op_count = ListOps.Num();
+			}
+		}
+	};
+
+	void AddOp(TArray<Worker_Op>& Ops, Worker_OpType OpType, Worker_EntityId EntityId)
+	{
+		Worker_Op& Op = Ops.AddZeroed_GetRef();
+		Op.op_type = OpType;
+		switch (OpType)
+		{
+		case WORKER_OP_TYPE_ADD_ENTITY:
+			Op.op.add_entity.entity_id = EntityId;
+			break;
+		case WORKER_OP_TYPE_REMOVE_COMPONENT:
+			Op.op.remove_component.entity_id = EntityId;
+			Op.op.remove_component.component_id = SpatialConstants::POSITION_COMPONENT_ID;
+			break;
+		case WORKER_OP_TYPE_COMPONENT_UPDATE:
+			Op.op.component_update.entity_id = EntityId;
+			Op.op.component_update.update = Position::CreatePositionUpdate(Coordinates{ double(EntityId), 0.0, 0.0 });
+			break;
+		default:
+			break;
+		}
+	}
+} // anonymous namespace
+
+OPLISTBATCH_TEST(GIVEN_op_lists_that_remove_components_WHEN_coalesced_THEN_ops_keep_their_order_and_removals_end_a_list)
+{
+	FTestOpLists TestOpLists;
+	{
+		TArray<Worker_Op>& Ops = TestOpLists.AddOpList();
+		AddOp(Ops, WORKER_OP_TYPE_ADD_ENTITY, 1);
+		AddOp(Ops, WORKER_OP_TYPE_COMPONENT_UPDATE, 1);
+	}
+	AddOp(TestOpLists.AddOpList(), WORKER_OP_TYPE_COMPONENT_UPDATE, 2);
+	{
+		TArray<Worker_Op>& Ops = TestOpLists.AddOpList();
+		AddOp(Ops, WORKER_OP_TYPE_REMOVE_COMPONENT, 1);
+		AddOp(Ops, WORKER_OP_TYPE_COMPONENT_UPDATE, 3);
+	}
+	AddOp(TestOpLists.AddOpList(), WORKER_OP_TYPE_COMPONENT_UPDATE, 1);
+	TestOpLists.Finish();
+
+	FOpListBatch Batch;
+	Batch.SetCountBytes(true);
+	for (Worker_OpList& OpList : TestOpLists.OpLists)
+	{
+		Batch.Add(&OpList);
+	}
+
+	const FOpListBatchStats& Stats = Batch.GetStats();
+	TestEqual("Op lists are counted", Stats.NumOpLists, 4);
+	TestEqual("Ops are counted", Stats.NumOps, 6);
+	TestEqual("Ops are counted by type", Stats.GetNumOpsOfType(WORKER_OP_TYPE_COMPONENT_UPDATE), 4);
+	TestEqual("Types not received have no ops", Stats.GetNumOpsOfType(WORKER_OP_TYPE_COMMAND_REQUEST), 0);
+	TestTrue("Schema bytes are counted", Stats.NumBytes > 0);
+
+	const TArray<Worker_OpList>& Coalesced = Batch.Coalesce();
+	TestEqual("Op list that removes a component ends the first coalesced op list", Coalesced.Num(), 2);
+	TestEqual("First coalesced op list has the ops up to the removal", (int32)Coalesced[0].op_count, 5);
+	TestEqual("Second coalesced op list has the rest", (int32)Coalesced[1].op_count, 1);
+
+	TArray<Worker_EntityId> EntityOrder;
+	for (const Worker_OpList& OpList : Coalesced)
+	{
+		for (uint32 i = 0; i < OpList.op_count; i++)
+		{
+			if (OpList.ops[i].op_type == WORKER_OP_TYPE_COMPONENT_UPDATE)
+			{
+				EntityOrder.Add(OpList.ops[i].op.component_update.entity_id);
+			}
+		}
+	}
+	TestTrue("Updates keep the order they were received in", EntityOrder == TArray<Worker_EntityId>({ 1, 2, 3, 1 }));
+
+	Batch.Reset();
+	TestTrue("Reset batch is empty", Batch.IsEmpty());
+	TestEqual("Reset clears the tick's ops by type", Batch.GetStats().GetNumOpsOfType(WORKER_OP_TYPE_COMPONENT_UPDATE), 0);
+
+	int32 NumTicks = 0;
+	int32 NumOpLists = 0;
+	int32 NumOps = 0;
+	uint64 NumBytes = 0;
+	Batch.ConsumeStats(NumTicks, NumOpLists, NumOps, NumBytes);
+	TestEqual("Ticks since consumed are counted", NumTicks, 1);
+	TestEqual("Op lists since consumed are counted", NumOpLists, 4);
+	TestEqual("Ops since consumed are counted", NumOps, 6);
+
+	Batch.ConsumeStats(NumTicks, NumOpLists, NumOps, NumBytes);
+	TestEqual("Stats are reset once consumed", NumOpLists, 0);
+
+	return true;
+}
+
+// Replays bursty ticks where many small op lists arrive per tick, as USpatialWorkerConnection queues them between net driver ticks.
+OPLISTBATCH_TEST(GIVEN_bursty_ticks_of_small_op_lists_WHEN_taken_through_a_batch_THEN_every_op_is_processed_in_order_once_per_tick)
+{
+	const int32 NumTicks = 3;
+	const int32 OpListsPerTick = 32;
+	const int32 OpsPerOpList = 4;
+
+	FTestOpLists TestOpLists;
+	for (int32 i = 0; i < OpListsPerTick; i++)
+	{
+		TArray<Worker_Op>& Ops = TestOpLists.AddOpList();
+		for (int32 j = 0; j < OpsPerOpList; j++)
+		{
+			// Every eighth op list removes a component, as when an actor leaves view.
+			AddOp(Ops, (i % 8 == 7 && j == 0) ? WORKER_OP_TYPE_REMOVE_COMPONENT : WORKER_OP_TYPE_ADD_ENTITY, i * OpsPerOpList + j);
+		}
+	}
+	TestOpLists.Finish();
+
+	TQueue<Worker_OpList*> Queue;
+	FOpListBatch Batch;
+
+	for (int32 Tick = 0; Tick < NumTicks; Tick++)
+	{
+		for (Worker_OpList& OpList : TestOpLists.OpLists)
+		{
+			Queue.Enqueue(&OpList);
+		}
+
+		Worker_OpList* OutOpList;
+		while (Queue.Dequeue(OutOpList))
+		{
+			Batch.Add(OutOpList);
+		}
+
+		TArray<Worker_EntityId> EntityOrder;
+		int32 NumOpListsProcessed = 0;
+		for (const Worker_OpList& OpList : Batch.Coalesce())
+		{
+			for (uint32 i = 0; i < OpList.op_count; i++)
+			{
+				const Worker_Op& Op = OpList.ops[i];
+				EntityOrder.Add(Op.op_type == WORKER_OP_TYPE_REMOVE_COMPONENT ? Op.op.remove_component.entity_id : Op.op.add_entity.entity_id);
+			}
+			NumOpListsProcessed++;
+		}
+
+		bool bInOrder = EntityOrder.Num() == OpListsPerTick * OpsPerOpList;
+		for (int32 i = 0; bInOrder && i < EntityOrder.Num(); i++)
+		{
+			bInOrder = EntityOrder[i] == i;
+		}
+		TestTrue(FString::Printf(TEXT("Every op of tick %d is processed in the order it was received"), Tick), bInOrder);
+		TestEqual(FString::Printf(TEXT("One coalesced op list is processed per removal in tick %d"), Tick), NumOpListsProcessed, OpListsPerTick / 8);
+
+		Batch.Reset();
+		TestTrue(FString::Printf(TEXT("Batch is empty after tick %d"), Tick), Batch.IsEmpty());
+	}
+
+	return true;
+}
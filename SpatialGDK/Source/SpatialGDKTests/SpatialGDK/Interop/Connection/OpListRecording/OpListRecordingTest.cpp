@@ -0,0 +1,317 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestDefinitions.h"
+
+#include "Interop/Connection/OpListRecording.h"
+#include "Interop/SpatialStaticComponentView.h"
+#include "Schema/StandardLibrary.h"
+#include "SpatialConstants.h"
+
+#include "CoreMinimal.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+#include <WorkerSDK/improbable/c_worker.h>
+
+#define OPLISTRECORDING_TEST(TestName) \
+	GDK_TEST(Core, FOpListRecording, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	const char* TestCallerAttributes[] = { "UnrealClient", "workerId:TestClient" };
+
+	FString GetTestRecordingFilename(const TCHAR* Name)
+	{
+		return FPaths::Combine(FPaths::AutomationTransientDir(), FString(Name) + TEXT(".spatialops"));
+	}
+
+	void AddEntityOps(TArray<Worker_Op>& Ops, Worker_EntityId EntityId, const Coordinates& Coords)
+	{
+		Worker_Op& AddEntity = Ops.AddZeroed_GetRef();
+		AddEntity.op_type = WORKER_OP_TYPE_ADD_ENTITY;
+		AddEntity.op.add_entity.entity_id = EntityId;
+
+		Worker_Op& AddComponent = Ops.AddZeroed_GetRef();
+		AddComponent.op_type = WORKER_OP_TYPE_ADD_COMPONENT;
+		AddComponent.op.add_component.entity_id = EntityId;
+		AddComponent.op.add_component.data = Position(Coords).CreatePositionData();
+
+		Worker_Op& AuthorityChange = Ops.AddZeroed_GetRef();
+		AuthorityChange.op_type = WORKER_OP_TYPE_AUTHORITY_CHANGE;
+		AuthorityChange.op.authority_change.entity_id = EntityId;
+		AuthorityChange.op.authority_change.component_id = SpatialConstants::POSITION_COMPONENT_ID;
+		AuthorityChange.op.authority_change.authority = WORKER_AUTHORITY_AUTHORITATIVE;
+	}
+
+	void AddPositionUpdateOp(TArray<Worker_Op>& Ops, Worker_EntityId EntityId, const Coordinates& Coords)
+	{
+		Worker_Op& Update = Ops.AddZeroed_GetRef();
+		Update.op_type = WORKER_OP_TYPE_COMPONENT_UPDATE;
+		Update.op.component_update.entity_id = EntityId;
+		Update.op.component_update.update = Position::CreatePositionUpdate(Coords);
+	}
+
+	void RecordOps(FOpListRecorder& Recorder, TArray<Worker_Op>& Ops)
+	{
+		Worker_OpList OpList = {};
+		OpList.ops = Ops.GetData();
+		OpList.op_count = Ops.Num();
+		Recorder.RecordOpList(OpList);
+	}
+
+	// Frees the schema data of ops built by the helpers above, which the Worker SDK would own for received op lists.
+	void DestroyOps(TArray<Worker_Op>& Ops)
+	{
+		for (Worker_Op& Op : Ops)
+		{
+			switch (Op.op_type)
+			{
+			case WORKER_OP_TYPE_ADD_COMPONENT:
+				Schema_DestroyComponentData(Op.op.add_component.data.schema_type);
+				break;
+			case WORKER_OP_TYPE_COMPONENT_UPDATE:
+				Schema_DestroyComponentUpdate(Op.op.component_update.update.schema_type);
+				break;
+			case WORKER_OP_TYPE_COMMAND_REQUEST:
+				Schema_DestroyCommandRequest(Op.op.command_request.request.schema_type);
+				break;
+			case WORKER_OP_TYPE_ENTITY_QUERY_RESPONSE:
+				for (uint32 i = 0; i < Op.op.entity_query_response.result_count; i++)
+				{
+					Schema_DestroyComponentData(Op.op.entity_query_response.results[i].components[0].schema_type);
+				}
+				break;
+			default:
+				break;
+			}
+		}
+		Ops.Empty();
+	}
+
+	void ApplyToView(USpatialStaticComponentView* View, const Worker_OpList& OpList)
+	{
+		for (uint32 i = 0; i < OpList.op_count; i++)
+		{
+			const Worker_Op& Op = OpList.ops[i];
+			switch (Op.op_type)
+			{
+			case WORKER_OP_TYPE_ADD_COMPONENT:
+				View->OnAddComponent(Op.op.add_component);
+				break;
+			case WORKER_OP_TYPE_COMPONENT_UPDATE:
+				View->OnComponentUpdate(Op.op.component_update);
+				break;
+			case WORKER_OP_TYPE_AUTHORITY_CHANGE:
+				View->OnAuthorityChange(Op.op.authority_change);
+				break;
+			default:
+				break;
+			}
+		}
+	}
+
+	bool CoordinatesEqual(const Coordinates& A, const Coordinates& B)
+	{
+		return A.X == B.X && A.Y == B.Y && A.Z == B.Z;
+	}
+} // anonymous namespace
+
+OPLISTRECORDING_TEST(GIVEN_recorded_op_lists_and_messages_WHEN_loaded_THEN_they_match_what_was_recorded)
+{
+	const FString Filename = GetTestRecordingFilename(TEXT("RoundTrip"));
+	const Coordinates CreatedAt{ 1.0, 2.0, 3.0 };
+	const Coordinates MovedTo{ -4.5, 0.0, 1e6 };
+
+	FOpListRecorder Recorder;
+	TestTrue("Recorder opens", Recorder.Open(Filename, TEXT("TestWorker"), { TEXT("UnrealWorker"), TEXT("workerId:TestWorker") }));
+
+	TArray<Worker_Op> Ops;
+	AddEntityOps(Ops, 10, CreatedAt);
+	RecordOps(Recorder, Ops);
+	DestroyOps(Ops);
+
+	AddPositionUpdateOp(Ops, 10, MovedTo);
+	Schema_AddComponentUpdateClearedField(Ops.Last().op.component_update.update.schema_type, 2);
+	{
+		Worker_Op& Request = Ops.AddZeroed_GetRef();
+		Request.op_type = WORKER_OP_TYPE_COMMAND_REQUEST;
+		Request.op.command_request.request_id = 7;
+		Request.op.command_request.entity_id = 10;
+		Request.op.command_request.caller_worker_id = "TestClient";
+		Request.op.command_request.caller_attribute_set.attribute_count = ARRAY_COUNT(TestCallerAttributes);
+		Request.op.command_request.caller_attribute_set.attributes = TestCallerAttributes;
+		Request.op.command_request.request.component_id = SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID;
+		Request.op.command_request.request.command_index = 1;
+		Request.op.command_request.request.schema_type = Schema_CreateCommandRequest();
+		Schema_AddUint32(Schema_GetCommandRequestObject(Request.op.command_request.request.schema_type), 1, 42);
+	}
+	Worker_ComponentData QueriedComponent = Position(CreatedAt).CreatePositionData();
+	Worker_Entity QueriedEntity = { 11, 1, &QueriedComponent };
+	{
+		Worker_Op& Response = Ops.AddZeroed_GetRef();
+		Response.op_type = WORKER_OP_TYPE_ENTITY_QUERY_RESPONSE;
+		Response.op.entity_query_response.request_id = 8;
+		Response.op.entity_query_response.status_code = WORKER_STATUS_CODE_SUCCESS;
+		Response.op.entity_query_response.result_count = 1;
+		Response.op.entity_query_response.results = &QueriedEntity;
+	}
+	RecordOps(Recorder, Ops);
+	DestroyOps(Ops);
+
+	FComponentUpdate SentUpdate(10, Position::CreatePositionUpdate(MovedTo));
+	Recorder.RecordOutgoingMessage(SentUpdate);
+	DiscardOutgoingMessage(SentUpdate);
+
+	Recorder.Close();
+
+	FOpListRecording Recording;
+	TestTrue("Recording loads", Recording.Load(Filename));
+	TestEqual("Worker ID", Recording.GetWorkerId(), FString(TEXT("TestWorker")));
+	TestEqual("Worker attributes", Recording.GetWorkerAttributes().Num(), 2);
+	TestEqual("Both op lists are read back", Recording.OpLists.Num(), 2);
+	TestEqual("The outgoing message is read back", Recording.OutgoingMessages.Num(), 1);
+	if (Recording.OpLists.Num() != 2 || Recording.OutgoingMessages.Num() != 1)
+	{
+		return false;
+	}
+
+	const Worker_OpList& First = *Recording.OpLists[0]->Get();
+	TestTrue("First op list has three ops", First.op_count == 3);
+	TestTrue("Entity is added", First.ops[0].op_type == WORKER_OP_TYPE_ADD_ENTITY && First.ops[0].op.add_entity.entity_id == 10);
+	TestTrue("Position is added", CoordinatesEqual(Position(First.ops[1].op.add_component.data).Coords, CreatedAt));
+	TestTrue("Authority is gained", First.ops[2].op.authority_change.authority == WORKER_AUTHORITY_AUTHORITATIVE);
+
+	const Worker_OpList& Second = *Recording.OpLists[1]->Get();
+	TestTrue("Second op list has three ops", Second.op_count == 3);
+
+	Position Moved(CreatedAt);
+	Moved.ApplyComponentUpdate(Second.ops[0].op.component_update.update);
+	TestTrue("Position is updated", CoordinatesEqual(Moved.Coords, MovedTo));
+	TestTrue("Cleared fields are kept", Schema_GetComponentUpdateClearedFieldCount(Second.ops[0].op.component_update.update.schema_type) == 1);
+
+	const Worker_CommandRequestOp& Request = Second.ops[1].op.command_request;
+	TestTrue("Command request ID", Request.request_id == 7);
+	TestEqual("Caller worker ID", FString(UTF8_TO_TCHAR(Request.caller_worker_id)), FString(TEXT("TestClient")));
+	TestTrue("Caller attributes", Request.caller_attribute_set.attribute_count == 2 && FCStringAnsi::Strcmp(Request.caller_attribute_set.attributes[1], "workerId:TestClient") == 0);
+	TestTrue("Command payload", Schema_GetUint32(Schema_GetCommandRequestObject(Request.request.schema_type), 1) == 42);
+
+	const Worker_EntityQueryResponseOp& Response = Second.ops[2].op.entity_query_response;
+	TestTrue("Query result", Response.result_count == 1 && Response.results[0].entity_id == 11 && Response.results[0].component_count == 1);
+	TestTrue("Query result data", CoordinatesEqual(Position(Response.results[0].components[0]).Coords, CreatedAt));
+
+	const FRecordedOutgoingMessage& Message = Recording.OutgoingMessages[0];
+	TestTrue("Outgoing message target", Message.Type == EOutgoingMessageType::ComponentUpdate && Message.EntityId == 10 && Message.ComponentId == SpatialConstants::POSITION_COMPONENT_ID);
+	TestTrue("Outgoing message payload", Message.Payload.Num() > 0);
+
+	IFileManager::Get().Delete(*Filename);
+
+	return true;
+}
+
+OPLISTRECORDING_TEST(GIVEN_a_truncated_recording_WHEN_loaded_THEN_complete_op_lists_are_kept)
+{
+	const FString Filename = GetTestRecordingFilename(TEXT("Truncated"));
+
+	{
+		FOpListRecorder Recorder;
+		Recorder.Open(Filename, TEXT("TestWorker"), {});
+
+		TArray<Worker_Op> Ops;
+		AddEntityOps(Ops, 1, Origin);
+		RecordOps(Recorder, Ops);
+		DestroyOps(Ops);
+
+		AddPositionUpdateOp(Ops, 1, Coordinates{ 5.0, 5.0, 5.0 });
+		RecordOps(Recorder, Ops);
+		DestroyOps(Ops);
+	}
+
+	TArray<uint8> Bytes;
+	FFileHelper::LoadFileToArray(Bytes, *Filename);
+	Bytes.SetNum(Bytes.Num() - 4);
+	FFileHelper::SaveArrayToFile(Bytes, *Filename);
+
+	AddExpectedError(TEXT("is truncated or corrupt"), EAutomationExpectedErrorFlags::Contains, 1);
+
+	FOpListRecording Recording;
+	TestTrue("Truncated recording still loads", Recording.Load(Filename));
+	TestTrue("Only the complete op list is kept", Recording.OpLists.Num() == 1 && Recording.OpLists[0]->Get()->op_count == 3);
+
+	IFileManager::Get().Delete(*Filename);
+
+	return true;
+}
+
+// Captures a synthetic session of entities moving every tick, then replays it into a component view, reporting
+// capture throughput, file size and how quickly the replay can be applied.
+OPLISTRECORDING_TEST(GIVEN_a_captured_session_WHEN_replayed_into_a_view_THEN_the_view_matches_and_throughput_is_reported)
+{
+	const FString Filename = GetTestRecordingFilename(TEXT("Benchmark"));
+	const int32 NumEntities = 1000;
+	const int32 NumTicks = 200;
+
+	FOpListRecorder Recorder;
+	Recorder.Open(Filename, TEXT("TestWorker"), { TEXT("UnrealWorker") });
+
+	double CaptureSeconds = 0.0;
+	TArray<Worker_Op> Ops;
+	for (int32 i = 0; i < NumEntities; i++)
+	{
+		AddEntityOps(Ops, i + 1, Origin);
+	}
+	double StartTime = FPlatformTime::Seconds();
+	RecordOps(Recorder, Ops);
+	CaptureSeconds += FPlatformTime::Seconds() - StartTime;
+	DestroyOps(Ops);
+
+	for (int32 Tick = 1; Tick <= NumTicks; Tick++)
+	{
+		for (int32 i = 0; i < NumEntities; i++)
+		{
+			AddPositionUpdateOp(Ops, i + 1, Coordinates{ (double)Tick, (double)i, 0.0 });
+		}
+		StartTime = FPlatformTime::Seconds();
+		RecordOps(Recorder, Ops);
+		CaptureSeconds += FPlatformTime::Seconds() - StartTime;
+		DestroyOps(Ops);
+	}
+
+	const int64 BytesWritten = Recorder.GetBytesWritten();
+	Recorder.Close();
+
+	StartTime = FPlatformTime::Seconds();
+	FOpListRecording Recording;
+	TestTrue("Recording loads", Recording.Load(Filename));
+	const double LoadSeconds = FPlatformTime::Seconds() - StartTime;
+
+	USpatialStaticComponentView* View = NewObject<USpatialStaticComponentView>();
+	StartTime = FPlatformTime::Seconds();
+	for (const TUniquePtr<FRecordedOpList>& OpList : Recording.OpLists)
+	{
+		ApplyToView(View, *OpList->Get());
+	}
+	const double ReplaySeconds = FPlatformTime::Seconds() - StartTime;
+
+	bool bViewMatches = true;
+	for (int32 i = 0; i < NumEntities; i++)
+	{
+		const Position* EntityPosition = View->GetComponentData<Position>(i + 1);
+		bViewMatches &= EntityPosition != nullptr && CoordinatesEqual(EntityPosition->Coords, Coordinates{ (double)NumTicks, (double)i, 0.0 });
+		bViewMatches &= View->HasAuthority(i + 1, SpatialConstants::POSITION_COMPONENT_ID);
+	}
+	TestTrue("Replayed view has every entity at its final position", bViewMatches);
+
+	const int32 NumOps = NumEntities * (3 + NumTicks);
+	AddInfo(FString::Printf(TEXT("Captured %d ops in %.1f ms (%.0f bytes per op)"), NumOps, CaptureSeconds * 1000.0, (double)BytesWritten / NumOps));
+	AddInfo(FString::Printf(TEXT("Loaded recording in %.1f ms, replayed into a component view in %.1f ms (%.2f M ops/s)"),
+		LoadSeconds * 1000.0, ReplaySeconds * 1000.0, NumOps / FMath::Max(ReplaySeconds, 1e-9) / 1e6));
+
+	IFileManager::Get().Delete(*Filename);
+
+	return true;
+}
@@ -0,0 +1,274 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestDefinitions.h"
+
+#include "Interop/EntityMaterializationQueue.h"
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+#include <WorkerSDK/improbable/c_worker.h>
+
+#define ENTITYMATERIALIZATIONQUEUE_TEST(TestName) \
+	GDK_TEST(Core, FEntityMaterializationQueue, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	const Worker_ComponentId TestComponentId = SpatialConstants::STARTING_GENERATED_COMPONENT_ID;
+
+	// Owns the schema objects handed to the queue, standing in for the op list.
+	struct FTestSchemaData
+	{
+		FTestSchemaData()
+		{
+			Data = {};
+			Data.component_id = TestComponentId;
+			Data.schema_type = Schema_CreateComponentData();
+
+			Update = {};
+			Update.component_id = TestComponentId;
+			Update.schema_type = Schema_CreateComponentUpdate();
+		}
+
+		~FTestSchemaData()
+		{
+			Schema_DestroyComponentData(Data.schema_type);
+			Schema_DestroyComponentUpdate(Update.schema_type);
+		}
+
+		Worker_ComponentData ForComponent(Worker_ComponentId ComponentId) const
+		{
+			Worker_ComponentData ComponentData = Data;
+			ComponentData.component_id = ComponentId;
+			return ComponentData;
+		}
+
+		Worker_ComponentUpdate UpdateForComponent(Worker_ComponentId ComponentId) const
+		{
+			Worker_ComponentUpdate ComponentUpdate = Update;
+			ComponentUpdate.component_id = ComponentId;
+			return ComponentUpdate;
+		}
+
+		Worker_ComponentData Data;
+		Worker_ComponentUpdate Update;
+	};
+
+	TArray<Worker_EntityId> PopAll(FEntityMaterializationQueue& Queue)
+	{
+		TArray<Worker_EntityId> EntityIds;
+		FEntityMaterializationQueue::FEntry Entry;
+		while (Queue.Pop(Entry))
+		{
+			EntityIds.Add(Entry.EntityId);
+		}
+		return EntityIds;
+	}
+} // anonymous namespace
+
+ENTITYMATERIALIZATIONQUEUE_TEST(GIVEN_queued_entities_WHEN_popped_THEN_higher_class_priority_then_nearer_entities_come_first)
+{
+	FEntityMaterializationQueue Queue;
+
+	Queue.Enqueue(1, 0, 900.f, {});
+	Queue.Enqueue(2, 0, 100.f, {});
+	Queue.Enqueue(3, 5, 10000.f, {});
+	Queue.Enqueue(4, 0, 100.f, {});
+	Queue.Enqueue(5, -1, 0.f, {});
+
+	TestEqual("Queue depth", Queue.Num(), 5);
+
+	const TArray<Worker_EntityId> Expected = { 3, 2, 4, 1, 5 };
+	TestTrue("Entities come out by class priority, then distance, then arrival order", PopAll(Queue) == Expected);
+	TestEqual("Queue is empty", Queue.Num(), 0);
+
+	return true;
+}
+
+ENTITYMATERIALIZATIONQUEUE_TEST(GIVEN_queued_entities_WHEN_one_is_removed_or_popped_early_THEN_it_is_skipped)
+{
+	FEntityMaterializationQueue Queue;
+
+	Queue.Enqueue(1, 0, 100.f, {});
+	Queue.Enqueue(2, 0, 200.f, {});
+	Queue.Enqueue(3, 0, 300.f, {});
+
+	TestTrue("Removed entity was queued", Queue.Remove(1));
+	TestFalse("Entity can't be removed twice", Queue.Remove(1));
+
+	FEntityMaterializationQueue::FEntry Entry;
+	TestTrue("Entity can be popped ahead of its turn", Queue.Pop(3, Entry));
+	TestTrue("Popped the requested entity", Entry.EntityId == 3);
+	TestFalse("Entity that isn't queued can't be popped", Queue.Pop(3, Entry));
+
+	// Re-queueing an entity that left and re-entered view uses its new priority.
+	Queue.Enqueue(1, 0, 1000.f, {});
+
+	const TArray<Worker_EntityId> Expected = { 2, 1 };
+	TestTrue("Only entities still queued come out", PopAll(Queue) == Expected);
+
+	return true;
+}
+
+ENTITYMATERIALIZATIONQUEUE_TEST(GIVEN_a_queued_entity_WHEN_ops_arrive_for_it_THEN_they_are_kept_in_order)
+{
+	FTestSchemaData SchemaData;
+
+	{
+		FEntityMaterializationQueue Queue;
+
+		TArray<PendingAddComponentWrapper> Components;
+		Components.Emplace(1, TestComponentId, SchemaData.ForComponent(TestComponentId));
+		Components.Emplace(1, TestComponentId + 1, SchemaData.ForComponent(TestComponentId + 1));
+		Queue.Enqueue(1, 0, 0.f, MoveTemp(Components));
+
+		TestTrue("Component added to queued entity", Queue.AddComponent(1, SchemaData.ForComponent(TestComponentId + 2)));
+		TestTrue("Component removed from queued entity", Queue.RemoveComponent(1, TestComponentId + 1));
+		TestTrue("Update buffered for queued entity", Queue.AddUpdate(1, SchemaData.UpdateForComponent(TestComponentId + 2)));
+		TestTrue("Second update buffered for queued entity", Queue.AddUpdate(1, SchemaData.UpdateForComponent(TestComponentId)));
+
+		TestFalse("Ops for other entities are not taken", Queue.AddUpdate(2, SchemaData.UpdateForComponent(TestComponentId)));
+		TestFalse("Components for other entities are not taken", Queue.AddComponent(2, SchemaData.ForComponent(TestComponentId)));
+
+		FEntityMaterializationQueue::FEntry Entry;
+		if (!TestTrue("Entity is popped", Queue.Pop(Entry)))
+		{
+			return false;
+		}
+
+		if (TestTrue("Entity has the remaining components", Entry.Components.Num() == 2))
+		{
+			TestTrue("First component kept", Entry.Components[0].ComponentId == TestComponentId);
+			TestTrue("Added component appended", Entry.Components[1].ComponentId == TestComponentId + 2);
+		}
+
+		if (TestTrue("Entity has both updates", Entry.Updates.Num() == 2))
+		{
+			TestTrue("Updates are kept in arrival order", Entry.Updates[0].Update->component_id == TestComponentId + 2 && Entry.Updates[1].Update->component_id == TestComponentId);
+		}
+	}
+
+	return true;
+}
+
+ENTITYMATERIALIZATIONQUEUE_TEST(GIVEN_entities_parked_for_a_class_load_WHEN_the_class_loads_THEN_they_come_out_in_priority_order)
+{
+	const FSoftObjectPath ClassA(TEXT("/Game/Test/A.A_C"));
+	const FSoftObjectPath ClassB(TEXT("/Game/Test/B.B_C"));
+
+	FEntityMaterializationQueue Queue;
+
+	TestTrue("First entity of a class starts its load", Queue.Park(1, ClassA, 0, 500.f, {}));
+	TestFalse("Second entity of a class waits for the same load", Queue.Park(2, ClassA, 0, 100.f, {}));
+	TestTrue("Entity of another class starts another load", Queue.Park(3, ClassB, 0, 0.f, {}));
+	Queue.Enqueue(4, 0, 1000.f, {});
+
+	TestEqual("Parked entities are queued", Queue.Num(), 4);
+	TestEqual("Parked entity count", Queue.NumParked(), 3);
+	TestEqual("Loading class count", Queue.NumLoadingClasses(), 2);
+
+	const TArray<Worker_EntityId> BeforeLoad = { 4 };
+	TestTrue("Only entities that aren't parked come out", PopAll(Queue) == BeforeLoad);
+
+	Queue.OnClassLoaded(ClassA);
+	TestEqual("Entities of the loaded class are no longer parked", Queue.NumParked(), 1);
+	TestEqual("Only the other class is loading", Queue.NumLoadingClasses(), 1);
+
+	const TArray<Worker_EntityId> AfterLoad = { 2, 1 };
+	TestTrue("Entities of the loaded class come out nearest first", PopAll(Queue) == AfterLoad);
+	TestEqual("Entity of the other class is still queued", Queue.Num(), 1);
+
+	return true;
+}
+
+ENTITYMATERIALIZATIONQUEUE_TEST(GIVEN_a_parked_entity_WHEN_ops_arrive_or_it_leaves_view_THEN_it_is_kept_up_to_date)
+{
+	FTestSchemaData SchemaData;
+	const FSoftObjectPath Class(TEXT("/Game/Test/A.A_C"));
+
+	{
+		FEntityMaterializationQueue Queue;
+
+		TArray<PendingAddComponentWrapper> Components;
+		Components.Emplace(1, TestComponentId, SchemaData.ForComponent(TestComponentId));
+		Queue.Park(1, Class, 0, 0.f, MoveTemp(Components));
+		Queue.Park(2, Class, 0, 0.f, {});
+		Queue.Park(3, Class, 0, 0.f, {});
+
+		TestTrue("Component added to parked entity", Queue.AddComponent(1, SchemaData.ForComponent(TestComponentId + 1)));
+		TestTrue("Update buffered for parked entity", Queue.AddUpdate(1, SchemaData.UpdateForComponent(TestComponentId)));
+
+		TestTrue("Parked entity can leave view", Queue.Remove(2));
+		TestEqual("Removed entity is no longer parked", Queue.NumParked(), 2);
+
+		// An entity needed straight away is handed over without waiting for its class.
+		FEntityMaterializationQueue::FEntry Entry;
+		TestTrue("Parked entity can be popped ahead of its turn", Queue.Pop(3, Entry));
+		TestEqual("Popped entity is no longer parked", Queue.NumParked(), 1);
+
+		Queue.OnClassLoaded(Class);
+
+		FEntityMaterializationQueue::FEntry Loaded;
+		if (!TestTrue("Remaining entity comes out once its class loads", Queue.Pop(Loaded) && Loaded.EntityId == 1))
+		{
+			return false;
+		}
+
+		TestTrue("Entity has its initial and added components", Loaded.Components.Num() == 2);
+		TestTrue("Entity has the update received while parked", Loaded.Updates.Num() == 1);
+		TestEqual("Queue is empty", Queue.Num(), 0);
+		TestEqual("Nothing is parked", Queue.NumParked(), 0);
+	}
+
+	return true;
+}
+
+ENTITYMATERIALIZATIONQUEUE_TEST(GIVEN_queued_and_parked_entities_WHEN_a_command_request_arrives_for_each_THEN_they_are_popped_with_their_buffered_ops)
+{
+	FTestSchemaData SchemaData;
+	const FSoftObjectPath Class(TEXT("/Game/Test/A.A_C"));
+
+	{
+		FEntityMaterializationQueue Queue;
+
+		// USpatialReceiver::OnCommandRequest pops the target entity by id when it is queued, so that the
+		// RPC is applied to its actor rather than dropped.
+		TArray<PendingAddComponentWrapper> QueuedComponents;
+		QueuedComponents.Emplace(1, TestComponentId, SchemaData.ForComponent(TestComponentId));
+		Queue.Enqueue(1, 0, 0.f, MoveTemp(QueuedComponents));
+		TestTrue("Update buffered for queued entity", Queue.AddUpdate(1, SchemaData.UpdateForComponent(TestComponentId)));
+
+		TArray<PendingAddComponentWrapper> ParkedComponents;
+		ParkedComponents.Emplace(2, TestComponentId, SchemaData.ForComponent(TestComponentId));
+		Queue.Park(2, Class, 0, 0.f, MoveTemp(ParkedComponents));
+		TestTrue("Update buffered for parked entity", Queue.AddUpdate(2, SchemaData.UpdateForComponent(TestComponentId)));
+
+		for (Worker_EntityId EntityId : { 1, 2 })
+		{
+			TestTrue("Command target is queued", Queue.Contains(EntityId));
+
+			FEntityMaterializationQueue::FEntry Entry;
+			if (!TestTrue("Command target is popped", Queue.Pop(EntityId, Entry)))
+			{
+				return false;
+			}
+
+			TestTrue("Command target is the popped entity", Entry.EntityId == EntityId);
+			TestTrue("Command target has its initial component", Entry.Components.Num() == 1);
+			TestTrue("Command target has its buffered update", Entry.Updates.Num() == 1);
+			TestFalse("Command target is no longer queued", Queue.Contains(EntityId));
+		}
+
+		TestFalse("Command for an entity that isn't queued leaves the queue alone", Queue.Contains(3));
+		TestEqual("Nothing is parked", Queue.NumParked(), 0);
+
+		// The class load still completes, without handing the entity out a second time.
+		Queue.OnClassLoaded(Class);
+		TestEqual("Class is no longer loading", Queue.NumLoadingClasses(), 0);
+		TestTrue("Popped entities don't come out again", PopAll(Queue).Num() == 0);
+	}
+
+	return true;
+}
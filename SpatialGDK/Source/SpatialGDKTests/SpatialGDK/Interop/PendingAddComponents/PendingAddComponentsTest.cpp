@@ -0,0 +1,202 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestDefinitions.h"
+
+#include "Interop/SpatialReceiver.h"
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+#include <WorkerSDK/improbable/c_worker.h>
+
+#define PENDINGADDCOMPONENTS_TEST(TestName) \
+	GDK_TEST(Core, FPendingAddComponentMap, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	const uint32 NumComponentsPerEntity = 8;
+	const Worker_EntityId FirstEntityId = 1000;
+
+	// Owns the component data handed to the buffers, standing in for the op list during a critical section.
+	struct FTestComponentData
+	{
+		FTestComponentData()
+		{
+			Data = {};
+			Data.schema_type = Schema_CreateComponentData();
+		}
+
+		~FTestComponentData()
+		{
+			Schema_DestroyComponentData(Data.schema_type);
+		}
+
+		Worker_ComponentData ForComponent(Worker_ComponentId ComponentId) const
+		{
+			Worker_ComponentData ComponentData = Data;
+			ComponentData.component_id = ComponentId;
+			return ComponentData;
+		}
+
+		Worker_ComponentData Data;
+	};
+
+	Worker_ComponentId TestComponentId(uint32 Index)
+	{
+		// Deliberately not in ascending order, so the test can tell arrival order from sorted order.
+		return SpatialConstants::STARTING_GENERATED_COMPONENT_ID + (NumComponentsPerEntity - 1 - Index);
+	}
+
+	// Buffers AddComponent ops the way USpatialReceiver::OnAddComponent does during a critical section.
+	// Components arrive entity by entity, as they do when a critical section adds new entities.
+	void BufferCriticalSection(FPendingAddComponentMap& PendingAddComponents, const FTestComponentData& ComponentData, int32 NumEntities)
+	{
+		for (int32 i = 0; i < NumEntities; i++)
+		{
+			const Worker_EntityId EntityId = FirstEntityId + i;
+			for (uint32 j = 0; j < NumComponentsPerEntity; j++)
+			{
+				const Worker_ComponentId ComponentId = TestComponentId(j);
+				PendingAddComponents.FindOrAdd(EntityId).Emplace(EntityId, ComponentId, ComponentData.ForComponent(ComponentId));
+			}
+		}
+	}
+
+	// Visits each entity's pending components the way USpatialReceiver::ReceiveActor does when leaving the critical section.
+	uint64 ReceiveAllEntities(FPendingAddComponentMap& PendingAddComponents, int32 NumEntities)
+	{
+		uint64 Checksum = 0;
+		for (int32 i = 0; i < NumEntities; i++)
+		{
+			if (TArray<PendingAddComponentWrapper>* EntityPendingAddComponents = PendingAddComponents.Find(FirstEntityId + i))
+			{
+				for (const PendingAddComponentWrapper& PendingAddComponent : *EntityPendingAddComponents)
+				{
+					Checksum += PendingAddComponent.ComponentId;
+				}
+			}
+		}
+		return Checksum;
+	}
+
+	// The previous layout: one flat array, scanned in full for every received entity.
+	uint64 ReceiveAllEntitiesFromFlatArray(TArray<PendingAddComponentWrapper>& PendingAddComponents, int32 NumEntities)
+	{
+		uint64 Checksum = 0;
+		for (int32 i = 0; i < NumEntities; i++)
+		{
+			for (const PendingAddComponentWrapper& PendingAddComponent : PendingAddComponents)
+			{
+				if (PendingAddComponent.EntityId == FirstEntityId + i)
+				{
+					Checksum += PendingAddComponent.ComponentId;
+				}
+			}
+		}
+		return Checksum;
+	}
+
+	uint64 ExpectedChecksum(int32 NumEntities)
+	{
+		uint64 PerEntity = 0;
+		for (uint32 j = 0; j < NumComponentsPerEntity; j++)
+		{
+			PerEntity += TestComponentId(j);
+		}
+		return PerEntity * NumEntities;
+	}
+} // anonymous namespace
+
+PENDINGADDCOMPONENTS_TEST(GIVEN_components_for_interleaved_entities_WHEN_buffered_THEN_each_entity_keeps_arrival_order)
+{
+	FTestComponentData ComponentData;
+
+	{
+		FPendingAddComponentMap PendingAddComponents;
+
+		// Interleave two entities' components to check order is kept per entity.
+		for (uint32 j = 0; j < NumComponentsPerEntity; j++)
+		{
+			const Worker_ComponentId ComponentId = TestComponentId(j);
+			PendingAddComponents.FindOrAdd(FirstEntityId).Emplace(FirstEntityId, ComponentId, ComponentData.ForComponent(ComponentId));
+			PendingAddComponents.FindOrAdd(FirstEntityId + 1).Emplace(FirstEntityId + 1, ComponentId, ComponentData.ForComponent(ComponentId));
+		}
+
+		TestTrue("Two entities are buffered", PendingAddComponents.Num() == 2);
+
+		for (Worker_EntityId EntityId : { FirstEntityId, FirstEntityId + 1 })
+		{
+			TArray<PendingAddComponentWrapper>* EntityPendingAddComponents = PendingAddComponents.Find(EntityId);
+			if (!TestNotNull("Entity has pending components", EntityPendingAddComponents))
+			{
+				return false;
+			}
+
+			TestTrue("Entity has all its components", EntityPendingAddComponents->Num() == NumComponentsPerEntity);
+			for (int32 j = 0; j < EntityPendingAddComponents->Num(); j++)
+			{
+				const PendingAddComponentWrapper& PendingAddComponent = (*EntityPendingAddComponents)[j];
+				TestTrue("Component belongs to the entity", PendingAddComponent.EntityId == EntityId);
+				TestTrue("Components are in arrival order", PendingAddComponent.ComponentId == TestComponentId(j));
+				TestNotNull("Component data is held", PendingAddComponent.Data.ComponentData);
+			}
+		}
+
+		TestNull("Unknown entity has no pending components", PendingAddComponents.Find(FirstEntityId + 2));
+	}
+
+	return true;
+}
+
+PENDINGADDCOMPONENTS_TEST(GIVEN_large_critical_sections_WHEN_entities_are_received_THEN_report_buffering_cost)
+{
+	FTestComponentData ComponentData;
+
+	for (int32 NumEntities : { 1000, 10000, 50000 })
+	{
+		FPendingAddComponentMap PendingAddComponents;
+
+		double StartTime = FPlatformTime::Seconds();
+		BufferCriticalSection(PendingAddComponents, ComponentData, NumEntities);
+		const double BufferTime = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		const uint64 Checksum = ReceiveAllEntities(PendingAddComponents, NumEntities);
+		const double ReceiveTime = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		PendingAddComponents.Empty();
+		const double ReleaseTime = FPlatformTime::Seconds() - StartTime;
+
+		TestTrue(FString::Printf(TEXT("Every component was received for %d entities"), NumEntities), Checksum == ExpectedChecksum(NumEntities));
+
+		AddInfo(FString::Printf(TEXT("%d entities x %u components: buffered in %.2fms, received in %.2fms, released in %.2fms"),
+			NumEntities, NumComponentsPerEntity, BufferTime * 1000.0, ReceiveTime * 1000.0, ReleaseTime * 1000.0));
+	}
+
+	// The flat array is quadratic, so only compare against it for the smallest critical section.
+	{
+		const int32 NumEntities = 1000;
+		TArray<PendingAddComponentWrapper> FlatPendingAddComponents;
+		for (int32 i = 0; i < NumEntities; i++)
+		{
+			for (uint32 j = 0; j < NumComponentsPerEntity; j++)
+			{
+				const Worker_ComponentId ComponentId = TestComponentId(j);
+				FlatPendingAddComponents.Emplace(FirstEntityId + i, ComponentId, ComponentData.ForComponent(ComponentId));
+			}
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+		const uint64 Checksum = ReceiveAllEntitiesFromFlatArray(FlatPendingAddComponents, NumEntities);
+		const double ReceiveTime = FPlatformTime::Seconds() - StartTime;
+
+		TestTrue("Flat array received every component", Checksum == ExpectedChecksum(NumEntities));
+		AddInfo(FString::Printf(TEXT("%d entities x %u components with a flat array: received in %.2fms"), NumEntities, NumComponentsPerEntity, ReceiveTime * 1000.0));
+	}
+
+	return true;
+}
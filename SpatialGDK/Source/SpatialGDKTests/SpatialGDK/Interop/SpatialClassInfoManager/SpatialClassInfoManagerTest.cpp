@@ -0,0 +1,185 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestDefinitions.h"
+#include "TestWarmUpActor.h"
+
+#include "Interop/SpatialClassInfoManager.h"
+#include "SpatialConstants.h"
+#include "SpatialGDKSettings.h"
+#include "Utils/ActorGroupManager.h"
+#include "Utils/SchemaDatabase.h"
+
+#include "CoreMinimal.h"
+#include "Tests/AutomationCommon.h"
+
+#define SPATIALCLASSINFOMANAGER_TEST(TestName) \
+	GDK_TEST(Core, USpatialClassInfoManager, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	const double WarmUpTimeoutSeconds = 10.0;
+
+	USpatialClassInfoManager* WarmUpClassInfoManager = nullptr;
+	int32 NumWarmUpBuildingTicks = 0;
+
+	bool bSavedWarmUpClassInfo = false;
+	TArray<FSoftClassPath> SavedClassInfoWarmUpClasses;
+	float SavedClassInfoWarmUpBudgetMs = 0.f;
+
+	void AddActorSchema(USchemaDatabase* SchemaDatabase, UClass* ActorClass, uint32& NextComponentId)
+	{
+		FActorSchemaData ActorData;
+		ActorData.GeneratedSchemaName = ActorClass->GetName();
+		for (int32 Type = SCHEMA_Begin; Type < SCHEMA_Count; Type++)
+		{
+			ActorData.SchemaComponents[Type] = NextComponentId++;
+		}
+		SchemaDatabase->ActorClassPathToSchema.Add(ActorClass->GetPathName(), ActorData);
+	}
+
+	USchemaDatabase* CreateTestSchemaDatabase()
+	{
+		USchemaDatabase* SchemaDatabase = NewObject<USchemaDatabase>();
+
+		uint32 NextComponentId = SpatialConstants::STARTING_GENERATED_COMPONENT_ID;
+
+		AddActorSchema(SchemaDatabase, ATestWarmUpActor::StaticClass(), NextComponentId);
+		AddActorSchema(SchemaDatabase, ATestWarmUpOtherActor::StaticClass(), NextComponentId);
+
+		FActorSpecificSubobjectSchemaData ActorSubobjectData;
+		ActorSubobjectData.ClassPath = UTestWarmUpComponent::StaticClass()->GetPathName();
+		ActorSubobjectData.Name = FName(TEXT("WarmUpComponent"));
+		ActorSubobjectData.SchemaComponents[SCHEMA_Data] = NextComponentId++;
+		SchemaDatabase->ActorClassPathToSchema[ATestWarmUpActor::StaticClass()->GetPathName()].SubobjectData.Add(ActorSubobjectData.SchemaComponents[SCHEMA_Data], ActorSubobjectData);
+
+		FSubobjectSchemaData SubobjectData;
+		SubobjectData.GeneratedSchemaName = UTestWarmUpComponent::StaticClass()->GetName();
+		FDynamicSubobjectSchemaData DynamicData;
+		DynamicData.SchemaComponents[SCHEMA_Data] = NextComponentId++;
+		SubobjectData.DynamicSubobjectComponents.Add(DynamicData);
+		SchemaDatabase->SubobjectClassPathToSchema.Add(UTestWarmUpComponent::StaticClass()->GetPathName(), SubobjectData);
+
+		SchemaDatabase->NextAvailableComponentId = NextComponentId;
+
+		return SchemaDatabase;
+	}
+
+	// Class info is built without a net driver, as with a worker that has not connected yet.
+	void StartWarmUp(const TArray<FSoftClassPath>& Classes, float BudgetMs)
+	{
+		USpatialGDKSettings* Settings = GetMutableDefault<USpatialGDKSettings>();
+		bSavedWarmUpClassInfo = Settings->bWarmUpClassInfo;
+		SavedClassInfoWarmUpClasses = Settings->ClassInfoWarmUpClasses;
+		SavedClassInfoWarmUpBudgetMs = Settings->ClassInfoWarmUpBudgetMs;
+
+		Settings->bWarmUpClassInfo = true;
+		Settings->ClassInfoWarmUpClasses = Classes;
+		Settings->ClassInfoWarmUpBudgetMs = BudgetMs;
+
+		UActorGroupManager* ActorGroupManager = NewObject<UActorGroupManager>();
+		ActorGroupManager->Init();
+
+		NumWarmUpBuildingTicks = 0;
+		WarmUpClassInfoManager = NewObject<USpatialClassInfoManager>();
+		WarmUpClassInfoManager->AddToRoot();
+		WarmUpClassInfoManager->InitWithSchemaDatabase(nullptr, ActorGroupManager, CreateTestSchemaDatabase());
+		WarmUpClassInfoManager->StartWarmUp();
+	}
+
+	bool HasAnyTestClassInfo()
+	{
+		return WarmUpClassInfoManager->HasClassInfo(ATestWarmUpActor::StaticClass())
+			|| WarmUpClassInfoManager->HasClassInfo(ATestWarmUpOtherActor::StaticClass())
+			|| WarmUpClassInfoManager->HasClassInfo(UTestWarmUpComponent::StaticClass());
+	}
+
+	bool HasWarmUpTimedOut(FAutomationTestBase* Test, double RunTime)
+	{
+		if (RunTime > WarmUpTimeoutSeconds)
+		{
+			Test->AddError(TEXT("Timed out waiting for the warm-up classes to load"));
+			return true;
+		}
+		return false;
+	}
+} // anonymous namespace
+
+// With no budget, the class info is built as soon as the classes have loaded, without waiting for TickWarmUp.
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FCheckWarmUpBuildsConfiguredClasses, FAutomationTestBase*, Test);
+bool FCheckWarmUpBuildsConfiguredClasses::Update()
+{
+	if (WarmUpClassInfoManager->IsWarmingUp())
+	{
+		return HasWarmUpTimedOut(Test, GetCurrentRunTime());
+	}
+
+	Test->TestTrue("Configured actor class is warmed up", WarmUpClassInfoManager->HasClassInfo(ATestWarmUpActor::StaticClass()));
+	Test->TestTrue("Subobject class of the configured actor class is warmed up", WarmUpClassInfoManager->HasClassInfo(UTestWarmUpComponent::StaticClass()));
+	Test->TestFalse("Actor class that is not configured is not warmed up", WarmUpClassInfoManager->HasClassInfo(ATestWarmUpOtherActor::StaticClass()));
+
+	return true;
+}
+
+// Every class takes longer to build than the budget allows, so each tick builds exactly one.
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(FCheckWarmUpRespectsBudget, FAutomationTestBase*, Test, int32, NumClasses);
+bool FCheckWarmUpRespectsBudget::Update()
+{
+	WarmUpClassInfoManager->TickWarmUp();
+
+	if (!HasAnyTestClassInfo())
+	{
+		return HasWarmUpTimedOut(Test, GetCurrentRunTime());
+	}
+
+	NumWarmUpBuildingTicks++;
+	if (WarmUpClassInfoManager->IsWarmingUp() && NumWarmUpBuildingTicks < NumClasses)
+	{
+		return false;
+	}
+
+	Test->TestFalse("Warm-up finishes once every class is built", WarmUpClassInfoManager->IsWarmingUp());
+	Test->TestEqual("One class is built per tick", NumWarmUpBuildingTicks, NumClasses);
+	Test->TestTrue("Configured actor class is warmed up", WarmUpClassInfoManager->HasClassInfo(ATestWarmUpActor::StaticClass()));
+	Test->TestTrue("Other configured actor class is warmed up", WarmUpClassInfoManager->HasClassInfo(ATestWarmUpOtherActor::StaticClass()));
+	Test->TestTrue("Subobject class of the configured actor class is warmed up", WarmUpClassInfoManager->HasClassInfo(UTestWarmUpComponent::StaticClass()));
+
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND(FCleanupWarmUpTest);
+bool FCleanupWarmUpTest::Update()
+{
+	USpatialGDKSettings* Settings = GetMutableDefault<USpatialGDKSettings>();
+	Settings->bWarmUpClassInfo = bSavedWarmUpClassInfo;
+	Settings->ClassInfoWarmUpClasses = SavedClassInfoWarmUpClasses;
+	Settings->ClassInfoWarmUpBudgetMs = SavedClassInfoWarmUpBudgetMs;
+
+	WarmUpClassInfoManager->RemoveFromRoot();
+	WarmUpClassInfoManager = nullptr;
+
+	return true;
+}
+
+SPATIALCLASSINFOMANAGER_TEST(GIVEN_warm_up_classes_WHEN_warm_up_has_no_budget_THEN_class_info_is_built_for_them_and_their_subobject_classes)
+{
+	StartWarmUp({ FSoftClassPath(ATestWarmUpActor::StaticClass()) }, 0.f);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckWarmUpBuildsConfiguredClasses(this));
+	ADD_LATENT_AUTOMATION_COMMAND(FCleanupWarmUpTest());
+
+	return true;
+}
+
+SPATIALCLASSINFOMANAGER_TEST(GIVEN_warm_up_classes_WHEN_each_exceeds_the_warm_up_budget_THEN_class_info_is_built_over_several_ticks)
+{
+	// The configured actor classes, plus the subobject class of ATestWarmUpActor.
+	const int32 NumClasses = 3;
+	StartWarmUp({ FSoftClassPath(ATestWarmUpActor::StaticClass()), FSoftClassPath(ATestWarmUpOtherActor::StaticClass()) }, 0.000001f);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckWarmUpRespectsBudget(this, NumClasses));
+	ADD_LATENT_AUTOMATION_COMMAND(FCleanupWarmUpTest());
+
+	return true;
+}
@@ -0,0 +1,8 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestWarmUpActor.h"
+
+ATestWarmUpActor::ATestWarmUpActor()
+{
+	WarmUpComponent = CreateDefaultSubobject<UTestWarmUpComponent>(TEXT("WarmUpComponent"));
+}
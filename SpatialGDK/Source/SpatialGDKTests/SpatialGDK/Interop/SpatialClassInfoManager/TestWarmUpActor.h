@@ -0,0 +1,35 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "TestWarmUpActor.generated.h"
+
+/**
+ * These types are for testing purposes only.
+ */
+UCLASS(HideDropdown)
+class SPATIALGDKTESTS_API UTestWarmUpComponent : public UActorComponent
+{
+	GENERATED_BODY()
+};
+
+UCLASS(HideDropdown)
+class SPATIALGDKTESTS_API ATestWarmUpActor : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	ATestWarmUpActor();
+
+	UPROPERTY()
+	UTestWarmUpComponent* WarmUpComponent;
+};
+
+UCLASS(HideDropdown)
+class SPATIALGDKTESTS_API ATestWarmUpOtherActor : public AActor
+{
+	GENERATED_BODY()
+};
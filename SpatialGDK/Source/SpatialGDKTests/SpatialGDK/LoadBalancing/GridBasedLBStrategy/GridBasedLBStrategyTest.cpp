@@ -5,6 +5,8 @@
 #include "LoadBalancing/GridBasedLBStrategy.h"
 #include "GameFramework/DefaultPawn.h"
 #include "GameFramework/GameStateBase.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
 #include "SpatialConstants.h"
 #include "TestDefinitions.h"
 #include "TestGridBasedLBStrategy.h"
@@ -22,6 +24,73 @@ namespace
 	UGridBasedLBStrategy* Strat;
 }
 
+namespace
+{
+	// Builds the cells the same way UGridBasedLBStrategy::Init does, in virtual worker order.
+	TArray<FBox2D> CreateCells(uint32 Rows, uint32 Cols, float WorldWidth, float WorldHeight)
+	{
+		TArray<FBox2D> Cells;
+
+		const float ColumnWidth = WorldWidth / Cols;
+		const float RowHeight = WorldHeight / Rows;
+
+		float XMin = -(WorldWidth / 2.f);
+		for (uint32 Col = 0; Col < Cols; ++Col)
+		{
+			const float XMax = XMin + ColumnWidth;
+			float YMin = -(WorldHeight / 2.f);
+			for (uint32 Row = 0; Row < Rows; ++Row)
+			{
+				const float YMax = YMin + RowHeight;
+				Cells.Add(FBox2D(FVector2D(XMin, YMin), FVector2D(XMax, YMax)));
+				YMin = YMax;
+			}
+			XMin = XMax;
+		}
+
+		return Cells;
+	}
+
+	// The lookup UGridBasedLBStrategy used before cells were computed directly from the location.
+	uint32 FindVirtualWorkerByScan(const TArray<FBox2D>& Cells, const FVector2D& Location)
+	{
+		for (int32 i = 0; i < Cells.Num(); i++)
+		{
+			if (Cells[i].Min.X <= Location.X && Cells[i].Min.Y <= Location.Y
+				&& Location.X < Cells[i].Max.X && Location.Y < Cells[i].Max.Y)
+			{
+				return i + 1;
+			}
+		}
+
+		return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	}
+
+	// Moves an actor back and forth across the edge between two cells, handing it over whenever its worker relinquishes it.
+	int32 CountHandoversAtCellEdge(UGridBasedLBStrategy* Strategy, float JitterDistance)
+	{
+		FRandomStream Random(1234);
+
+		FVector2D Location(-1.f, 0.f);
+		uint32 Owner = Strategy->WhoShouldHaveAuthority(Location);
+
+		int32 Handovers = 0;
+		for (int32 Tick = 0; Tick < 1000; Tick++)
+		{
+			Location.X = Random.FRandRange(-JitterDistance, JitterDistance);
+
+			Strategy->SetLocalVirtualWorkerId(Owner);
+			if (Strategy->ShouldRelinquishAuthority(Location))
+			{
+				Owner = Strategy->WhoShouldHaveAuthority(Location);
+				Handovers++;
+			}
+		}
+
+		return Handovers;
+	}
+} // anonymous namespace
+
 // Copied from AutomationCommon::GetAnyGameWorld()
 UWorld* GetAnyGameWorld()
 {
@@ -285,3 +354,122 @@ GRIDBASEDLBSTRATEGY_TEST(GIVEN_two_cells_WHEN_actor_in_one_cell_THEN_strategy_re
 
 	return true;
 }
+
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_a_grid_WHEN_locations_are_looked_up_THEN_they_match_the_cell_containing_them)
+{
+	const uint32 Rows = 7;
+	const uint32 Cols = 13;
+	Strat = UTestGridBasedLBStrategy::Create(Rows, Cols, 10000.f, 10000.f);
+	Strat->Init(nullptr);
+
+	const TArray<FBox2D> Cells = CreateCells(Rows, Cols, 10000.f, 10000.f);
+
+	// Cell corners, points just either side of them, and points outside the world.
+	TArray<FVector2D> Locations;
+	for (const FBox2D& Cell : Cells)
+	{
+		for (const FVector2D& Corner : { Cell.Min, Cell.Max })
+		{
+			Locations.Add(Corner);
+			Locations.Add(Corner - FVector2D(0.01f, 0.01f));
+			Locations.Add(Corner + FVector2D(0.01f, 0.01f));
+		}
+	}
+	Locations.Add(FVector2D(-20000.f, 0.f));
+	Locations.Add(FVector2D(0.f, 20000.f));
+
+	TArray<uint32> BatchVirtualWorkerIds;
+	Strat->WhoShouldHaveAuthority(Locations, BatchVirtualWorkerIds);
+	TestEqual("Batch returns a worker for each location", BatchVirtualWorkerIds.Num(), Locations.Num());
+
+	int32 Mismatches = 0;
+	for (int32 i = 0; i < Locations.Num(); i++)
+	{
+		const uint32 Expected = FindVirtualWorkerByScan(Cells, Locations[i]);
+		if (Strat->WhoShouldHaveAuthority(Locations[i]) != Expected || BatchVirtualWorkerIds[i] != Expected)
+		{
+			AddError(FString::Printf(TEXT("Location %s should belong to virtual worker %u"), *Locations[i].ToString(), Expected));
+			Mismatches++;
+		}
+	}
+	TestEqual("Lookups matching the containing cell", Mismatches, 0);
+
+	return true;
+}
+
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_an_actor_on_a_cell_edge_WHEN_it_jitters_THEN_boundary_hysteresis_prevents_handovers)
+{
+	const float JitterDistance = 50.f;
+
+	Strat = UTestGridBasedLBStrategy::Create(1, 2, 10000.f, 10000.f);
+	Strat->Init(nullptr);
+	const int32 HandoversWithoutHysteresis = CountHandoversAtCellEdge(Strat, JitterDistance);
+
+	Strat = UTestGridBasedLBStrategy::Create(1, 2, 10000.f, 10000.f, 2.f * JitterDistance);
+	Strat->Init(nullptr);
+	const int32 HandoversWithHysteresis = CountHandoversAtCellEdge(Strat, JitterDistance);
+
+	TestTrue("Jitter across an edge hands the actor over without hysteresis", HandoversWithoutHysteresis > 0);
+	TestEqual("Jitter within the hysteresis never hands the actor over", HandoversWithHysteresis, 0);
+
+	Strat->SetLocalVirtualWorkerId(Strat->WhoShouldHaveAuthority(FVector2D(-1.f, 0.f)));
+	TestFalse("Worker keeps an actor just past its edge", Strat->ShouldRelinquishAuthority(FVector2D(JitterDistance, 0.f)));
+	TestTrue("Worker relinquishes an actor beyond the hysteresis", Strat->ShouldRelinquishAuthority(FVector2D(4.f * JitterDistance, 0.f)));
+
+	AddInfo(FString::Printf(TEXT("Actor jittering %.0fcm across a cell edge for 1000 ticks: %d handovers without hysteresis, %d with %.0fcm"),
+		JitterDistance, HandoversWithoutHysteresis, HandoversWithHysteresis, 2.f * JitterDistance));
+
+	return true;
+}
+
+// Simulates a server deciding authority for every replicated actor in a tick on a large grid.
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_a_32x32_grid_WHEN_many_locations_are_looked_up_THEN_report_lookup_throughput)
+{
+	const uint32 GridSize = 32;
+	const float WorldSize = 100000.f;
+	const int32 NumLocations = 100000;
+
+	Strat = UTestGridBasedLBStrategy::Create(GridSize, GridSize, WorldSize, WorldSize);
+	Strat->Init(nullptr);
+
+	const TArray<FBox2D> Cells = CreateCells(GridSize, GridSize, WorldSize, WorldSize);
+
+	FRandomStream Random(NumLocations);
+	TArray<FVector2D> Locations;
+	for (int32 i = 0; i < NumLocations; i++)
+	{
+		Locations.Add(FVector2D(Random.FRandRange(-WorldSize / 2.f, WorldSize / 2.f), Random.FRandRange(-WorldSize / 2.f, WorldSize / 2.f)));
+	}
+
+	TArray<uint32> ScanVirtualWorkerIds;
+	ScanVirtualWorkerIds.SetNumUninitialized(NumLocations);
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumLocations; i++)
+	{
+		ScanVirtualWorkerIds[i] = FindVirtualWorkerByScan(Cells, Locations[i]);
+	}
+	const double ScanTime = FPlatformTime::Seconds() - StartTime;
+
+	TArray<uint32> SingleVirtualWorkerIds;
+	SingleVirtualWorkerIds.SetNumUninitialized(NumLocations);
+	StartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumLocations; i++)
+	{
+		SingleVirtualWorkerIds[i] = Strat->WhoShouldHaveAuthority(Locations[i]);
+	}
+	const double SingleTime = FPlatformTime::Seconds() - StartTime;
+
+	TArray<uint32> BatchVirtualWorkerIds;
+	StartTime = FPlatformTime::Seconds();
+	Strat->WhoShouldHaveAuthority(Locations, BatchVirtualWorkerIds);
+	const double BatchTime = FPlatformTime::Seconds() - StartTime;
+
+	TestTrue("Direct lookups match the scan", SingleVirtualWorkerIds == ScanVirtualWorkerIds);
+	TestTrue("Batch lookups match the scan", BatchVirtualWorkerIds == ScanVirtualWorkerIds);
+
+	AddInfo(FString::Printf(TEXT("%d lookups on a %ux%u grid: scan %.2fms (%.1fns each), direct %.2fms (%.1fns each), batch %.2fms (%.1fns each)"),
+		NumLocations, GridSize, GridSize, ScanTime * 1000.0, ScanTime * 1e9 / NumLocations, SingleTime * 1000.0, SingleTime * 1e9 / NumLocations,
+		BatchTime * 1000.0, BatchTime * 1e9 / NumLocations));
+
+	return true;
+}
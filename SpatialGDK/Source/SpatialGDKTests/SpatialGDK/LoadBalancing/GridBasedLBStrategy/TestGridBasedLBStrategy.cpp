@@ -2,7 +2,7 @@
 
 #include "TestGridBasedLBStrategy.h"
 
-UGridBasedLBStrategy* UTestGridBasedLBStrategy::Create(uint32 InRows, uint32 InCols, float WorldWidth, float WorldHeight)
+UGridBasedLBStrategy* UTestGridBasedLBStrategy::Create(uint32 InRows, uint32 InCols, float WorldWidth, float WorldHeight, float BoundaryHysteresis)
 {
 	UTestGridBasedLBStrategy* Strat = NewObject<UTestGridBasedLBStrategy>();
 
@@ -12,5 +12,7 @@ UGridBasedLBStrategy* UTestGridBasedLBStrategy::Create(uint32 InRows, uint32 InC
 	Strat->WorldWidth = WorldWidth;
 	Strat->WorldHeight = WorldHeight;
 
+	Strat->BoundaryHysteresis = BoundaryHysteresis;
+
 	return Strat;
 }
@@ -0,0 +1,190 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "CoreMinimal.h"
+#include "LoadBalancing/KDTreeLBStrategy.h"
+#include "Math/RandomStream.h"
+#include "SpatialConstants.h"
+#include "TestDefinitions.h"
+#include "TestKDTreeLBStrategy.h"
+
+#define KDTREELBSTRATEGY_TEST(TestName) \
+	GDK_TEST(Core, UKDTreeLBStrategy, TestName)
+
+namespace
+{
+	const float TestWorldSize = 100000.f;
+
+	UKDTreeLBStrategy* CreateStrategy(uint32 NumWorkers)
+	{
+		UKDTreeLBStrategy* Strat = UTestKDTreeLBStrategy::Create(NumWorkers, TestWorldSize, TestWorldSize);
+		Strat->Init(nullptr);
+		Strat->SetLocalVirtualWorkerId(1);
+		return Strat;
+	}
+
+	struct FCrowdSimulationResult
+	{
+		double MeanMaxToMeanLoad = 0.0;
+		double PeakMaxToMeanLoad = 0.0;
+		int32 Handoffs = 0;
+		int32 Rebalances = 0;
+	};
+
+	// Moves a crowd of agents, most of which follow a hotspot circling the world, assigning each to a worker every
+	// simulated second. Load is reported as the number of agents per worker, relative to an even share.
+	FCrowdSimulationResult SimulateCrowd(UKDTreeLBStrategy* Strat, uint32 NumWorkers, bool bRebalance)
+	{
+		const int32 NumAgents = 20000;
+		const int32 NumTicks = 600;
+		const float HalfWorld = TestWorldSize / 2.f;
+		const double EvenShare = (double)NumAgents / NumWorkers;
+
+		FRandomStream Random(NumAgents);
+
+		TArray<FVector2D> Positions;
+		TArray<bool> bFollowsHotspot;
+		TArray<uint32> Owners;
+		for (int32 i = 0; i < NumAgents; i++)
+		{
+			Positions.Add(FVector2D(Random.FRandRange(-HalfWorld, HalfWorld), Random.FRandRange(-HalfWorld, HalfWorld)));
+			bFollowsHotspot.Add(Random.FRand() < 0.7f);
+			Owners.Add(SpatialConstants::INVALID_VIRTUAL_WORKER_ID);
+		}
+
+		FCrowdSimulationResult Result;
+		TArray<int32> Counts;
+
+		for (int32 Tick = 0; Tick < NumTicks; Tick++)
+		{
+			const float Angle = 2.f * PI * Tick / NumTicks;
+			const FVector2D Hotspot(FMath::Cos(Angle) * HalfWorld * 0.5f, FMath::Sin(Angle) * HalfWorld * 0.5f);
+
+			Counts.Init(0, NumWorkers);
+			for (int32 i = 0; i < NumAgents; i++)
+			{
+				FVector2D Step(Random.FRandRange(-200.f, 200.f), Random.FRandRange(-200.f, 200.f));
+				if (bFollowsHotspot[i])
+				{
+					Step += (Hotspot + FVector2D(Random.FRandRange(-5000.f, 5000.f), Random.FRandRange(-5000.f, 5000.f)) - Positions[i]) * 0.05f;
+				}
+				Positions[i] = (Positions[i] + Step).ClampAxes(-HalfWorld, HalfWorld);
+
+				const uint32 Owner = Strat->WhoShouldHaveAuthority(Positions[i]);
+				if (Owners[i] != SpatialConstants::INVALID_VIRTUAL_WORKER_ID && Owners[i] != Owner)
+				{
+					Result.Handoffs++;
+				}
+				Owners[i] = Owner;
+				Counts[Owner - 1]++;
+			}
+
+			int32 MaxCount = 0;
+			for (int32 Count : Counts)
+			{
+				MaxCount = FMath::Max(MaxCount, Count);
+			}
+			const double MaxToMean = MaxCount / EvenShare;
+			Result.MeanMaxToMeanLoad += MaxToMean / NumTicks;
+			Result.PeakMaxToMeanLoad = FMath::Max(Result.PeakMaxToMeanLoad, MaxToMean);
+
+			if (bRebalance)
+			{
+				for (uint32 WorkerIndex = 0; WorkerIndex < NumWorkers; WorkerIndex++)
+				{
+					Strat->SetWorkerLoad(WorkerIndex + 1, Counts[WorkerIndex] / EvenShare, Counts[WorkerIndex]);
+				}
+				Result.Rebalances += Strat->Rebalance((float)Tick) ? 1 : 0;
+			}
+		}
+
+		return Result;
+	}
+} // anonymous namespace
+
+KDTREELBSTRATEGY_TEST(GIVEN_n_workers_WHEN_initialized_THEN_regions_split_the_world_evenly)
+{
+	const uint32 NumWorkers = 6;
+	UKDTreeLBStrategy* Strat = CreateStrategy(NumWorkers);
+
+	TSet<uint32> VirtualWorkerIds = Strat->GetVirtualWorkerIds();
+	TestEqual("Number of virtual workers", VirtualWorkerIds.Num(), (int32)NumWorkers);
+
+	const float ExpectedArea = TestWorldSize * TestWorldSize / NumWorkers;
+	for (uint32 VirtualWorkerId : VirtualWorkerIds)
+	{
+		const FBox2D& Region = Strat->GetWorkerRegion(VirtualWorkerId);
+		TestTrue(FString::Printf(TEXT("Worker %u has an even share of the world"), VirtualWorkerId), FMath::IsNearlyEqual(Region.GetArea(), ExpectedArea, ExpectedArea * 0.01f));
+		TestTrue(FString::Printf(TEXT("Centre of worker %u's region is its own"), VirtualWorkerId), Strat->WhoShouldHaveAuthority(Region.GetCenter()) == VirtualWorkerId);
+	}
+
+	TestTrue("Locations outside the world belong to a worker", Strat->WhoShouldHaveAuthority(FVector2D(TestWorldSize, -TestWorldSize)) != SpatialConstants::INVALID_VIRTUAL_WORKER_ID);
+
+	return true;
+}
+
+KDTREELBSTRATEGY_TEST(GIVEN_load_within_threshold_WHEN_rebalanced_THEN_regions_do_not_move)
+{
+	UKDTreeLBStrategy* Strat = CreateStrategy(4);
+
+	const FBox2D RegionBefore = Strat->GetWorkerRegion(1);
+
+	Strat->SetWorkerLoad(1, 1.1, 0);
+	Strat->SetWorkerLoad(2, 1.0, 0);
+	Strat->SetWorkerLoad(3, 0.95, 0);
+	Strat->SetWorkerLoad(4, 1.0, 0);
+
+	TestFalse("Nearly even load doesn't rebalance", Strat->Rebalance(100.f));
+	TestTrue("Region is unchanged", Strat->GetWorkerRegion(1) == RegionBefore);
+
+	return true;
+}
+
+KDTREELBSTRATEGY_TEST(GIVEN_an_overloaded_worker_WHEN_rebalanced_THEN_its_region_shrinks_at_a_limited_rate)
+{
+	UKDTreeLBStrategy* Strat = CreateStrategy(4);
+
+	const float AreaBefore = Strat->GetWorkerRegion(1).GetArea();
+
+	Strat->SetWorkerLoad(1, 4.0, 0);
+	Strat->SetWorkerLoad(2, 1.0, 0);
+	Strat->SetWorkerLoad(3, 1.0, 0);
+	Strat->SetWorkerLoad(4, 1.0, 0);
+
+	TestTrue("Uneven load rebalances", Strat->Rebalance(100.f));
+
+	const float AreaAfter = Strat->GetWorkerRegion(1).GetArea();
+	TestTrue("Overloaded worker's region shrinks", AreaAfter < AreaBefore);
+
+	// With the default 10% limit on each of the two splits above a leaf, its region keeps at least 0.8 * 0.8 of its area.
+	TestTrue("Region shrinks by a limited amount", AreaAfter >= AreaBefore * 0.8f * 0.8f * 0.99f);
+
+	TestFalse("Rebalancing again straight away does nothing", Strat->Rebalance(101.f));
+	TestTrue("Rebalancing after the minimum interval moves regions again", Strat->Rebalance(200.f));
+
+	float TotalArea = 0.f;
+	for (uint32 VirtualWorkerId : Strat->GetVirtualWorkerIds())
+	{
+		TotalArea += Strat->GetWorkerRegion(VirtualWorkerId).GetArea();
+	}
+	TestTrue("Regions still cover the world", FMath::IsNearlyEqual(TotalArea, TestWorldSize * TestWorldSize, TestWorldSize * TestWorldSize * 0.001f));
+
+	return true;
+}
+
+// Replays a synthetic crowd against fixed and adaptive regions, reporting the load on the busiest worker and the number of handoffs.
+KDTREELBSTRATEGY_TEST(GIVEN_a_moving_crowd_WHEN_simulated_THEN_adaptive_regions_reduce_peak_load)
+{
+	const uint32 NumWorkers = 8;
+
+	const FCrowdSimulationResult Fixed = SimulateCrowd(CreateStrategy(NumWorkers), NumWorkers, /* bRebalance */ false);
+	const FCrowdSimulationResult Adaptive = SimulateCrowd(CreateStrategy(NumWorkers), NumWorkers, /* bRebalance */ true);
+
+	TestTrue("Adaptive regions lower the average load on the busiest worker", Adaptive.MeanMaxToMeanLoad < Fixed.MeanMaxToMeanLoad);
+
+	AddInfo(FString::Printf(TEXT("Fixed regions: busiest worker at %.2fx mean load on average (peak %.2fx), %d handoffs"),
+		Fixed.MeanMaxToMeanLoad, Fixed.PeakMaxToMeanLoad, Fixed.Handoffs));
+	AddInfo(FString::Printf(TEXT("Adaptive regions: busiest worker at %.2fx mean load on average (peak %.2fx), %d handoffs, %d rebalances"),
+		Adaptive.MeanMaxToMeanLoad, Adaptive.PeakMaxToMeanLoad, Adaptive.Handoffs, Adaptive.Rebalances));
+
+	return true;
+}
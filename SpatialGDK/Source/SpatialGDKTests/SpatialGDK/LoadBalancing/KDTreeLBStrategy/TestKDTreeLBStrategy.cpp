@@ -0,0 +1,15 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestKDTreeLBStrategy.h"
+
+UKDTreeLBStrategy* UTestKDTreeLBStrategy::Create(uint32 InNumWorkers, float WorldWidth, float WorldHeight)
+{
+	UTestKDTreeLBStrategy* Strat = NewObject<UTestKDTreeLBStrategy>();
+
+	Strat->NumWorkers = InNumWorkers;
+
+	Strat->WorldWidth = WorldWidth;
+	Strat->WorldHeight = WorldHeight;
+
+	return Strat;
+}
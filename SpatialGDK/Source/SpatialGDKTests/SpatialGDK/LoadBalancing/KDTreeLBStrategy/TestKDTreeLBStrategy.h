@@ -0,0 +1,21 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LoadBalancing/KDTreeLBStrategy.h"
+#include "TestKDTreeLBStrategy.generated.h"
+
+/**
+ * This class is for testing purposes only.
+ */
+UCLASS(HideDropdown)
+class SPATIALGDKTESTS_API UTestKDTreeLBStrategy : public UKDTreeLBStrategy
+{
+	GENERATED_BODY()
+
+public:
+
+	static UKDTreeLBStrategy* Create(uint32 NumWorkers, float WorldWidth, float WorldHeight);
+
+};
@@ -0,0 +1,83 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestDefinitions.h"
+
+#include "Schema/Interest.h"
+
+#include "CoreMinimal.h"
+
+#define INTEREST_TEST(TestName) \
+	GDK_TEST(Core, Interest, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	const uint32 ClientComponentId = 1001;
+	const uint32 ServerComponentId = 1002;
+
+	Interest CreateTestInterest(double CheckoutRadius, const TArray<uint32>& LevelComponentIds)
+	{
+		QueryConstraint RadiusConstraint;
+		RadiusConstraint.RelativeCylinderConstraint = RelativeCylinderConstraint{ CheckoutRadius };
+
+		QueryConstraint LevelConstraint;
+		for (uint32 LevelComponentId : LevelComponentIds)
+		{
+			QueryConstraint ComponentConstraint;
+			ComponentConstraint.ComponentConstraint = LevelComponentId;
+			LevelConstraint.OrConstraint.Add(ComponentConstraint);
+		}
+
+		Query ClientQuery;
+		ClientQuery.Constraint.AndConstraint.Add(RadiusConstraint);
+		ClientQuery.Constraint.AndConstraint.Add(LevelConstraint);
+		ClientQuery.FullSnapshotResult = true;
+
+		Query ServerQuery;
+		ServerQuery.Constraint.EntityIdConstraint = 1;
+		ServerQuery.FullSnapshotResult = true;
+
+		Interest NewInterest;
+		NewInterest.ComponentInterestMap.Add(ClientComponentId, ComponentInterest{ { ClientQuery } });
+		NewInterest.ComponentInterestMap.Add(ServerComponentId, ComponentInterest{ { ServerQuery } });
+		return NewInterest;
+	}
+} // anonymous namespace
+
+INTEREST_TEST(GIVEN_identical_interest_WHEN_diffed_THEN_nothing_has_changed)
+{
+	const Interest Old = CreateTestInterest(100.0, { 5000, 5001 });
+	const Interest New = CreateTestInterest(100.0, { 5000, 5001 });
+
+	TestEqual("No components changed", Interest::GetChangedComponents(Old, New).Num(), 0);
+
+	return true;
+}
+
+INTEREST_TEST(GIVEN_a_nested_constraint_change_WHEN_diffed_THEN_only_that_component_has_changed)
+{
+	const Interest Old = CreateTestInterest(100.0, { 5000, 5001 });
+	const Interest New = CreateTestInterest(100.0, { 5000, 5002 });
+
+	const TArray<uint32> ChangedComponents = Interest::GetChangedComponents(Old, New);
+	TestEqual("One component changed", ChangedComponents.Num(), 1);
+	TestTrue("The client component changed", ChangedComponents.Contains(ClientComponentId));
+
+	return true;
+}
+
+INTEREST_TEST(GIVEN_added_and_removed_component_interest_WHEN_diffed_THEN_both_have_changed)
+{
+	const Interest Old = CreateTestInterest(100.0, { 5000 });
+	Interest New = CreateTestInterest(100.0, { 5000 });
+	New.ComponentInterestMap.Remove(ServerComponentId);
+	New.ComponentInterestMap.Add(ServerComponentId + 1, ComponentInterest());
+
+	const TArray<uint32> ChangedComponents = Interest::GetChangedComponents(Old, New);
+	TestEqual("Two components changed", ChangedComponents.Num(), 2);
+	TestTrue("The removed component changed", ChangedComponents.Contains(ServerComponentId));
+	TestTrue("The added component changed", ChangedComponents.Contains(ServerComponentId + 1));
+
+	return true;
+}
@@ -0,0 +1,183 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestDefinitions.h"
+
+#include "Utils/ActorPool.h"
+
+#include "CoreMinimal.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/DefaultPawn.h"
+#include "HAL/PlatformTime.h"
+#include "Tests/AutomationCommon.h"
+#include "Tests/AutomationEditorCommon.h"
+
+#define ACTORPOOL_TEST(TestName) \
+	GDK_TEST(Core, FActorPool, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	UWorld* ActorPoolTestWorld = nullptr;
+
+	UWorld* GetActorPoolTestWorld()
+	{
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			if ((Context.WorldType == EWorldType::PIE || Context.WorldType == EWorldType::Game) && Context.World() != nullptr)
+			{
+				return Context.World();
+			}
+		}
+		return nullptr;
+	}
+
+	AActor* SpawnTestActor(UWorld* World, const FTransform& Transform)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.bNoFail = true;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		return World->SpawnActorAbsolute(ADefaultPawn::StaticClass(), Transform, SpawnParams);
+	}
+
+	FTransform ChurnTransform(int32 Index)
+	{
+		return FTransform(FVector(100.f * (Index % 100), 100.f * (Index / 100), 0.f));
+	}
+} // anonymous namespace
+
+DEFINE_LATENT_AUTOMATION_COMMAND(FWaitForActorPoolTestWorld);
+bool FWaitForActorPoolTestWorld::Update()
+{
+	ActorPoolTestWorld = GetActorPoolTestWorld();
+	return ActorPoolTestWorld != nullptr && ActorPoolTestWorld->AreActorsInitialized();
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FCheckPoolReusesActors, FAutomationTestBase*, Test);
+bool FCheckPoolReusesActors::Update()
+{
+	FActorPool Pool;
+	Pool.SetClassCap(FSoftObjectPath(ADefaultPawn::StaticClass()), 2);
+
+	Test->TestNull("Nothing to reuse in an empty pool", Pool.Acquire(ActorPoolTestWorld, ADefaultPawn::StaticClass(), FTransform::Identity));
+
+	AActor* First = SpawnTestActor(ActorPoolTestWorld, FTransform::Identity);
+	AActor* Second = SpawnTestActor(ActorPoolTestWorld, FTransform::Identity);
+	AActor* Third = SpawnTestActor(ActorPoolTestWorld, FTransform::Identity);
+
+	Test->TestTrue("First actor is pooled", Pool.Release(First));
+	Test->TestTrue("Second actor is pooled", Pool.Release(Second));
+	Test->TestFalse("Third actor exceeds the cap", Pool.Release(Third));
+	Test->TestEqual("Pool holds the capped number of actors", Pool.Num(), 2);
+	Test->TestTrue("Pooled actor is hidden", First->bHidden);
+	Test->TestFalse("Pooled actor has no collision", First->GetActorEnableCollision());
+	Test->TestFalse("Actor over the cap is left untouched", Third->bHidden);
+
+	const FVector NewLocation(1000.f, 2000.f, 300.f);
+	AActor* Reused = Pool.Acquire(ActorPoolTestWorld, ADefaultPawn::StaticClass(), FTransform(NewLocation));
+	if (Test->TestNotNull("Pooled actor is reused", Reused))
+	{
+		Test->TestTrue("Reused actor is one of the pooled actors", Reused == First || Reused == Second);
+		Test->TestTrue("Reused actor is moved to the new transform", Reused->GetActorLocation().Equals(NewLocation));
+		Test->TestFalse("Reused actor is visible again", Reused->bHidden);
+		Test->TestTrue("Reused actor has collision again", Reused->GetActorEnableCollision());
+	}
+	Test->TestTrue("Reuse is counted", Pool.GetNumReused() == 1);
+
+	Test->TestNull("Other classes are not pooled", Pool.Acquire(ActorPoolTestWorld, AActor::StaticClass(), FTransform::Identity));
+
+	AActor* Idle = (Reused == First) ? Second : First;
+	Pool.Empty();
+	Test->TestEqual("Empty pool holds no actors", Pool.Num(), 0);
+	Test->TestTrue("Idle actors are destroyed when the pool is emptied", Idle->IsPendingKillPending());
+
+	if (Reused != nullptr)
+	{
+		Reused->Destroy();
+	}
+	Third->Destroy();
+
+	return true;
+}
+
+// Simulates entities of one class repeatedly leaving and entering a client's view.
+DEFINE_LATENT_AUTOMATION_COMMAND_THREE_PARAMETER(FRunCheckoutChurnBenchmark, FAutomationTestBase*, Test, int32, NumActors, int32, NumRounds);
+bool FRunCheckoutChurnBenchmark::Update()
+{
+	TArray<AActor*> Actors;
+	Actors.Reserve(NumActors);
+
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 Round = 0; Round < NumRounds; Round++)
+	{
+		for (int32 i = 0; i < NumActors; i++)
+		{
+			Actors.Add(SpawnTestActor(ActorPoolTestWorld, ChurnTransform(i)));
+		}
+		for (AActor* Actor : Actors)
+		{
+			Actor->Destroy(true);
+		}
+		Actors.Reset();
+	}
+	const double SpawnTime = FPlatformTime::Seconds() - StartTime;
+
+	FActorPool Pool;
+	Pool.SetClassCap(FSoftObjectPath(ADefaultPawn::StaticClass()), NumActors);
+
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Round = 0; Round < NumRounds; Round++)
+	{
+		for (int32 i = 0; i < NumActors; i++)
+		{
+			AActor* Actor = Pool.Acquire(ActorPoolTestWorld, ADefaultPawn::StaticClass(), ChurnTransform(i));
+			Actors.Add(Actor != nullptr ? Actor : SpawnTestActor(ActorPoolTestWorld, ChurnTransform(i)));
+		}
+		for (AActor* Actor : Actors)
+		{
+			Pool.Release(Actor);
+		}
+		Actors.Reset();
+	}
+	const double PooledTime = FPlatformTime::Seconds() - StartTime;
+
+	Test->TestTrue("Every round after the first reuses all actors", Pool.GetNumReused() == uint64(NumActors) * (NumRounds - 1));
+	Pool.Empty();
+
+	const int32 NumCheckouts = NumActors * NumRounds;
+	Test->AddInfo(FString::Printf(TEXT("%d checkouts of %d actors: spawn/destroy %.2fms (%.1fus each), pooled %.2fms (%.1fus each), %.1fx faster"),
+		NumCheckouts, NumActors, SpawnTime * 1000.0, SpawnTime * 1e6 / NumCheckouts, PooledTime * 1000.0, PooledTime * 1e6 / NumCheckouts,
+		PooledTime > 0.0 ? SpawnTime / PooledTime : 0.0));
+
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND(FCleanupActorPoolTest);
+bool FCleanupActorPoolTest::Update()
+{
+	ActorPoolTestWorld = nullptr;
+	return true;
+}
+
+ACTORPOOL_TEST(GIVEN_a_capped_pool_WHEN_actors_are_released_and_acquired_THEN_they_are_deactivated_and_reused)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForActorPoolTestWorld());
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckPoolReusesActors(this));
+	ADD_LATENT_AUTOMATION_COMMAND(FCleanupActorPoolTest());
+
+	return true;
+}
+
+ACTORPOOL_TEST(GIVEN_checkout_churn_WHEN_actors_are_pooled_THEN_report_spawn_cost_savings)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForActorPoolTestWorld());
+	ADD_LATENT_AUTOMATION_COMMAND(FRunCheckoutChurnBenchmark(this, 500, 10));
+	ADD_LATENT_AUTOMATION_COMMAND(FCleanupActorPoolTest());
+
+	return true;
+}
@@ -0,0 +1,283 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestDefinitions.h"
+
+#include "Utils/CompactSchemaDatabase.h"
+#include "Utils/SchemaDatabase.h"
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+
+#define COMPACTSCHEMADATABASE_TEST(TestName) \
+	GDK_TEST(Core, FCompactSchemaDatabase, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	const uint32 NumTestActorClasses = 2000;
+
+	FString ActorClassPath(uint32 Index)
+	{
+		return FString::Printf(TEXT("/Game/Blueprints/Generated/BP_TestActor_%u.BP_TestActor_%u_C"), Index, Index);
+	}
+
+	FString SubobjectClassPath(uint32 Index)
+	{
+		return FString::Printf(TEXT("/Script/TestModule.TestComponent_%u"), Index);
+	}
+
+	USchemaDatabase* CreateTestSchemaDatabase()
+	{
+		USchemaDatabase* SchemaDatabase = NewObject<USchemaDatabase>();
+
+		uint32 NextComponentId = SpatialConstants::STARTING_GENERATED_COMPONENT_ID;
+
+		for (uint32 i = 0; i < NumTestActorClasses; i++)
+		{
+			FActorSchemaData ActorData;
+			ActorData.GeneratedSchemaName = FString::Printf(TEXT("BPTestActor%u"), i);
+			for (int32 Type = SCHEMA_Begin; Type < SCHEMA_Count; Type++)
+			{
+				ActorData.SchemaComponents[Type] = NextComponentId;
+				SchemaDatabase->ComponentIdToClassPath.Add(NextComponentId, ActorClassPath(i));
+				NextComponentId++;
+			}
+
+			FActorSpecificSubobjectSchemaData SubobjectData;
+			SubobjectData.ClassPath = SubobjectClassPath(i % 10);
+			SubobjectData.Name = FName(TEXT("MyComponent"));
+			SubobjectData.SchemaComponents[SCHEMA_Data] = NextComponentId++;
+			ActorData.SubobjectData.Add(SubobjectData.SchemaComponents[SCHEMA_Data], SubobjectData);
+
+			SchemaDatabase->ActorClassPathToSchema.Add(ActorClassPath(i), ActorData);
+		}
+
+		for (uint32 i = 0; i < 10; i++)
+		{
+			FSubobjectSchemaData SubobjectData;
+			SubobjectData.GeneratedSchemaName = FString::Printf(TEXT("TestComponent%u"), i);
+
+			FDynamicSubobjectSchemaData DynamicData;
+			DynamicData.SchemaComponents[SCHEMA_Data] = NextComponentId++;
+			SubobjectData.DynamicSubobjectComponents.Add(DynamicData);
+
+			SchemaDatabase->SubobjectClassPathToSchema.Add(SubobjectClassPath(i), SubobjectData);
+		}
+
+		SchemaDatabase->LevelPathToComponentId.Add(TEXT("/Game/Maps/Sublevel_A"), NextComponentId);
+		SchemaDatabase->LevelComponentIds.Add(NextComponentId);
+		NextComponentId++;
+
+		SchemaDatabase->NextAvailableComponentId = NextComponentId;
+
+		return SchemaDatabase;
+	}
+
+	template <typename T>
+	T& GetRecord(TArray<uint8>& Blob, uint32 Offset, uint32 Index)
+	{
+		return reinterpret_cast<T*>(Blob.GetData() + Offset)[Index];
+	}
+
+	// Stands in for FMD5Hash::HashFile on the SchemaDatabase asset's package file.
+	FMD5Hash HashPackage(const FString& PackageContents)
+	{
+		FTCHARToUTF8 Converted(*PackageContents);
+
+		FMD5 MD5;
+		MD5.Update(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+
+		FMD5Hash Hash;
+		Hash.Set(MD5);
+		return Hash;
+	}
+} // anonymous namespace
+
+COMPACTSCHEMADATABASE_TEST(GIVEN_a_schema_database_WHEN_baked_and_loaded_THEN_all_lookups_match_the_source)
+{
+	USchemaDatabase* SchemaDatabase = CreateTestSchemaDatabase();
+
+	FCompactSchemaDatabase CompactDatabase;
+	TestTrue("Compact database loaded", CompactDatabase.LoadFromMemory(FCompactSchemaDatabase::Serialize(*SchemaDatabase)));
+
+	for (const auto& Pair : SchemaDatabase->ActorClassPathToSchema)
+	{
+		const FCompactSchemaDatabase::FActorRecord* Actor = CompactDatabase.FindActor(Pair.Key);
+		if (!TestNotNull(FString::Printf(TEXT("Actor class %s found"), *Pair.Key), Actor))
+		{
+			return false;
+		}
+
+		for (int32 Type = SCHEMA_Begin; Type < SCHEMA_Count; Type++)
+		{
+			TestEqual("Actor schema component", Actor->SchemaComponents[Type], Pair.Value.SchemaComponents[Type]);
+		}
+
+		TestEqual("Generated schema name", CompactDatabase.GetString(Actor->GeneratedSchemaNameId), Pair.Value.GeneratedSchemaName);
+
+		uint32 NumSubobjects = 0;
+		CompactDatabase.ForEachActorSubobject(*Actor, [&](const FCompactSchemaDatabase::FActorSubobjectRecord& Subobject)
+		{
+			const FActorSpecificSubobjectSchemaData* Expected = Pair.Value.SubobjectData.Find(Subobject.Offset);
+			if (TestNotNull("Subobject offset matches", Expected))
+			{
+				TestEqual("Subobject class path", CompactDatabase.GetString(Subobject.ClassPathId), Expected->ClassPath);
+				TestEqual("Subobject name", CompactDatabase.GetName(Subobject.NameId), Expected->Name);
+			}
+			NumSubobjects++;
+		});
+		TestEqual("Number of subobjects", NumSubobjects, uint32(Pair.Value.SubobjectData.Num()));
+	}
+
+	for (const auto& Pair : SchemaDatabase->SubobjectClassPathToSchema)
+	{
+		const FCompactSchemaDatabase::FSubobjectClassRecord* SubobjectClass = CompactDatabase.FindSubobjectClass(Pair.Key);
+		if (TestNotNull(FString::Printf(TEXT("Subobject class %s found"), *Pair.Key), SubobjectClass))
+		{
+			TestEqual("Number of dynamic subobjects", SubobjectClass->NumDynamicSubobjects, uint32(Pair.Value.DynamicSubobjectComponents.Num()));
+		}
+	}
+
+	for (const auto& Pair : SchemaDatabase->ComponentIdToClassPath)
+	{
+		FString ClassPath;
+		TestTrue("Component ID has a class path", CompactDatabase.FindClassPathForComponentId(Pair.Key, ClassPath));
+		TestEqual("Component ID class path", ClassPath, Pair.Value);
+	}
+
+	for (const auto& Pair : SchemaDatabase->LevelPathToComponentId)
+	{
+		TestEqual("Level component ID", CompactDatabase.FindComponentIdForLevelPath(Pair.Key), Pair.Value);
+		TestTrue("Is level component", CompactDatabase.IsLevelComponent(Pair.Value));
+	}
+
+	TestFalse("Unknown class path", CompactDatabase.ContainsClassPath(TEXT("/Game/NotAClass.NotAClass_C")));
+	TestFalse("Actor component is not a level component", CompactDatabase.IsLevelComponent(SpatialConstants::STARTING_GENERATED_COMPONENT_ID));
+	TestTrue("Lookups are case-insensitive", CompactDatabase.ContainsClassPath(ActorClassPath(0).ToLower()));
+
+	return true;
+}
+
+COMPACTSCHEMADATABASE_TEST(GIVEN_a_corrupt_blob_WHEN_loaded_THEN_it_is_rejected)
+{
+	USchemaDatabase* SchemaDatabase = CreateTestSchemaDatabase();
+	TArray<uint8> Blob = FCompactSchemaDatabase::Serialize(*SchemaDatabase);
+
+	FCompactSchemaDatabase CompactDatabase;
+
+	TArray<uint8> Truncated(Blob.GetData(), Blob.Num() / 2);
+	TestFalse("Truncated blob is rejected", CompactDatabase.LoadFromMemory(MoveTemp(Truncated)));
+	TestFalse("Database is not loaded", CompactDatabase.IsLoaded());
+
+	TArray<uint8> WrongVersion = Blob;
+	reinterpret_cast<FCompactSchemaDatabase::FHeader*>(WrongVersion.GetData())->Version = FCompactSchemaDatabase::Version + 1;
+	TestFalse("Blob with a different version is rejected", CompactDatabase.LoadFromMemory(MoveTemp(WrongVersion)));
+
+	const FCompactSchemaDatabase::FHeader Header = *reinterpret_cast<const FCompactSchemaDatabase::FHeader*>(Blob.GetData());
+
+	TArray<uint8> BadSubobjectRange = Blob;
+	GetRecord<FCompactSchemaDatabase::FActorRecord>(BadSubobjectRange, Header.ActorsOffset, Header.NumActors - 1).NumSubobjects = 2;
+	TestFalse("Actor whose subobjects run past the table is rejected", CompactDatabase.LoadFromMemory(MoveTemp(BadSubobjectRange)));
+
+	TArray<uint8> BadKeyString = Blob;
+	GetRecord<FCompactSchemaDatabase::FPathKey>(BadKeyString, Header.ActorKeysOffset, 0).StringId = Header.NumStrings;
+	TestFalse("Key with an unknown string is rejected", CompactDatabase.LoadFromMemory(MoveTemp(BadKeyString)));
+
+	TArray<uint8> BadKeyValue = Blob;
+	GetRecord<FCompactSchemaDatabase::FPathKey>(BadKeyValue, Header.SubobjectClassKeysOffset, 0).Value = Header.NumSubobjectClasses;
+	TestFalse("Key with an unknown record is rejected", CompactDatabase.LoadFromMemory(MoveTemp(BadKeyValue)));
+
+	TArray<uint8> BadSubobjectName = Blob;
+	GetRecord<FCompactSchemaDatabase::FActorSubobjectRecord>(BadSubobjectName, Header.ActorSubobjectsOffset, 0).NameId = MAX_uint32;
+	TestFalse("Subobject with an unknown name is rejected", CompactDatabase.LoadFromMemory(MoveTemp(BadSubobjectName)));
+
+	TArray<uint8> BadDynamicSubobjects = Blob;
+	GetRecord<FCompactSchemaDatabase::FSubobjectClassRecord>(BadDynamicSubobjects, Header.SubobjectClassesOffset, 0).FirstDynamicSubobject = MAX_uint32;
+	TestFalse("Subobject class whose dynamic subobjects run past the table is rejected", CompactDatabase.LoadFromMemory(MoveTemp(BadDynamicSubobjects)));
+
+	TArray<uint8> BadComponentClassPath = Blob;
+	GetRecord<FCompactSchemaDatabase::FComponentClassPathRecord>(BadComponentClassPath, Header.ComponentClassPathsOffset, 0).ClassPathId = Header.NumStrings;
+	TestFalse("Component with an unknown class path is rejected", CompactDatabase.LoadFromMemory(MoveTemp(BadComponentClassPath)));
+
+	TArray<uint8> BadString = Blob;
+	GetRecord<FCompactSchemaDatabase::FStringEntry>(BadString, Header.StringsOffset, Header.NumStrings - 1).Length = Header.StringDataSize;
+	TestFalse("String that runs past the string data is rejected", CompactDatabase.LoadFromMemory(MoveTemp(BadString)));
+
+	TestFalse("Database is not loaded", CompactDatabase.IsLoaded());
+	TestTrue("Unmodified blob is accepted", CompactDatabase.LoadFromMemory(MoveTemp(Blob)));
+
+	return true;
+}
+
+COMPACTSCHEMADATABASE_TEST(GIVEN_a_database_baked_from_an_asset_WHEN_checked_against_asset_hashes_THEN_only_the_same_asset_matches)
+{
+	USchemaDatabase* SchemaDatabase = CreateTestSchemaDatabase();
+
+	const FString BakedPackage = TEXT("Package saved by schema generation");
+	const FString ChangedPackage = TEXT("Package saved by a later schema generation");
+	const FMD5Hash BakedHash = HashPackage(BakedPackage);
+
+	FCompactSchemaDatabase CompactDatabase;
+	TestTrue("Compact database loaded", CompactDatabase.LoadFromMemory(FCompactSchemaDatabase::Serialize(*SchemaDatabase, BakedHash)));
+	TestTrue("Database matches the asset it was baked from", CompactDatabase.IsBakedFrom(HashPackage(BakedPackage)));
+	TestFalse("Database doesn't match a changed asset", CompactDatabase.IsBakedFrom(HashPackage(ChangedPackage)));
+	TestFalse("Database doesn't match an unknown hash", CompactDatabase.IsBakedFrom(FMD5Hash()));
+
+	FCompactSchemaDatabase UnhashedDatabase;
+	TestTrue("Database baked without a hash loaded", UnhashedDatabase.LoadFromMemory(FCompactSchemaDatabase::Serialize(*SchemaDatabase)));
+	TestFalse("Database baked without a hash doesn't match any asset", UnhashedDatabase.IsBakedFrom(BakedHash));
+
+	return true;
+}
+
+COMPACTSCHEMADATABASE_TEST(GIVEN_a_baked_database_WHEN_looking_up_class_paths_THEN_report_lookup_cost_against_the_asset)
+{
+	USchemaDatabase* SchemaDatabase = CreateTestSchemaDatabase();
+
+	double StartTime = FPlatformTime::Seconds();
+	TArray<uint8> Blob = FCompactSchemaDatabase::Serialize(*SchemaDatabase);
+	const double BakeTime = FPlatformTime::Seconds() - StartTime;
+
+	FCompactSchemaDatabase CompactDatabase;
+	StartTime = FPlatformTime::Seconds();
+	CompactDatabase.LoadFromMemory(MoveTemp(Blob));
+	const double LoadTime = FPlatformTime::Seconds() - StartTime;
+
+	TArray<FString> Queries;
+	for (uint32 i = 0; i < NumTestActorClasses; i++)
+	{
+		Queries.Add(ActorClassPath(i));
+	}
+
+	const int32 Iterations = 20;
+	uint32 Checksum = 0;
+
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+	{
+		for (const FString& Query : Queries)
+		{
+			Checksum += SchemaDatabase->ActorClassPathToSchema.FindChecked(Query).SchemaComponents[SCHEMA_Data];
+		}
+	}
+	const double AssetLookupTime = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+	{
+		for (const FString& Query : Queries)
+		{
+			Checksum -= CompactDatabase.FindActorSchemaComponents(Query)[SCHEMA_Data];
+		}
+	}
+	const double CompactLookupTime = FPlatformTime::Seconds() - StartTime;
+
+	TestEqual("Both lookups returned the same component IDs", Checksum, 0u);
+
+	const double NumLookups = double(Iterations * Queries.Num());
+	AddInfo(FString::Printf(TEXT("Baked %d classes into %u bytes in %.2fms, loaded in %.3fms"), Queries.Num(), CompactDatabase.GetSize(), BakeTime * 1000.0, LoadTime * 1000.0));
+	AddInfo(FString::Printf(TEXT("Per-lookup cost: asset TMap %.1fns, compact %.1fns"), AssetLookupTime * 1e9 / NumLookups, CompactLookupTime * 1e9 / NumLookups));
+
+	return true;
+}
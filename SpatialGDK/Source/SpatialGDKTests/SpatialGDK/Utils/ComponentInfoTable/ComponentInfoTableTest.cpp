@@ -0,0 +1,152 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestDefinitions.h"
+
+#include "Interop/SpatialClassInfoManager.h"
+#include "SpatialConstants.h"
+#include "Utils/ComponentInfoTable.h"
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+#define COMPONENTINFOTABLE_TEST(TestName) \
+	GDK_TEST(Core, FComponentInfoTable, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	const Worker_ComponentId FirstTestComponentId = SpatialConstants::STARTING_GENERATED_COMPONENT_ID;
+
+	// Gives each class info the data, owner only and handover components of one class, as schema generation does.
+	void AddClasses(FComponentInfoTable& Table, TArray<TSharedRef<FClassInfo>>& OutClassInfos, int32 NumClasses)
+	{
+		for (int32 i = 0; i < NumClasses; i++)
+		{
+			TSharedRef<FClassInfo> Info = MakeShared<FClassInfo>();
+			for (int32 Type = SCHEMA_Begin; Type < SCHEMA_Count; Type++)
+			{
+				const Worker_ComponentId ComponentId = FirstTestComponentId + i * SCHEMA_Count + Type;
+				Info->SchemaComponents[Type] = ComponentId;
+				Table.SetClassInfo(ComponentId, Info, i % 4, ESchemaComponentType(Type));
+			}
+			OutClassInfos.Add(Info);
+		}
+	}
+} // anonymous namespace
+
+COMPONENTINFOTABLE_TEST(GIVEN_components_inside_and_outside_the_generated_range_WHEN_set_THEN_both_are_found)
+{
+	FComponentInfoTable Table;
+	Table.Init(FirstTestComponentId, FirstTestComponentId + 100);
+
+	TSharedRef<FClassInfo> Dense = MakeShared<FClassInfo>();
+	TSharedRef<FClassInfo> Sparse = MakeShared<FClassInfo>();
+	Table.SetClassInfo(FirstTestComponentId + 5, Dense, 3, SCHEMA_OwnerOnly);
+	Table.SetClassInfo(FirstTestComponentId + 500, Sparse, 0, SCHEMA_Handover);
+	Table.MarkSublevel(FirstTestComponentId + 6);
+
+	const FComponentInfo* DenseInfo = Table.FindClassInfo(FirstTestComponentId + 5);
+	TestTrue("Dense component is found", DenseInfo != nullptr && DenseInfo->ClassInfo == &Dense.Get());
+	TestTrue("Dense component keeps its offset and category", DenseInfo != nullptr && DenseInfo->Offset == 3 && DenseInfo->GetCategory() == SCHEMA_OwnerOnly);
+
+	const FComponentInfo* SparseInfo = Table.FindClassInfo(FirstTestComponentId + 500);
+	TestTrue("Component outside the dense range is found", SparseInfo != nullptr && SparseInfo->ClassInfo == &Sparse.Get() && SparseInfo->GetCategory() == SCHEMA_Handover);
+	TestEqual("Only the outlier is sparse", Table.GetNumSparse(), 1);
+
+	TestTrue("Unset component in the dense range has no class info", Table.FindClassInfo(FirstTestComponentId + 7) == nullptr);
+	TestTrue("Component below the dense range has no class info", Table.FindClassInfo(SpatialConstants::POSITION_COMPONENT_ID) == nullptr);
+
+	TestTrue("Sublevel component is marked", Table.IsSublevel(FirstTestComponentId + 6));
+	TestFalse("Sublevel component has no class info", Table.FindClassInfo(FirstTestComponentId + 6) != nullptr);
+	TestFalse("Class component is not a sublevel", Table.IsSublevel(FirstTestComponentId + 5));
+
+	return true;
+}
+
+COMPONENTINFOTABLE_TEST(GIVEN_a_component_with_class_info_WHEN_replaced_THEN_the_table_releases_the_old_class_info)
+{
+	FComponentInfoTable Table;
+	Table.Init(FirstTestComponentId, FirstTestComponentId + 10);
+
+	TWeakPtr<FClassInfo> Old;
+	{
+		TSharedRef<FClassInfo> Info = MakeShared<FClassInfo>();
+		Old = Info;
+		Table.SetClassInfo(FirstTestComponentId, Info, 0, SCHEMA_Data);
+	}
+	TestTrue("Table keeps the class info alive", Old.IsValid());
+
+	TSharedRef<FClassInfo> New = MakeShared<FClassInfo>();
+	Table.SetClassInfo(FirstTestComponentId, New, 0, SCHEMA_Data);
+	TestFalse("Old class info is released once replaced", Old.IsValid());
+	TestTrue("New class info is found", Table.FindClassInfo(FirstTestComponentId)->ClassInfo == &New.Get());
+
+	return true;
+}
+
+// Looks up random components of a few thousand classes, as receiving component updates does, comparing the table
+// against the three maps USpatialClassInfoManager used before.
+COMPONENTINFOTABLE_TEST(GIVEN_many_classes_WHEN_looked_up_at_op_dispatch_rates_THEN_the_table_matches_the_maps_and_reports_throughput)
+{
+	const int32 NumClasses = 5000;
+	const int32 NumLookups = 4000000;
+	const Worker_ComponentId EndComponentId = FirstTestComponentId + NumClasses * SCHEMA_Count;
+
+	FComponentInfoTable Table;
+	Table.Init(FirstTestComponentId, EndComponentId);
+	TArray<TSharedRef<FClassInfo>> ClassInfos;
+	AddClasses(Table, ClassInfos, NumClasses);
+
+	TMap<Worker_ComponentId, TSharedRef<FClassInfo>> ComponentToClassInfoMap;
+	TMap<Worker_ComponentId, uint32> ComponentToOffsetMap;
+	TMap<Worker_ComponentId, ESchemaComponentType> ComponentToCategoryMap;
+	for (int32 i = 0; i < NumClasses; i++)
+	{
+		for (int32 Type = SCHEMA_Begin; Type < SCHEMA_Count; Type++)
+		{
+			const Worker_ComponentId ComponentId = ClassInfos[i]->SchemaComponents[Type];
+			ComponentToClassInfoMap.Add(ComponentId, ClassInfos[i]);
+			ComponentToOffsetMap.Add(ComponentId, i % 4);
+			ComponentToCategoryMap.Add(ComponentId, ESchemaComponentType(Type));
+		}
+	}
+
+	FRandomStream Random(NumClasses);
+	TArray<Worker_ComponentId> Lookups;
+	Lookups.SetNumUninitialized(NumLookups);
+	for (Worker_ComponentId& ComponentId : Lookups)
+	{
+		ComponentId = Random.RandRange(FirstTestComponentId, EndComponentId - 1);
+	}
+
+	// Each op needs the class info, offset and category of its component.
+	uint64 MapChecksum = 0;
+	double StartTime = FPlatformTime::Seconds();
+	for (Worker_ComponentId ComponentId : Lookups)
+	{
+		const FClassInfo& Info = ComponentToClassInfoMap.FindChecked(ComponentId).Get();
+		MapChecksum += Info.SchemaComponents[SCHEMA_Data] + ComponentToOffsetMap[ComponentId] + ComponentToCategoryMap[ComponentId];
+	}
+	const double MapSeconds = FPlatformTime::Seconds() - StartTime;
+
+	uint64 TableChecksum = 0;
+	StartTime = FPlatformTime::Seconds();
+	for (Worker_ComponentId ComponentId : Lookups)
+	{
+		const FComponentInfo* Info = Table.FindClassInfo(ComponentId);
+		TableChecksum += Info->ClassInfo->SchemaComponents[SCHEMA_Data] + Info->Offset + Info->Category;
+	}
+	const double TableSeconds = FPlatformTime::Seconds() - StartTime;
+
+	TestTrue("Table lookups match map lookups", TableChecksum == MapChecksum);
+	TestEqual("All generated components are dense", Table.GetNumSparse(), 0);
+
+	AddInfo(FString::Printf(TEXT("%d lookups over %d components: maps %.1f ms (%.1f M ops/s), table %.1f ms (%.1f M ops/s)"),
+		NumLookups, NumClasses * SCHEMA_Count,
+		MapSeconds * 1000.0, NumLookups / FMath::Max(MapSeconds, 1e-9) / 1e6,
+		TableSeconds * 1000.0, NumLookups / FMath::Max(TableSeconds, 1e-9) / 1e6));
+
+	return true;
+}
@@ -0,0 +1,146 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestDefinitions.h"
+
+#include "EngineClasses/SpatialNetConnection.h"
+#include "EngineClasses/SpatialNetDriver.h"
+#include "Utils/DormantColdStorage.h"
+
+#include "Components/ActorComponent.h"
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Net/DataReplication.h"
+#include "Net/RepLayout.h"
+#include "UObject/Package.h"
+
+#define DORMANTCOLDSTORAGE_TEST(TestName) \
+	GDK_TEST(Core, FDormantColdStorage, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	const Worker_EntityId DormantEntityId = 1000;
+	const Worker_EntityId OtherDormantEntityId = 1001;
+
+	// A dormant actor with a subobject, and the state Unreal keeps for both after its channel closes for dormancy.
+	struct FDormantActor
+	{
+		FDormantActor(USpatialNetDriver* NetDriver, UNetConnection* NetConnection)
+		{
+			Actor = NewObject<AActor>(GetTransientPackage());
+			Subobject = NewObject<UActorComponent>(Actor);
+
+			for (UObject* Object : { (UObject*)Actor, (UObject*)Subobject })
+			{
+				NetConnection->DormantReplicatorMap.Add(Object, MakeShared<FObjectReplicator>());
+				NetDriver->GetReplicationChangeListMgr(Object);
+			}
+		}
+
+		bool HasReplicationState(USpatialNetDriver* NetDriver, UNetConnection* NetConnection) const
+		{
+			return NetConnection->DormantReplicatorMap.Contains(Actor) || NetConnection->DormantReplicatorMap.Contains(Subobject)
+				|| NetDriver->ReplicationChangeListMap.Contains(Actor) || NetDriver->ReplicationChangeListMap.Contains(Subobject);
+		}
+
+		AActor* Actor;
+		UActorComponent* Subobject;
+	};
+
+	uint64 NumWakeSamples(FDormantColdStorage& ColdStorage)
+	{
+		FLatencyHistogramSnapshot Snapshot;
+		ColdStorage.GetWakeLatency().Drain(Snapshot);
+		return Snapshot.TotalCount;
+	}
+} // anonymous namespace
+
+DORMANTCOLDSTORAGE_TEST(GIVEN_an_actor_closed_for_dormancy_WHEN_stored_THEN_its_replication_state_is_released_and_its_record_kept)
+{
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	USpatialNetConnection* NetConnection = NewObject<USpatialNetConnection>();
+
+	FDormantActor Dormant(NetDriver, NetConnection);
+	FDormantActor Other(NetDriver, NetConnection);
+
+	FDormantColdStorage ColdStorage;
+	TestTrue("Replication state is kept while dormant", Dormant.HasReplicationState(NetDriver, NetConnection));
+
+	// As USpatialNetDriver::ProcessPendingDormancy does once the channel has closed.
+	ColdStorage.Store(DormantEntityId, Dormant.Actor, NetConnection, NetDriver);
+
+	TestFalse("Replicators and changelist state of the actor and its subobjects are released", Dormant.HasReplicationState(NetDriver, NetConnection));
+	TestTrue("State of other dormant actors is kept", Other.HasReplicationState(NetDriver, NetConnection));
+	TestTrue("Entity is in cold storage", ColdStorage.Contains(DormantEntityId));
+	TestFalse("Other entity is not in cold storage", ColdStorage.Contains(OtherDormantEntityId));
+	TestTrue("Released bytes are estimated", ColdStorage.GetReleasedBytes() > 0);
+
+	return true;
+}
+
+DORMANTCOLDSTORAGE_TEST(GIVEN_an_actor_in_cold_storage_WHEN_flushed_from_dormancy_THEN_fresh_state_is_built_and_the_wake_recorded)
+{
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	USpatialNetConnection* NetConnection = NewObject<USpatialNetConnection>();
+
+	FDormantActor Dormant(NetDriver, NetConnection);
+	TSharedPtr<FReplicationChangelistMgr> DormantChangelist = NetDriver->GetReplicationChangeListMgr(Dormant.Actor);
+
+	FDormantColdStorage ColdStorage;
+	ColdStorage.Store(DormantEntityId, Dormant.Actor, NetConnection, NetDriver);
+
+	// With no dormant replicator left, the recreated channel builds new state from the actor rather than resuming the old state.
+	TestFalse("No stale replicator is left to resume from", NetConnection->DormantReplicatorMap.Contains(Dormant.Actor));
+	TSharedPtr<FReplicationChangelistMgr> WokenChangelist = NetDriver->GetReplicationChangeListMgr(Dormant.Actor);
+	TestTrue("Changelist state is rebuilt", WokenChangelist.IsValid() && WokenChangelist != DormantChangelist);
+
+	// As USpatialActorChannel::SetChannelActor does once the replicators have been rebuilt.
+	ColdStorage.TrackWake(DormantEntityId, 0.001);
+
+	TestFalse("Woken entity leaves cold storage", ColdStorage.Contains(DormantEntityId));
+	TestTrue("Rebuild time is recorded", NumWakeSamples(ColdStorage) == uint64(1));
+
+	ColdStorage.TrackWake(DormantEntityId, 0.001);
+	TestTrue("Entities that weren't in cold storage record no rebuild time", NumWakeSamples(ColdStorage) == uint64(0));
+
+	return true;
+}
+
+DORMANTCOLDSTORAGE_TEST(GIVEN_entities_entering_and_leaving_cold_storage_WHEN_gauges_are_read_THEN_they_match_the_stored_entities)
+{
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	USpatialNetConnection* NetConnection = NewObject<USpatialNetConnection>();
+
+	FDormantActor First(NetDriver, NetConnection);
+	FDormantActor Second(NetDriver, NetConnection);
+
+	// USpatialMetrics reports Num() and GetReleasedBytes() as the cold storage gauges.
+	FDormantColdStorage ColdStorage;
+	TestEqual("Nothing stored", ColdStorage.Num(), 0);
+	TestTrue("Nothing released", ColdStorage.GetReleasedBytes() == uint64(0));
+
+	ColdStorage.Store(DormantEntityId, First.Actor, NetConnection, NetDriver);
+	const uint64 FirstBytes = ColdStorage.GetReleasedBytes();
+	ColdStorage.Store(OtherDormantEntityId, Second.Actor, NetConnection, NetDriver);
+
+	TestEqual("Both entities stored", ColdStorage.Num(), 2);
+	TestTrue("Released bytes of both entities", ColdStorage.GetReleasedBytes() == 2 * FirstBytes);
+
+	// Storing an entity again, after its state was rebuilt and released once more, replaces its record.
+	First = FDormantActor(NetDriver, NetConnection);
+	ColdStorage.Store(DormantEntityId, First.Actor, NetConnection, NetDriver);
+	TestEqual("Restored entity is counted once", ColdStorage.Num(), 2);
+	TestTrue("Restored entity's bytes are counted once", ColdStorage.GetReleasedBytes() == 2 * FirstBytes);
+
+	ColdStorage.TrackWake(DormantEntityId, 0.001);
+	TestEqual("Woken entity leaves the gauge", ColdStorage.Num(), 1);
+	TestTrue("Woken entity's bytes leave the gauge", ColdStorage.GetReleasedBytes() == FirstBytes);
+
+	// As when the entity leaves view or is deleted while dormant.
+	ColdStorage.Remove(OtherDormantEntityId);
+	TestEqual("Removed entity leaves the gauge", ColdStorage.Num(), 0);
+	TestTrue("No bytes are released", ColdStorage.GetReleasedBytes() == uint64(0));
+
+	return true;
+}
@@ -0,0 +1,223 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestDefinitions.h"
+
+#include "Schema/StandardLibrary.h"
+#include "Utils/EntityAclTemplateCache.h"
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/PlatformTime.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+#define ENTITYACLTEMPLATECACHE_TEST(TestName) \
+	GDK_TEST(Core, FEntityAclTemplateCache, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	const TArray<FName> TestServerWorkerTypes = { TEXT("UnrealWorker"), TEXT("AIWorker") };
+	const FString TestOwnerAttribute = TEXT("workerId:UnrealClient-0123456789abcdef");
+
+	// A class with actor components and three static subobjects, each with data and handover components.
+	FClassInfo CreateTestClassInfo()
+	{
+		FClassInfo Info;
+		Info.WorkerType = TestServerWorkerTypes[0];
+
+		Worker_ComponentId NextComponentId = SpatialConstants::STARTING_GENERATED_COMPONENT_ID;
+		Info.SchemaComponents[SCHEMA_Data] = NextComponentId++;
+		Info.SchemaComponents[SCHEMA_OwnerOnly] = NextComponentId++;
+		Info.SchemaComponents[SCHEMA_Handover] = NextComponentId++;
+
+		for (uint32 Offset = 1; Offset <= 3; Offset++)
+		{
+			TSharedRef<FClassInfo> SubobjectInfo = MakeShared<FClassInfo>();
+			SubobjectInfo->SchemaComponents[SCHEMA_Data] = NextComponentId++;
+			SubobjectInfo->SchemaComponents[SCHEMA_Handover] = NextComponentId++;
+			Info.SubobjectInfo.Add(Offset, SubobjectInfo);
+		}
+
+		return Info;
+	}
+
+	void AddSchemaComponents(const FClassInfo& Info, WriteAclMap& ComponentWriteAcl, const WorkerRequirementSet& RequirementSet)
+	{
+		ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
+		{
+			if (Info.SchemaComponents[Type] != SpatialConstants::INVALID_COMPONENT_ID)
+			{
+				ComponentWriteAcl.Add(Info.SchemaComponents[Type], RequirementSet);
+			}
+		});
+	}
+
+	// Builds the EntityAcl the way USpatialSender::CreateEntity did before templates were cached.
+	Worker_ComponentData CreateUncachedEntityAclData(UClass* Class, const FClassInfo& Info, const TBitArray<>& PresentSubobjects, const FString& OwnerAttribute, const TArray<Worker_ComponentId>& ExtraComponents)
+	{
+		WorkerRequirementSet AnyServerRequirementSet;
+		WorkerRequirementSet AnyServerOrClientRequirementSet = { SpatialConstants::UnrealClientAttributeSet };
+
+		WorkerAttributeSet OwningClientAttributeSet = { OwnerAttribute };
+
+		WorkerRequirementSet AnyServerOrOwningClientRequirementSet = { OwningClientAttributeSet };
+		WorkerRequirementSet OwningClientOnlyRequirementSet = { OwningClientAttributeSet };
+
+		for (const FName& WorkerType : TestServerWorkerTypes)
+		{
+			WorkerAttributeSet ServerWorkerAttributeSet = { WorkerType.ToString() };
+
+			AnyServerRequirementSet.Add(ServerWorkerAttributeSet);
+			AnyServerOrClientRequirementSet.Add(ServerWorkerAttributeSet);
+			AnyServerOrOwningClientRequirementSet.Add(ServerWorkerAttributeSet);
+		}
+
+		const bool bIsPlayerController = Class->IsChildOf(APlayerController::StaticClass());
+		const WorkerRequirementSet& ReadAcl = bIsPlayerController ? AnyServerOrOwningClientRequirementSet : AnyServerOrClientRequirementSet;
+
+		const WorkerRequirementSet AuthoritativeWorkerRequirementSet = { WorkerAttributeSet{ Info.WorkerType.ToString() } };
+
+		WriteAclMap ComponentWriteAcl;
+		ComponentWriteAcl.Add(SpatialConstants::POSITION_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+		ComponentWriteAcl.Add(SpatialConstants::INTEREST_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+		ComponentWriteAcl.Add(SpatialConstants::SPAWN_DATA_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+		ComponentWriteAcl.Add(SpatialConstants::ENTITY_ACL_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+		ComponentWriteAcl.Add(SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+		ComponentWriteAcl.Add(SpatialConstants::NETMULTICAST_RPCS_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+		ComponentWriteAcl.Add(SpatialConstants::DORMANT_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+		ComponentWriteAcl.Add(SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID, OwningClientOnlyRequirementSet);
+		ComponentWriteAcl.Add(SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+		ComponentWriteAcl.Add(SpatialConstants::ALWAYS_RELEVANT_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+
+		if (bIsPlayerController)
+		{
+#if !UE_BUILD_SHIPPING
+			ComponentWriteAcl.Add(SpatialConstants::DEBUG_METRICS_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+#endif // !UE_BUILD_SHIPPING
+			ComponentWriteAcl.Add(SpatialConstants::HEARTBEAT_COMPONENT_ID, OwningClientOnlyRequirementSet);
+		}
+
+		for (Worker_ComponentId ComponentId : ExtraComponents)
+		{
+			ComponentWriteAcl.Add(ComponentId, AuthoritativeWorkerRequirementSet);
+		}
+
+		AddSchemaComponents(Info, ComponentWriteAcl, AuthoritativeWorkerRequirementSet);
+
+		int32 SubobjectIndex = 0;
+		for (const auto& SubobjectInfoPair : Info.SubobjectInfo)
+		{
+			if (PresentSubobjects[SubobjectIndex++])
+			{
+				AddSchemaComponents(SubobjectInfoPair.Value.Get(), ComponentWriteAcl, AuthoritativeWorkerRequirementSet);
+			}
+		}
+
+		return EntityAcl(ReadAcl, ComponentWriteAcl).CreateEntityAclData();
+	}
+
+	bool AclDataMatches(const Worker_ComponentData& Expected, const Worker_ComponentData& Actual)
+	{
+		const EntityAcl ExpectedAcl(Expected);
+		const EntityAcl ActualAcl(Actual);
+		return ExpectedAcl.ReadAcl == ActualAcl.ReadAcl && ExpectedAcl.ComponentWriteAcl.OrderIndependentCompareEqual(ActualAcl.ComponentWriteAcl);
+	}
+} // anonymous namespace
+
+ENTITYACLTEMPLATECACHE_TEST(GIVEN_a_class_template_WHEN_acl_data_is_created_THEN_it_matches_the_uncached_acl)
+{
+	FEntityAclTemplateCache Cache;
+	Cache.Init(TestServerWorkerTypes);
+
+	const FClassInfo Info = CreateTestClassInfo();
+
+	TBitArray<> PresentSubobjects(true, Info.SubobjectInfo.Num());
+	PresentSubobjects[1] = false;
+
+	const TArray<Worker_ComponentId> ExtraComponents = { SpatialConstants::TOMBSTONE_COMPONENT_ID, Info.SchemaComponents[SCHEMA_Data] };
+
+	for (UClass* Class : { AActor::StaticClass(), APlayerController::StaticClass() })
+	{
+		const FEntityAclTemplate& Template = Cache.GetOrCreateTemplate(Class, Info, PresentSubobjects);
+
+		Worker_ComponentData Expected = CreateUncachedEntityAclData(Class, Info, PresentSubobjects, TestOwnerAttribute, ExtraComponents);
+		Worker_ComponentData Actual = Cache.CreateEntityAclData(Template, TestOwnerAttribute, ExtraComponents);
+
+		TestTrue(FString::Printf(TEXT("%s ACL matches the uncached ACL"), *Class->GetName()), AclDataMatches(Expected, Actual));
+
+		Schema_DestroyComponentData(Expected.schema_type);
+		Schema_DestroyComponentData(Actual.schema_type);
+	}
+
+	return true;
+}
+
+ENTITYACLTEMPLATECACHE_TEST(GIVEN_a_cache_WHEN_templates_are_requested_THEN_they_are_reused_per_class_and_present_subobjects)
+{
+	FEntityAclTemplateCache Cache;
+	Cache.Init(TestServerWorkerTypes);
+
+	const FClassInfo Info = CreateTestClassInfo();
+
+	TBitArray<> AllPresent(true, Info.SubobjectInfo.Num());
+	TBitArray<> OneMissing(true, Info.SubobjectInfo.Num());
+	OneMissing[0] = false;
+
+	const FEntityAclTemplate* First = &Cache.GetOrCreateTemplate(AActor::StaticClass(), Info, AllPresent);
+	const FEntityAclTemplate* Second = &Cache.GetOrCreateTemplate(AActor::StaticClass(), Info, AllPresent);
+	TestTrue("Same class and subobjects reuse the template", First == Second);
+	TestEqual("One template cached", Cache.Num(), 1);
+
+	const FEntityAclTemplate& Missing = Cache.GetOrCreateTemplate(AActor::StaticClass(), Info, OneMissing);
+	TestFalse("Missing subobject's components are not in the template", Missing.Components.Contains(Info.SubobjectInfo.FindChecked(1)->SchemaComponents[SCHEMA_Data]));
+	TestEqual("Missing subobject creates a second template", Cache.Num(), 2);
+
+	Cache.GetOrCreateTemplate(APlayerController::StaticClass(), Info, AllPresent);
+	TestEqual("Other classes get their own template", Cache.Num(), 3);
+
+	Cache.Empty();
+	TestEqual("Empty cache holds no templates", Cache.Num(), 0);
+
+	return true;
+}
+
+// Simulates a server creating many entities of the same class, as when a level or wave of AI is spawned.
+ENTITYACLTEMPLATECACHE_TEST(GIVEN_mass_spawn_WHEN_acls_are_created_from_templates_THEN_report_creation_throughput)
+{
+	const int32 NumEntities = 10000;
+
+	FEntityAclTemplateCache Cache;
+	Cache.Init(TestServerWorkerTypes);
+
+	const FClassInfo Info = CreateTestClassInfo();
+	const TBitArray<> PresentSubobjects(true, Info.SubobjectInfo.Num());
+	const TArray<Worker_ComponentId> NoExtraComponents;
+
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumEntities; i++)
+	{
+		Worker_ComponentData Data = CreateUncachedEntityAclData(AActor::StaticClass(), Info, PresentSubobjects, TestOwnerAttribute, NoExtraComponents);
+		Schema_DestroyComponentData(Data.schema_type);
+	}
+	const double UncachedTime = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumEntities; i++)
+	{
+		const FEntityAclTemplate& Template = Cache.GetOrCreateTemplate(AActor::StaticClass(), Info, PresentSubobjects);
+		Worker_ComponentData Data = Cache.CreateEntityAclData(Template, TestOwnerAttribute, NoExtraComponents);
+		Schema_DestroyComponentData(Data.schema_type);
+	}
+	const double CachedTime = FPlatformTime::Seconds() - StartTime;
+
+	TestEqual("One template is built for all entities", Cache.Num(), 1);
+
+	AddInfo(FString::Printf(TEXT("EntityAcl for %d entities: uncached %.2fms (%.2fus each), templated %.2fms (%.2fus each), %.1fx faster"),
+		NumEntities, UncachedTime * 1000.0, UncachedTime * 1e6 / NumEntities, CachedTime * 1000.0, CachedTime * 1e6 / NumEntities,
+		CachedTime > 0.0 ? UncachedTime / CachedTime : 0.0));
+
+	return true;
+}
@@ -0,0 +1,153 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestDefinitions.h"
+
+#include "EngineClasses/SpatialNetBitWriter.h"
+#include "SpatialConstants.h"
+#include "Utils/FrameArena.h"
+#include "Utils/SchemaUtils.h"
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+#define FRAMEARENA_TEST(TestName) \
+	GDK_TEST(Core, FFrameArena, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	// Parameters of a typical ability RPC: a target location and direction, an ability ID and a timestamp.
+	void WriteRPCParameters(FSpatialNetBitWriter& Writer, int32 RPCIndex)
+	{
+		FVector Location(RPCIndex, RPCIndex * 2.f, RPCIndex * 3.f);
+		FVector Direction = FVector::ForwardVector;
+		int32 AbilityId = RPCIndex % 64;
+		float Timestamp = RPCIndex * 0.016f;
+		Writer << Location << Direction << AbilityId << Timestamp;
+	}
+
+	void AddPackedRPCToSchema(Schema_Object* EventsObject, int32 RPCIndex, const uint8* Data, int32 NumBytes)
+	{
+		Schema_Object* EventData = Schema_AddObject(EventsObject, SpatialConstants::UNREAL_RPC_ENDPOINT_PACKED_EVENT_ID);
+		Schema_AddUint32(EventData, SpatialConstants::UNREAL_RPC_PAYLOAD_OFFSET_ID, 0);
+		Schema_AddUint32(EventData, SpatialConstants::UNREAL_RPC_PAYLOAD_RPC_INDEX_ID, RPCIndex);
+		AddBytesToSchema(EventData, SpatialConstants::UNREAL_RPC_PAYLOAD_RPC_PAYLOAD_ID, Data, NumBytes);
+	}
+} // anonymous namespace
+
+FRAMEARENA_TEST(GIVEN_an_arena_WHEN_reset_THEN_its_blocks_are_reused)
+{
+	FFrameArena Arena(64);
+
+	uint8* First = Arena.Allocate(40);
+	uint8* Second = Arena.Allocate(40);
+	TestTrue("Allocation that doesn't fit starts a new block", Second != First + 40);
+	TestEqual("Bytes allocated are counted", Arena.GetBytesAllocated(), 80);
+
+	Arena.Reset();
+	TestEqual("Reset releases allocations", Arena.GetBytesAllocated(), 0);
+	TestTrue("First allocation after reset reuses the first block", Arena.Allocate(40) == First);
+	TestTrue("Second allocation after reset reuses the second block", Arena.Allocate(40) == Second);
+	TestEqual("No blocks are added for a frame of the same size", Arena.GetReservedBytes(), 128);
+
+	int32 HighWaterMark = 0;
+	int32 BlocksAllocated = 0;
+	Arena.ConsumeStats(HighWaterMark, BlocksAllocated);
+	TestEqual("High water mark is the largest frame", HighWaterMark, 80);
+	TestEqual("Blocks allocated from the heap are counted", BlocksAllocated, 2);
+
+	Arena.ConsumeStats(HighWaterMark, BlocksAllocated);
+	TestEqual("Stats are reset once consumed, apart from the current frame", HighWaterMark, 80);
+	TestEqual("Block count is reset once consumed", BlocksAllocated, 0);
+
+	return true;
+}
+
+FRAMEARENA_TEST(GIVEN_an_allocation_larger_than_a_block_WHEN_allocated_THEN_it_gets_its_own_block)
+{
+	FFrameArena Arena(64);
+
+	const uint8 Bytes[100] = { 1, 2, 3 };
+	TArrayView<const uint8> Copy = Arena.Copy(Bytes, sizeof(Bytes));
+	TestTrue("Copy has the data", Copy.Num() == sizeof(Bytes) && FMemory::Memcmp(Copy.GetData(), Bytes, sizeof(Bytes)) == 0);
+	TestEqual("Oversized block fits the allocation", Arena.GetReservedBytes(), 100);
+
+	Arena.Allocate(8);
+	TestEqual("Following allocations get a regular block", Arena.GetReservedBytes(), 164);
+
+	return true;
+}
+
+// Sends a frame's worth of packed RPCs the way USpatialSender did before the arena, with a new writer and two array
+// copies per RPC, and then the way it does now, with one writer and packed payloads held in the arena until the flush.
+FRAMEARENA_TEST(GIVEN_frames_of_packed_RPCs_WHEN_sent_through_the_arena_THEN_reports_throughput)
+{
+	const int32 NumFrames = 200;
+	const int32 RPCsPerFrame = 500;
+
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 Frame = 0; Frame < NumFrames; Frame++)
+	{
+		TArray<TArray<uint8>> PendingRPCs;
+		for (int32 i = 0; i < RPCsPerFrame; i++)
+		{
+			FSpatialNetBitWriter Writer(nullptr);
+			WriteRPCParameters(Writer, i);
+			TArray<uint8> Payload(Writer.GetData(), Writer.GetNumBytes());
+			PendingRPCs.Add(TArray<uint8>(Payload.GetData(), Payload.Num()));
+		}
+
+		Schema_ComponentUpdate* Update = Schema_CreateComponentUpdate();
+		Schema_Object* EventsObject = Schema_GetComponentUpdateEvents(Update);
+		for (int32 i = 0; i < PendingRPCs.Num(); i++)
+		{
+			AddPackedRPCToSchema(EventsObject, i, PendingRPCs[i].GetData(), PendingRPCs[i].Num());
+		}
+		Schema_DestroyComponentUpdate(Update);
+	}
+	const double PerRPCSeconds = FPlatformTime::Seconds() - StartTime;
+
+	FFrameArena Arena;
+	FSpatialNetBitWriter Writer(nullptr);
+	TArray<TArrayView<const uint8>> PendingRPCs;
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Frame = 0; Frame < NumFrames; Frame++)
+	{
+		for (int32 i = 0; i < RPCsPerFrame; i++)
+		{
+			Writer.Reset();
+			WriteRPCParameters(Writer, i);
+			TArray<uint8> Payload(Writer.GetData(), Writer.GetNumBytes());
+			PendingRPCs.Add(Arena.Copy(Payload.GetData(), Payload.Num()));
+		}
+
+		Schema_ComponentUpdate* Update = Schema_CreateComponentUpdate();
+		Schema_Object* EventsObject = Schema_GetComponentUpdateEvents(Update);
+		for (int32 i = 0; i < PendingRPCs.Num(); i++)
+		{
+			AddPackedRPCToSchema(EventsObject, i, PendingRPCs[i].GetData(), PendingRPCs[i].Num());
+		}
+		Schema_DestroyComponentUpdate(Update);
+
+		PendingRPCs.Reset();
+		Arena.Reset();
+	}
+	const double ArenaSeconds = FPlatformTime::Seconds() - StartTime;
+
+	int32 HighWaterMark = 0;
+	int32 BlocksAllocated = 0;
+	Arena.ConsumeStats(HighWaterMark, BlocksAllocated);
+	TestTrue("A frame of RPCs fits in the arena", HighWaterMark > 0 && BlocksAllocated >= 1);
+
+	const int32 NumRPCs = NumFrames * RPCsPerFrame;
+	AddInfo(FString::Printf(TEXT("%d RPCs in %d frames: per RPC buffers %.1f ms (%.2f M RPCs/s), arena %.1f ms (%.2f M RPCs/s), arena high water mark %d bytes in %d blocks"),
+		NumRPCs, NumFrames,
+		PerRPCSeconds * 1000.0, NumRPCs / FMath::Max(PerRPCSeconds, 1e-9) / 1e6,
+		ArenaSeconds * 1000.0, NumRPCs / FMath::Max(ArenaSeconds, 1e-9) / 1e6,
+		HighWaterMark, BlocksAllocated));
+
+	return true;
+}
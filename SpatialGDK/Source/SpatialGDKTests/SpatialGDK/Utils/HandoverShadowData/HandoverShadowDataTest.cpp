@@ -0,0 +1,179 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestDefinitions.h"
+#include "TestHandoverObject.h"
+
+#include "Interop/SpatialClassInfoManager.h"
+#include "Utils/HandoverShadowData.h"
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/UnrealType.h"
+
+#define HANDOVERSHADOWDATA_TEST(TestName) \
+	GDK_TEST(Core, FHandoverShadowData, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	// Builds the handover properties of the test class as USpatialClassInfoManager does.
+	TArray<FHandoverPropertyInfo> GetTestHandoverProperties()
+	{
+		TArray<FHandoverPropertyInfo> HandoverProperties;
+		for (TFieldIterator<UProperty> PropertyIt(UTestHandoverObject::StaticClass()); PropertyIt; ++PropertyIt)
+		{
+			UProperty* Property = *PropertyIt;
+			for (int32 ArrayIdx = 0; ArrayIdx < Property->ArrayDim; ++ArrayIdx)
+			{
+				FHandoverPropertyInfo HandoverInfo;
+				HandoverInfo.Handle = HandoverProperties.Num() + 1;
+				HandoverInfo.Offset = Property->GetOffset_ForGC() + Property->ElementSize * ArrayIdx;
+				HandoverInfo.ArrayIdx = ArrayIdx;
+				HandoverInfo.Property = Property;
+				HandoverInfo.bPlainOldData = (Property->PropertyFlags & CPF_IsPlainOldData) && !Property->IsA<UBoolProperty>();
+				HandoverProperties.Add(HandoverInfo);
+			}
+		}
+		return HandoverProperties;
+	}
+
+	uint16 FindHandle(const TArray<FHandoverPropertyInfo>& HandoverProperties, FName PropertyName, int32 ArrayIdx = 0)
+	{
+		const FHandoverPropertyInfo* Info = HandoverProperties.FindByPredicate([PropertyName, ArrayIdx](const FHandoverPropertyInfo& PropertyInfo)
+		{
+			return PropertyInfo.Property->GetFName() == PropertyName && PropertyInfo.ArrayIdx == ArrayIdx;
+		});
+		return Info != nullptr ? Info->Handle : 0;
+	}
+} // anonymous namespace
+
+HANDOVERSHADOWDATA_TEST(GIVEN_handover_properties_WHEN_classified_THEN_only_plain_old_data_other_than_bools_is_compared_as_memory)
+{
+	TArray<FHandoverPropertyInfo> HandoverProperties = GetTestHandoverProperties();
+
+	for (const FHandoverPropertyInfo& PropertyInfo : HandoverProperties)
+	{
+		const FName Name = PropertyInfo.Property->GetFName();
+		const bool bExpectPlainOldData = Name == GET_MEMBER_NAME_CHECKED(UTestHandoverObject, Health)
+			|| Name == GET_MEMBER_NAME_CHECKED(UTestHandoverObject, Stamina)
+			|| Name == GET_MEMBER_NAME_CHECKED(UTestHandoverObject, Destination)
+			|| Name == GET_MEMBER_NAME_CHECKED(UTestHandoverObject, Cooldowns);
+		TestEqual(FString::Printf(TEXT("%s is compared as memory"), *Name.ToString()), PropertyInfo.bPlainOldData, bExpectPlainOldData);
+	}
+
+	return true;
+}
+
+HANDOVERSHADOWDATA_TEST(GIVEN_shadow_data_WHEN_properties_change_THEN_only_changed_properties_are_reported)
+{
+	TArray<FHandoverPropertyInfo> HandoverProperties = GetTestHandoverProperties();
+	UTestHandoverObject* Object = NewObject<UTestHandoverObject>();
+
+	TArray<uint8> ShadowData;
+	InitializeHandoverShadowData(HandoverProperties, ShadowData);
+
+	FHandoverChangeState Changed = GetHandoverChangeList(HandoverProperties, ShadowData, (const uint8*)Object, /* bForceAll */ true);
+	TestEqual("Every property is reported when forced", Changed.Num(), HandoverProperties.Num());
+
+	Changed = GetHandoverChangeList(HandoverProperties, ShadowData, (const uint8*)Object, /* bForceAll */ false);
+	TestEqual("Nothing is reported when nothing changed", Changed.Num(), 0);
+
+	Object->bOtherFlag = true;
+	Object->Destination.Y = 5.f;
+	Object->Cooldowns[2] = 3;
+	Object->Name = TEXT("Changed");
+	Changed = GetHandoverChangeList(HandoverProperties, ShadowData, (const uint8*)Object, /* bForceAll */ false);
+
+	TestEqual("Each changed property is reported once", Changed.Num(), 4);
+	TestTrue("Changed bitfield bool is reported without its neighbour", Changed.Contains(FindHandle(HandoverProperties, GET_MEMBER_NAME_CHECKED(UTestHandoverObject, bOtherFlag)))
+		&& !Changed.Contains(FindHandle(HandoverProperties, GET_MEMBER_NAME_CHECKED(UTestHandoverObject, bFlag))));
+	TestTrue("Changed struct is reported", Changed.Contains(FindHandle(HandoverProperties, GET_MEMBER_NAME_CHECKED(UTestHandoverObject, Destination))));
+	TestTrue("Only the changed static array element is reported", Changed.Contains(FindHandle(HandoverProperties, GET_MEMBER_NAME_CHECKED(UTestHandoverObject, Cooldowns), 2))
+		&& !Changed.Contains(FindHandle(HandoverProperties, GET_MEMBER_NAME_CHECKED(UTestHandoverObject, Cooldowns), 1)));
+	TestTrue("Changed string is reported", Changed.Contains(FindHandle(HandoverProperties, GET_MEMBER_NAME_CHECKED(UTestHandoverObject, Name))));
+
+	Changed = GetHandoverChangeList(HandoverProperties, ShadowData, (const uint8*)Object, /* bForceAll */ false);
+	TestEqual("Shadow data holds the sent values", Changed.Num(), 0);
+
+	return true;
+}
+
+// Compares the handover properties of many actors as ReplicateActor does each tick, through UProperty::Identical as
+// before and with the raw memory fast path. With on-demand handover, ticks without a capture skip this entirely.
+HANDOVERSHADOWDATA_TEST(GIVEN_many_actors_WHEN_handover_is_compared_every_tick_THEN_reports_per_tick_cost)
+{
+	const int32 NumObjects = 2000;
+	const int32 NumTicks = 100;
+
+	TArray<FHandoverPropertyInfo> FastPathProperties = GetTestHandoverProperties();
+	TArray<FHandoverPropertyInfo> IdenticalProperties = FastPathProperties;
+	for (FHandoverPropertyInfo& PropertyInfo : IdenticalProperties)
+	{
+		PropertyInfo.bPlainOldData = false;
+	}
+
+	TArray<UTestHandoverObject*> Objects;
+	TArray<TArray<uint8>> IdenticalShadowData;
+	TArray<TArray<uint8>> FastPathShadowData;
+	for (int32 i = 0; i < NumObjects; i++)
+	{
+		UTestHandoverObject* Object = NewObject<UTestHandoverObject>();
+		Object->Name = FString::Printf(TEXT("Actor%d"), i);
+		Object->Inventory.SetNum(8);
+		Objects.Add(Object);
+		InitializeHandoverShadowData(IdenticalProperties, IdenticalShadowData.AddDefaulted_GetRef());
+		InitializeHandoverShadowData(FastPathProperties, FastPathShadowData.AddDefaulted_GetRef());
+	}
+
+	auto ResetObjects = [&Objects]()
+	{
+		for (UTestHandoverObject* Object : Objects)
+		{
+			Object->Health = 100;
+		}
+	};
+
+	// Handover state changes rarely, so only a few actors change between ticks.
+	auto ChangeSomeObjects = [&Objects](int32 Tick)
+	{
+		for (int32 i = Tick % 50; i < Objects.Num(); i += 50)
+		{
+			Objects[i]->Health = Tick;
+		}
+	};
+
+	int32 IdenticalChanges = 0;
+	ResetObjects();
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 Tick = 0; Tick < NumTicks; Tick++)
+	{
+		ChangeSomeObjects(Tick);
+		for (int32 i = 0; i < NumObjects; i++)
+		{
+			IdenticalChanges += GetHandoverChangeList(IdenticalProperties, IdenticalShadowData[i], (const uint8*)Objects[i], false).Num();
+		}
+	}
+	const double IdenticalSeconds = FPlatformTime::Seconds() - StartTime;
+
+	int32 FastPathChanges = 0;
+	ResetObjects();
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Tick = 0; Tick < NumTicks; Tick++)
+	{
+		ChangeSomeObjects(Tick);
+		for (int32 i = 0; i < NumObjects; i++)
+		{
+			FastPathChanges += GetHandoverChangeList(FastPathProperties, FastPathShadowData[i], (const uint8*)Objects[i], false).Num();
+		}
+	}
+	const double FastPathSeconds = FPlatformTime::Seconds() - StartTime;
+
+	TestEqual("Fast path finds the same changes as UProperty", FastPathChanges, IdenticalChanges);
+
+	AddInfo(FString::Printf(TEXT("%d actors x %d handover properties: per tick %.3f ms through UProperty, %.3f ms with the memory fast path, 0 ms on ticks skipped by on-demand handover"),
+		NumObjects, FastPathProperties.Num(),
+		IdenticalSeconds * 1000.0 / NumTicks, FastPathSeconds * 1000.0 / NumTicks));
+
+	return true;
+}
@@ -0,0 +1,42 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "TestHandoverObject.generated.h"
+
+/**
+ * These types are for testing purposes only.
+ */
+UCLASS(HideDropdown)
+class SPATIALGDKTESTS_API UTestHandoverObject : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	// Bitfields sharing a byte, which must be compared through UBoolProperty.
+	UPROPERTY(Handover)
+	uint8 bFlag : 1;
+
+	UPROPERTY(Handover)
+	uint8 bOtherFlag : 1;
+
+	UPROPERTY(Handover)
+	int32 Health = 100;
+
+	UPROPERTY(Handover)
+	float Stamina = 1.f;
+
+	UPROPERTY(Handover)
+	FVector Destination = FVector::ZeroVector;
+
+	UPROPERTY(Handover)
+	int32 Cooldowns[4] = {};
+
+	UPROPERTY(Handover)
+	FString Name;
+
+	UPROPERTY(Handover)
+	TArray<int32> Inventory;
+};
@@ -0,0 +1,193 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestDefinitions.h"
+
+#include "Utils/HeartbeatTimingWheel.h"
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "TimerManager.h"
+
+#define HEARTBEATTIMINGWHEEL_TEST(TestName) \
+	GDK_TEST(Core, FHeartbeatTimingWheel, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	const float TestTimeoutSeconds = 10.f;
+	const float TestResolutionSeconds = 0.5f;
+} // anonymous namespace
+
+HEARTBEATTIMINGWHEEL_TEST(GIVEN_a_tracked_entity_WHEN_no_heartbeat_arrives_THEN_it_times_out_within_one_tick_of_the_timeout)
+{
+	FHeartbeatTimingWheel Wheel;
+	Wheel.Init(TestTimeoutSeconds, TestResolutionSeconds, 100.0);
+
+	Wheel.Refresh(1, 100.2);
+
+	TArray<Worker_EntityId> TimedOut;
+	double Time = 100.0;
+	while (TimedOut.Num() == 0 && Time < 200.0)
+	{
+		Time += TestResolutionSeconds;
+		Wheel.Advance(Time, TimedOut);
+	}
+
+	TestTrue("Entity times out", TimedOut.Num() == 1 && TimedOut[0] == 1);
+	TestTrue("Entity doesn't time out early", Time >= 100.2 + TestTimeoutSeconds);
+	TestTrue("Entity times out within one tick of its timeout", Time < 100.2 + TestTimeoutSeconds + TestResolutionSeconds);
+	TestFalse("Timed out entity is no longer tracked", Wheel.Contains(1));
+
+	return true;
+}
+
+HEARTBEATTIMINGWHEEL_TEST(GIVEN_tracked_entities_WHEN_refreshed_or_removed_THEN_only_silent_entities_time_out)
+{
+	FHeartbeatTimingWheel Wheel;
+	Wheel.Init(TestTimeoutSeconds, TestResolutionSeconds, 0.0);
+
+	Wheel.Refresh(1, 0.0);
+	Wheel.Refresh(2, 0.0);
+	Wheel.Refresh(3, 0.0);
+	TestEqual("Three entities tracked", Wheel.Num(), 3);
+
+	TArray<Worker_EntityId> TimedOut;
+	for (double Time = TestResolutionSeconds; Time <= 30.0; Time += TestResolutionSeconds)
+	{
+		// Entity 1 sends a heartbeat every two seconds, entity 2 goes quiet and entity 3 disconnects cleanly.
+		if (FMath::Fmod(Time, 2.0) == 0.0)
+		{
+			Wheel.Refresh(1, Time);
+		}
+		if (Time == 5.0)
+		{
+			Wheel.Remove(3);
+		}
+
+		Wheel.Advance(Time, TimedOut);
+	}
+
+	TestTrue("Only the silent entity times out", TimedOut.Num() == 1 && TimedOut[0] == 2);
+	TestTrue("Entity sending heartbeats is still tracked", Wheel.Contains(1));
+	TestEqual("One entity tracked", Wheel.Num(), 1);
+
+	return true;
+}
+
+HEARTBEATTIMINGWHEEL_TEST(GIVEN_a_long_hitch_WHEN_advanced_THEN_every_expired_entity_times_out)
+{
+	FHeartbeatTimingWheel Wheel;
+	Wheel.Init(TestTimeoutSeconds, TestResolutionSeconds, 0.0);
+
+	for (Worker_EntityId EntityId = 1; EntityId <= 100; EntityId++)
+	{
+		Wheel.Refresh(EntityId, EntityId * 0.1);
+	}
+
+	TArray<Worker_EntityId> TimedOut;
+	Wheel.Advance(5.0, TimedOut);
+	TestEqual("Nothing times out before the timeout", TimedOut.Num(), 0);
+
+	Wheel.Refresh(100, 5.0);
+	Wheel.Advance(1000.0, TimedOut);
+	TestEqual("Every entity times out after a hitch longer than the wheel", TimedOut.Num(), 100);
+	TestEqual("No entities tracked", Wheel.Num(), 0);
+
+	return true;
+}
+
+// Simulates a server with 10k connected clients, each sending a heartbeat every two seconds, for one minute.
+HEARTBEATTIMINGWHEEL_TEST(GIVEN_10000_connections_WHEN_heartbeats_arrive_THEN_report_timer_and_wheel_cost)
+{
+	const int32 NumConnections = 10000;
+	const float HeartbeatIntervalSeconds = 2.f;
+	const float DeltaSeconds = 1.f / 30.f;
+	const int32 NumTicks = 60 * 30;
+
+	FRandomStream Random(NumConnections);
+	TArray<float> NextHeartbeatTimes;
+	for (int32 i = 0; i < NumConnections; i++)
+	{
+		NextHeartbeatTimes.Add(Random.FRandRange(0.f, HeartbeatIntervalSeconds));
+	}
+
+	// One FTimerManager timer per connection, re-armed on every heartbeat.
+	double TimerRefreshTime = 0.0;
+	{
+		FTimerManager TimerManager;
+		TArray<FTimerHandle> Timers;
+		Timers.SetNum(NumConnections);
+
+		TArray<float> HeartbeatTimes = NextHeartbeatTimes;
+		for (int32 Tick = 0; Tick < NumTicks; Tick++)
+		{
+			const float Time = Tick * DeltaSeconds;
+
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 i = 0; i < NumConnections; i++)
+			{
+				if (HeartbeatTimes[i] <= Time)
+				{
+					TimerManager.SetTimer(Timers[i], []() {}, TestTimeoutSeconds, false);
+					HeartbeatTimes[i] += HeartbeatIntervalSeconds;
+				}
+			}
+			TimerRefreshTime += FPlatformTime::Seconds() - StartTime;
+		}
+
+		for (FTimerHandle& Timer : Timers)
+		{
+			TimerManager.ClearTimer(Timer);
+		}
+	}
+
+	// One timing wheel for all connections, advanced every HEARTBEAT_TIMEOUT_CHECK_INTERVAL_SECONDS.
+	int32 WheelTimeouts = 0;
+	double WheelRefreshTime = 0.0;
+	double WheelAdvanceTime = 0.0;
+	{
+		FHeartbeatTimingWheel Wheel;
+		Wheel.Init(TestTimeoutSeconds, TestResolutionSeconds, 0.0);
+
+		TArray<float> HeartbeatTimes = NextHeartbeatTimes;
+		TArray<Worker_EntityId> TimedOut;
+		float NextAdvanceTime = TestResolutionSeconds;
+		for (int32 Tick = 0; Tick < NumTicks; Tick++)
+		{
+			const float Time = Tick * DeltaSeconds;
+
+			double StartTime = FPlatformTime::Seconds();
+			for (int32 i = 0; i < NumConnections; i++)
+			{
+				if (HeartbeatTimes[i] <= Time)
+				{
+					Wheel.Refresh(i + 1, Time);
+					HeartbeatTimes[i] += HeartbeatIntervalSeconds;
+				}
+			}
+			WheelRefreshTime += FPlatformTime::Seconds() - StartTime;
+
+			if (Time >= NextAdvanceTime)
+			{
+				StartTime = FPlatformTime::Seconds();
+				Wheel.Advance(Time, TimedOut);
+				WheelAdvanceTime += FPlatformTime::Seconds() - StartTime;
+				NextAdvanceTime += TestResolutionSeconds;
+			}
+		}
+
+		WheelTimeouts = TimedOut.Num();
+		TestEqual("Every connection is still tracked", Wheel.Num(), NumConnections);
+	}
+
+	TestEqual("No connection sending heartbeats times out", WheelTimeouts, 0);
+
+	const int32 NumHeartbeats = FMath::RoundToInt(NumConnections * NumTicks * DeltaSeconds / HeartbeatIntervalSeconds);
+	AddInfo(FString::Printf(TEXT("%d connections, ~%d heartbeats over %.0fs: timer re-arm %.2fms (%.0fns each), wheel refresh %.2fms (%.0fns each), wheel advance %.2fms total"),
+		NumConnections, NumHeartbeats, NumTicks * DeltaSeconds, TimerRefreshTime * 1000.0, TimerRefreshTime * 1e9 / NumHeartbeats,
+		WheelRefreshTime * 1000.0, WheelRefreshTime * 1e9 / NumHeartbeats, WheelAdvanceTime * 1000.0));
+
+	return true;
+}
@@ -0,0 +1,279 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestDefinitions.h"
+#include "TestInitialDataActor.h"
+
+#include "EngineClasses/SpatialNetBitWriter.h"
+#include "EngineClasses/SpatialNetDriver.h"
+#include "SpatialGDKSettings.h"
+#include "Utils/RepLayoutUtils.h"
+
+#include "CoreMinimal.h"
+#include "Net/RepLayout.h"
+#include "UObject/Package.h"
+
+#define INITIALDATABASELINE_TEST(TestName) \
+	GDK_TEST(Core, FInitialDataBaseline, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	// Sets bOmitDefaultPropertiesFromInitialData for the lifetime of a test.
+	struct FOmitDefaultPropertiesScope
+	{
+		explicit FOmitDefaultPropertiesScope(bool bEnabled)
+			: bWasEnabled(GetDefault<USpatialGDKSettings>()->bOmitDefaultPropertiesFromInitialData)
+		{
+			GetMutableDefault<USpatialGDKSettings>()->bOmitDefaultPropertiesFromInitialData = bEnabled;
+		}
+
+		~FOmitDefaultPropertiesScope()
+		{
+			GetMutableDefault<USpatialGDKSettings>()->bOmitDefaultPropertiesFromInitialData = bWasEnabled;
+		}
+
+		bool bWasEnabled;
+	};
+
+	const FRepLayoutCmd& GetCmdForHandle(const FRepLayout& RepLayout, uint32 Handle)
+	{
+		return RepLayout.Cmds[RepLayout.BaseHandleToCmdIndex[Handle - 1].CmdIndex];
+	}
+
+	uint32 GetHandleForProperty(const FRepLayout& RepLayout, FName PropertyName)
+	{
+		for (int32 Handle = 1; Handle <= RepLayout.BaseHandleToCmdIndex.Num(); Handle++)
+		{
+			if (GetCmdForHandle(RepLayout, Handle).Property->GetFName() == PropertyName)
+			{
+				return Handle;
+			}
+		}
+		return 0;
+	}
+
+	// Picks the top-level properties of Object's initial data the way USpatialActorChannel::CreateInitialRepChangeState does,
+	// returning their handles and adding their serialized size to OutNumBytes.
+	TArray<uint32> WriteInitialData(USpatialNetDriver* NetDriver, FRepLayout& RepLayout, UObject* Object, int64& OutNumBytes)
+	{
+		const uint8* Baseline = nullptr;
+		if (GetDefault<USpatialGDKSettings>()->bOmitDefaultPropertiesFromInitialData)
+		{
+			Baseline = (const uint8*)GetInitialDataBaseline(Object);
+		}
+		uint8* Data = (uint8*)Object;
+
+		FSpatialNetBitWriter Writer(NetDriver->PackageMap);
+		TArray<uint32> Handles;
+		for (int32 Handle = 1; Handle <= RepLayout.BaseHandleToCmdIndex.Num(); Handle++)
+		{
+			const int32 CmdIndex = RepLayout.BaseHandleToCmdIndex[Handle - 1].CmdIndex;
+			const FRepLayoutCmd& Cmd = RepLayout.Cmds[CmdIndex];
+			if (Baseline != nullptr && IsPropertyOmittedFromInitialData(RepLayout, Cmd, Data, Baseline))
+			{
+				continue;
+			}
+
+			Handles.Add(Handle);
+
+			if (Cmd.Type == ERepLayoutCmdType::DynamicArray)
+			{
+				bool bHasUnmapped = false;
+				RepLayout_SerializeProperties_DynamicArray(RepLayout, Writer, NetDriver->PackageMap, CmdIndex, Data + Cmd.Offset, bHasUnmapped);
+			}
+			else if (Cmd.Property->IsA<UObjectPropertyBase>())
+			{
+				// Object references are written as an entity ID and offset, and need a resolving package map to serialize.
+				OutNumBytes += sizeof(Worker_EntityId) + sizeof(uint32);
+			}
+			else
+			{
+				Cmd.Property->NetSerializeItem(Writer, NetDriver->PackageMap, Data + Cmd.Offset);
+			}
+		}
+
+		OutNumBytes += Writer.GetNumBytes();
+		return Handles;
+	}
+
+	// Applies initial data the way ComponentReader does. The received properties are copied from the writer, standing in for
+	// the schema round trip, and the omitted ones are restored from the baseline when the setting is on.
+	void ReadInitialData(const FRepLayout& RepLayout, UObject* Object, const UObject* Source, const TArray<uint32>& Handles)
+	{
+		for (uint32 Handle : Handles)
+		{
+			const FRepLayoutCmd& Cmd = GetCmdForHandle(RepLayout, Handle);
+			Cmd.Property->CopySingleValue((uint8*)Object + Cmd.Offset, (const uint8*)Source + Cmd.Offset);
+		}
+
+		if (GetDefault<USpatialGDKSettings>()->bOmitDefaultPropertiesFromInitialData)
+		{
+			RestoreOmittedProperties(RepLayout, Object, Handles, [](const FRepParentCmd&) { return true; });
+		}
+	}
+
+	bool ReaderMatchesWriter(const FRepLayout& RepLayout, const UObject* Reader, const UObject* Writer)
+	{
+		for (int32 Handle = 1; Handle <= RepLayout.BaseHandleToCmdIndex.Num(); Handle++)
+		{
+			const FRepLayoutCmd& Cmd = GetCmdForHandle(RepLayout, Handle);
+			if (!Cmd.Property->Identical((const uint8*)Reader + Cmd.Offset, (const uint8*)Writer + Cmd.Offset))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	ATestInitialDataActor* NewTestActor(ATestInitialDataActor* Template = nullptr)
+	{
+		return NewObject<ATestInitialDataActor>(GetTransientPackage(), NAME_None, RF_NoFlags, Template);
+	}
+
+	// Writes the writer's initial data with the setting on or off and applies it to the reader, returning the handles sent.
+	TArray<uint32> RoundTrip(USpatialNetDriver* NetDriver, FRepLayout& RepLayout, ATestInitialDataActor* Writer, ATestInitialDataActor* Reader, bool bOmitDefaultProperties)
+	{
+		FOmitDefaultPropertiesScope OmitDefaultPropertiesScope(bOmitDefaultProperties);
+
+		int64 NumBytes = 0;
+		TArray<uint32> Handles = WriteInitialData(NetDriver, RepLayout, Writer, NumBytes);
+		ReadInitialData(RepLayout, Reader, Writer, Handles);
+		return Handles;
+	}
+} // anonymous namespace
+
+INITIALDATABASELINE_TEST(GIVEN_a_default_actor_WHEN_its_initial_data_is_round_tripped_THEN_defaults_are_only_omitted_with_the_setting_on)
+{
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	TSharedPtr<FRepLayout> RepLayout = NetDriver->GetObjectClassRepLayout(ATestInitialDataActor::StaticClass());
+	const uint32 HealthHandle = GetHandleForProperty(*RepLayout, GET_MEMBER_NAME_CHECKED(ATestInitialDataActor, Health));
+	const uint32 InventoryHandle = GetHandleForProperty(*RepLayout, GET_MEMBER_NAME_CHECKED(ATestInitialDataActor, Inventory));
+
+	for (bool bOmitDefaultProperties : { false, true })
+	{
+		ATestInitialDataActor* Writer = NewTestActor();
+		ATestInitialDataActor* Reader = NewTestActor();
+
+		const TArray<uint32> Handles = RoundTrip(NetDriver, *RepLayout, Writer, Reader, bOmitDefaultProperties);
+
+		TestEqual(FString::Printf(TEXT("Default property is only omitted with the setting on (setting %d)"), bOmitDefaultProperties), Handles.Contains(HealthHandle), !bOmitDefaultProperties);
+		TestTrue(FString::Printf(TEXT("Dynamic arrays are always sent (setting %d)"), bOmitDefaultProperties), Handles.Contains(InventoryHandle));
+		TestTrue(FString::Printf(TEXT("Reader matches the writer (setting %d)"), bOmitDefaultProperties), ReaderMatchesWriter(*RepLayout, Reader, Writer));
+	}
+
+	return true;
+}
+
+INITIALDATABASELINE_TEST(GIVEN_an_actor_with_a_non_default_property_WHEN_its_initial_data_is_round_tripped_THEN_the_property_is_sent)
+{
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	TSharedPtr<FRepLayout> RepLayout = NetDriver->GetObjectClassRepLayout(ATestInitialDataActor::StaticClass());
+	const uint32 HealthHandle = GetHandleForProperty(*RepLayout, GET_MEMBER_NAME_CHECKED(ATestInitialDataActor, Health));
+	const uint32 SpeedHandle = GetHandleForProperty(*RepLayout, GET_MEMBER_NAME_CHECKED(ATestInitialDataActor, Speed));
+
+	for (bool bOmitDefaultProperties : { false, true })
+	{
+		ATestInitialDataActor* Writer = NewTestActor();
+		Writer->Health = 5;
+		Writer->Inventory = { 1, 2, 3 };
+		ATestInitialDataActor* Reader = NewTestActor();
+
+		const TArray<uint32> Handles = RoundTrip(NetDriver, *RepLayout, Writer, Reader, bOmitDefaultProperties);
+
+		TestTrue(FString::Printf(TEXT("Non-default property is sent (setting %d)"), bOmitDefaultProperties), Handles.Contains(HealthHandle));
+		TestEqual(FString::Printf(TEXT("Default property is only omitted with the setting on (setting %d)"), bOmitDefaultProperties), Handles.Contains(SpeedHandle), !bOmitDefaultProperties);
+		TestTrue(FString::Printf(TEXT("Reader matches the writer (setting %d)"), bOmitDefaultProperties), ReaderMatchesWriter(*RepLayout, Reader, Writer));
+	}
+
+	return true;
+}
+
+INITIALDATABASELINE_TEST(GIVEN_a_reused_actor_WHEN_initial_data_for_a_default_actor_is_applied_to_it_THEN_omitted_properties_are_restored)
+{
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	TSharedPtr<FRepLayout> RepLayout = NetDriver->GetObjectClassRepLayout(ATestInitialDataActor::StaticClass());
+
+	for (bool bOmitDefaultProperties : { false, true })
+	{
+		ATestInitialDataActor* Writer = NewTestActor();
+
+		// A pooled actor keeps the values it had for the entity it last represented.
+		ATestInitialDataActor* Reader = NewTestActor();
+		Reader->Health = 7;
+		Reader->Speed = 1.f;
+		Reader->Nickname = TEXT("Reused");
+		Reader->Inventory = { 4 };
+
+		RoundTrip(NetDriver, *RepLayout, Writer, Reader, bOmitDefaultProperties);
+
+		TestTrue(FString::Printf(TEXT("Reused reader matches the writer (setting %d)"), bOmitDefaultProperties), ReaderMatchesWriter(*RepLayout, Reader, Writer));
+	}
+
+	return true;
+}
+
+INITIALDATABASELINE_TEST(GIVEN_an_actor_spawned_from_a_template_WHEN_its_initial_data_is_round_tripped_THEN_values_from_the_template_are_sent)
+{
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	TSharedPtr<FRepLayout> RepLayout = NetDriver->GetObjectClassRepLayout(ATestInitialDataActor::StaticClass());
+	const uint32 HealthHandle = GetHandleForProperty(*RepLayout, GET_MEMBER_NAME_CHECKED(ATestInitialDataActor, Health));
+
+	ATestInitialDataActor* Template = NewTestActor();
+	Template->Health = 50;
+
+	for (bool bOmitDefaultProperties : { false, true })
+	{
+		// The writer's archetype is the template, while the reader's is the class default.
+		ATestInitialDataActor* Writer = NewTestActor(Template);
+		ATestInitialDataActor* Reader = NewTestActor();
+
+		TestTrue("Writer has the template's value", Writer->Health == 50);
+		TestTrue("Baseline is the class default, not the template", GetInitialDataBaseline(Writer) == ATestInitialDataActor::StaticClass()->GetDefaultObject());
+
+		const TArray<uint32> Handles = RoundTrip(NetDriver, *RepLayout, Writer, Reader, bOmitDefaultProperties);
+
+		TestTrue(FString::Printf(TEXT("Value from the template is sent (setting %d)"), bOmitDefaultProperties), Handles.Contains(HealthHandle));
+		TestTrue(FString::Printf(TEXT("Reader matches the writer (setting %d)"), bOmitDefaultProperties), ReaderMatchesWriter(*RepLayout, Reader, Writer));
+	}
+
+	return true;
+}
+
+INITIALDATABASELINE_TEST(GIVEN_mostly_default_actors_WHEN_initial_data_is_written_THEN_report_bytes_per_entity)
+{
+	const int32 NumEntities = 1000;
+
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	TSharedPtr<FRepLayout> RepLayout = NetDriver->GetObjectClassRepLayout(ATestInitialDataActor::StaticClass());
+
+	// One in ten actors has taken damage; the rest are as spawned.
+	TArray<ATestInitialDataActor*> Actors;
+	for (int32 i = 0; i < NumEntities; i++)
+	{
+		ATestInitialDataActor* Actor = NewTestActor();
+		if (i % 10 == 0)
+		{
+			Actor->Health = i % 100;
+		}
+		Actors.Add(Actor);
+	}
+
+	int64 TotalBytes[2] = { 0, 0 };
+	for (bool bOmitDefaultProperties : { false, true })
+	{
+		FOmitDefaultPropertiesScope OmitDefaultPropertiesScope(bOmitDefaultProperties);
+
+		for (ATestInitialDataActor* Actor : Actors)
+		{
+			WriteInitialData(NetDriver, *RepLayout, Actor, TotalBytes[bOmitDefaultProperties]);
+		}
+	}
+
+	TestTrue("Omitting default properties sends fewer bytes", TotalBytes[1] < TotalBytes[0]);
+
+	AddInfo(FString::Printf(TEXT("%d mostly default actors: %.1f bytes per entity with every property, %.1f bytes per entity with defaults omitted (%.1fx smaller)"),
+		NumEntities, (double)TotalBytes[0] / NumEntities, (double)TotalBytes[1] / NumEntities, TotalBytes[1] > 0 ? (double)TotalBytes[0] / TotalBytes[1] : 0.0));
+
+	return true;
+}
@@ -0,0 +1,15 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestInitialDataActor.h"
+
+#include "Net/UnrealNetwork.h"
+
+void ATestInitialDataActor::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(ATestInitialDataActor, Health);
+	DOREPLIFETIME(ATestInitialDataActor, Speed);
+	DOREPLIFETIME(ATestInitialDataActor, Nickname);
+	DOREPLIFETIME(ATestInitialDataActor, Inventory);
+}
@@ -0,0 +1,31 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "TestInitialDataActor.generated.h"
+
+/**
+ * These types are for testing purposes only.
+ */
+UCLASS(HideDropdown)
+class SPATIALGDKTESTS_API ATestInitialDataActor : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	UPROPERTY(Replicated)
+	int32 Health = 100;
+
+	UPROPERTY(Replicated)
+	float Speed = 600.f;
+
+	UPROPERTY(Replicated)
+	FString Nickname = TEXT("Unnamed");
+
+	UPROPERTY(Replicated)
+	TArray<int32> Inventory;
+};
@@ -0,0 +1,100 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestDefinitions.h"
+
+#include "Utils/LatencyHistogram.h"
+
+#include "Async/ParallelFor.h"
+#include "CoreMinimal.h"
+
+#define LATENCYHISTOGRAM_TEST(TestName) \
+	GDK_TEST(Core, FLatencyHistogram, TestName)
+
+using namespace SpatialGDK;
+
+LATENCYHISTOGRAM_TEST(GIVEN_any_value_WHEN_bucketed_THEN_it_falls_within_the_bucket_bounds)
+{
+	for (uint64 Value : { 0ull, 1ull, 7ull, 8ull, 9ull, 15ull, 16ull, 1000ull, 123456ull, 999999999ull })
+	{
+		const int32 Bucket = FLatencyHistogram::GetBucketIndex(Value);
+		TestTrue(FString::Printf(TEXT("Bucket of %llu is in range"), Value), Bucket >= 0 && Bucket < FLatencyHistogram::NumBuckets);
+		TestTrue(FString::Printf(TEXT("%llu is above the lower bound"), Value), FLatencyHistogram::GetBucketLowerBound(Bucket) <= Value);
+		TestTrue(FString::Printf(TEXT("%llu is below the upper bound"), Value), Value < FLatencyHistogram::GetBucketUpperBound(Bucket));
+	}
+
+	for (int32 Bucket = 0; Bucket < FLatencyHistogram::NumBuckets - 1; Bucket++)
+	{
+		TestTrue("Buckets are contiguous", FLatencyHistogram::GetBucketUpperBound(Bucket) == FLatencyHistogram::GetBucketLowerBound(Bucket + 1));
+	}
+
+	return true;
+}
+
+LATENCYHISTOGRAM_TEST(GIVEN_uniform_samples_WHEN_percentiles_are_queried_THEN_they_are_within_the_bucket_error)
+{
+	FLatencyHistogram Histogram;
+	for (uint64 Microseconds = 1; Microseconds <= 100000; Microseconds++)
+	{
+		Histogram.RecordMicroseconds(Microseconds);
+	}
+
+	FLatencyHistogramSnapshot Snapshot;
+	Histogram.Drain(Snapshot);
+
+	TestTrue("Total count", Snapshot.TotalCount == 100000);
+	TestEqual("Max", Snapshot.GetMaxSeconds(), 0.1);
+	TestEqual("Mean", Snapshot.GetMeanSeconds(), 0.0500005, 1e-9);
+
+	const double MaxRelativeError = 1.0 / FLatencyHistogram::SubBucketCount;
+	for (double Fraction : { 0.5, 0.99, 0.999 })
+	{
+		const double Expected = Fraction * 0.1;
+		const double Actual = Snapshot.GetPercentile(Fraction);
+		TestTrue(FString::Printf(TEXT("p%g is not below the true value"), Fraction * 100), Actual >= Expected);
+		TestTrue(FString::Printf(TEXT("p%g is within the bucket error"), Fraction * 100), Actual <= Expected * (1.0 + MaxRelativeError));
+	}
+
+	TestEqual("p100 is the max", Snapshot.GetPercentile(1.0), 0.1);
+
+	HistogramMetric Metric = Snapshot.ToHistogramMetric(TEXT("Test"));
+	if (TestTrue("Histogram metric has buckets", Metric.Buckets.Num() > 0))
+	{
+		TestTrue("Last bucket contains every sample", Metric.Buckets.Last().Samples == 100000);
+		for (int32 i = 1; i < Metric.Buckets.Num(); i++)
+		{
+			TestTrue("Buckets are cumulative", Metric.Buckets[i].Samples >= Metric.Buckets[i - 1].Samples);
+			TestTrue("Bucket bounds increase", Metric.Buckets[i].UpperBound > Metric.Buckets[i - 1].UpperBound);
+		}
+	}
+
+	FLatencyHistogramSnapshot EmptySnapshot;
+	Histogram.Drain(EmptySnapshot);
+	TestTrue("Histogram is reset after draining", EmptySnapshot.TotalCount == 0);
+
+	return true;
+}
+
+LATENCYHISTOGRAM_TEST(GIVEN_concurrent_writers_WHEN_recording_THEN_no_samples_are_lost)
+{
+	const int32 NumWriters = 8;
+	const int32 SamplesPerWriter = 50000;
+
+	FLatencyHistogram Histogram;
+	ParallelFor(NumWriters, [&Histogram](int32 Writer)
+	{
+		for (int32 i = 0; i < SamplesPerWriter; i++)
+		{
+			Histogram.RecordMicroseconds(static_cast<uint64>(Writer * SamplesPerWriter + i));
+		}
+	});
+
+	FLatencyHistogramSnapshot Snapshot;
+	Histogram.Drain(Snapshot);
+
+	const uint64 NumSamples = NumWriters * SamplesPerWriter;
+	TestTrue("Every sample was counted", Snapshot.TotalCount == NumSamples);
+	TestTrue("Sum of samples", Snapshot.SumMicroseconds == NumSamples * (NumSamples - 1) / 2);
+	TestTrue("Max sample", Snapshot.MaxMicroseconds == NumSamples - 1);
+
+	return true;
+}
@@ -0,0 +1,271 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestDefinitions.h"
+#include "TestSerializationPlanObject.h"
+
+#include "Utils/PropertySerializationPlan.h"
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/UnrealType.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+#define PROPERTYSERIALIZATIONPLAN_TEST(TestName) \
+	GDK_TEST(Core, FPropertySerializationPlan, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	// Compiles a step for each element of each property of the test class, as USpatialClassInfoManager does for handover properties.
+	TArray<FPropertyPlanStep> CompileTestClassSteps()
+	{
+		TArray<FPropertyPlanStep> Steps;
+		for (TFieldIterator<UProperty> PropertyIt(UTestSerializationPlanObject::StaticClass()); PropertyIt; ++PropertyIt)
+		{
+			for (int32 ArrayIdx = 0; ArrayIdx < PropertyIt->ArrayDim; ++ArrayIdx)
+			{
+				Steps.Add(CompilePropertyStep(*PropertyIt, PropertyIt->GetOffset_ForGC() + PropertyIt->ElementSize * ArrayIdx));
+			}
+		}
+		return Steps;
+	}
+
+	const FPropertyPlanStep* FindStep(const TArray<FPropertyPlanStep>& Steps, FName PropertyName)
+	{
+		return Steps.FindByPredicate([PropertyName](const FPropertyPlanStep& Step) { return Step.Property->GetFName() == PropertyName; });
+	}
+
+	// Objects and structs need a package map, so these tests only run the steps the primitive interpreters handle.
+	bool IsPrimitiveStep(const FPropertyPlanStep& Step)
+	{
+		return IsPrimitivePropertyOp(Step.Op) || (Step.Op == EPropertyOp::DynamicArray && IsPrimitivePropertyOp(Step.ElementOp));
+	}
+
+	// Writes a step as ComponentFactory does, using the plan's ops.
+	void WriteStep(Schema_Object* Object, Schema_FieldId FieldId, const FPropertyPlanStep& Step, const uint8* Data)
+	{
+		if (Step.Op == EPropertyOp::DynamicArray)
+		{
+			const FScriptArray* Array = reinterpret_cast<const FScriptArray*>(Data);
+			for (int32 i = 0; i < Array->Num(); i++)
+			{
+				AddPrimitiveToSchema(Object, FieldId, Step.ElementOp, Step.ElementProperty, static_cast<const uint8*>(Array->GetData()) + i * Step.ElementSize);
+			}
+		}
+		else
+		{
+			AddPrimitiveToSchema(Object, FieldId, Step.Op, Step.Property, Data);
+		}
+	}
+
+	// Reads a step as ComponentReader does, using the plan's ops.
+	void ReadStep(const Schema_Object* Object, Schema_FieldId FieldId, const FPropertyPlanStep& Step, uint8* Data)
+	{
+		if (Step.Op == EPropertyOp::DynamicArray)
+		{
+			FScriptArrayHelper ArrayHelper(static_cast<UArrayProperty*>(Step.Property), Data);
+			const uint32 Count = GetSchemaCountForOp(Object, FieldId, Step.ElementOp);
+			ArrayHelper.Resize(Count);
+			for (uint32 i = 0; i < Count; i++)
+			{
+				ApplyPrimitiveFromSchema(Object, FieldId, i, Step.ElementOp, Step.ElementProperty, ArrayHelper.GetRawPtr(i));
+			}
+		}
+		else
+		{
+			ApplyPrimitiveFromSchema(Object, FieldId, 0, Step.Op, Step.Property, Data);
+		}
+	}
+
+	void FillTestObject(UTestSerializationPlanObject* Object)
+	{
+		Object->bFlag = true;
+		Object->Float = 1.5f;
+		Object->Double = -2.25;
+		Object->Int8 = -8;
+		Object->Int16 = -1600;
+		Object->Int32 = -320000;
+		Object->Int64 = -6400000000ll;
+		Object->Byte = 200;
+		Object->UInt16 = 60000;
+		Object->UInt32 = 4000000000u;
+		Object->UInt64 = 18000000000000000000ull;
+		Object->Enum = ETestSerializationPlanEnum::Third;
+		Object->Name = FName(TEXT("TestName"));
+		Object->String = TEXT("Test string");
+		Object->Text = FText::FromString(TEXT("Test text"));
+		for (int32 i = 0; i < 4; i++)
+		{
+			Object->StaticArray[i] = i * 10 + 1;
+		}
+		Object->FloatArray = { 0.5f, 1.5f, 2.5f };
+		Object->StringArray = { TEXT("A"), TEXT("BB"), TEXT("CCC") };
+	}
+} // anonymous namespace
+
+PROPERTYSERIALIZATIONPLAN_TEST(GIVEN_a_class_WHEN_its_steps_are_compiled_THEN_each_property_gets_the_op_for_its_type)
+{
+	const TArray<FPropertyPlanStep> Steps = CompileTestClassSteps();
+
+	struct FExpectedOp
+	{
+		const TCHAR* PropertyName;
+		EPropertyOp Op;
+	};
+
+	const FExpectedOp ExpectedOps[] = {
+		{ TEXT("bFlag"), EPropertyOp::Bool },
+		{ TEXT("Float"), EPropertyOp::Float },
+		{ TEXT("Double"), EPropertyOp::Double },
+		{ TEXT("Int8"), EPropertyOp::Int8 },
+		{ TEXT("Int16"), EPropertyOp::Int16 },
+		{ TEXT("Int32"), EPropertyOp::Int32 },
+		{ TEXT("Int64"), EPropertyOp::Int64 },
+		{ TEXT("Byte"), EPropertyOp::Byte },
+		{ TEXT("UInt16"), EPropertyOp::UInt16 },
+		{ TEXT("UInt32"), EPropertyOp::UInt32 },
+		{ TEXT("UInt64"), EPropertyOp::UInt64 },
+		{ TEXT("Enum"), EPropertyOp::SmallEnum },
+		{ TEXT("Name"), EPropertyOp::Name },
+		{ TEXT("String"), EPropertyOp::String },
+		{ TEXT("Text"), EPropertyOp::Text },
+		{ TEXT("StaticArray"), EPropertyOp::Int32 },
+		{ TEXT("FloatArray"), EPropertyOp::DynamicArray },
+		{ TEXT("Vector"), EPropertyOp::NetSerializeStruct },
+		{ TEXT("ObjectRef"), EPropertyOp::Object },
+	};
+
+	for (const FExpectedOp& Expected : ExpectedOps)
+	{
+		const FPropertyPlanStep* Step = FindStep(Steps, Expected.PropertyName);
+		TestTrue(FString::Printf(TEXT("%s has the expected op"), Expected.PropertyName), Step != nullptr && Step->Op == Expected.Op);
+	}
+
+	const FPropertyPlanStep* StringArrayStep = FindStep(Steps, TEXT("StringArray"));
+	TestTrue("Dynamic array elements get the op of the inner property", StringArrayStep != nullptr && StringArrayStep->ElementOp == EPropertyOp::String);
+	TestTrue("Dynamic array steps have the element size of the inner property", StringArrayStep != nullptr && StringArrayStep->ElementSize == sizeof(FString));
+
+	const int32 NumStaticArraySteps = Steps.FilterByPredicate([](const FPropertyPlanStep& Step) { return Step.Property->GetFName() == TEXT("StaticArray"); }).Num();
+	TestEqual("Each element of a static array has its own step", NumStaticArraySteps, 4);
+
+	return true;
+}
+
+PROPERTYSERIALIZATIONPLAN_TEST(GIVEN_an_object_WHEN_written_and_read_with_its_plan_THEN_the_values_round_trip)
+{
+	const TArray<FPropertyPlanStep> Steps = CompileTestClassSteps();
+
+	UTestSerializationPlanObject* Source = NewObject<UTestSerializationPlanObject>();
+	UTestSerializationPlanObject* Target = NewObject<UTestSerializationPlanObject>();
+	FillTestObject(Source);
+
+	Schema_ComponentData* ComponentData = Schema_CreateComponentData();
+	Schema_Object* Fields = Schema_GetComponentDataFields(ComponentData);
+
+	for (int32 i = 0; i < Steps.Num(); i++)
+	{
+		if (IsPrimitiveStep(Steps[i]))
+		{
+			WriteStep(Fields, i + 1, Steps[i], reinterpret_cast<const uint8*>(Source) + Steps[i].Offset);
+		}
+	}
+
+	for (int32 i = 0; i < Steps.Num(); i++)
+	{
+		if (IsPrimitiveStep(Steps[i]))
+		{
+			ReadStep(Fields, i + 1, Steps[i], reinterpret_cast<uint8*>(Target) + Steps[i].Offset);
+		}
+	}
+
+	Schema_DestroyComponentData(ComponentData);
+
+	// Texts are compared by their strings below, as separately created texts aren't identical.
+	for (const FPropertyPlanStep& Step : Steps)
+	{
+		if (IsPrimitiveStep(Step) && Step.Op != EPropertyOp::Text)
+		{
+			TestTrue(FString::Printf(TEXT("%s round trips"), *Step.Property->GetName()),
+				Step.Property->Identical(reinterpret_cast<const uint8*>(Source) + Step.Offset, reinterpret_cast<const uint8*>(Target) + Step.Offset));
+		}
+	}
+
+	TestTrue("Text round trips", Target->Text.ToString() == Source->Text.ToString());
+
+	return true;
+}
+
+// Compares serializing with precompiled steps against choosing each property's encoding on every update, which is what
+// ComponentFactory and ComponentReader did before plans.
+PROPERTYSERIALIZATIONPLAN_TEST(GIVEN_a_representative_class_WHEN_serialized_repeatedly_THEN_report_properties_per_second)
+{
+	const int32 NumIterations = 20000;
+
+	TArray<FPropertyPlanStep> Steps = CompileTestClassSteps();
+	Steps.RemoveAll([](const FPropertyPlanStep& Step) { return !IsPrimitiveStep(Step); });
+
+	UTestSerializationPlanObject* Source = NewObject<UTestSerializationPlanObject>();
+	UTestSerializationPlanObject* Target = NewObject<UTestSerializationPlanObject>();
+	FillTestObject(Source);
+
+	double PerUpdateWriteSeconds = 0.0;
+	double PerUpdateReadSeconds = 0.0;
+	double PlanWriteSeconds = 0.0;
+	double PlanReadSeconds = 0.0;
+
+	for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+	{
+		Schema_ComponentData* ComponentData = Schema_CreateComponentData();
+		Schema_Object* Fields = Schema_GetComponentDataFields(ComponentData);
+
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Steps.Num(); i++)
+		{
+			const FPropertyPlanStep Step = CompilePropertyStep(Steps[i].Property, Steps[i].Offset);
+			WriteStep(Fields, i + 1, Step, reinterpret_cast<const uint8*>(Source) + Step.Offset);
+		}
+		PerUpdateWriteSeconds += FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Steps.Num(); i++)
+		{
+			const FPropertyPlanStep Step = CompilePropertyStep(Steps[i].Property, Steps[i].Offset);
+			ReadStep(Fields, i + 1, Step, reinterpret_cast<uint8*>(Target) + Step.Offset);
+		}
+		PerUpdateReadSeconds += FPlatformTime::Seconds() - StartTime;
+
+		Schema_DestroyComponentData(ComponentData);
+		ComponentData = Schema_CreateComponentData();
+		Fields = Schema_GetComponentDataFields(ComponentData);
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Steps.Num(); i++)
+		{
+			WriteStep(Fields, i + 1, Steps[i], reinterpret_cast<const uint8*>(Source) + Steps[i].Offset);
+		}
+		PlanWriteSeconds += FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Steps.Num(); i++)
+		{
+			ReadStep(Fields, i + 1, Steps[i], reinterpret_cast<uint8*>(Target) + Steps[i].Offset);
+		}
+		PlanReadSeconds += FPlatformTime::Seconds() - StartTime;
+
+		Schema_DestroyComponentData(ComponentData);
+	}
+
+	TestTrue("Values round trip", Target->Int64 == Source->Int64 && Target->StringArray == Source->StringArray);
+
+	const double NumProperties = double(NumIterations) * Steps.Num();
+	auto PropertiesPerSecond = [NumProperties](double Seconds) { return NumProperties / FMath::Max(Seconds, 1e-9) / 1e6; };
+
+	AddInfo(FString::Printf(TEXT("%d properties x %d updates. Write: per update %.2f M props/s, plan %.2f M props/s. Read: per update %.2f M props/s, plan %.2f M props/s"),
+		Steps.Num(), NumIterations,
+		PropertiesPerSecond(PerUpdateWriteSeconds), PropertiesPerSecond(PlanWriteSeconds),
+		PropertiesPerSecond(PerUpdateReadSeconds), PropertiesPerSecond(PlanReadSeconds)));
+
+	return true;
+}
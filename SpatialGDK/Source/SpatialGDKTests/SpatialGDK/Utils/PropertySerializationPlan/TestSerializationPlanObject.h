@@ -0,0 +1,85 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "TestSerializationPlanObject.generated.h"
+
+/**
+ * These types are for testing purposes only.
+ */
+UENUM()
+enum class ETestSerializationPlanEnum : uint8
+{
+	First,
+	Second,
+	Third,
+};
+
+UCLASS(HideDropdown)
+class SPATIALGDKTESTS_API UTestSerializationPlanObject : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	bool bFlag = false;
+
+	UPROPERTY()
+	float Float = 0.f;
+
+	UPROPERTY()
+	double Double = 0.0;
+
+	UPROPERTY()
+	int8 Int8 = 0;
+
+	UPROPERTY()
+	int16 Int16 = 0;
+
+	UPROPERTY()
+	int32 Int32 = 0;
+
+	UPROPERTY()
+	int64 Int64 = 0;
+
+	UPROPERTY()
+	uint8 Byte = 0;
+
+	UPROPERTY()
+	uint16 UInt16 = 0;
+
+	UPROPERTY()
+	uint32 UInt32 = 0;
+
+	UPROPERTY()
+	uint64 UInt64 = 0;
+
+	UPROPERTY()
+	ETestSerializationPlanEnum Enum = ETestSerializationPlanEnum::First;
+
+	UPROPERTY()
+	FName Name;
+
+	UPROPERTY()
+	FString String;
+
+	UPROPERTY()
+	FText Text;
+
+	UPROPERTY()
+	int32 StaticArray[4] = {};
+
+	UPROPERTY()
+	TArray<float> FloatArray;
+
+	UPROPERTY()
+	TArray<FString> StringArray;
+
+	UPROPERTY()
+	FVector Vector = FVector::ZeroVector;
+
+	UPROPERTY()
+	UObject* ObjectRef = nullptr;
+};
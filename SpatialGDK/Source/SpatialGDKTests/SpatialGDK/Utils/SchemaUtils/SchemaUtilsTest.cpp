@@ -0,0 +1,137 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestDefinitions.h"
+
+#include "Utils/SchemaUtils.h"
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Serialization/BitReader.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+#define SCHEMAUTILS_TEST(TestName) \
+	GDK_TEST(Core, FSchemaUtils, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	TArray<uint8> MakeBytes(FRandomStream& Random, int32 NumBytes)
+	{
+		TArray<uint8> Bytes;
+		Bytes.SetNumUninitialized(NumBytes);
+		for (uint8& Byte : Bytes)
+		{
+			Byte = (uint8)Random.RandRange(0, 255);
+		}
+		return Bytes;
+	}
+
+	// Reads the bytes as a struct property would, so that both paths do the same work apart from the copy.
+	uint64 ReadBytes(const uint8* Data, int32 NumBytes)
+	{
+		FBitReader Reader(const_cast<uint8*>(Data), NumBytes * 8);
+		uint64 Checksum = 0;
+		while (Reader.GetBitsLeft() >= 8)
+		{
+			uint8 Byte = 0;
+			Reader << Byte;
+			Checksum += Byte;
+		}
+		return Checksum;
+	}
+} // anonymous namespace
+
+SCHEMAUTILS_TEST(GIVEN_a_bytes_field_WHEN_viewed_THEN_the_view_points_into_the_schema_buffer)
+{
+	FRandomStream Random(1);
+	TArray<uint8> First = MakeBytes(Random, 24);
+	TArray<uint8> Second = MakeBytes(Random, 0);
+
+	Schema_ComponentUpdate* Update = Schema_CreateComponentUpdate();
+	Schema_Object* Fields = Schema_GetComponentUpdateFields(Update);
+	AddBytesToSchema(Fields, 1, First.GetData(), First.Num());
+	AddBytesToSchema(Fields, 1, Second.GetData(), Second.Num());
+
+	TArrayView<const uint8> FirstView = GetBytesViewFromSchema(Fields, 1);
+	TestTrue("View points into the schema object", FirstView.GetData() == Schema_IndexBytes(Fields, 1, 0));
+	TestTrue("View has the field's contents", FirstView.Num() == First.Num() && FMemory::Memcmp(FirstView.GetData(), First.GetData(), First.Num()) == 0);
+	TestTrue("View matches the copying accessor", GetBytesFromSchema(Fields, 1) == TArray<uint8>(FirstView.GetData(), FirstView.Num()));
+	TestEqual("Empty field gives an empty view", IndexBytesViewFromSchema(Fields, 1, 1).Num(), 0);
+
+	Schema_DestroyComponentUpdate(Update);
+
+	return true;
+}
+
+// Replays incoming updates shaped like a busy actor's: a few struct fields and a fast array per update. The copying
+// path is what ComponentReader did before reading straight from the op's buffer.
+SCHEMAUTILS_TEST(GIVEN_a_replay_of_incoming_updates_WHEN_byte_fields_are_read_through_views_THEN_no_bytes_are_copied_and_reports_throughput)
+{
+	const int32 NumUpdates = 20000;
+	const int32 NumStructFields = 6;
+	const int32 FastArrayBytes = 512;
+
+	FRandomStream Random(NumUpdates);
+	TArray<Schema_ComponentUpdate*> Updates;
+	for (int32 i = 0; i < NumUpdates; i++)
+	{
+		Schema_ComponentUpdate* Update = Schema_CreateComponentUpdate();
+		Schema_Object* Fields = Schema_GetComponentUpdateFields(Update);
+		for (Schema_FieldId FieldId = 1; FieldId <= NumStructFields; FieldId++)
+		{
+			TArray<uint8> Bytes = MakeBytes(Random, Random.RandRange(12, 64));
+			AddBytesToSchema(Fields, FieldId, Bytes.GetData(), Bytes.Num());
+		}
+		TArray<uint8> FastArray = MakeBytes(Random, FastArrayBytes);
+		AddBytesToSchema(Fields, NumStructFields + 1, FastArray.GetData(), FastArray.Num());
+		Updates.Add(Update);
+	}
+
+	uint64 CopyChecksum = 0;
+	uint64 CopiedBytes = 0;
+	uint64 CopyAllocations = 0;
+	double StartTime = FPlatformTime::Seconds();
+	for (Schema_ComponentUpdate* Update : Updates)
+	{
+		Schema_Object* Fields = Schema_GetComponentUpdateFields(Update);
+		for (Schema_FieldId FieldId = 1; FieldId <= NumStructFields + 1; FieldId++)
+		{
+			TArray<uint8> ValueData = GetBytesFromSchema(Fields, FieldId);
+			CopiedBytes += ValueData.Num();
+			CopyAllocations += ValueData.Num() > 0 ? 1 : 0;
+			CopyChecksum += ReadBytes(ValueData.GetData(), ValueData.Num());
+		}
+	}
+	const double CopySeconds = FPlatformTime::Seconds() - StartTime;
+
+	uint64 ViewChecksum = 0;
+	StartTime = FPlatformTime::Seconds();
+	for (Schema_ComponentUpdate* Update : Updates)
+	{
+		Schema_Object* Fields = Schema_GetComponentUpdateFields(Update);
+		for (Schema_FieldId FieldId = 1; FieldId <= NumStructFields + 1; FieldId++)
+		{
+			TArrayView<const uint8> ValueData = GetBytesViewFromSchema(Fields, FieldId);
+			ViewChecksum += ReadBytes(ValueData.GetData(), ValueData.Num());
+		}
+	}
+	const double ViewSeconds = FPlatformTime::Seconds() - StartTime;
+
+	for (Schema_ComponentUpdate* Update : Updates)
+	{
+		Schema_DestroyComponentUpdate(Update);
+	}
+
+	TestTrue("Views read the same bytes as copies", ViewChecksum == CopyChecksum);
+
+	// FBitReader still takes its own copy of the bytes in both paths, so only the intermediate copy is saved.
+	AddInfo(FString::Printf(TEXT("%d updates x %d byte fields: copying %.1f ms (%llu allocations, %.1f MB copied), views %.1f ms (0 allocations, 0 MB copied)"),
+		NumUpdates, NumStructFields + 1,
+		CopySeconds * 1000.0, CopyAllocations, CopiedBytes / (1024.0 * 1024.0),
+		ViewSeconds * 1000.0));
+
+	return true;
+}
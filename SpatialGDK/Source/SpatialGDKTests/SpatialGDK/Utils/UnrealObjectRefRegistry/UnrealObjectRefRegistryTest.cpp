@@ -0,0 +1,180 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestDefinitions.h"
+
+#include "Schema/UnrealObjectRef.h"
+#include "Utils/UnrealObjectRefRegistry.h"
+
+#include "CoreMinimal.h"
+
+#define UNREALOBJECTREFREGISTRY_TEST(TestName) \
+	GDK_TEST(Core, FUnrealObjectRefRegistry, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	const uint32 NumStaticSubobjects = 4;
+	const uint32 NumDynamicSubobjects = 2;
+
+	uint32 NextNetGUID = 1;
+
+	FNetworkGUID MakeNetGUID()
+	{
+		return FNetworkGUID(NextNetGUID++);
+	}
+
+	// Registers an entity the way FSpatialNetGUIDCache::AssignNewEntityActorNetGUID does for a startup actor when
+	// bStablyNamed is set: the path refs are registered first, then become aliases of the entity id refs.
+	void RegisterEntity(FUnrealObjectRefRegistry& Registry, Worker_EntityId EntityId, bool bStablyNamed)
+	{
+		const FUnrealObjectRef LevelRef(0, 0, TEXT("PersistentLevel"), FUnrealObjectRef(0, 0, TEXT("/Game/Maps/Churn"), {}));
+		const FUnrealObjectRef StablyNamedRef(0, 0, FString::Printf(TEXT("Actor_%lld"), EntityId), LevelRef);
+
+		const FNetworkGUID ActorNetGUID = MakeNetGUID();
+		if (bStablyNamed)
+		{
+			Registry.Register(ActorNetGUID, StablyNamedRef);
+			Registry.AddAlias(StablyNamedRef, ActorNetGUID, EntityId);
+		}
+		Registry.Register(ActorNetGUID, FUnrealObjectRef(EntityId, 0));
+
+		for (uint32 Offset = 1; Offset <= NumStaticSubobjects; Offset++)
+		{
+			const FNetworkGUID SubobjectNetGUID = MakeNetGUID();
+			if (bStablyNamed)
+			{
+				const FUnrealObjectRef StablyNamedSubobjectRef(0, 0, FString::Printf(TEXT("Component_%u"), Offset), StablyNamedRef);
+				Registry.Register(SubobjectNetGUID, StablyNamedSubobjectRef);
+				Registry.AddAlias(StablyNamedSubobjectRef, SubobjectNetGUID, EntityId);
+			}
+			Registry.Register(SubobjectNetGUID, FUnrealObjectRef(EntityId, Offset));
+		}
+
+		for (uint32 Offset = NumStaticSubobjects + 1; Offset <= NumStaticSubobjects + NumDynamicSubobjects; Offset++)
+		{
+			Registry.Register(MakeNetGUID(), FUnrealObjectRef(EntityId, Offset));
+		}
+	}
+} // anonymous namespace
+
+UNREALOBJECTREFREGISTRY_TEST(GIVEN_a_stably_named_entity_WHEN_removed_THEN_its_aliases_are_removed_too)
+{
+	FUnrealObjectRefRegistry Registry;
+	RegisterEntity(Registry, 1, true);
+	RegisterEntity(Registry, 2, true);
+
+	const FUnrealObjectRef SubobjectRef(1, 1);
+	const FNetworkGUID SubobjectNetGUID = *Registry.FindNetGUID(SubobjectRef);
+	TestTrue("Entity id ref is the ref of the subobject's NetGUID", *Registry.FindObjectRef(SubobjectNetGUID) == SubobjectRef);
+
+	const int32 NumObjectRefsPerEntity = Registry.NumObjectRefs() / 2;
+	Registry.RemoveNetGUIDOf(SubobjectRef);
+	TestTrue("Subobject's NetGUID is removed", Registry.FindObjectRef(SubobjectNetGUID) == nullptr);
+	TestEqual("Subobject's stably named ref is removed along with its entity id ref", Registry.NumObjectRefs(), NumObjectRefsPerEntity * 2 - 2);
+
+	Registry.RemoveEntity(1);
+	TestEqual("Only the other entity's refs are left", Registry.NumObjectRefs(), NumObjectRefsPerEntity);
+	TestTrue("Other entity is untouched", Registry.FindNetGUID(FUnrealObjectRef(2, 0)) != nullptr);
+
+	Registry.RemoveEntity(2);
+	TestEqual("No NetGUIDs are left", Registry.NumNetGUIDs(), 0);
+	TestEqual("No object refs are left", Registry.NumObjectRefs(), 0);
+	TestEqual("No entities are left", Registry.NumEntities(), 0);
+
+	return true;
+}
+
+UNREALOBJECTREFREGISTRY_TEST(GIVEN_a_path_ref_WHEN_unregistered_THEN_it_is_removed_in_both_directions)
+{
+	FUnrealObjectRefRegistry Registry;
+	const FUnrealObjectRef PathRef(0, 0, TEXT("Actor"), FUnrealObjectRef(0, 0, TEXT("/Game/Maps/Churn"), {}));
+	Registry.Register(FNetworkGUID(7), PathRef);
+
+	Registry.Unregister(PathRef);
+	TestEqual("No NetGUIDs are left", Registry.NumNetGUIDs(), 0);
+	TestEqual("No object refs are left", Registry.NumObjectRefs(), 0);
+
+	return true;
+}
+
+UNREALOBJECTREFREGISTRY_TEST(GIVEN_a_stably_named_actor_WHEN_its_refs_are_unregistered_THEN_its_aliases_are_removed_too)
+{
+	FUnrealObjectRefRegistry Registry;
+	RegisterEntity(Registry, 1, true);
+
+	const FUnrealObjectRef EntityRef(1, 0);
+	const FNetworkGUID ActorNetGUID = *Registry.FindNetGUID(EntityRef);
+	const int32 NumObjectRefs = Registry.NumObjectRefs();
+
+	Registry.Unregister(EntityRef);
+	TestTrue("Actor's NetGUID is removed", Registry.FindObjectRef(ActorNetGUID) == nullptr);
+	TestEqual("Actor's stably named ref is removed along with its entity id ref", Registry.NumObjectRefs(), NumObjectRefs - 2);
+
+	// The subobject's stably named ref is an alias, which FSpatialNetGUIDCache::UnregisterActorObjectRefOnly is given.
+	const FUnrealObjectRef SubobjectRef(1, 1);
+	const FNetworkGUID SubobjectNetGUID = *Registry.FindNetGUID(SubobjectRef);
+	const FUnrealObjectRef StablyNamedSubobjectRef(0, 0, TEXT("Component_1"),
+		FUnrealObjectRef(0, 0, TEXT("Actor_1"), FUnrealObjectRef(0, 0, TEXT("PersistentLevel"), FUnrealObjectRef(0, 0, TEXT("/Game/Maps/Churn"), {}))));
+	TestTrue("Stably named ref is an alias of the subobject's NetGUID", Registry.FindNetGUID(StablyNamedSubobjectRef) != nullptr && *Registry.FindNetGUID(StablyNamedSubobjectRef) == SubobjectNetGUID);
+
+	Registry.Unregister(StablyNamedSubobjectRef);
+	TestTrue("Subobject's NetGUID is removed", Registry.FindObjectRef(SubobjectNetGUID) == nullptr);
+	TestTrue("Subobject's entity id ref is removed along with its stably named ref", Registry.FindNetGUID(SubobjectRef) == nullptr);
+
+	// Dropping the entity's remaining subobjects one by one leaves nothing behind, without RemoveEntity.
+	for (uint32 Offset = 2; Offset <= NumStaticSubobjects + NumDynamicSubobjects; Offset++)
+	{
+		Registry.Unregister(FUnrealObjectRef(1, Offset));
+	}
+	TestEqual("No NetGUIDs are left", Registry.NumNetGUIDs(), 0);
+	TestEqual("No object refs are left", Registry.NumObjectRefs(), 0);
+	TestEqual("No entities are left", Registry.NumEntities(), 0);
+
+	return true;
+}
+
+// Checks out and releases entities the way a busy server does, in waves, with some subobjects removed on their own before
+// their entity. Every map has to be empty at the end, which is what catches refs that were registered but never removed.
+UNREALOBJECTREFREGISTRY_TEST(GIVEN_entity_churn_WHEN_every_entity_is_removed_THEN_no_refs_leak)
+{
+	const int32 NumWaves = 4;
+	const int32 EntitiesPerWave = 100;
+
+	FUnrealObjectRefRegistry Registry;
+	Worker_EntityId NextEntityId = 1;
+
+	for (int32 Wave = 0; Wave < NumWaves; Wave++)
+	{
+		const Worker_EntityId FirstEntityId = NextEntityId;
+		for (int32 i = 0; i < EntitiesPerWave; i++)
+		{
+			RegisterEntity(Registry, NextEntityId++, i % 2 == 0);
+		}
+
+		for (Worker_EntityId EntityId = FirstEntityId; EntityId < NextEntityId; EntityId += 3)
+		{
+			Registry.RemoveNetGUIDOf(FUnrealObjectRef(EntityId, NumStaticSubobjects + 1));
+			Registry.RemoveNetGUIDOf(FUnrealObjectRef(EntityId, 1));
+		}
+
+		// Release the previous wave, so that two waves are checked out at a time.
+		if (Wave > 0)
+		{
+			for (Worker_EntityId EntityId = FirstEntityId - EntitiesPerWave; EntityId < FirstEntityId; EntityId++)
+			{
+				Registry.RemoveEntity(EntityId);
+			}
+		}
+	}
+	for (Worker_EntityId EntityId = NextEntityId - EntitiesPerWave; EntityId < NextEntityId; EntityId++)
+	{
+		Registry.RemoveEntity(EntityId);
+	}
+
+	TestEqual("No NetGUIDs leak", Registry.NumNetGUIDs(), 0);
+	TestEqual("No object refs leak", Registry.NumObjectRefs(), 0);
+	TestEqual("No entities leak", Registry.NumEntities(), 0);
+
+	return true;
+}
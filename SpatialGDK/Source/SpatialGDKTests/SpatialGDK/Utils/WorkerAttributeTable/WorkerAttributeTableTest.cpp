@@ -0,0 +1,246 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestDefinitions.h"
+
+#include "Schema/StandardLibrary.h"
+#include "SpatialConstants.h"
+#include "Utils/SchemaUtils.h"
+#include "Utils/WorkerAttributeTable.h"
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+#define WORKERATTRIBUTETABLE_TEST(TestName) \
+	GDK_TEST(Core, FWorkerAttributeTable, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	const TArray<FString> TestServerWorkerTypes = { TEXT("UnrealWorker"), TEXT("AIWorker") };
+	const int32 NumComponentsPerEntity = 16;
+
+	FString GetOwnerAttribute(int32 ClientIndex)
+	{
+		return FString::Printf(TEXT("workerId:UnrealClient-%016x"), ClientIndex);
+	}
+
+	// The EntityAcl of a typical actor: readable by clients and servers, with its components written by its worker type
+	// and its client RPC endpoint written by its owning client.
+	void CreateTestAcl(int32 ClientIndex, WorkerRequirementSet& OutReadAcl, WriteAclMap& OutComponentWriteAcl)
+	{
+		OutReadAcl = { SpatialConstants::UnrealClientAttributeSet };
+		for (const FString& WorkerType : TestServerWorkerTypes)
+		{
+			OutReadAcl.Add({ WorkerType });
+		}
+
+		const WorkerRequirementSet AuthoritativeRequirementSet = { { TestServerWorkerTypes[0] } };
+		for (int32 i = 0; i < NumComponentsPerEntity; i++)
+		{
+			OutComponentWriteAcl.Add(SpatialConstants::STARTING_GENERATED_COMPONENT_ID + i, AuthoritativeRequirementSet);
+		}
+		OutComponentWriteAcl.Add(SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID, { { GetOwnerAttribute(ClientIndex) } });
+	}
+
+	SIZE_T GetRequirementSetSize(const WorkerRequirementSet& RequirementSet)
+	{
+		SIZE_T Size = RequirementSet.GetAllocatedSize();
+		for (const WorkerAttributeSet& AttributeSet : RequirementSet)
+		{
+			Size += AttributeSet.GetAllocatedSize();
+			for (const FString& Attribute : AttributeSet)
+			{
+				Size += Attribute.GetAllocatedSize();
+			}
+		}
+		return Size;
+	}
+
+	// The EntityAcl as USpatialStaticComponentView stored it before attributes were interned.
+	struct FStringEntityAcl
+	{
+		WorkerRequirementSet ReadAcl;
+		WriteAclMap ComponentWriteAcl;
+
+		void ReadFields(Schema_Object* ComponentObject)
+		{
+			if (Schema_GetObjectCount(ComponentObject, 1) > 0)
+			{
+				ReadAcl = GetWorkerRequirementSetFromSchema(ComponentObject, 1);
+			}
+
+			uint32 KVPairCount = Schema_GetObjectCount(ComponentObject, 2);
+			if (KVPairCount > 0)
+			{
+				ComponentWriteAcl.Empty();
+				for (uint32 i = 0; i < KVPairCount; i++)
+				{
+					Schema_Object* KVPairObject = Schema_IndexObject(ComponentObject, 2, i);
+					ComponentWriteAcl.Add(Schema_GetUint32(KVPairObject, SCHEMA_MAP_KEY_FIELD_ID), GetWorkerRequirementSetFromSchema(KVPairObject, SCHEMA_MAP_VALUE_FIELD_ID));
+				}
+			}
+		}
+
+		void WriteFields(Schema_Object* ComponentObject) const
+		{
+			AddWorkerRequirementSetToSchema(ComponentObject, 1, ReadAcl);
+			for (const auto& KVPair : ComponentWriteAcl)
+			{
+				Schema_Object* KVPairObject = Schema_AddObject(ComponentObject, 2);
+				Schema_AddUint32(KVPairObject, SCHEMA_MAP_KEY_FIELD_ID, KVPair.Key);
+				AddWorkerRequirementSetToSchema(KVPairObject, SCHEMA_MAP_VALUE_FIELD_ID, KVPair.Value);
+			}
+		}
+
+		SIZE_T GetAllocatedSize() const
+		{
+			SIZE_T Size = GetRequirementSetSize(ReadAcl) + ComponentWriteAcl.GetAllocatedSize();
+			for (const auto& KVPair : ComponentWriteAcl)
+			{
+				Size += GetRequirementSetSize(KVPair.Value);
+			}
+			return Size;
+		}
+	};
+} // anonymous namespace
+
+WORKERATTRIBUTETABLE_TEST(GIVEN_equal_attributes_and_requirement_sets_WHEN_interned_THEN_they_share_a_handle)
+{
+	FWorkerAttributeTable Table;
+
+	const FWorkerAttributeHandle Attribute = Table.InternAttribute(TEXT("UnrealWorker"));
+	TestEqual("Same attribute gets the same handle", Table.InternAttribute(TEXT("UnrealWorker")), Attribute);
+	TestNotEqual("Attributes are case sensitive", Table.InternAttribute(TEXT("unrealworker")), Attribute);
+	TestEqual("Attributes are looked up by their UTF-8 encoding", Table.InternAttribute("UnrealWorker", 12), Attribute);
+	TestEqual("Attribute string is kept", Table.GetAttribute(Attribute), FString(TEXT("UnrealWorker")));
+
+	const WorkerRequirementSet RequirementSet = { { TEXT("UnrealClient") }, { TEXT("UnrealWorker"), TEXT("workerId:A") } };
+	const FRequirementSetHandle Handle = Table.InternRequirementSet(RequirementSet);
+	TestEqual("Same requirement set gets the same handle", Table.InternRequirementSet(RequirementSet), Handle);
+	TestTrue("Requirement set converts back to strings", Table.ToWorkerRequirementSet(Handle) == RequirementSet);
+	TestEqual("Single attribute requirement set matches its string form", Table.InternRequirementSet(Attribute), Table.InternRequirementSet(WorkerRequirementSet{ { TEXT("UnrealWorker") } }));
+	TestEqual("Empty requirement set has the reserved handle", Table.InternRequirementSet(WorkerRequirementSet()), FWorkerAttributeTable::EmptyRequirementSet);
+
+	TestTrue("Worker with one of the attributes is found", Table.ContainsAnyAttribute(Handle, { TEXT("workerId:A") }));
+	TestFalse("Worker with none of the attributes is not found", Table.ContainsAnyAttribute(Handle, { TEXT("workerId:B") }));
+
+	return true;
+}
+
+WORKERATTRIBUTETABLE_TEST(GIVEN_an_entity_acl_WHEN_written_and_read_through_schema_THEN_it_has_the_same_handles)
+{
+	WorkerRequirementSet ReadAcl;
+	WriteAclMap ComponentWriteAcl;
+	CreateTestAcl(7, ReadAcl, ComponentWriteAcl);
+
+	EntityAcl Acl(ReadAcl, ComponentWriteAcl);
+	Worker_ComponentData Data = Acl.CreateEntityAclData();
+
+	FStringEntityAcl StringAcl;
+	StringAcl.ReadFields(Schema_GetComponentDataFields(Data.schema_type));
+	TestTrue("Schema data has the same read ACL strings", StringAcl.ReadAcl == ReadAcl);
+	TestTrue("Schema data has the same write ACL strings", StringAcl.ComponentWriteAcl.OrderIndependentCompareEqual(ComponentWriteAcl));
+
+	const EntityAcl ReadBack(Data);
+	TestEqual("Read ACL handle is the same", ReadBack.ReadAcl, Acl.ReadAcl);
+	TestTrue("Write ACL handles are the same", ReadBack.ComponentWriteAcl.OrderIndependentCompareEqual(Acl.ComponentWriteAcl));
+
+	Schema_DestroyComponentData(Data.schema_type);
+
+	return true;
+}
+
+// Stores the EntityAcl of 100k checked out entities owned by 1k clients, then changes the owner of 10k of them, applying
+// each update as the authoritative server's view does. The string path is how EntityAcl was stored before interning.
+WORKERATTRIBUTETABLE_TEST(GIVEN_100k_entity_acls_WHEN_stored_and_updated_THEN_reports_memory_and_update_cost)
+{
+	const int32 NumEntities = 100000;
+	const int32 NumClients = 1000;
+	const int32 NumUpdates = 10000;
+
+	TArray<Worker_ComponentData> EntityData;
+	EntityData.Reserve(NumEntities);
+	for (int32 i = 0; i < NumEntities; i++)
+	{
+		WorkerRequirementSet ReadAcl;
+		WriteAclMap ComponentWriteAcl;
+		CreateTestAcl(i % NumClients, ReadAcl, ComponentWriteAcl);
+		EntityData.Add(EntityAcl(ReadAcl, ComponentWriteAcl).CreateEntityAclData());
+	}
+
+	TArray<FStringEntityAcl> StringAcls;
+	StringAcls.SetNum(NumEntities);
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumEntities; i++)
+	{
+		StringAcls[i].ReadFields(Schema_GetComponentDataFields(EntityData[i].schema_type));
+	}
+	const double StringAddSeconds = FPlatformTime::Seconds() - StartTime;
+
+	const SIZE_T TableSizeBefore = FWorkerAttributeTable::Get().GetAllocatedSize();
+	TArray<EntityAcl> InternedAcls;
+	InternedAcls.Reserve(NumEntities);
+	StartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumEntities; i++)
+	{
+		InternedAcls.Emplace(EntityData[i]);
+	}
+	const double InternedAddSeconds = FPlatformTime::Seconds() - StartTime;
+
+	for (Worker_ComponentData& Data : EntityData)
+	{
+		Schema_DestroyComponentData(Data.schema_type);
+	}
+
+	SIZE_T StringBytes = StringAcls.GetAllocatedSize();
+	for (const FStringEntityAcl& Acl : StringAcls)
+	{
+		StringBytes += Acl.GetAllocatedSize();
+	}
+	SIZE_T InternedBytes = InternedAcls.GetAllocatedSize() + (FWorkerAttributeTable::Get().GetAllocatedSize() - TableSizeBefore);
+	for (const EntityAcl& Acl : InternedAcls)
+	{
+		InternedBytes += Acl.ComponentWriteAcl.GetAllocatedSize();
+	}
+
+	StartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumUpdates; i++)
+	{
+		FStringEntityAcl& Acl = StringAcls[i];
+		Acl.ComponentWriteAcl.Add(SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID, { { GetOwnerAttribute((i + 1) % NumClients) } });
+
+		Schema_ComponentUpdate* Update = Schema_CreateComponentUpdate();
+		Acl.WriteFields(Schema_GetComponentUpdateFields(Update));
+		Acl.ReadFields(Schema_GetComponentUpdateFields(Update));
+		Schema_DestroyComponentUpdate(Update);
+	}
+	const double StringUpdateSeconds = FPlatformTime::Seconds() - StartTime;
+
+	FWorkerAttributeTable& AttributeTable = FWorkerAttributeTable::Get();
+	StartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumUpdates; i++)
+	{
+		EntityAcl& Acl = InternedAcls[i];
+		Acl.ComponentWriteAcl.Add(SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID, AttributeTable.InternRequirementSet(AttributeTable.InternAttribute(GetOwnerAttribute((i + 1) % NumClients))));
+
+		Worker_ComponentUpdate Update = Acl.CreateEntityAclUpdate();
+		Acl.ApplyComponentUpdate(Update);
+		Schema_DestroyComponentUpdate(Update.schema_type);
+	}
+	const double InternedUpdateSeconds = FPlatformTime::Seconds() - StartTime;
+
+	TestTrue("Interned ACLs hold the same owner as string ACLs",
+		AttributeTable.ToWorkerRequirementSet(InternedAcls[0].ComponentWriteAcl[SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID]) == StringAcls[0].ComponentWriteAcl[SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID]);
+	TestTrue("Interned ACLs take less memory than strings", InternedBytes < StringBytes);
+
+	AddInfo(FString::Printf(TEXT("%d EntityAcls: strings %.1f MB (%.1f ms to read), interned %.1f MB (%.1f ms to read), table holds %d attributes and %d requirement sets"),
+		NumEntities, StringBytes / (1024.0 * 1024.0), StringAddSeconds * 1000.0, InternedBytes / (1024.0 * 1024.0), InternedAddSeconds * 1000.0,
+		AttributeTable.NumAttributes(), AttributeTable.NumRequirementSets()));
+	AddInfo(FString::Printf(TEXT("%d owner changes written and applied: strings %.1f ms (%.2f us each), interned %.1f ms (%.2f us each)"),
+		NumUpdates, StringUpdateSeconds * 1000.0, StringUpdateSeconds * 1e6 / NumUpdates, InternedUpdateSeconds * 1000.0, InternedUpdateSeconds * 1e6 / NumUpdates));
+
+	return true;
+}